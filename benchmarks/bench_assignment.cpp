@@ -0,0 +1,153 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file bench_assignment.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Benchmark mesh assignment engines against the number of threads.
+ *
+ * Usage: bench_assignment [nparticles] [ngrid] [assignment] [max_threads]
+ *
+ * For each thread count (doubling from 1 up to `max_threads`), the
+ * 'atomic' and 'slab' engines paint the same random catalogue, and
+ * the wall time and the maximum deviation from the single-thread
+ * 'slab' mesh are reported.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "particles.hpp"
+#include "field.hpp"
+
+namespace trvs = trv::sys;
+
+int main(int argc, char* argv[]) {
+  const int nparticles = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const int ngrid = (argc > 2) ? std::atoi(argv[2]) : 256;
+  const std::string assignment = (argc > 3) ? argv[3] : "tsc";
+  int max_threads = (argc > 4) ? std::atoi(argv[4]) : 64;
+
+#ifndef TRV_USE_OMP
+  max_threads = 1;
+#endif  // !TRV_USE_OMP
+
+  trvs::logger.reset_level(trvs::LogLevel::WARN);
+
+  // Set up mesh parameters.
+  trv::ParameterSet params;
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    params.boxsize[iaxis] = 1000.;
+    params.ngrid[iaxis] = ngrid;
+  }
+  params.volume = params.boxsize[0] * params.boxsize[1] * params.boxsize[2];
+  params.nmesh = static_cast<long long>(ngrid) * ngrid * ngrid;
+  params.assignment = assignment;
+  params.assignment_order = (assignment == "ngp") ? 1
+    : (assignment == "cic") ? 2
+    : (assignment == "tsc") ? 3 : 4;
+
+  // Generate a uniform random catalogue.
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> uniform(0., params.boxsize[0]);
+
+  std::vector<double> x(nparticles), y(nparticles), z(nparticles);
+  std::vector<double> nz(nparticles, 1.), ws(nparticles, 1.);
+  std::vector<double> wc(nparticles, 1.);
+  for (int pid = 0; pid < nparticles; pid++) {
+    x[pid] = uniform(rng);
+    y[pid] = uniform(rng);
+    z[pid] = uniform(rng);
+  }
+
+  trv::ParticleCatalogue catalogue;
+  catalogue.load_particle_data(x, y, z, nz, ws, wc);
+
+  fftw_complex* weights = fftw_alloc_complex(catalogue.ntotal);
+  for (int pid = 0; pid < catalogue.ntotal; pid++) {
+    weights[pid][0] = catalogue[pid].w;
+    weights[pid][1] = 0.;
+  }
+
+  // Paint the mesh with the given engine and thread count.
+  auto paint = [&](const std::string& engine, int nthreads, double& time) {
+#ifdef TRV_USE_OMP
+    omp_set_num_threads(nthreads);
+#endif  // TRV_USE_OMP
+
+    params.assignment_engine = engine;
+    trv::MeshField field(params, false, "bench-field");
+
+    auto tstart = std::chrono::steady_clock::now();
+    field.assign_weighted_field_to_mesh(catalogue, weights);
+    auto tend = std::chrono::steady_clock::now();
+    time = std::chrono::duration<double>(tend - tstart).count();
+
+    std::vector<double> mesh(params.nmesh);
+    for (long long gid = 0; gid < params.nmesh; gid++) {
+      mesh[gid] = field[gid][0];
+    }
+    return mesh;
+  };
+
+  double time_ref = 0.;
+  std::vector<double> mesh_ref = paint("slab", 1, time_ref);
+
+  std::printf(
+    "# nparticles = %d, ngrid = %d, assignment = %s\n",
+    nparticles, ngrid, assignment.c_str()
+  );
+  std::printf(
+    "# %8s  %12s  %12s  %12s  %12s\n",
+    "nthreads", "t_atomic [s]", "t_slab [s]", "dev_atomic", "dev_slab"
+  );
+
+  for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    double time_atomic = 0., time_slab = 0.;
+    std::vector<double> mesh_atomic = paint("atomic", nthreads, time_atomic);
+    std::vector<double> mesh_slab = paint("slab", nthreads, time_slab);
+
+    double dev_atomic = 0., dev_slab = 0.;
+    for (long long gid = 0; gid < params.nmesh; gid++) {
+      dev_atomic = std::max(
+        dev_atomic, std::fabs(mesh_atomic[gid] - mesh_ref[gid])
+      );
+      dev_slab = std::max(
+        dev_slab, std::fabs(mesh_slab[gid] - mesh_ref[gid])
+      );
+    }
+
+    std::printf(
+      "  %8d  %12.4f  %12.4f  %12.4e  %12.4e\n",
+      nthreads, time_atomic, time_slab, dev_atomic, dev_slab
+    );
+  }
+
+  fftw_free(weights);
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file bench_catalogue_io.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Benchmark catalogue loaders on a generated catalogue file.
+ *
+ * Usage: bench_catalogue_io [nrows] [filepath]
+ *
+ * A plain-text catalogue with columns 'x,y,z,nz' is generated and
+ * read with the previous line-by-line loader (reproduced here as the
+ * reference), the parallel plain-text loader and, after conversion,
+ * the binary catalogue loader.  The wall time, row throughput and the
+ * maximum deviation from the reference are reported.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "monitor.hpp"
+#include "particles.hpp"
+
+namespace trvs = trv::sys;
+
+/**
+ * @brief Read 'x,y,z,nz' rows with the previous line-by-line loader,
+ *        which counts lines in a first pass and parses each line
+ *        through a string stream in a second pass.
+ *
+ * @param filepath Catalogue file path.
+ * @returns Particle data by row.
+ */
+std::vector< std::vector<double> > load_reference(
+  const std::string& filepath
+) {
+  std::ifstream fin(filepath.c_str(), std::ios::in);
+
+  int num_lines = 0;
+  std::string line_str;
+  while (std::getline(fin, line_str)) {
+    if (line_str.empty() || line_str[0] == '#') {continue;}
+    num_lines++;
+  }
+  fin.close();
+
+  std::vector< std::vector<double> > rows;
+  rows.reserve(num_lines);
+
+  fin.open(filepath.c_str(), std::ios::in);
+  double entry;
+  while (std::getline(fin, line_str)) {
+    if (line_str.empty() || line_str[0] == '#') {continue;}
+
+    std::vector<double> row;
+    std::stringstream ss(
+      line_str, std::ios_base::out | std::ios_base::in | std::ios_base::binary
+    );
+    while (ss >> entry) {row.push_back(entry);}
+
+    rows.push_back(row);
+  }
+  fin.close();
+
+  return rows;
+}
+
+/**
+ * @brief Return the maximum deviation of a catalogue from the reference.
+ *
+ * @param catalogue Particle catalogue.
+ * @param rows Reference particle data by row.
+ * @returns Maximum absolute deviation.
+ */
+double calc_max_deviation(
+  trv::ParticleCatalogue& catalogue,
+  std::vector< std::vector<double> >& rows
+) {
+  if (catalogue.ntotal != int(rows.size())) {return INFINITY;}
+
+  double dev = 0.;
+  for (int pid = 0; pid < catalogue.ntotal; pid++) {
+    dev = std::max(dev, std::fabs(catalogue[pid].pos[0] - rows[pid][0]));
+    dev = std::max(dev, std::fabs(catalogue[pid].pos[1] - rows[pid][1]));
+    dev = std::max(dev, std::fabs(catalogue[pid].pos[2] - rows[pid][2]));
+    dev = std::max(dev, std::fabs(catalogue[pid].nz - rows[pid][3]));
+  }
+  return dev;
+}
+
+int main(int argc, char* argv[]) {
+  const long long nrows = (argc > 1) ? std::atoll(argv[1]) : 100000000;
+  const std::string filepath =
+    (argc > 2) ? argv[2] : "bench_catalogue_io.txt";
+  const std::string filepath_bin =
+    filepath.substr(0, filepath.find_last_of('.')) + trv::BINARY_CATALOGUE_EXT;
+
+  trvs::logger.reset_level(trvs::LogLevel::WARN);
+
+  // Generate a uniform random catalogue file.
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> uniform(0., 1000.);
+
+  std::FILE* fout = std::fopen(filepath.c_str(), "w");
+  if (fout == nullptr) {
+    std::fprintf(stderr, "Failed to create file: %s\n", filepath.c_str());
+    return 1;
+  }
+  std::fprintf(fout, "# x y z nz\n");
+  for (long long irow = 0; irow < nrows; irow++) {
+    std::fprintf(
+      fout, "%.9e %.9e %.9e %.9e\n",
+      uniform(rng), uniform(rng), uniform(rng), 1.e-4 * uniform(rng)
+    );
+  }
+  std::fclose(fout);
+
+  std::printf("# nrows = %lld, filepath = %s\n", nrows, filepath.c_str());
+  std::printf(
+    "# %-12s  %12s  %12s  %12s\n", "loader", "time [s]", "rows/s", "dev"
+  );
+
+  auto report = [&](const char* loader, double time, double dev) {
+    std::printf(
+      "  %-12s  %12.4f  %12.4e  %12.4e\n",
+      loader, time, double(nrows) / time, dev
+    );
+  };
+
+  // Reference loader.
+  auto tstart = std::chrono::steady_clock::now();
+  std::vector< std::vector<double> > rows_ref = load_reference(filepath);
+  auto tend = std::chrono::steady_clock::now();
+  report(
+    "reference", std::chrono::duration<double>(tend - tstart).count(), 0.
+  );
+
+  // Parallel plain-text loader.
+  {
+    trv::ParticleCatalogue catalogue;
+    tstart = std::chrono::steady_clock::now();
+    catalogue.load_catalogue_file(filepath, "x,y,z,nz");
+    tend = std::chrono::steady_clock::now();
+    report(
+      "text", std::chrono::duration<double>(tend - tstart).count(),
+      calc_max_deviation(catalogue, rows_ref)
+    );
+  }
+
+  // Binary loader.
+  trv::ParticleCatalogue::convert_catalogue_file(
+    filepath, "x,y,z,nz", filepath_bin
+  );
+  {
+    trv::ParticleCatalogue catalogue;
+    tstart = std::chrono::steady_clock::now();
+    catalogue.load_catalogue_file(filepath_bin, "");
+    tend = std::chrono::steady_clock::now();
+    report(
+      "binary", std::chrono::duration<double>(tend - tstart).count(),
+      calc_max_deviation(catalogue, rows_ref)
+    );
+  }
+
+  std::remove(filepath.c_str());
+  std::remove(filepath_bin.c_str());
+
+  return 0;
+}
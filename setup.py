@@ -329,8 +329,8 @@ def set_cli_compiler(compiler=None):
 
 PKG_LIB_NAME = 'trv'
 
-LIBS_CORE = ['gsl', 'fftw3',]  # noqa: E231
-LIBS_FULL = ['gsl', 'gslcblas', 'm', 'fftw3',]  # noqa: E231
+LIBS_CORE = ['gsl', 'fftw3', 'fftw3f',]  # noqa: E231
+LIBS_FULL = ['gsl', 'gslcblas', 'm', 'fftw3', 'fftw3f',]  # noqa: E231
 
 # Default to GCC OpenMP implementation.
 OPENMP_LIBS = {
@@ -633,6 +633,7 @@ def add_options_omp(macros, cflags, ldflags, libs, lib_dirs, include_dirs):
     # Adapt `ldflags`, `libs` and `lib_dirs`.
     LIBS_OMP_BASED = [
         'fftw3_omp',
+        'fftw3f_omp',
     ]  # noqa: E231
     for lib_ in LIBS_OMP_BASED:
         if lib_ and lib_ not in libs:
@@ -37,12 +37,22 @@
 #ifndef TRIUMVIRATE_INCLUDE_FIELD_HPP_INCLUDED_
 #define TRIUMVIRATE_INCLUDE_FIELD_HPP_INCLUDED_
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <fftw3.h>
 
+#include <algorithm>
 #include <chrono>
+#include <climits>
 #include <cmath>
 #include <complex>
+#include <cstdio>
 #include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "arrayops.hpp"
@@ -52,11 +62,411 @@
 #include "dataobjs.hpp"
 #include "io.hpp"
 #include "particles.hpp"
+#include "mpitools.hpp"
 
 namespace trvm = trv::maths;
 
 namespace trv {
 
+// ***********************************************************************
+// FFTW wisdom
+// ***********************************************************************
+
+/**
+ * @brief Import FFTW wisdom from the wisdom cache before planning.
+ *
+ * Wisdom in memory is kept for one wisdom file (see
+ * @ref trv::ParameterSet::ret_fftw_wisdom_filepath) per precision at
+ * a time: wisdom of any other file is forgotten before the wisdom file
+ * is imported, so that each wisdom file only accumulates wisdom planned
+ * under its own key.  Wisdom already in memory is not imported again.
+ *
+ * @param params Parameter set.
+ * @param sign Transform direction: {`FFTW_FORWARD`, `FFTW_BACKWARD`}.
+ * @param single Single-precision transform flag (default is `false`).
+ * @returns Whether wisdom from the cache is in memory.
+ */
+bool import_fftw_wisdom(
+  trv::ParameterSet& params, int sign, bool single = false
+);
+
+/**
+ * @brief Export FFTW wisdom to the wisdom cache after planning.
+ *
+ * Wisdom is exported if it was not in the cache, or if planning took
+ * longer than 0.1 seconds despite the cache (e.g. for new transform
+ * shapes).  As wisdom in memory is that of the wisdom file only (see
+ * @ref trv::import_fftw_wisdom), the exported file does not gain
+ * wisdom planned under other keys.  The wisdom file is written to
+ * a temporary file which is then renamed, so that concurrent programs
+ * never import a partially written file.
+ *
+ * @param params Parameter set.
+ * @param sign Transform direction: {`FFTW_FORWARD`, `FFTW_BACKWARD`}.
+ * @param imported Whether wisdom from the cache was in memory.
+ * @param plan_time Planning time (in seconds).
+ * @param single Single-precision transform flag (default is `false`).
+ */
+void export_fftw_wisdom(
+  trv::ParameterSet& params, int sign, bool imported, double plan_time,
+  bool single = false
+);
+
+// ***********************************************************************
+// Mesh field pool
+// ***********************************************************************
+
+/**
+ * @brief Pool of mesh grid buffers and FFTW plans shared by mesh fields.
+ *
+ * Mesh fields constructed repeatedly (e.g. in loops over spherical
+ * harmonic orders) can acquire their grid buffers from the pool instead
+ * of allocating them anew, and share FFTW plans executed on new arrays
+ * instead of re-planning.  Batched FFTW plans are also shared for
+ * contiguous mesh grids that are Fourier transformed together, e.g.
+ * a mesh field and its interlaced shadow (see
+ * @ref trv::MeshFieldBatch).  Buffers are aligned by FFTW and pre-faulted
+ * when first allocated, and are returned to the pool when the mesh field
+ * is destructed, so the pool holds at most as many buffers as there are
+ * mesh fields alive at the same time.  All buffers are freed when the
+ * pool is destructed.
+ *
+ * The pool memory is counted in @ref trv::sys::gbytesMem when allocated,
+ * so its high-water mark is reflected in @ref trv::sys::gbytesMaxMem.
+ *
+ * Single-precision mesh fields (see @ref trv::ParameterSet::precision)
+ * acquire buffers of the same pool reinterpreted as `fftwf_complex`
+ * elements, and share single-precision FFTW plans.
+ *
+ */
+class MeshFieldPool {
+ public:
+  trv::ParameterSet params;  ///< parameter set
+  int nbuffers = 0;          ///< number of allocated buffers
+  double gbytes = 0.;        ///< memory of allocated buffers (in gibibytes)
+
+  // ---------------------------------------------------------------------
+  // Life cycle
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Construct the mesh field pool.
+   *
+   * @param params Parameter set.
+   */
+  explicit MeshFieldPool(trv::ParameterSet& params);
+
+  /**
+   * @brief Destruct the mesh field pool.
+   */
+  ~MeshFieldPool();
+
+  // ---------------------------------------------------------------------
+  // Buffers & plans
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Acquire a free buffer from the pool.
+   *
+   * A new buffer is allocated only if no free buffer of the same size
+   * is available.
+   *
+   * @param nelem Number of complex elements in the buffer.
+   * @returns Buffer (with unspecified values).
+   */
+  fftw_complex* acquire_buffer(long long nelem);
+
+  /**
+   * @brief Release a buffer back to the pool.
+   *
+   * @param buffer Buffer acquired from the pool.
+   */
+  void release_buffer(fftw_complex* buffer);
+
+  /**
+   * @brief Acquire a free single-precision buffer from the pool.
+   *
+   * @param nelem Number of single-precision complex elements in
+   *              the buffer.
+   * @returns Buffer (with unspecified values).
+   */
+  fftwf_complex* acquire_buffer_sp(long long nelem);
+
+  /**
+   * @brief Release a single-precision buffer back to the pool.
+   *
+   * @param buffer Buffer acquired from the pool.
+   *
+   * @overload
+   */
+  void release_buffer(fftwf_complex* buffer);
+
+  /**
+   * @brief Return shared in-place FFTW plans for the full mesh.
+   *
+   * The plans are created on first request and must be executed with
+   * the new-array execute functions, e.g. `fftw_execute_dft`.
+   *
+   * @param[in] r2c Real-to-complex transform flag.
+   * @param[out] transform FFTW plan for Fourier transform.
+   * @param[out] inv_transform FFTW plan for inverse Fourier transform.
+   */
+  void ret_plans(bool r2c, fftw_plan& transform, fftw_plan& inv_transform);
+
+  /**
+   * @brief Return shared in-place single-precision FFTW plans for
+   *        the full mesh.
+   *
+   * The plans must be executed with the new-array execute functions,
+   * e.g. `fftwf_execute_dft`.
+   *
+   * @param[in] r2c Real-to-complex transform flag.
+   * @param[out] transform FFTW plan for Fourier transform.
+   * @param[out] inv_transform FFTW plan for inverse Fourier transform.
+   *
+   * @overload
+   */
+  void ret_plans(bool r2c, fftwf_plan& transform, fftwf_plan& inv_transform);
+
+  /**
+   * @brief Return the shared in-place batched FFTW plan for Fourier
+   *        transforms of contiguous full meshes.
+   *
+   * The plan is created on first request for each batch size and must be
+   * executed with the new-array execute functions on a buffer holding
+   * @p nbatch meshes of @ref trv::MeshFieldPool::ret_mesh_size elements
+   * each, spaced by @ref trv::MeshFieldPool::ret_mesh_stride elements.
+   *
+   * @param r2c Real-to-complex transform flag.
+   * @param nbatch Number of meshes in the batch.
+   * @returns Batched FFTW plan for Fourier transforms, or `nullptr` if
+   *          a mesh is too large to be batched.
+   */
+  fftw_plan ret_batch_plan(bool r2c, int nbatch);
+
+  /**
+   * @brief Return the shared in-place batched single-precision FFTW plan
+   *        for Fourier transforms of contiguous full meshes.
+   *
+   * As @ref trv::MeshFieldPool::ret_batch_plan, with meshes spaced by
+   * @ref trv::MeshFieldPool::ret_mesh_stride single-precision elements.
+   *
+   * @param r2c Real-to-complex transform flag.
+   * @param nbatch Number of meshes in the batch.
+   * @returns Batched FFTW plan for Fourier transforms, or `nullptr` if
+   *          a mesh is too large to be batched.
+   */
+  fftwf_plan ret_batch_plan_sp(bool r2c, int nbatch);
+
+  /**
+   * @brief Return the number of complex elements allocated for
+   *        a full mesh.
+   *
+   * @param r2c Real-to-complex transform flag.
+   * @returns Number of complex elements.
+   */
+  long long ret_mesh_size(bool r2c);
+
+  /**
+   * @brief Return the number of complex elements between contiguous
+   *        meshes in a buffer.
+   *
+   * Meshes are spaced by their sizes padded to 64-byte boundaries, so
+   * that every mesh has the same alignment as the buffer for FFTW plans.
+   *
+   * @param nelem Number of complex elements in a mesh.
+   * @param single Single-precision element flag (default is `false`).
+   * @returns Number of complex elements between contiguous meshes.
+   */
+  static long long ret_mesh_stride(long long nelem, bool single = false);
+
+  /**
+   * @brief Return shared slab-decomposed FFT plans.
+   *
+   * The plans are created on first request.
+   *
+   * @param[out] transform Slab-decomposed FFT plan for
+   *                       Fourier transform.
+   * @param[out] inv_transform Slab-decomposed FFT plan for inverse
+   *                           Fourier transform.
+   */
+  void ret_slab_plans(
+    trv::SlabFFTPlan*& transform, trv::SlabFFTPlan*& inv_transform
+  );
+
+ private:
+  std::vector<fftw_complex*> buffers;   ///< allocated buffers
+  std::vector<long long> buffer_sizes;  ///< buffer sizes
+  std::vector<bool> buffer_used;        ///< buffer acquisition flags
+
+  /// FFTW plans for complex-to-complex transforms
+  fftw_plan transform_c2c, inv_transform_c2c;
+  /// FFTW plans for real-to-complex transforms
+  fftw_plan transform_r2c, inv_transform_r2c;
+  bool plan_c2c_ini = false;  ///< complex-to-complex plan flag
+  bool plan_r2c_ini = false;  ///< real-to-complex plan flag
+
+  /// batched FFTW plans keyed by transform type and batch size
+  std::map<std::pair<bool, int>, fftw_plan> batch_plans;
+
+  /// single-precision FFTW plans for complex-to-complex transforms
+  fftwf_plan transform_c2c_sp, inv_transform_c2c_sp;
+  /// single-precision FFTW plans for real-to-complex transforms
+  fftwf_plan transform_r2c_sp, inv_transform_r2c_sp;
+  /// single-precision complex-to-complex plan flag
+  bool plan_c2c_sp_ini = false;
+  /// single-precision real-to-complex plan flag
+  bool plan_r2c_sp_ini = false;
+
+  /// batched single-precision FFTW plans keyed by transform type and
+  /// batch size
+  std::map<std::pair<bool, int>, fftwf_plan> batch_plans_sp;
+
+  /// slab-decomposed FFT plan for Fourier transform
+  trv::SlabFFTPlan* slab_transform = nullptr;
+  /// slab-decomposed FFT plan for inverse Fourier transform
+  trv::SlabFFTPlan* slab_inv_transform = nullptr;
+};
+
+
+// ***********************************************************************
+// Wavevector geometry
+// ***********************************************************************
+
+/**
+ * @brief Wavevector geometry of a (local slab of a) mesh grid.
+ *
+ * This stores the squared wavenumber and the assignment window along
+ * each axis, so that they are not recomputed by every mesh field and on
+ * every call to Fourier-space binning and band-limiting methods.  Both
+ * are separable, @f$ k^2 = k_x^2 + k_y^2 + k_z^2 @f$ and
+ * @f$ W(\vec{k}) = W(k_x) W(k_y) W(k_z) @f$, so only one-dimensional
+ * tables are stored.  The geometry depends only on
+ * the mesh grid, box size and assignment scheme, and is shared by all
+ * mesh fields (and field statistics) on the same mesh grid through
+ * @ref trv::WavevectorGeometry::ret_shared.
+ *
+ */
+class WavevectorGeometry {
+ public:
+  int ngrid[3];               ///< grid number in each dimension
+  double boxsize[3];          ///< box size in each dimension
+  int assignment_order;       ///< assignment scheme order
+  int n0_local;               ///< number of local grid cells along x-axis
+  int i0_start;               ///< starting local grid index along x-axis
+  long long nmesh_local;      ///< number of local grid cells
+  /// squared wavenumber @f$ k_x^2 @f$ at grid indices along x-axis
+  std::vector<double> ksq_x;
+  /// squared wavenumber @f$ k_y^2 @f$ at grid indices along y-axis
+  std::vector<double> ksq_y;
+  /// squared wavenumber @f$ k_z^2 @f$ at grid indices along z-axis
+  std::vector<double> ksq_z;
+  /// assignment window @f$ W(k_x) @f$ at grid indices along x-axis
+  std::vector<double> window_x;
+  /// assignment window @f$ W(k_y) @f$ at grid indices along y-axis
+  std::vector<double> window_y;
+  /// assignment window @f$ W(k_z) @f$ at grid indices along z-axis
+  std::vector<double> window_z;
+
+  // ---------------------------------------------------------------------
+  // Life cycle
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Construct the wavevector geometry.
+   *
+   * @param params Parameter set.
+   * @param n0_local Number of local grid cells along x-axis.
+   * @param i0_start Starting local grid index along x-axis.
+   */
+  WavevectorGeometry(trv::ParameterSet& params, int n0_local, int i0_start);
+
+  /**
+   * @brief Destruct the wavevector geometry.
+   */
+  ~WavevectorGeometry();
+
+  /**
+   * @brief Return the wavevector geometry shared by all mesh fields
+   *        on the same mesh grid.
+   *
+   * The geometry is computed only if no geometry for the same mesh grid
+   * is currently held, and is freed when it is no longer held.
+   *
+   * @param params Parameter set.
+   * @param n0_local Number of local grid cells along x-axis.
+   * @param i0_start Starting local grid index along x-axis.
+   * @returns Shared wavevector geometry.
+   */
+  static std::shared_ptr<WavevectorGeometry> ret_shared(
+    trv::ParameterSet& params, int n0_local, int i0_start
+  );
+
+  /**
+   * @brief Return the assignment window at a grid cell.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Assignment window @f$ W(\vec{k}) @f$.
+   */
+  double ret_window(int i, int j, int k) const {
+    return this->window_x[i] * this->window_y[j] * this->window_z[k];
+  }
+
+  /**
+   * @brief Return the wavevector magnitude at a grid cell.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Wavevector magnitude @f$ k @f$.
+   */
+  double ret_kmag(int i, int j, int k) const {
+    return std::sqrt(this->ksq_x[i] + this->ksq_y[j] + this->ksq_z[k]);
+  }
+
+  // ---------------------------------------------------------------------
+  // Unique wavevector magnitudes
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Return the sorted unique wavevector magnitudes on the mesh grid.
+   *
+   * Wavevector magnitudes are invariant under reflections of the
+   * wavevector components, so functions of the magnitude only need to be
+   * evaluated once per unique value.  The unique values and their
+   * indices over the reflection octant of the mesh grid are computed on
+   * the first call.
+   *
+   * @returns Unique wavevector magnitudes.
+   */
+  const std::vector<double>& ret_unique_kmag();
+
+  /**
+   * @brief Return the index of the wavevector magnitude at a grid cell
+   *        in the unique wavevector magnitudes.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Index in @ref trv::WavevectorGeometry::ret_unique_kmag.
+   */
+  int ret_unique_kmag_index(int i, int j, int k) const {
+    int i_ = (i < this->ngrid[0]/2) ? i : this->ngrid[0] - i;
+    int j_ = (j < this->ngrid[1]/2) ? j : this->ngrid[1] - j;
+    int k_ = (k < this->ngrid[2]/2) ? k : this->ngrid[2] - k;
+
+    return this->kmag_unique_index[
+      (i_ * static_cast<long long>(this->noctant[1]) + j_)
+      * this->noctant[2] + k_
+    ];
+  }
+
+ private:
+  /// grid number in each dimension of the reflection octant
+  int noctant[3] = {0, 0, 0};
+  /// unique wavevector magnitudes
+  std::vector<double> kmag_unique;
+  /// index in unique wavevector magnitudes over the reflection octant
+  std::vector<int> kmag_unique_index;
+};
+
+
 // ***********************************************************************
 // Mesh field
 // ***********************************************************************
@@ -70,6 +480,11 @@ class MeshField {
   trv::ParameterSet params;  ///< parameter set
   std::string name;          ///< field name
   fftw_complex* field;       ///< complex field on mesh
+  bool r2c = false;          ///< real-to-complex transform flag
+  bool single = false;       ///< single-precision storage flag
+  int n0_local;              ///< number of local grid cells along x-axis
+  int i0_start;              ///< starting local grid index along x-axis
+  long long nmesh_local;     ///< number of local grid cells
   double dr[3];              ///< grid size in each dimension
   double dk[3];              ///< fundamental wavenumber in each dimension
   double vol;                ///< mesh volume
@@ -82,20 +497,51 @@ class MeshField {
   /**
    * @brief Construct the mesh field.
    *
+   * If @p r2c is `true`, the field is assumed to be real-valued in
+   * configuration space (the imaginary part of any assigned weights is
+   * discarded) and is Fourier transformed with real-to-complex FFTW
+   * plans.  The field is then stored in half-complex form, i.e. only
+   * modes with @f$ k_z \geqslant 0 @f$ are kept, which halves
+   * both the memory usage and the transform cost.  In configuration space,
+   * the real field values are stored contiguously with padding along the
+   * last dimension, so @ref trv::MeshField::operator[] no longer returns
+   * grid cell values and @ref trv::MeshField::ret_fourier_mode should be
+   * used to access Fourier modes.
+   *
+   * With more than one MPI task, the field is decomposed into slabs
+   * along the x-axis (see @ref trv::sys::allocate_slab), where only
+   * the local slab of @ref trv::MeshField.nmesh_local grid cells
+   * starting at index @ref trv::MeshField.i0_start is stored, and is
+   * Fourier transformed with @ref trv::SlabFFTPlan.  Such a field is
+   * always complex-to-complex, i.e. @p r2c is ignored.
+   *
+   * If @ref trv::ParameterSet::precision is "single", the field is
+   * stored in single precision and Fourier transformed with
+   * single-precision FFTW plans (with their own FFTW wisdom files if
+   * the wisdom cache is used), which halves the memory usage;
+   * @ref trv::MeshField.field is then `nullptr` and
+   * field values are only accessible through
+   * @ref trv::MeshField::ret_fourier_mode, which returns them in double
+   * precision.  Slab-decomposed fields are always in double precision.
+   *
    * @param params Parameter set.
    * @param plan_ini Flag for FFTW plan initialisation
    *                 (default is `true`).
    * @param name Field name (default is "mesh-field").
+   * @param r2c Real-to-complex transform flag (default is `false`).
    */
   explicit MeshField(
     trv::ParameterSet& params,
     bool plan_ini = true,
-    const std::string& name = "mesh-field"
+    const std::string& name = "mesh-field",
+    bool r2c = false
   );
 
   /**
    * @brief Construct the mesh field with external FFTW plans.
    *
+   * The field is always in double precision.
+   *
    * @param params Parameter set.
    * @param transform External FFTW plan for Fourier transform.
    * @param inv_transform External FFTW plan for inverse
@@ -110,6 +556,28 @@ class MeshField {
     const std::string& name = "mesh-field"
   );
 
+  /**
+   * @brief Construct the mesh field with buffers and FFTW plans
+   *        from a mesh field pool.
+   *
+   * The buffers are returned to @p pool when the mesh field is
+   * destructed, so @p pool must outlive the mesh field.  The field
+   * and its interlaced shadow (if any) are stored contiguously and
+   * Fourier transformed together with a batched FFTW plan.
+   *
+   * @param params Parameter set.
+   * @param pool Mesh field pool.
+   * @param name Field name (default is "mesh-field").
+   * @param r2c Real-to-complex transform flag (default is `false`).
+   *
+   * @overload
+   */
+  explicit MeshField(
+    trv::ParameterSet& params, trv::MeshFieldPool& pool,
+    const std::string& name = "mesh-field",
+    bool r2c = false
+  );
+
   /**
    * @brief Destruct the mesh field.
    */
@@ -130,11 +598,24 @@ class MeshField {
   /**
    * @brief Return mesh field grid cell value.
    *
+   * This is only available for a double-precision field.
+   *
    * @param gid Grid index.
    * @returns Field value.
    */
   const fftw_complex& operator[](long long gid);
 
+  /**
+   * @brief Return the mesh field value of a Fourier mode.
+   *
+   * For a real-to-complex field, modes not stored in the half-complex
+   * mesh are recovered from Hermitian symmetry.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Fourier-space field value.
+   */
+  std::complex<double> ret_fourier_mode(int i, int j, int k);
+
   // ---------------------------------------------------------------------
   // Mesh assignment
   // ---------------------------------------------------------------------
@@ -223,6 +704,30 @@ class MeshField {
     double alpha, int ell, int m
   );
 
+  /**
+   * @brief Compute the weighted field fluctuations further weighted by
+   *        the reduced spherical harmonics with a precomputed
+   *        random-source field.
+   *
+   * The random-source field is the weighted field of the random-source
+   * catalogue computed with the same degree and order and with unit
+   * alpha contrast, so that it can be reused for different
+   * data-source catalogues.
+   *
+   * @param particles_data (Data-source) particle catalogue.
+   * @param los_data (Data-source) particle lines of sight.
+   * @param field_rand (Random-source) weighted field.
+   * @param alpha Alpha contrast.
+   * @param ell Degree of the spherical harmonic.
+   * @param m Order of the spherical harmonic.
+   *
+   * @overload
+   */
+  void compute_ylm_wgtd_field(
+    ParticleCatalogue& particles_data, LineOfSight* los_data,
+    MeshField& field_rand, double alpha, int ell, int m
+  );
+
   /**
    * @brief Compute the weighted field further weighted by the
    *        reduced spherical harmonics.
@@ -331,6 +836,18 @@ class MeshField {
    */
   void apply_assignment_compensation();
 
+  /**
+   * @brief Negate the order of a reduced-spherical-harmonic-weighted
+   *        field in configuration space.
+   *
+   * Since particle weights are real, the field at order @f$ -M @f$ is
+   * @f$ (-1)^M @f$ times the complex conjugate of the field at order
+   * @f$ M @f$, which is computed in place.
+   *
+   * @param M Order @f$ M @f$ of the field.
+   */
+  void apply_order_negation(int M);
+
   // ---------------------------------------------------------------------
   // One-point statistics
   // ---------------------------------------------------------------------
@@ -352,14 +869,16 @@ class MeshField {
    *      [<a href="https://arxiv.org/abs/1803.02132">1803.02132</a>].
    *
    * @param[in] field_fourier A Fourier-space field.
-   * @param[in] ylm Reduced spherical harmonic on a mesh.
+   * @param[in] ylm Reduced spherical harmonics on a mesh.
+   * @param[in] m Order of the reduced spherical harmonic.
    * @param[in] k_band Band wavenumber.
    * @param[in] dk_band Band wavenumber width.
    * @param[out] k_eff Effective band wavenumber.
    * @param[out] nmodes Number of wavevector modes in band.
    */
   void inv_fourier_transform_ylm_wgtd_field_band_limited(
-    MeshField& field_fourier, std::vector< std::complex<double> >& ylm,
+    MeshField& field_fourier,
+    const trvm::SphericalHarmonicTable& ylm, const int m,
     double k_band, double dk_band,
     double& k_eff, int& nmodes
   );
@@ -380,14 +899,15 @@ class MeshField {
    *      [<a href="https://arxiv.org/abs/1803.02132">1803.02132</a>].
    *
    * @param field_fourier A Fourier-space field.
-   * @param ylm Reduced spherical harmonic on a mesh.
+   * @param ylm Reduced spherical harmonics on a mesh.
+   * @param m Order of the reduced spherical harmonic.
    * @param sjl Spherical Bessel function interpolator.
    * @param r Separation in configuration space.
    */
   void inv_fourier_transform_sjl_ylm_wgtd_field(
     MeshField& field_fourier,
-    std::vector< std::complex<double> >& ylm,
-    trvm::SphericalBesselCalculator& sjl,
+    const trvm::SphericalHarmonicTable& ylm, const int m,
+    const trvm::SphericalBesselCalculator& sjl,
     double r
   );
 
@@ -409,14 +929,15 @@ class MeshField {
   double calc_grid_based_powlaw_norm(ParticleCatalogue& particles, int order);
 
  private:
-  /// assignment window on mesh
-  std::vector<double> window;
-  /// window assignment order (default -1 if unassigned)
-  int window_assign_order = -1;
+  /// wavevector geometry of the mesh grid (shared by fields)
+  std::shared_ptr<trv::WavevectorGeometry> kgeom;
 
   /// half-grid shifted complex field on mesh
   fftw_complex* field_s = nullptr;
 
+  /// number of complex elements allocated for the field on mesh
+  long long nmesh_alloc;
+
   /// FFTW plan for Fourier transform of the field
   fftw_plan transform;
   /// FFTW plan for Fourier transform of the shadow field
@@ -424,10 +945,101 @@ class MeshField {
   /// FFTW plan for inverse Fourier transform of the field
   fftw_plan inv_transform;
 
+  /// single-precision complex field on mesh
+  fftwf_complex* field_sp = nullptr;
+  /// single-precision half-grid shifted complex field on mesh
+  fftwf_complex* field_s_sp = nullptr;
+  /// single-precision FFTW plan for Fourier transform of the field
+  /// (and its shadow, executed on new arrays)
+  fftwf_plan transform_sp = nullptr;
+  /// single-precision FFTW plan for inverse Fourier transform of
+  /// the field
+  fftwf_plan inv_transform_sp = nullptr;
+  /// batched single-precision FFTW plan for Fourier transform of
+  /// the pooled field and its shadow
+  fftwf_plan batch_transform_sp = nullptr;
+
   bool plan_ini = false;  ///< FFTW plan initialisation flag
   bool plan_ext = false;  ///< FFTW plan externality flag
 
+  /// mesh field pool owning the buffers (if any)
+  trv::MeshFieldPool* pool = nullptr;
+  /// batched FFTW plan for Fourier transform of the pooled field
+  /// and its shadow
+  fftw_plan batch_transform = nullptr;
+  /// buffer externality flag (for buffers owned by a mesh field batch)
+  bool buffer_ext = false;
+
+  /// slab decomposition flag
+  bool distributed = false;
+  /// slab-decomposed FFT plan for Fourier transform
+  trv::SlabFFTPlan* slab_transform = nullptr;
+  /// slab-decomposed FFT plan for inverse Fourier transform
+  trv::SlabFFTPlan* slab_inv_transform = nullptr;
+
   friend class FieldStats;
+  friend class MeshFieldBatch;
+
+  /**
+   * @brief Construct the mesh field with FFTW plans from a mesh field
+   *        pool in an external buffer.
+   *
+   * @param params Parameter set.
+   * @param pool Mesh field pool.
+   * @param name Field name.
+   * @param r2c Real-to-complex transform flag.
+   * @param buffer External buffer for the field and its shadow (if any)
+   *               of `fftw_complex` or (in single precision)
+   *               `fftwf_complex` elements, or `nullptr` to acquire one
+   *               from @p pool.
+   */
+  MeshField(
+    trv::ParameterSet& params, trv::MeshFieldPool& pool,
+    const std::string& name, bool r2c, void* buffer
+  );
+
+  /**
+   * @brief Apply an operation to the field and its shadow in their
+   *        storage precision.
+   *
+   * @tparam Op Operation type.
+   * @param op Operation called with the field and its shadow as either
+   *           `fftw_complex*` or `fftwf_complex*` pointers.
+   * @returns Return value of @p op.
+   */
+  template<typename Op>
+  auto apply_to_fields(Op&& op);
+
+  /**
+   * @brief Apply an operation to the field and its shadow together with
+   *        another field and its shadow in the same storage precision.
+   *
+   * @tparam Op Operation type.
+   * @param other Other mesh field.
+   * @param op Operation called with the field, its shadow, the other
+   *           field and its shadow as either `fftw_complex*` or
+   *           `fftwf_complex*` pointers.
+   * @returns Return value of @p op.
+   *
+   * @overload
+   */
+  template<typename Op>
+  auto apply_to_fields(MeshField& other, Op&& op);
+
+  // ---------------------------------------------------------------------
+  // Field transforms
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Apply the FFT volume normalisation to the field (and its
+   *        shadow) before Fourier transform.
+   */
+  void apply_fourier_volume_normalisation();
+
+  /**
+   * @brief Interlace the Fourier-transformed field with its shadow.
+   */
+  void interlace_shadow_field();
 
   // ---------------------------------------------------------------------
   // Mesh grid properties
@@ -436,11 +1048,37 @@ class MeshField {
   /**
    * @brief Return the grid cell index.
    *
+   * For a slab-decomposed field, this is the index within the local
+   * slab, which lies in the range [0, @ref trv::MeshField.nmesh_local)
+   * only if @p i is local.
+   *
    * @param i, j, k Grid index in each dimension.
    * @returns Grid cell index.
    */
   long long ret_grid_index(int i, int j, int k);
 
+  /**
+   * @brief Return the storage index of a Fourier mode of the field.
+   *
+   * This coincides with @ref trv::MeshField::ret_grid_index unless
+   * the field is real-to-complex, in which case @p k must not exceed
+   * half the grid number in the last dimension.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Storage index in @ref trv::MeshField.field.
+   */
+  long long ret_fourier_grid_index(int i, int j, int k);
+
+  /**
+   * @brief Return the storage index of a real-to-complex field value in
+   *        configuration space.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Storage index in @ref trv::MeshField.field viewed as
+   *          an array of real values.
+   */
+  long long ret_real_grid_index(int i, int j, int k);
+
   /**
    * @brief Shift the grid indices on a discrete Fourier mesh grid.
    *
@@ -464,6 +1102,14 @@ class MeshField {
    */
   void get_grid_wavevector(int i, int j, int k, double kvec[3]);
 
+  /**
+   * @brief Return the wavevector geometry of the mesh grid.
+   *
+   * @returns Wavevector geometry (see
+   *          @ref trv::WavevectorGeometry::ret_shared).
+   */
+  trv::WavevectorGeometry& ret_kgeometry();
+
   // ---------------------------------------------------------------------
   // Mesh assignment
   // ---------------------------------------------------------------------
@@ -512,6 +1158,100 @@ class MeshField {
     ParticleCatalogue& particles, fftw_complex* weight
   );
 
+  /**
+   * @brief Set the sampling window stencil of a particle along one
+   *        dimension.
+   *
+   * @tparam order Order of the assignment scheme.
+   * @param[in] loc_grid Particle coordinate in units of the grid size.
+   * @param[in] ngrid Grid number in the dimension.
+   * @param[out] ijk Grid indices of the covered grid cells.
+   * @param[out] win Sampling window values at the covered grid cells.
+   *
+   * @note The covered grid cells are consecutive (modulo periodic
+   *       wrapping) starting from @p ijk[0].
+   */
+  template<int order>
+  static void set_assignment_stencil(
+    double loc_grid, int ngrid, int ijk[order], double win[order]
+  );
+
+  /**
+   * @brief Get the sampling window stencil of a particle.
+   *
+   * @tparam order Order of the assignment scheme.
+   * @param[in] pos Particle position.
+   * @param[in] shift Half-grid shift flag for the interlaced mesh.
+   * @param[out] ijk Grid indices of the covered grid cells
+   *                 in each dimension.
+   * @param[out] win Sampling window values at the covered grid cells
+   *                 in each dimension.
+   */
+  template<int order>
+  void get_assignment_stencil(
+    const double pos[3], bool shift, int ijk[3][order], double win[3][order]
+  );
+
+  /**
+   * @brief Assign weighted field to a mesh by an assignment scheme
+   *        of a given order.
+   *
+   * The assignment engine is set by
+   * @ref trv::ParameterSet::assignment_engine.
+   *
+   * @tparam order Order of the assignment scheme.
+   * @param particles Particle catalogue.
+   * @param weight Particle weights.
+   */
+  template<int order>
+  void assign_weighted_field_to_mesh_by_order(
+    ParticleCatalogue& particles, fftw_complex* weight
+  );
+
+  /**
+   * @brief Assign weighted field to a mesh with atomic updates of
+   *        grid cells shared between threads.
+   *
+   * @tparam order Order of the assignment scheme.
+   * @tparam T Mesh grid cell type, either `fftw_complex` or
+   *           `fftwf_complex`.
+   * @param particles Particle catalogue.
+   * @param weight Particle weights.
+   * @param mesh Mesh to assign to.
+   * @param shift Half-grid shift flag for the interlaced mesh.
+   */
+  template<int order, typename T>
+  void assign_weighted_field_to_mesh_atomic(
+    ParticleCatalogue& particles, fftw_complex* weight,
+    T* mesh, bool shift
+  );
+
+  /**
+   * @brief Assign weighted field to a mesh by slabs without atomic
+   *        updates.
+   *
+   * Particles are bucketed by the mesh slab along the first dimension
+   * in which their sampling window stencil starts.  Each slab is at least
+   * as thick as the stencil, so slabs that are not adjacent (with
+   * periodic wrapping) never write to the same grid cell; alternate
+   * slabs are painted concurrently in colour passes.  The summation
+   * order in each grid cell is fixed, so the mesh is reproducible
+   * regardless of the number of threads.
+   *
+   * @tparam order Order of the assignment scheme.
+   * @tparam T Mesh grid cell type, either `fftw_complex` or
+   *           `fftwf_complex`.
+   * @param particles Particle catalogue.
+   * @param weight Particle weights.
+   * @param mesh Mesh to assign to.
+   * @param shift Half-grid shift flag for the interlaced mesh.
+   */
+  template<int order, typename T>
+  void assign_weighted_field_to_mesh_slab(
+    ParticleCatalogue& particles, fftw_complex* weight,
+    T* mesh, bool shift
+  );
+
   /**
    * @brief Calculate the interpolation window at each mesh grid
    *        in Fourier space for different assignment schemes.
@@ -522,16 +1262,311 @@ class MeshField {
    * @returns Window value.
    */
   double calc_assignment_window_in_fourier(int i, int j, int k, int order = 0);
+};
+
+
+// ***********************************************************************
+// Mesh field batch
+// ***********************************************************************
+
+/**
+ * @brief Batch of mesh fields Fourier transformed together.
+ *
+ * The mesh fields (and their interlaced shadows) are stored contiguously
+ * in a single buffer from a mesh field pool, so that they are computed
+ * separately but Fourier transformed by a single batched FFTW plan (see
+ * @ref trv::MeshFieldPool::ret_batch_plan), which amortises planning and
+ * improves cache reuse across meshes.  Slab-decomposed mesh fields are
+ * Fourier transformed one at a time.
+ *
+ */
+class MeshFieldBatch {
+ public:
+  int nfields;  ///< number of mesh fields
+
+  // ---------------------------------------------------------------------
+  // Life cycle
+  // ---------------------------------------------------------------------
 
   /**
-   * @brief Compute the interpolation window at each mesh grid
-   *        in Fourier space for different assignment schemes and store
-   *        the values in @ref trv::MeshField.window.
+   * @brief Construct the mesh field batch.
    *
-   * @param order Order of the assignment scheme
-   *              (default is 0 as placeholder).
+   * The buffer is returned to @p pool when the batch is destructed,
+   * so @p pool must outlive the batch.
+   *
+   * @param params Parameter set.
+   * @param pool Mesh field pool.
+   * @param names Field names.
+   * @param r2c Real-to-complex transform flag (default is `false`).
+   */
+  MeshFieldBatch(
+    trv::ParameterSet& params, trv::MeshFieldPool& pool,
+    const std::vector<std::string>& names, bool r2c = false
+  );
+
+  /**
+   * @brief Destruct the mesh field batch.
+   */
+  ~MeshFieldBatch();
+
+  // ---------------------------------------------------------------------
+  // Operators & reserved methods
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Return mesh field in the batch.
+   *
+   * @param ifield Field index.
+   * @returns Mesh field.
+   */
+  trv::MeshField& operator[](int ifield);
+
+  // ---------------------------------------------------------------------
+  // Field transforms
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Fourier transform all fields in the batch.
+   *
+   * This is equivalent to calling @ref trv::MeshField::fourier_transform
+   * for each field.
    */
-  void compute_assignment_window_in_fourier(int order = 0);
+  void fourier_transform();
+
+ private:
+  trv::MeshFieldPool* pool;             ///< mesh field pool
+  std::vector<trv::MeshField*> fields;  ///< mesh fields
+  fftw_complex* buffer = nullptr;       ///< contiguous buffer of fields
+  bool r2c = false;                     ///< real-to-complex transform flag
+  bool interlace = false;               ///< interlacing flag
+  /// batched FFTW plan for Fourier transform (if any)
+  fftw_plan transform = nullptr;
+
+  bool single = false;                  ///< single-precision storage flag
+  /// contiguous single-precision buffer of fields
+  fftwf_complex* buffer_sp = nullptr;
+  /// batched single-precision FFTW plan for Fourier transform (if any)
+  fftwf_plan transform_sp = nullptr;
+};
+
+
+// ***********************************************************************
+// Shell field cache
+// ***********************************************************************
+
+/**
+ * @brief Cache of band-limited fields in wavenumber shells or
+ *        spherical-Bessel-weighted fields in separation shells.
+ *
+ * This stores the inverse Fourier transform of a spherical harmonic
+ * weighted field in every wavenumber shell of a binning scheme (see
+ * @ref trv::MeshField::inv_fourier_transform_ylm_wgtd_field_band_limited),
+ * or weighted by the spherical Bessel function at the effective
+ * separation of every separation bin (see
+ * @ref trv::MeshField::inv_fourier_transform_sjl_ylm_wgtd_field),
+ * so that each shell field is computed once and reused for all pairs
+ * of shells.  If the cache does not fit in the available physical
+ * memory, it is spilled to a disk-backed memory map.
+ *
+ */
+class ShellFieldCache {
+ public:
+  std::string name;           ///< cache name
+  int num_shells;             ///< number of wavenumber shells
+  long long nmesh;            ///< number of local grid cells per shell
+  std::vector<double> k_eff;  ///< effective wavenumber in shells
+  std::vector<int> nmodes;    ///< number of wavevector modes in shells
+  bool spilled = false;       ///< disk-backed memory map flag
+
+  // ---------------------------------------------------------------------
+  // Life cycle
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Construct the shell field cache.
+   *
+   * The spill file, if needed, is created in the measurement
+   * directory and unlinked immediately so that it is removed when
+   * the cache is destructed.
+   *
+   * @param params Parameter set.
+   * @param num_shells Number of wavenumber shells.
+   * @param name Cache name (default is "shell-field-cache").
+   * @throws trv::sys::IOError When the spill file cannot be created
+   *                           or mapped.
+   */
+  ShellFieldCache(
+    trv::ParameterSet& params, int num_shells,
+    const std::string& name = "shell-field-cache"
+  );
+
+  /**
+   * @brief Destruct the shell field cache.
+   */
+  ~ShellFieldCache();
+
+  // The cache memory (or memory map) is owned, so copying is disallowed.
+  ShellFieldCache(const ShellFieldCache&) = delete;
+  ShellFieldCache& operator=(const ShellFieldCache&) = delete;
+
+  /**
+   * @brief Return the cached field in a shell.
+   *
+   * @param ishell Shell index.
+   * @returns Configuration-space field in the shell.
+   */
+  const fftw_complex* operator[](int ishell) const;
+
+  // ---------------------------------------------------------------------
+  // Computation
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Compute and store the band-limited fields in all shells.
+   *
+   * @param field_fourier A Fourier-space field.
+   * @param ylm Reduced spherical harmonics on a mesh.
+   * @param m Order of the reduced spherical harmonic.
+   * @param binning Wavenumber binning whose bins are the shells.
+   * @param workspace Mesh field used as the transform workspace.
+   */
+  void compute_shell_fields(
+    MeshField& field_fourier,
+    const trvm::SphericalHarmonicTable& ylm, const int m,
+    trv::Binning& binning, MeshField& workspace
+  );
+
+  /**
+   * @brief Compute and store the spherical-Bessel-weighted fields in
+   *        all separation shells.
+   *
+   * @param field_fourier A Fourier-space field.
+   * @param ylm Reduced spherical harmonics on a mesh.
+   * @param m Order of the reduced spherical harmonic.
+   * @param sjl Spherical Bessel function interpolator.
+   * @param r Effective separations in shells.
+   * @param workspace Mesh field used as the transform workspace.
+   */
+  void compute_sjl_fields(
+    MeshField& field_fourier,
+    const trvm::SphericalHarmonicTable& ylm, const int m,
+    const trvm::SphericalBesselCalculator& sjl,
+    const std::vector<double>& r, MeshField& workspace
+  );
+
+ private:
+  fftw_complex* cache = nullptr;  ///< cached shell fields
+  std::size_t nbytes = 0;         ///< cache size in bytes
+};
+
+
+// ***********************************************************************
+// Binned reduction
+// ***********************************************************************
+
+/**
+ * @brief Reduction of mesh grid cell contributions into bins.
+ *
+ * The binning coordinate (wavenumber or separation) of each contribution
+ * is first sampled with a fine spacing, and the contribution is assigned
+ * to the bin containing the fine sample.  Each bin accumulates the number
+ * of contributions and the sums of their components.
+ *
+ * Instead of atomic updates of shared bins, contributions are accumulated
+ * into private partial bins, which are summed in a fixed order at the end:
+ * - "thread": one set of partial bins per thread, so binned sums are
+ *   reproducible for a fixed number of threads;
+ * - "ordered": one set of partial bins per mesh grid plane, so binned
+ *   sums do not depend on the number of threads.
+ *
+ * In either case, each mesh grid plane must be processed by a single
+ * thread in a loop parallelised over planes.
+ *
+ */
+class BinnedReduction {
+ public:
+  int num_bins;  ///< number of bins
+  int ncomp;     ///< number of summed components per bin
+  bool ordered;  ///< ordered reduction flag
+
+  /**
+   * @brief Construct the binned reduction.
+   *
+   * @param binning Binning scheme.
+   * @param n_sample Number of fine samples.
+   * @param d_sample Fine sample spacing.
+   * @param ncomp Number of summed components per bin.
+   * @param nplanes Number of mesh grid planes.
+   * @param reduction Reduction type, either "thread" or "ordered".
+   */
+  BinnedReduction(
+    trv::Binning& binning, int n_sample, double d_sample,
+    int ncomp, int nplanes, const std::string& reduction
+  );
+
+  /**
+   * @brief Return the bin index of a binning coordinate.
+   *
+   * @param coord Binning coordinate.
+   * @returns Bin index, or -1 if not in any bin.
+   */
+  int ret_bin_index(double coord) const {
+    int idx_sample = int(coord / this->d_sample);
+    if (0 <= idx_sample && idx_sample < this->n_sample) {
+      return this->sample_bins[idx_sample];
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Return the partial bin counts for a mesh grid plane.
+   *
+   * This must be called by the thread processing the plane.
+   *
+   * @param iplane (Local) mesh grid plane index.
+   * @returns Partial bin counts.
+   */
+  int* ret_partial_counts(int iplane);
+
+  /**
+   * @brief Return the partial bin sums for a mesh grid plane.
+   *
+   * This must be called by the thread processing the plane.
+   *
+   * @param iplane (Local) mesh grid plane index.
+   * @returns Partial bin sums, with @ref trv::BinnedReduction.ncomp
+   *          components for each bin.
+   */
+  double* ret_partial_sums(int iplane);
+
+  /**
+   * @brief Sum partial bins in order.
+   *
+   * @param[out] counts Bin counts.
+   * @param[out] sums Bin sums, with @ref trv::BinnedReduction.ncomp
+   *                  components for each bin.
+   */
+  void reduce(std::vector<int>& counts, std::vector<double>& sums);
+
+ private:
+  int n_sample;                      ///< number of fine samples
+  double d_sample;                   ///< fine sample spacing
+  std::vector<int> sample_bins;      ///< bin index of each fine sample
+
+  int npartials;                     ///< number of sets of partial bins
+  int stride_counts;                 ///< padded size of partial counts
+  int stride_sums;                   ///< padded size of partial sums
+  std::vector<int> partial_counts;   ///< partial bin counts
+  std::vector<double> partial_sums;  ///< partial bin sums
+
+  /**
+   * @brief Return the index of the set of partial bins for a mesh
+   *        grid plane.
+   *
+   * @param iplane (Local) mesh grid plane index.
+   * @returns Index of the set of partial bins.
+   */
+  int ret_partial_index(int iplane);
 };
 
 
@@ -672,14 +1707,16 @@ class FieldStats {
    * @param field_a First field.
    * @param field_b Second field.
    * @param ylm_a Reduced spherical harmonics over the first field mesh.
+   * @param m_a Order of the first reduced spherical harmonic.
    * @param ylm_b Reduced spherical harmonics over the second field mesh.
+   * @param m_b Order of the second reduced spherical harmonic.
    * @param shotnoise_amp Shot-noise amplitude.
    * @param rbinning Separation binning.
    */
   void compute_uncoupled_shotnoise_for_3pcf(
     MeshField& field_a, MeshField& field_b,
-    std::vector< std::complex<double> >& ylm_a,
-    std::vector< std::complex<double> >& ylm_b,
+    const trvm::SphericalHarmonicTable& ylm_a, const int m_a,
+    const trvm::SphericalHarmonicTable& ylm_b, const int m_b,
     std::complex<double> shotnoise_amp,
     trv::Binning& rbinning
   );
@@ -713,8 +1750,10 @@ class FieldStats {
    * @param field_b Second field.
    * @param ylm_a Reduced spherical harmonics over the first
    *              field mesh.
+   * @param m_a Order of the first reduced spherical harmonic.
    * @param ylm_b Reduced spherical harmonics over the second
    *              field mesh.
+   * @param m_b Order of the second reduced spherical harmonic.
    * @param sj_a First spherical Bessel function.
    * @param sj_b Second spherical Bessel function.
    * @param shotnoise_amp Shot-noise amplitude.
@@ -723,10 +1762,10 @@ class FieldStats {
    */
   std::complex<double> compute_uncoupled_shotnoise_for_bispec_per_bin(
     MeshField& field_a, MeshField& field_b,
-    std::vector< std::complex<double> >& ylm_a,
-    std::vector< std::complex<double> >& ylm_b,
-    trvm::SphericalBesselCalculator& sj_a,
-    trvm::SphericalBesselCalculator& sj_b,
+    const trvm::SphericalHarmonicTable& ylm_a, const int m_a,
+    const trvm::SphericalHarmonicTable& ylm_b, const int m_b,
+    const trvm::SphericalBesselCalculator& sj_a,
+    const trvm::SphericalBesselCalculator& sj_b,
     std::complex<double> shotnoise_amp,
     double k_a, double k_b
   );
@@ -747,19 +1786,31 @@ class FieldStats {
   double dk[3];              ///< fundamental wavenumber in each dimension
   double vol;                ///< mesh volume
   double vol_cell;           ///< mesh grid cell volume
+  int n0_local;              ///< number of local grid cells along x-axis
+  int i0_start;              ///< starting local grid index along x-axis
+  long long nmesh_local;     ///< number of local grid cells
 
   /// FFTW buffer array for pseudo-two-point statistics
   fftw_complex* twopt_3d = nullptr;
   /// FFTW plan for inverse Fourier transform
   fftw_plan inv_transform;
+  /// slab-decomposed FFT plan for inverse Fourier transform
+  trv::SlabFFTPlan* slab_inv_transform = nullptr;
   /// FFTW plan initialisation flag
   bool plan_ini = false;
 
-  /// shot-noise aliasing scale-dependence function
-  std::vector<double> alias_sn;
+  /// shot-noise aliasing function factor at grid indices along x-axis
+  std::vector<double> alias_sn_x;
+  /// shot-noise aliasing function factor at grid indices along y-axis
+  std::vector<double> alias_sn_y;
+  /// shot-noise aliasing function factor at grid indices along z-axis
+  std::vector<double> alias_sn_z;
   /// shot-noise aliasing function initialisation flag
   bool alias_ini = false;
 
+  /// wavevector geometry of the mesh grid (shared with fields)
+  std::shared_ptr<trv::WavevectorGeometry> kgeom;
+
   // ---------------------------------------------------------------------
   // Utilities
   // ---------------------------------------------------------------------
@@ -804,67 +1855,77 @@ class FieldStats {
   // ---------------------------------------------------------------------
 
   /**
-   * @brief Return the shot-noise aliasing scale-dependence function
-   *        @f$ C_1(\vec{k}) @f$ at each mesh grid.
+   * @brief Return the one-dimensional factor of the separable shot-noise
+   *        aliasing scale-dependence function @f$ C_1(\vec{k}) @f$.
    *
    * @see Eqs. (45) and (46) in Sugiyama et al. (2019)
    *      [<a href="https://arxiv.org/abs/1803.02132">1803.02132</a>]
    *      and Jing (2004)
    *      [<a href="https://arxiv.org/abs/astro-ph/0409240">astro-ph/0409240</a>].
    *
-   * @returns Aliasing function.
+   * @returns Aliasing function factor of the square-sine argument.
    */
-  std::function<double(int, int, int)> ret_calc_shotnoise_aliasing();
+  std::function<double(double)> ret_calc_shotnoise_aliasing();
 
   /**
-   * @brief Get the square-sine arguments for the shot-noise aliasing
-   *        function.
+   * @brief Get the square-sine argument for the shot-noise aliasing
+   *        function along an axis.
    *
-   * @param i, j, k Grid index in each dimension.
-   * @param cx2, cy2, cz2 Square-sine arguments.
+   * @param i Grid index along the axis.
+   * @param iaxis Axis index.
+   * @returns Square-sine argument.
    */
-  void get_shotnoise_aliasing_sin2(
-    int i, int j, int k, double& cx2, double& cy2, double& cz2
-  );
+  double ret_shotnoise_aliasing_sin2(int i, int iaxis);
 
   /**
-   * Calculate the shot-noise aliasing function for the
+   * Calculate the shot-noise aliasing function factor for the
    * nearest-grid-point (NGP) assignment scheme.
    *
-   * @param i, j, k Grid indices.
-   * @returns Function value.
+   * @param s2 Square-sine argument.
+   * @returns Function factor value.
    */
-  double calc_shotnoise_aliasing_ngp(int i, int j, int k);
+  double calc_shotnoise_aliasing_ngp(double s2);
 
   /**
-   * Calculate the shot-noise aliasing function for the
+   * Calculate the shot-noise aliasing function factor for the
    * cloud-in-cell (CIC) assignment scheme.
    *
-   * @param i, j, k Grid indices.
-   * @returns Function value.
+   * @param s2 Square-sine argument.
+   * @returns Function factor value.
    */
-  double calc_shotnoise_aliasing_cic(int i, int j, int k);
+  double calc_shotnoise_aliasing_cic(double s2);
 
   /**
-   * Calculate the shot-noise aliasing function for the
+   * Calculate the shot-noise aliasing function factor for the
    * triangular-shaped-cloud (TSC) assignment scheme.
    *
-   * @param i, j, k Grid indices.
-   * @returns Function value.
+   * @param s2 Square-sine argument.
+   * @returns Function factor value.
    */
-  double calc_shotnoise_aliasing_tsc(int i, int j, int k);
+  double calc_shotnoise_aliasing_tsc(double s2);
 
   /**
-   * Calculate the shot-noise aliasing function for the
+   * Calculate the shot-noise aliasing function factor for the
    * piecewise-cubic-spline (PCS) assignment scheme.
    *
-   * @param i, j, k Grid indices.
-   * @returns Function value.
+   * @param s2 Square-sine argument.
+   * @returns Function factor value.
+   */
+  double calc_shotnoise_aliasing_pcs(double s2);
+
+  /**
+   * @brief Return the shot-noise aliasing function at a grid cell.
+   *
+   * @param i, j, k Grid index in each dimension.
+   * @returns Aliasing function @f$ C_1(\vec{k}) @f$.
    */
-  double calc_shotnoise_aliasing_pcs(int i, int j, int k);
+  double ret_shotnoise_aliasing(int i, int j, int k) const {
+    return this->alias_sn_x[i] * this->alias_sn_y[j] * this->alias_sn_z[k];
+  }
 
   /**
-   * Compute the shot-noise aliasing function.
+   * Compute the shot-noise aliasing function factor tables along
+   * each axis.
    *
    */
   void compute_shotnoise_aliasing();
@@ -0,0 +1,149 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file jobqueue.hpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Local job queue of measurements over Unix domain sockets.
+ *
+ * This module provides the inter-process communication between
+ * the program in server mode and its local clients, including:
+ * - listening on and connecting to a Unix domain socket;
+ * - line-based reading and writing over a socket connection;
+ * - composing and parsing job requests.
+ *
+ * Each client connection submits a single job request line, which
+ * contains the client working directory followed by the program
+ * arguments of the job, separated by tabs.  The server streams the
+ * program output of the job back over the same connection, ending with
+ * a status line tagged by @ref trv::sys::JOB_STATUS_TAG.
+ */
+
+#ifndef TRIUMVIRATE_INCLUDE_JOBQUEUE_HPP_INCLUDED_
+#define TRIUMVIRATE_INCLUDE_JOBQUEUE_HPP_INCLUDED_
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "monitor.hpp"
+
+namespace trv {
+namespace sys {
+
+/// tag of the status line ending the response to a job request
+const std::string JOB_STATUS_TAG = "[TRV:JOB] Exit status:";
+
+/// job request argument for shutting down the server
+const std::string JOB_SHUTDOWN_ARG = "--shutdown";
+
+/// timeout (in seconds) for reading a job request line from a client
+const int JOB_REQUEST_TIMEOUT = 10;
+
+// ***********************************************************************
+// Socket connections
+// ***********************************************************************
+
+/**
+ * @brief Listen on a Unix domain socket.
+ *
+ * Any stale socket file at the same path is removed first.  The socket
+ * is only accessible to its owner, as submitted jobs are run with
+ * the privileges of the listening process.
+ *
+ * @param socket_path Socket file path.
+ * @param backlog Maximum number of pending connections.
+ * @returns Listening socket file descriptor.
+ * @throws trv::sys::IOError When the socket path is occupied by
+ *                           a non-socket file, or when the socket
+ *                           cannot be listened on.
+ */
+int listen_on_socket(const std::string& socket_path, int backlog = 16);
+
+/**
+ * @brief Connect to a Unix domain socket.
+ *
+ * @param socket_path Socket file path.
+ * @returns Connected socket file descriptor.
+ * @throws trv::sys::IOError When the socket cannot be connected to.
+ */
+int connect_to_socket(const std::string& socket_path);
+
+/**
+ * @brief Read a line from a socket connection.
+ *
+ * @param[in] fd Socket file descriptor.
+ * @param[out] line Line without the trailing newline.
+ * @param[in] timeout Timeout (in seconds) for reading the whole line
+ *                    (default is 0, i.e. no timeout).
+ * @returns Whether a line (possibly unterminated at the end of
+ *          the connection) has been read, which is false on a read
+ *          error or timeout.
+ */
+bool read_line(int fd, std::string& line, int timeout = 0);
+
+/**
+ * @brief Write a line to a socket connection.
+ *
+ * @param fd Socket file descriptor.
+ * @param line Line without the trailing newline.
+ * @returns Whether the line has been fully written.
+ */
+bool write_line(int fd, const std::string& line);
+
+// ***********************************************************************
+// Job requests
+// ***********************************************************************
+
+/**
+ * @brief Compose a job request line.
+ *
+ * @param cwd Working directory of the job.
+ * @param args Program arguments of the job.
+ * @returns Job request line.
+ */
+std::string compose_job_request(
+  const std::string& cwd, const std::vector<std::string>& args
+);
+
+/**
+ * @brief Parse a job request line.
+ *
+ * @param[in] request Job request line.
+ * @param[out] cwd Working directory of the job.
+ * @param[out] args Program arguments of the job.
+ * @returns Whether the job request is well-formed.
+ */
+bool parse_job_request(
+  const std::string& request, std::string& cwd,
+  std::vector<std::string>& args
+);
+
+}  // namespace trv::sys
+}  // namespace trv
+
+#endif  // !TRIUMVIRATE_INCLUDE_JOBQUEUE_HPP_INCLUDED_
@@ -25,7 +25,8 @@
  *
  * Mathematical calculations provided include:
  * - spherical Bessel functions of the first kind with interpolation;
- * - (reduced) spherical harmonics include 3-d mesh grid storage;
+ * - (reduced) spherical harmonics include 3-d mesh grid storage
+ *   and tables of all orders on a mesh grid;
  * - Wigner 3-j symbols;
  * - the gamma function and related quantities with Lanzcos approximation.
  *
@@ -34,16 +35,16 @@
 #ifndef TRIUMVIRATE_INCLUDE_MATHS_HPP_INCLUDED_
 #define TRIUMVIRATE_INCLUDE_MATHS_HPP_INCLUDED_
 
-#include <gsl/gsl_interp.h>
 #include <gsl/gsl_sf_bessel.h>
 #include <gsl/gsl_sf_coupling.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_sf_legendre.h>
 #include <gsl/gsl_sf_result.h>
-#include <gsl/gsl_spline.h>
 
 #include <cmath>
 #include <complex>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "monitor.hpp"
@@ -245,6 +246,192 @@ class SphericalHarmonicCalculator {
   );
 };
 
+/**
+ * @brief Table of reduced spherical harmonics of all orders
+ *        on a mesh grid.
+ *
+ * For a given degree @f$ \ell @f$, the reduced spherical harmonics
+ * @f$ y_\ell^m @f$ are computed with the normalised associated Legendre
+ * polynomials from their recurrence relations in @f$ \mu = \cos\theta @f$
+ * and the azimuthal phases from powers of @f$ (x - \mathrm{i} y)/r @f$.
+ * Since @f$ y_\ell^{-m} = (-1)^m {y_\ell^m}^\ast @f$, only the
+ * @f$ 2\ell + 1 @f$ real components of @f$ y_\ell^m @f$ with
+ * @f$ m \geq 0 @f$ are stored at each grid cell, in a single pass over
+ * the mesh grid and optionally in single precision.  Alternatively,
+ * no values are stored and each value is evaluated on the fly when
+ * requested, which for a fixed order is a short polynomial recurrence.
+ *
+ * The table depends only on the degree, the mesh grid, the box size
+ * and whether it is in Fourier or configuration space, and is shared
+ * through @ref trv::maths::SphericalHarmonicTable::ret_shared.
+ *
+ */
+class SphericalHarmonicTable {
+ public:
+  int ell;                ///< degree @f$ \ell @f$
+  bool fourier;           ///< Fourier-space flag
+  double boxsize[3];      ///< box size in each dimension
+  int ngrid[3];           ///< grid number in each dimension
+  long long nmesh;        ///< number of grid cells
+  bool stored = true;     ///< stored (otherwise on-the-fly) values flag
+  bool single = false;    ///< single-precision storage flag
+
+  /**
+   * @brief Construct the table of reduced spherical harmonics.
+   *
+   * @param ell Degree @f$ \ell @f$.
+   * @param fourier Fourier-space (otherwise configuration-space) flag.
+   * @param boxsize Box size in each dimension.
+   * @param ngrid Grid number in each dimension.
+   * @param stored Stored (otherwise on-the-fly) values flag
+   *               (default is `true`).
+   * @param single Single-precision storage flag (default is `false`).
+   */
+  SphericalHarmonicTable(
+    const int ell, bool fourier,
+    const double boxsize[3], const int ngrid[3],
+    bool stored = true, bool single = false
+  );
+
+  /**
+   * @brief Destruct the table of reduced spherical harmonics.
+   */
+  ~SphericalHarmonicTable();
+
+  /**
+   * @brief Return the table of reduced spherical harmonics shared
+   *        amongst all uses with the same degree and mesh grid.
+   *
+   * The table is computed only if no table for the same degree and
+   * mesh grid is currently held, and is freed when it is no longer held.
+   *
+   * @param ell Degree @f$ \ell @f$.
+   * @param fourier Fourier-space (otherwise configuration-space) flag.
+   * @param boxsize Box size in each dimension.
+   * @param ngrid Grid number in each dimension.
+   * @param stored Stored (otherwise on-the-fly) values flag
+   *               (default is `true`).
+   * @param single Single-precision storage flag (default is `false`).
+   * @returns Shared table of reduced spherical harmonics.
+   */
+  static std::shared_ptr<SphericalHarmonicTable> ret_shared(
+    const int ell, bool fourier,
+    const double boxsize[3], const int ngrid[3],
+    bool stored = true, bool single = false
+  );
+
+  /**
+   * @brief Return the memory size of stored values in a table.
+   *
+   * @param ell Degree @f$ \ell @f$.
+   * @param ngrid Grid number in each dimension.
+   * @param single Single-precision storage flag (default is `false`).
+   * @returns Memory size in gibibytes.
+   */
+  static double calc_size_in_gb(
+    const int ell, const int ngrid[3], bool single = false
+  );
+
+  /**
+   * @brief Evaluate the reduced spherical harmonic at a grid cell.
+   *
+   * @param m Order @f$ m @f$ with @f$ |m| \leq \ell @f$.
+   * @param i, j, k Grid index in each dimension.
+   * @returns Value of @f$ y_\ell^m @f$.
+   */
+  std::complex<double> eval(const int m, int i, int j, int k) const {
+    if (this->ell == 0) {return 1.;}
+
+    const int m_abs = (m < 0) ? - m : m;
+
+    std::complex<double> ylm;
+    if (this->stored) {
+      long long idx_grid =
+        (i * static_cast<long long>(this->ngrid[1]) + j) * this->ngrid[2] + k;
+      ylm = (m_abs == 0) ?
+        std::complex<double>(this->ret_comp(0, idx_grid), 0.) :
+        std::complex<double>(
+          this->ret_comp(2*m_abs - 1, idx_grid),
+          this->ret_comp(2*m_abs, idx_grid)
+        );
+    } else {
+      ylm = this->calc_nonneg_order(m_abs, i, j, k);
+    }
+
+    // Impose parity and conjugation for y_l^(-m) = (-1)^m (y_l^m)^*.
+    if (m < 0) {
+      ylm = (m_abs % 2 == 1) ? - std::conj(ylm) : std::conj(ylm);
+    }
+
+    return ylm;
+  }
+
+  /**
+   * @brief Store reduced spherical harmonics of a given order from
+   *        the table.
+   *
+   * @param[in] m Order @f$ m @f$.
+   * @param[out] ylm_out Stored @f$ y_\ell^m @f$ values.
+   * @throws trv::sys::InvalidParameterError When @p m is out of range.
+   */
+  void store_reduced_spherical_harmonic(
+    const int m, std::vector< std::complex<double> >& ylm_out
+  ) const;
+
+ private:
+  int ncomp;  ///< number of stored real components per grid cell
+  double dv[3];  ///< fundamental wavenumber or grid cell size
+
+  double norm;              ///< reduced-form normalisation
+  std::vector<double> qmm;  ///< Legendre recurrence initial values
+  std::vector<double> a_lm;  ///< Legendre recurrence coefficients
+  std::vector<double> b_lm;  ///< Legendre recurrence coefficients
+
+  /// stored real components (component-major) in double precision
+  std::vector<double> comps;
+  /// stored real components (component-major) in single precision
+  std::vector<float> comps_sp;
+
+  /**
+   * @brief Calculate the reduced spherical harmonic of a non-negative
+   *        order at a grid cell.
+   *
+   * @param m Order @f$ 0 \leq m \leq \ell @f$.
+   * @param i, j, k Grid index in each dimension.
+   * @returns Value of @f$ y_\ell^m @f$.
+   */
+  std::complex<double> calc_nonneg_order(const int m, int i, int j, int k)
+    const;
+
+  /**
+   * @brief Return a stored real component at a grid cell.
+   *
+   * @param icomp Component index.
+   * @param idx_grid Grid cell index.
+   * @returns Stored component value.
+   */
+  double ret_comp(int icomp, long long idx_grid) const {
+    long long idx = icomp * this->nmesh + idx_grid;
+    return this->single ? double(this->comps_sp[idx]) : this->comps[idx];
+  }
+
+  /**
+   * @brief Set a stored real component at a grid cell.
+   *
+   * @param icomp Component index.
+   * @param idx_grid Grid cell index.
+   * @param val Component value.
+   */
+  void set_comp(int icomp, long long idx_grid, double val) {
+    long long idx = icomp * this->nmesh + idx_grid;
+    if (this->single) {
+      this->comps_sp[idx] = float(val);
+    } else {
+      this->comps[idx] = val;
+    }
+  }
+};
+
 
 // ***********************************************************************
 // Spherical Bessel function
@@ -254,6 +441,12 @@ class SphericalHarmonicCalculator {
  * @brief Interpolated spherical Bessel function @f$ j_\ell(x) @f$
  *        of the first kind.
  *
+ * The function is tabulated once on a uniformly spaced grid together
+ * with its natural cubic spline coefficients in a flat table, so that
+ * interpolation needs no search or accelerator state.  The table is
+ * immutable and shared by copies of the calculator, which can be used
+ * concurrently by threads.
+ *
  */
 class SphericalBesselCalculator {
  public:
@@ -267,24 +460,23 @@ class SphericalBesselCalculator {
   explicit SphericalBesselCalculator(const int ell);
 
   /**
-   * @brief Copy an interpolated function calculator.
+   * @brief Evaluate the interpolated function.
    *
-   * @param other Interpolated function to be copied.
-   */
-  SphericalBesselCalculator(const SphericalBesselCalculator& other);
-
-  /**
-   * @brief Destruct the interpolated function.
+   * @param x Argument @f$ x @f$.
+   * @returns Value of @f$ j_\ell @f$.
    */
-  ~SphericalBesselCalculator();
+  double eval(double x) const;
 
   /**
-   * @brief Evaluate the interpolated function.
+   * @brief Evaluate the interpolated function at scaled arguments.
    *
-   * @param x Argument @f$ x @f$.
-   * @returns Value of @f$ j_\ell @f$.
+   * @param[in] x Arguments @f$ x_i @f$.
+   * @param[in] scale Scale factor @f$ s @f$.
+   * @param[out] j_ell Values of @f$ j_\ell(s x_i) @f$.
    */
-  double eval(double x);
+  void eval_batch(
+    const std::vector<double>& x, double scale, std::vector<double>& j_ell
+  ) const;
 
  private:
   // CAVEAT: This calculator is designed for the range of @f$ x = kr @f$
@@ -294,9 +486,19 @@ class SphericalBesselCalculator {
   // asymptotic expansion is used.
   double split = 1000.;    ///< minimum split value of @f$ x @f$
   double step = 0.05;      ///< step size of @f$ x @f$ for interpolation
+  int nsample;             ///< number of interpolation samples
 
-  gsl_interp_accel* accel;  ///< interpolation accelerator
-  gsl_spline* spline;       ///< interpolation scheme
+  /// sampled values @f$ y_i @f$ interleaved with scaled second derivatives
+  /// @f$ y''_i \Delta x^2 / 6 @f$ of the natural cubic spline
+  std::shared_ptr< const std::vector<double> > table;
+
+  /**
+   * @brief Interpolate the tabulated function.
+   *
+   * @param x Argument @f$ x < @f$ @ref split.
+   * @returns Interpolated value.
+   */
+  double interpolate(double x) const;
 };
 
 }  // namespace trv::maths
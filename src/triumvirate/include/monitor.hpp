@@ -66,8 +66,8 @@ namespace sys {
 
 // STYLE: Standard naming convention is not followed below.
 
-// RFE: Implement MPI.
 extern int currTask;  ///< current task
+extern int numTasks;  ///< number of tasks
 
 extern double gbytesMem;     ///< current memory usage in gibibytes
 extern double gbytesMaxMem;  ///< maximum memory usage in gibibytes
@@ -82,10 +82,10 @@ extern float max_count_grid;  ///< maximum number of grids
 extern int count_fft;   ///< number of FFTs
 extern int count_ifft;  ///< number of IFFTs
 
-/// wisdom import status for forward transform
-extern bool fftw_wisdom_f_imported;
-/// wisdom import status for backward transform
-extern bool fftw_wisdom_b_imported;
+/// FFTW wisdom file whose wisdom is in memory (imported or exported)
+/// for double- and single-precision transforms respectively
+extern std::string fftw_wisdom_file;
+extern std::string fftwf_wisdom_file;
 
 /**
  * @brief Return size in gibibytes.
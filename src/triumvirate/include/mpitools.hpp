@@ -0,0 +1,257 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file mpitools.hpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief MPI-based parallelisation tools.
+ *
+ * This module provides the distributed-memory (MPI) support for
+ * slab-decomposed mesh fields, including:
+ * - MPI environment initialisation and finalisation;
+ * - slab decomposition of a mesh grid dimension across tasks;
+ * - sharing of catalogue rows across tasks and their exchange;
+ * - reduction of partial sums and extrema across tasks;
+ * - transpose-based 3-d FFTs of slab-decomposed mesh grids.
+ *
+ * Without `TRV_USE_MPI`, there is a single task and all reductions and
+ * transposes are local.
+ */
+
+#ifndef TRIUMVIRATE_INCLUDE_MPITOOLS_HPP_INCLUDED_
+#define TRIUMVIRATE_INCLUDE_MPITOOLS_HPP_INCLUDED_
+
+#ifdef TRV_USE_MPI
+#include <mpi.h>
+#endif  // TRV_USE_MPI
+
+#include <fftw3.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+#include "monitor.hpp"
+
+namespace trv {
+
+// ***********************************************************************
+// MPI environment
+// ***********************************************************************
+
+namespace sys {
+
+/**
+ * @brief Initialise the MPI environment and set the current task and
+ *        the number of tasks.
+ *
+ * @param argc Pointer to the number of command-line arguments.
+ * @param argv Pointer to the command-line arguments.
+ */
+void init_mpi(int* argc, char*** argv);
+
+/**
+ * @brief Finalise the MPI environment.
+ */
+void finalise_mpi();
+
+/**
+ * @brief Allocate a share of items to the current task.
+ *
+ * The items are shared as evenly as possible amongst all tasks in
+ * task order, so a task may be allocated no items.
+ *
+ * @param[in] ntotal Total number of items.
+ * @param[out] n_local Number of items allocated to the current task.
+ * @param[out] i_start Starting item index allocated to the current task.
+ * @param[in] task Task (default is -1 for the current task).
+ */
+void allocate_share(
+  long long ntotal, long long& n_local, long long& i_start, int task = -1
+);
+
+/**
+ * @brief Allocate a slab of a mesh grid dimension to the current task.
+ *
+ * The grid cells are shared as evenly as possible amongst all tasks in
+ * task order, in the same way as tasks are allocated to processes in
+ * the Python module `triumvirate._mpitools`.
+ *
+ * @param[in] ngrid Grid number in the dimension.
+ * @param[out] n_local Number of grid cells allocated to the current task.
+ * @param[out] i_start Starting grid index allocated to the current task.
+ * @param[in] task Task (default is -1 for the current task).
+ * @throws trv::sys::InvalidParameterError When @p ngrid is less than
+ *                                         the number of tasks.
+ */
+void allocate_slab(int ngrid, int& n_local, int& i_start, int task = -1);
+
+/**
+ * @brief Sum values across all tasks in place.
+ *
+ * @param[in,out] data Values to be summed.
+ * @param[in] count Number of values.
+ */
+void allreduce_sum(double* data, int count);
+
+/**
+ * @brief Sum values across all tasks in place.
+ *
+ * @param[in,out] data Values to be summed.
+ * @param[in] count Number of values.
+ *
+ * @overload
+ */
+void allreduce_sum(int* data, int count);
+
+/**
+ * @brief Sum values across all tasks in place.
+ *
+ * @param[in,out] data Values to be summed.
+ * @param[in] count Number of values.
+ *
+ * @overload
+ */
+void allreduce_sum(long long* data, int count);
+
+/**
+ * @brief Take the minima of values across all tasks in place.
+ *
+ * @param[in,out] data Values to be minimised.
+ * @param[in] count Number of values.
+ */
+void allreduce_min(double* data, int count);
+
+/**
+ * @brief Take the maxima of values across all tasks in place.
+ *
+ * @param[in,out] data Values to be maximised.
+ * @param[in] count Number of values.
+ */
+void allreduce_max(double* data, int count);
+
+/**
+ * @brief Exchange blocks of values between all tasks.
+ *
+ * @param[in] sendbuf Send buffer holding blocks ordered by
+ *                    destination task.
+ * @param[in] sendcounts Numbers of values sent to each task.
+ * @param[out] recvbuf Receive buffer holding blocks ordered by
+ *                     source task.
+ * @throws trv::sys::InvalidParameterError When the buffers are too
+ *                                         large for MPI.
+ */
+void exchange_values(
+  const std::vector<double>& sendbuf,
+  const std::vector<long long>& sendcounts,
+  std::vector<double>& recvbuf
+);
+
+}  // namespace trv::sys
+
+
+// ***********************************************************************
+// Slab-decomposed FFT
+// ***********************************************************************
+
+/**
+ * @brief Transpose-based 3-d FFT plan for a slab-decomposed mesh grid.
+ *
+ * The mesh grid is decomposed into slabs along the first dimension,
+ * each holding a contiguous range of grid indices @f$ i @f$ in row-major
+ * order.  The 2-d transforms in the last two dimensions are performed on
+ * the local slab, which is then transposed across tasks into slabs along
+ * the second dimension so that the 1-d transforms in the first dimension
+ * are contiguous, before being transposed back.  The output therefore
+ * has the same slab decomposition and storage order as the input.
+ *
+ * Two scratch buffers, each of the size of a local slab, are allocated
+ * for the duration of each transform.
+ */
+class SlabFFTPlan {
+ public:
+  int ngrid[3];  ///< grid number in each dimension
+  int n0_local;  ///< number of local grid cells in the first dimension
+  int i0_start;  ///< starting local grid index in the first dimension
+  /// number of transposed local grid cells in the second dimension
+  int n1_local;
+  /// starting transposed local grid index in the second dimension
+  int j1_start;
+
+  /**
+   * @brief Construct the slab-decomposed FFT plan.
+   *
+   * @param ngrid Grid number in each dimension.
+   * @param sign Transform sign, either `FFTW_FORWARD` or
+   *             `FFTW_BACKWARD`.
+   * @param planner_flag FFTW planner flag.
+   */
+  SlabFFTPlan(const int ngrid[3], int sign, unsigned planner_flag);
+
+  /**
+   * @brief Destruct the slab-decomposed FFT plan.
+   */
+  ~SlabFFTPlan();
+
+  /**
+   * @brief Return the number of local grid cells.
+   *
+   * @returns Number of local grid cells.
+   */
+  long long ret_local_size();
+
+  /**
+   * @brief Execute the in-place transform of a local slab.
+   *
+   * @param grid Local slab of the mesh grid.
+   */
+  void execute(fftw_complex* grid);
+
+ private:
+  /// FFTW plan for transforms in the last two dimensions
+  fftw_plan plan_yz;
+  /// FFTW plan for transforms in the first dimension
+  fftw_plan plan_x;
+
+  long long nbuffer;  ///< number of scratch buffer elements
+
+  std::vector<int> n0_locals;  ///< @ref n0_local by task
+  std::vector<int> i0_starts;  ///< @ref i0_start by task
+  std::vector<int> n1_locals;  ///< @ref n1_local by task
+  std::vector<int> j1_starts;  ///< @ref j1_start by task
+
+  /**
+   * @brief Exchange blocks of grid cells between all tasks.
+   *
+   * @param sendbuf Send buffer holding blocks ordered by task.
+   * @param recvbuf Receive buffer holding blocks ordered by task.
+   * @param sendcounts Numbers of grid cells sent to each task.
+   * @param recvcounts Numbers of grid cells received from each task.
+   */
+  void exchange(
+    fftw_complex* sendbuf, fftw_complex* recvbuf,
+    const std::vector<long long>& sendcounts,
+    const std::vector<long long>& recvcounts
+  );
+};
+
+}  // namespace trv
+
+#endif  // !TRIUMVIRATE_INCLUDE_MPITOOLS_HPP_INCLUDED_
@@ -35,8 +35,11 @@
 #include <fftw3.h>
 
 #include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <string>
@@ -94,6 +97,11 @@ class ParameterSet {
   std::string assignment = "tsc";
   /// interlacing switch: {"true"/"on", "false"/"off" (default)}
   std::string interlace = "false";
+  /// mesh assignment engine: {"atomic" (default), "slab"}
+  std::string assignment_engine = "atomic";
+  /// floating-point precision of mesh fields: {"double" (default),
+  ///                                           "single"}
+  std::string precision = "double";
 
   // Derived mesh quantities.
   double volume = 0.;  ///< box volume (in Mpc^3/h^3)
@@ -146,6 +154,9 @@ class ParameterSet {
   /// binning scheme: {"lin" (default), "log",
   ///                  "linpad", "logpad", "custom"}
   std::string binning = "lin";
+  /// binned reduction over mesh grid cells: {"thread" (default),
+  ///                                         "ordered"}
+  std::string binning_reduction = "thread";
 
   double bin_min = 0.;  ///< measurement range minimum (in Mpc/h or h/Mpc)
   double bin_max = 0.;  ///< measurement range maximum (in Mpc/h or h/Mpc)
@@ -165,13 +176,34 @@ class ParameterSet {
   /// derived FFTW planner flag
   unsigned fftw_planner_flag = FFTW_MEASURE;
 
-  /// use FFTW wisdom: {"false" (default), <path-to-dir>}
+  /// use FFTW wisdom cache: {"false" (default), "auto", <path-to-dir>}
+  /// (see @ref trv::ParameterSet::ret_fftw_wisdom_dir_default for "auto");
+  /// the cache is opt-in as it writes files outside the measurement
+  /// directory (e.g. to home directories which may be read-only or
+  /// shared between machines with different FFTW builds on clusters)
+  /// and requires `fftw_scheme` to be "measure" or "patient"
   std::string use_fftw_wisdom = "false";
 
-  /// derived FFTW wisdom file paths
+  /// derived FFTW wisdom file paths (see
+  /// @ref trv::ParameterSet::ret_fftw_wisdom_filepath)
   std::string fftw_wisdom_file_f;  ///< forward-transform wisdom file path
   std::string fftw_wisdom_file_b;  ///< backward-transform wisdom file path
 
+  /// maximum number of mesh fields Fourier transformed together in
+  /// a batch (default is 1)
+  int fft_batch = 1;
+
+  /// memory limit (in gibibytes) above which lower-memory algorithms are
+  /// used (default is 0., i.e. no limit)
+  double memory_limit = 0.;
+
+  /// derived storage of cached shell fields (see @ref trv::MemoryPlan):
+  /// {"memory" (default), "disk"}
+  std::string shell_cache = "memory";
+  /// derived storage of spherical harmonic tables (see
+  /// @ref trv::MemoryPlan): {"double" (default), "single", "none"}
+  std::string ylm_tables = "double";
+
   /// save flag/path for detailed binning of vectors: {"true",
   ///                                                  "false" (default),
   ///                                                  <relpath-to-file>}
@@ -236,6 +268,44 @@ class ParameterSet {
    * @overload
    */
   int print_to_file();
+
+  /**
+   * @brief Return the hash of parameters which determine measurement
+   *        results.
+   *
+   * Parameters for output paths, logging, FFTW planning and memory
+   * planning are left out, so that the hash is unchanged when
+   * a measurement is resumed under different runtime conditions.
+   *
+   * @returns 64-bit FNV-1a hash.
+   */
+  std::uint64_t ret_hash();
+
+  /**
+   * @brief Return the FFTW wisdom file path in the wisdom cache
+   *        directory for transforms on the mesh grid.
+   *
+   * The file name is keyed by the precision and direction of the
+   * transforms, the mesh grid, the number of FFTW threads, the planner
+   * scheme and the FFTW version, so that wisdom is only reused under
+   * the same runtime conditions.
+   *
+   * @param sign Transform direction: {`FFTW_FORWARD`, `FFTW_BACKWARD`}.
+   * @param single Single-precision transform flag (default is `false`).
+   * @returns Wisdom file path (empty if FFTW wisdom is not used).
+   */
+  std::string ret_fftw_wisdom_filepath(int sign, bool single = false);
+
+  /**
+   * @brief Return the default FFTW wisdom cache directory.
+   *
+   * This is `$TRV_FFTW_WISDOM_DIR` if set, or otherwise
+   * `$XDG_CACHE_HOME/triumvirate/fftw_wisdom`, where `$XDG_CACHE_HOME`
+   * defaults to `$HOME/.cache`.
+   *
+   * @returns Directory path (with a trailing slash).
+   */
+  static std::string ret_fftw_wisdom_dir_default();
 };
 
 }  // namespace trv
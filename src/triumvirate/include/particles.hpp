@@ -25,24 +25,38 @@
  *
  * This module defines a particle catalogue object with I/O methods,
  * summary information and its computations, and methods to offset
- * particle coordinates (in particular in a mesh grid box).
+ * particle coordinates (in particular in a mesh grid box) and to
+ * distribute particles across MPI tasks.
  *
  */
 
 #ifndef TRIUMVIRATE_INCLUDE_PARTICLES_HPP_INCLUDED_
 #define TRIUMVIRATE_INCLUDE_PARTICLES_HPP_INCLUDED_
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <climits>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "monitor.hpp"
+#include "dataobjs.hpp"
+#include "mpitools.hpp"
 
 namespace trv {
 
@@ -58,12 +72,54 @@ struct ParticleData {
   double w;       ///< particle overall weight
 };
 
+/// binary catalogue file extension
+const std::string BINARY_CATALOGUE_EXT = ".trvbin";
+
+/// binary catalogue file magic string
+const char BINARY_CATALOGUE_MAGIC[8] = {'T', 'R', 'V', 'C', 'A', 'T', 0, 0};
+
+/// binary catalogue file format version
+const std::uint32_t BINARY_CATALOGUE_VERSION = 1;
+
+/**
+ * @brief Binary catalogue file header.
+ *
+ * A binary catalogue file consists of this header, followed by
+ * @ref ncols column descriptors (see @ref trv::BinaryCatalogueColumn)
+ * and the column data arrays.  Each data array is stored contiguously
+ * in native byte order and aligned to 64 bytes.
+ *
+ */
+struct BinaryCatalogueHeader {
+  char magic[8];          ///< magic string
+  std::uint32_t version;  ///< format version
+  std::uint32_t ncols;    ///< number of columns
+  std::uint64_t nrows;    ///< number of rows
+};
+
+/**
+ * @brief Binary catalogue file column descriptor.
+ *
+ */
+struct BinaryCatalogueColumn {
+  char name[16];           ///< column name (null-terminated)
+  std::uint32_t dtype;     ///< data type size in bytes: {4, 8}
+  std::uint32_t reserved;  ///< reserved (zero-filled)
+  std::uint64_t offset;    ///< byte offset of the data array in file
+};
+
 /**
  * @brief Particle catalogue.
  *
  * The catalogue object contains particle data and summary information,
  * as well as methods for computing its attributes.
  *
+ * With multiple MPI tasks, each task holds a share of the particles,
+ * which are its owned particles stored first, followed by any halo
+ * copies of particles owned by other tasks (see
+ * @ref trv::ParticleCatalogue::distribute_to_slabs).  Summary
+ * information is over all particles across tasks.
+ *
  */
 class ParticleCatalogue {
  public:
@@ -71,13 +127,17 @@ class ParticleCatalogue {
 
   ParticleData* pdata;  ///< particle data
 
-  int ntotal;      ///< total number of particles
-  double wtotal;   ///< total overall weight of particles
-  double wstotal;  ///< total sample weight of particles
+  int ntotal;         ///< number of particles held by the current task
+  int ntotal_owned;   ///< number of particles owned by the current task
+  int ntotal_global;  ///< total number of particles across tasks
+  double wtotal;      ///< total overall weight of particles
+  double wstotal;     ///< total sample weight of particles
 
   double pos_min[3];   ///< minimum values of particle coordinates
   double pos_max[3];   ///< maximum values of particle coordinates
   double pos_span[3];  ///< span of particle coordinates
+  /// cumulative offset subtracted from particle coordinates
+  double pos_offset[3];
 
   // ---------------------------------------------------------------------
   // Life cycle
@@ -110,9 +170,15 @@ class ParticleCatalogue {
    *            @ref trv::ParticleCatalogue.pos_max, or
    *            @ref trv::ParticleCatalogue.pos_span.
    *
-   * @param num Number of data units (i.e. particles).
+   * @param num Number of data units (i.e. particles) held by
+   *            the current task.
+   * @param num_global Total number of data units across tasks
+   *                   (default is -1 for @p num).
+   * @throws trv::sys::InvalidParameterError When @p num is negative or
+   *                                         @p num_global is
+   *                                         non-positive.
    */
-  void initialise_particles(const int num);
+  void initialise_particles(const int num, const int num_global = -1);
 
   /**
    * @brief Finalise particle data container.
@@ -148,6 +214,14 @@ class ParticleCatalogue {
   /**
    * @brief Read in a catalogue file.
    *
+   * With multiple MPI tasks, each task reads its own share of the
+   * catalogue rows in file order.
+   *
+   * Files with the extension @ref trv::BINARY_CATALOGUE_EXT are read as
+   * binary catalogues, whose column names are given in the file header
+   * so that @p catalogue_columns is not used; any other files are read
+   * as plain-text catalogues.
+   *
    * @param catalogue_filepath Catalogue file path.
    * @param catalogue_columns Catalogue data column names
    *                          (comma-separated without space).
@@ -161,6 +235,36 @@ class ParticleCatalogue {
     double volume = 0.
   );
 
+  /**
+   * @brief Convert a plain-text catalogue file to a binary
+   *        catalogue file.
+   *
+   * Only data columns with recognised field names (see
+   * @ref trv::ParticleCatalogue::load_catalogue_file) are written.
+   * The plain-text file is processed in chunks of rows so that memory
+   * usage is bounded regardless of the catalogue size.
+   *
+   * @param text_filepath Plain-text catalogue file path.
+   * @param catalogue_columns Catalogue data column names
+   *                          (comma-separated without space).
+   * @param binary_filepath Binary catalogue file path.
+   * @param single_precision If `true` (default is `false`), data
+   *                         are stored as 32-bit floats.
+   * @returns Number of rows converted.
+   * @throws trv::sys::IOError When the files cannot be read or
+   *                           written, when the plain-text file has
+   *                           no rows, or when a row has fewer
+   *                           parsable entries than the columns
+   *                           written (in which case no binary file
+   *                           is left behind).
+   */
+  static long long convert_catalogue_file(
+    const std::string& text_filepath,
+    const std::string& catalogue_columns,
+    const std::string& binary_filepath,
+    bool single_precision = false
+  );
+
   /**
    * @brief Read in particle data.
    *
@@ -203,6 +307,7 @@ class ParticleCatalogue {
    * @brief Offset particle positions by a given vector.
    *
    * The position specified by the input vector is the new origin.
+   * The offset is accumulated in @ref trv::ParticleCatalogue::pos_offset.
    *
    * @param dpos (Subtractive) offset position vector.
    */
@@ -312,6 +417,78 @@ class ParticleCatalogue {
     ParticleCatalogue& catalogue, ParticleCatalogue& catalogue_ref,
     const double boxsize[3], const int ngrid[3], const double ngrid_pad[3]
   );
+
+  // ---------------------------------------------------------------------
+  // Distribution
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Distribute particles to the MPI tasks owning the mesh slabs
+   *        they lie in.
+   *
+   * Mesh grids are decomposed into slabs along the first dimension (see
+   * @ref trv::sys::allocate_slab).  Each particle is owned by the task
+   * whose slab contains its grid cell, and is copied as a halo particle
+   * to any other tasks whose slabs lie within @p halo grid cells of it
+   * (with periodic wrapping), so that each task can assign all particles
+   * to its own slab.  Any previous halo particles are discarded, and
+   * particles are exchanged in two all-to-all communications, first for
+   * owned and then halo particles.  This is a no-op with a single task.
+   *
+   * @param boxsize Box size in each dimension.
+   * @param ngrid Grid number in each dimension.
+   * @param halo Halo width in grid cells, which should be at least the
+   *             order of the assignment scheme.
+   * @param los Lines of sight of particles (if not `nullptr`), which
+   *            are reallocated and distributed with the particles.
+   */
+  void distribute_to_slabs(
+    const double boxsize[3], const int ngrid[3], int halo,
+    LineOfSight*& los
+  );
+
+  /**
+   * @brief Distribute particles to the MPI tasks owning the mesh slabs
+   *        they lie in.
+   *
+   * @param boxsize Box size in each dimension.
+   * @param ngrid Grid number in each dimension.
+   * @param halo Halo width in grid cells.
+   *
+   * @overload
+   */
+  void distribute_to_slabs(
+    const double boxsize[3], const int ngrid[3], int halo
+  );
+
+  /**
+   * @brief Copy the owned particles of another catalogue.
+   *
+   * Halo particles are not copied, so the copied catalogue can be
+   * distributed afresh (e.g. for a different mesh grid).
+   *
+   * @param catalogue Particle catalogue.
+   */
+  void copy_owned_particles(ParticleCatalogue& catalogue);
+
+ private:
+  /**
+   * @brief Read in a binary catalogue file.
+   *
+   * The file is memory-mapped and its column data arrays are
+   * bulk-converted into particle data.
+   *
+   * @param catalogue_filepath Binary catalogue file path.
+   * @param volume Catalogue volume used for computing the default
+   *               'nz' value when the field is missing.
+   * @returns Exit status.
+   * @throws trv::sys::IOError When the file cannot be opened or mapped.
+   * @throws trv::sys::InvalidDataError When the file is not a valid
+   *                                    binary catalogue.
+   */
+  int load_catalogue_binary_file(
+    const std::string& catalogue_filepath, double volume
+  );
 };
 
 }  // namespace trv
@@ -0,0 +1,140 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file planner.hpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Memory budget planning of clustering statistic measurements.
+ *
+ * This module provides a dry-run planner which enumerates the mesh
+ * grids and auxiliary arrays held at peak by each measurement algorithm,
+ * estimates the peak memory usage and the number of FFTs, and chooses
+ * lower-memory strategies when a memory limit would be exceeded.
+ *
+ */
+
+#ifndef TRIUMVIRATE_INCLUDE_PLANNER_HPP_INCLUDED_
+#define TRIUMVIRATE_INCLUDE_PLANNER_HPP_INCLUDED_
+
+#include <fftw3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#include "monitor.hpp"
+#include "mpitools.hpp"
+#include "parameters.hpp"
+#include "maths.hpp"
+#include "particles.hpp"
+#include "dataobjs.hpp"
+#include "twopt.hpp"
+
+namespace trv {
+
+/**
+ * @brief Memory and FFT-count estimate of a measurement together with
+ *        the chosen storage strategies.
+ *
+ * Mesh grids are counted in units of complex full-size mesh grids
+ * (so that a half-complex or real mesh grid counts as one half).
+ *
+ */
+struct MemoryPlan {
+  std::string statistic_type;  ///< statistic type
+  std::string catalogue_type;  ///< catalogue type
+
+  /// storage of cached shell fields: {"memory", "disk"}
+  std::string shell_cache = "memory";
+  /// storage of spherical harmonic tables: {"double", "single", "none"}
+  std::string ylm_tables = "double";
+
+  double count_grid = 0.;          ///< mesh grids held at peak
+  double count_grid_shells = 0.;   ///< shell field caches held at peak
+  double gbytes_catalogues = 0.;   ///< catalogues and lines of sight
+  double gbytes_meshes = 0.;       ///< mesh grids (excluding shells)
+  double gbytes_shells = 0.;       ///< shell field caches in memory
+  double gbytes_tables = 0.;       ///< spherical harmonic tables
+  double gbytes_disk = 0.;         ///< shell field caches on disk
+  double gbytes_peak = 0.;         ///< estimated peak memory usage
+  long long count_fft = 0;         ///< number of forward FFTs
+  long long count_ifft = 0;        ///< number of backward FFTs
+
+  double memory_limit = 0.;        ///< memory limit (if positive)
+
+  /// estimated peak memory usage within the memory limit (if any)
+  bool within_limit = true;
+};
+
+/**
+ * @brief Estimate the peak memory usage and the number of FFTs of
+ *        a measurement with the storage strategies in a parameter set.
+ *
+ * Only the mesh grids and arrays whose sizes scale with the mesh grid
+ * or the catalogues are counted; transient allocations made before
+ * the measurement (e.g. for mesh-based normalisation) are excluded.
+ * With multiple MPI tasks, the estimate is that of the current task,
+ * which holds its own slabs of the mesh grids.
+ *
+ * @param params Parameter set.
+ * @param ntotal_data Number of data-source particles (held by
+ *                    the current task).
+ * @param ntotal_rand Number of random-source particles (held by
+ *                    the current task).
+ * @returns Memory plan.
+ */
+trv::MemoryPlan estimate_memory_usage(
+  trv::ParameterSet& params, long long ntotal_data, long long ntotal_rand
+);
+
+/**
+ * @brief Plan the storage strategies of a measurement within
+ *        the memory limit.
+ *
+ * Starting from in-memory storage of everything, the following
+ * lower-memory strategies are adopted in turn until the estimated peak
+ * memory usage is within @ref trv::ParameterSet::memory_limit:
+ * (1) streaming cached shell fields from disk;
+ * (2) storing spherical harmonic tables in single precision;
+ * (3) recomputing spherical harmonics on the fly instead of caching.
+ * The chosen strategies are set in @p params.
+ *
+ * @param[in,out] params Parameter set.
+ * @param[in] ntotal_data Number of data-source particles.
+ * @param[in] ntotal_rand Number of random-source particles.
+ * @returns Memory plan.
+ */
+trv::MemoryPlan plan_memory_usage(
+  trv::ParameterSet& params, long long ntotal_data, long long ntotal_rand
+);
+
+/**
+ * @brief Print a memory plan.
+ *
+ * @param plan Memory plan.
+ * @param fileptr Output file pointer (default is `stdout`).
+ */
+void print_memory_plan(
+  const trv::MemoryPlan& plan, std::FILE* fileptr = stdout
+);
+
+}  // namespace trv
+
+#endif  // !TRIUMVIRATE_INCLUDE_PLANNER_HPP_INCLUDED_
@@ -30,7 +30,8 @@
  * - bispectrum and three-point correlation function for paired
  *   survey-type catalogues;
  * - bispectrum and three-point correlation function for periodic-box
- *   simulation-type catalogues in the global plane-parallel approximation.
+ *   simulation-type catalogues in the global plane-parallel approximation;
+ * - checkpoints of bispectrum measurements for resumption.
  *
  */
 
@@ -41,7 +42,12 @@
 
 #include <cmath>
 #include <complex>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "monitor.hpp"
 #include "parameters.hpp"
@@ -50,6 +56,7 @@
 #include "dataobjs.hpp"
 #include "field.hpp"
 #include "twopt.hpp"
+#include "planner.hpp"
 
 namespace trv {
 
@@ -172,6 +179,123 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
 );
 
 
+// ***********************************************************************
+// Shell field products
+// ***********************************************************************
+
+/**
+ * @brief Calculate the grid products of cached shell fields in all
+ *        pairs of shells with a third field.
+ *
+ * This calculates the quantity
+ * @f[
+ *   \sum_{\vec{x}} F_{a,i}(\vec{x}) F_{b,j}(\vec{x}) G(\vec{x})
+ * @f]
+ * for all pairs of shells @f$ (i, j) @f$ in a single pass over tiles
+ * of mesh grid cells, so that the tiles of all shell fields are reused
+ * from cache for every pair instead of streaming three mesh grids from
+ * memory for each pair.  Partial sums are accumulated per thread and
+ * summed in a fixed order.
+ *
+ * @param shells_a First shell field cache.
+ * @param shells_b Second shell field cache.
+ * @param field Third (configuration-space) field.
+ * @param triu If @c true, only pairs of shells with @f$ i \leqslant j @f$
+ *             are calculated and the other pairs are zero.
+ * @returns Grid products with the pair of shells @f$ (i, j) @f$
+ *          at index @f$ i N + j @f$, where @f$ N @f$ is the number of
+ *          shells.
+ */
+std::vector<std::complex<double>> calc_shell_field_products(
+  const ShellFieldCache& shells_a, const ShellFieldCache& shells_b,
+  MeshField& field, bool triu = false
+);
+
+
+// ***********************************************************************
+// Checkpoints
+// ***********************************************************************
+
+/// bispectrum checkpoint file magic string
+const char BISPEC_CHECKPOINT_MAGIC[8] = {'T', 'R', 'V', 'C', 'K', 'P', 'T', 0};
+
+/// bispectrum checkpoint file format version
+const std::uint32_t BISPEC_CHECKPOINT_VERSION = 1;
+
+/**
+ * @brief Bispectrum checkpoint file header.
+ *
+ * A bispectrum checkpoint file consists of this header, followed by
+ * the data vector arrays of mode counts, bin centres, effective
+ * wavenumbers, raw bispectrum and shot noise (in the order of
+ * the members of @ref trv::BispecCheckpoint), each stored contiguously
+ * in native byte order.
+ *
+ */
+struct BispecCheckpointHeader {
+  char magic[8];              ///< magic string
+  std::uint32_t version;      ///< format version
+  std::int32_t dv_dim;        ///< data vector dimension
+  std::uint64_t params_hash;  ///< parameter set hash
+  std::int32_t idx_term;      ///< index of the next term to be computed
+  std::int32_t count_terms;   ///< number of computed terms
+  double norm_factor;         ///< normalisation factor
+};
+
+/**
+ * @brief Bispectrum measurement checkpoint.
+ *
+ * This holds the accumulated (unnormalised) data vector components
+ * of a bispectrum measurement, and the cursor of the loop over
+ * spherical harmonic orders @f$ (m_1, m_2, M) @f$, where each term is
+ * indexed by
+ * @f[
+ *   \left[ (m_1 + \ell_1) (2\ell_2 + 1) + (m_2 + \ell_2)
+ *   \right] (2L + 1) + (M + L) \,,
+ * @f]
+ * so that a measurement can be resumed after the last computed term.
+ *
+ */
+struct BispecCheckpoint {
+  std::uint64_t params_hash = 0;  ///< parameter set hash
+  int dv_dim = 0;                 ///< data vector dimension
+  int idx_term = 0;               ///< index of the next term to be computed
+  int count_terms = 0;            ///< number of computed terms
+  double norm_factor = 0.;        ///< normalisation factor
+
+  std::vector<int> nmodes1_dv;    ///< first wavenumber mode counts
+  std::vector<int> nmodes2_dv;    ///< second wavenumber mode counts
+  std::vector<double> k1bin_dv;   ///< first wavenumber bin centres
+  std::vector<double> k2bin_dv;   ///< second wavenumber bin centres
+  std::vector<double> k1eff_dv;   ///< first effective wavenumbers
+  std::vector<double> k2eff_dv;   ///< second effective wavenumbers
+  std::vector<std::complex<double>> bk_dv;  ///< raw bispectrum
+  std::vector<std::complex<double>> sn_dv;  ///< bispectrum shot noise
+
+  /**
+   * @brief Save the checkpoint to a file.
+   *
+   * The checkpoint is first written to a temporary file which then
+   * replaces any previous checkpoint file, so that an interrupted
+   * save leaves the previous checkpoint intact.
+   *
+   * @param filepath Checkpoint file path.
+   * @throws trv::sys::IOError When the checkpoint file cannot be written.
+   */
+  void save(const std::string& filepath) const;
+
+  /**
+   * @brief Load the checkpoint from a file.
+   *
+   * @param filepath Checkpoint file path.
+   * @returns Whether the checkpoint file exists and has been loaded.
+   * @throws trv::sys::IOError When the checkpoint file is invalid or
+   *                           truncated.
+   */
+  bool load(const std::string& filepath);
+};
+
+
 // ***********************************************************************
 // Full statistics
 // ***********************************************************************
@@ -191,13 +315,23 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
  * @param params Parameter set.
  * @param kbinning Wavenumber binning.
  * @param norm_factor Normalisation factor.
+ * @param checkpoint_filepath Checkpoint file path (default is empty,
+ *                            i.e. no checkpoints).  If non-empty,
+ *                            a checkpoint (see @ref trv::BispecCheckpoint)
+ *                            is saved after each computed term.
+ * @param resume If @c true (default is @c false), the measurement is
+ *               resumed from the checkpoint file if it exists.
  * @returns Bispectrum measurements.
+ * @throws trv::sys::InvalidParameterError When the checkpoint to resume
+ *                                         from does not match
+ *                                         the measurement.
  */
 trv::BispecMeasurements compute_bispec(
   ParticleCatalogue& catalogue_data, ParticleCatalogue& catalogue_rand,
   LineOfSight* los_data, LineOfSight* los_rand,
   trv::ParameterSet& params, trv::Binning& kbinning,
-  double norm_factor
+  double norm_factor,
+  const std::string& checkpoint_filepath = "", bool resume = false
 );
 
 /**
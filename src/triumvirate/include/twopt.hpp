@@ -30,7 +30,10 @@
  * - power spectrum and two-point correlation function for paired
  *   survey-type catalogues;
  * - power spectrum and two-point correlation function for periodic-box
- *   simulation catalogues.
+ *   simulation catalogues;
+ * - batches of power spectrum and two-point correlation function
+ *   measurements for multiple data-source catalogues paired with
+ *   the same random-source catalogue.
  *
  */
 
@@ -41,6 +44,8 @@
 #include <cmath>
 #include <complex>
 #include <cstdio>
+#include <memory>
+#include <vector>
 
 #include "monitor.hpp"
 #include "maths.hpp"
@@ -70,6 +75,69 @@ namespace trv {
  */
 double calc_coupling_coeff_2pt(int ell, int ELL, int m, int M);
 
+/**
+ * @brief Add to a spherical-harmonic component its counterpart at
+ *        negated orders.
+ *
+ * Since particle weights are real, reduced-spherical-harmonic-weighted
+ * fields at negated orders are the complex conjugates of those at
+ * the original orders up to a sign.  The counterpart component is thus
+ * the complex conjugate of the component times the parity
+ * @f$ (-1)^{\ell_k} @f$ of the reduced spherical harmonics in Fourier
+ * space, with the same coupling coefficient, so that only components
+ * at non-negative orders need to be computed.
+ *
+ * @param component Spherical-harmonic component.
+ * @param ell_k Total degree of reduced spherical harmonics
+ *              evaluated in Fourier space.
+ * @param self_mirrored Whether all orders are zero so that
+ *                      the component is its own counterpart, or
+ *                      the counterpart is computed separately; if so,
+ *                      the component is returned unchanged.
+ * @returns Spherical-harmonic component summed with its counterpart.
+ *
+ * @attention Wavevector modes on the Nyquist planes of the mesh grid
+ *            have no negated counterparts, so components in Fourier
+ *            space are mirrored only if
+ *            @ref trv::if_mirrored_in_fourier holds, and components in
+ *            configuration space only if
+ *            @ref trv::if_mirrored_in_config holds.
+ */
+std::complex<double> add_mirrored_component(
+  std::complex<double> component, int ell_k, bool self_mirrored
+);
+
+/**
+ * @brief Check whether Fourier-space spherical-harmonic components at
+ *        negated orders can be added as mirrored components.
+ *
+ * This holds if the wavenumber bins lie entirely below the Nyquist
+ * wavenumber along every axis of the mesh grid (or half a fundamental
+ * wavenumber below it for an odd number of grid cells), so that no
+ * wavevector modes without negated counterparts are binned.  Otherwise,
+ * components at all orders are computed.
+ *
+ * @param params Parameter set.
+ * @param k_max Upper edge of the last wavenumber bin.
+ * @returns Whether components at negated orders are mirrored.
+ */
+bool if_mirrored_in_fourier(trv::ParameterSet& params, double k_max);
+
+/**
+ * @brief Check whether configuration-space spherical-harmonic components
+ *        at negated orders can be added as mirrored components.
+ *
+ * Inverse Fourier transforms sum over all wavevector modes, so this
+ * holds only if interlacing is not used and the number of grid cells
+ * is even along every axis, so that field modes without negated
+ * counterparts are still Hermitian.  Otherwise, components at all
+ * orders are computed.
+ *
+ * @param params Parameter set.
+ * @returns Whether components at negated orders are mirrored.
+ */
+bool if_mirrored_in_config(trv::ParameterSet& params);
+
 
 // ***********************************************************************
 // Normalisation
@@ -316,6 +384,127 @@ trv::TwoPCFWindowMeasurements compute_corrfunc_window(
   double alpha, double norm_factor
 );
 
+
+
+// ***********************************************************************
+// Batch statistics
+// ***********************************************************************
+
+/**
+ * @brief Batch of two-point clustering measurements from multiple
+ *        data-source catalogues (e.g. mock realisations) paired with
+ *        the same survey-type random-source catalogue.
+ *
+ * The random-source fields weighted by the reduced spherical harmonics
+ * (with unit alpha contrast) and their shot noise amplitudes are
+ * computed once and held, together with the mesh field pool (with its
+ * buffers and FFTW plans), the field statistics (with the shared
+ * wavevector geometry and shot-noise aliasing) and the δn_00 mesh field,
+ * so that only the data-source work is redone for each data-source
+ * catalogue.  The measurements are the same as those from
+ * @ref trv::compute_powspec and @ref trv::compute_corrfunc.
+ *
+ * @attention (2ℓ + 2) mesh fields of the random-source catalogue, or
+ *            a single one if ℓ = 0, are held for degree ℓ of
+ *            the two-point statistic.
+ *
+ */
+class TwoPointBatch {
+ public:
+  trv::ParameterSet params;  ///< parameter set
+  double wstotal_rand;       ///< total sample weight of random particles
+
+  // ---------------------------------------------------------------------
+  // Life cycle
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Construct the batch from the random-source catalogue.
+   *
+   * @param catalogue_rand (Random-source) particle catalogue.
+   * @param los_rand (Random-source) particle lines of sight.
+   * @param params Parameter set.
+   */
+  TwoPointBatch(
+    ParticleCatalogue& catalogue_rand, LineOfSight* los_rand,
+    trv::ParameterSet& params
+  );
+
+  // Mesh fields and field statistics are owned, so copying is disallowed.
+  TwoPointBatch(const TwoPointBatch&) = delete;
+  TwoPointBatch& operator=(const TwoPointBatch&) = delete;
+
+  // ---------------------------------------------------------------------
+  // Measurements
+  // ---------------------------------------------------------------------
+
+  /**
+   * @brief Compute power spectrum from a data-source catalogue paired
+   *        with the random-source catalogue.
+   *
+   * @param catalogue_data (Data-source) particle catalogue.
+   * @param los_data (Data-source) particle lines of sight.
+   * @param kbinning Wavenumber binning.
+   * @param norm_factor Normalisation factor.
+   * @returns Power spectrum measurements.
+   */
+  trv::PowspecMeasurements compute_powspec(
+    ParticleCatalogue& catalogue_data, LineOfSight* los_data,
+    trv::Binning& kbinning, double norm_factor
+  );
+
+  /**
+   * @brief Compute two-point correlation function from a data-source
+   *        catalogue paired with the random-source catalogue.
+   *
+   * @param catalogue_data (Data-source) particle catalogue.
+   * @param los_data (Data-source) particle lines of sight.
+   * @param rbinning Separation binning.
+   * @param norm_factor Normalisation factor.
+   * @returns Two-point correlation function measurements.
+   */
+  trv::TwoPCFMeasurements compute_corrfunc(
+    ParticleCatalogue& catalogue_data, LineOfSight* los_data,
+    trv::Binning& rbinning, double norm_factor
+  );
+
+ private:
+  /// random-source field of degree and order zero
+  std::unique_ptr<MeshField> rand_00;
+  /// distinct random-source fields of degree ℓ > 0 over orders
+  /// M = 0, ..., ℓ
+  std::vector<std::unique_ptr<MeshField>> rand_LM_;
+  /// random-source fields of degree ℓ over orders M = 0, ..., ℓ
+  /// (`rand_00` if ℓ = 0)
+  std::vector<MeshField*> rand_LM;
+  /// random-source shot noise amplitudes over orders M = 0, ..., ℓ
+  std::vector<std::complex<double>> sn_amp_rand;
+
+  std::unique_ptr<MeshField> dn_00;        ///< δn_00(k)
+  std::unique_ptr<MeshFieldPool> pool;     ///< pool reused by δn_LM(k)
+  std::unique_ptr<FieldStats> stats_2pt;   ///< field statistics
+
+  /**
+   * @brief Compute and Fourier transform δn_00(k) and the batches of
+   *        δn_LM(k), and accumulate a two-point statistic over
+   *        orders M.
+   *
+   * @tparam Accumulate Callable with signature
+   *                    `void(MeshField& dn_LM, std::complex<double>
+   *                    sn_amp, int M_)` for the statistic at order M.
+   * @param catalogue_data (Data-source) particle catalogue.
+   * @param los_data (Data-source) particle lines of sight.
+   * @param mirrored Whether only non-negative orders M are computed
+   *                 (see @ref trv::add_mirrored_component).
+   * @param accumulate Accumulation at each order M.
+   */
+  template<typename Accumulate>
+  void compute_terms(
+    ParticleCatalogue& catalogue_data, LineOfSight* los_data,
+    bool mirrored, Accumulate&& accumulate
+  );
+};
+
 }  // namespace trv
 
 #endif  // !TRIUMVIRATE_INCLUDE_TWOPT_HPP_INCLUDED_
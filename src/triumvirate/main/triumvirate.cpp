@@ -25,15 +25,32 @@
  *
  */
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif  // __GLIBC__
+
+#include <cmath>
+#include <csignal>
 #include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "monitor.hpp"
+#include "mpitools.hpp"
 #include "parameters.hpp"
 #include "particles.hpp"
 #include "dataobjs.hpp"
 #include "io.hpp"
+#include "jobqueue.hpp"
+#include "planner.hpp"
 #include "twopt.hpp"
 #include "threept.hpp"
 
@@ -97,18 +114,389 @@ void _set_custom_bins(trv::Binning& _binning) {
 }
 
 /**
- * @brief A 'black-box' program for measuring two- and three-point
- *        clustering statistics.
+ * @brief Deleter of particle lines of sight, which also releases
+ *        their tracked memory usage.
+ */
+struct LineOfSightDeleter {
+  long long size = 0;  ///< number of particle lines of sight
+
+  void operator()(trv::LineOfSight* los) const {
+    delete[] los;
+    trv::sys::gbytesMem -=
+      trv::sys::size_in_gb<struct trv::LineOfSight>(this->size);
+  }
+};
+
+/// particle lines of sight released when out of scope
+using LineOfSightArray =
+  std::unique_ptr<trv::LineOfSight[], LineOfSightDeleter>;
+
+/**
+ * @brief Compute particle lines of sight.
  *
- * @param argc Number of command-line arguments.
- * @param argv Command-line arguments.
+ * @param catalogue Particle catalogue.
+ * @param source Catalogue source name: {"data", "random"}.
+ * @returns Particle lines of sight.
+ */
+LineOfSightArray _compute_lines_of_sight(
+  trv::ParticleCatalogue& catalogue, const std::string& source
+) {
+  LineOfSightArray los(
+    new trv::LineOfSight[catalogue.ntotal],
+    LineOfSightDeleter{catalogue.ntotal}
+  );
+  trv::sys::gbytesMem +=
+    trv::sys::size_in_gb<struct trv::LineOfSight>(catalogue.ntotal);
+  trv::sys::update_maxmem();
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for
+#endif  // TRV_USE_OMP
+  for (int pid = 0; pid < catalogue.ntotal; pid++) {
+    double los_mag = trv::maths::get_vec3d_magnitude(catalogue[pid].pos);
+
+    if (los_mag == 0.) {
+      trv::sys::logger.warn(
+        "A %s-catalogue particle coincides with the origin.", source.c_str()
+      );
+      los_mag = 1.;
+    }
+
+    los[pid].pos[0] = catalogue[pid].pos[0] / los_mag;
+    los[pid].pos[1] = catalogue[pid].pos[1] / los_mag;
+    los[pid].pos[2] = catalogue[pid].pos[2] / los_mag;
+  }
+
+  return los;
+}
+
+/**
+ * @brief Distribute aligned catalogue particles (together with their
+ *        lines of sight) to the MPI tasks owning their mesh slabs.
+ *
+ * @param catalogue Particle catalogue.
+ * @param los Particle lines of sight.
+ * @param params Parameter set.
+ */
+void _distribute_catalogue(
+  trv::ParticleCatalogue& catalogue, LineOfSightArray& los,
+  trv::ParameterSet& params
+) {
+  if (trv::sys::numTasks == 1) {return;}
+
+  trv::LineOfSight* los_ = los.release();
+  catalogue.distribute_to_slabs(
+    params.boxsize, params.ngrid, params.assignment_order, los_
+  );
+  los = LineOfSightArray(los_, LineOfSightDeleter{catalogue.ntotal});
+}
+
+/**
+ * @brief Calculate the mixed-mesh power spectrum normalisation factor
+ *        with the default parameters in `pypower`.
+ *
+ * @param catalogue_data (Data-source) particle catalogue.
+ * @param catalogue_rand (Random-source) particle catalogue.
+ * @param params Parameter set.
+ * @param alpha Alpha contrast.
+ * @returns Normalisation factor.
+ */
+double _calc_norm_factor_meshes(
+  trv::ParticleCatalogue& catalogue_data,
+  trv::ParticleCatalogue& catalogue_rand,
+  trv::ParameterSet& params, double alpha
+) {
+  // Use default parameters for mixed-mesh normalisation in `pypower`.
+  const double PADDING = 0.1;
+  const double CELLSIZE = 10.;
+  const std::string ASSIGNMENT = "cic";
+  // Box size for normalisation is internally set and as such,
+  // the current alignment of the catalogues is not applicable, but
+  // this should have no effect on the normalisation.
+  return trv::calc_powspec_normalisation_from_meshes(
+    catalogue_data, catalogue_rand, params, alpha,
+    PADDING, CELLSIZE, ASSIGNMENT
+  );
+}
+
+/**
+ * @brief Select the normalisation factor by convention.
+ *
+ * @param params Parameter set.
+ * @param norm_factor_part Particle-based normalisation factor.
+ * @param norm_factor_mesh Mesh-based normalisation factor.
+ * @param norm_factor_meshes Mixed-mesh-based normalisation factor.
+ * @returns Normalisation factor.
+ */
+double _select_norm_factor(
+  trv::ParameterSet& params,
+  double norm_factor_part, double norm_factor_mesh, double norm_factor_meshes
+) {
+  double norm_factor = 0.;
+  if (params.norm_convention == "none") {
+    norm_factor = 1.;
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.info(
+        "Normalisation factors: "
+        "%.6e (particle), %.6e (mesh), %.6e (mesh-mixed) (none used).",
+        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      );
+    }
+  } else
+  if (params.norm_convention == "particle") {
+    norm_factor = norm_factor_part;
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.info(
+        "Normalisation factors: "
+        "%.6e (particle; used), %.6e (mesh), %.6e (mesh-mixed).",
+        norm_factor, norm_factor_mesh, norm_factor_meshes
+      );
+    }
+  } else
+  if (params.norm_convention == "mesh") {
+    norm_factor = norm_factor_mesh;
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.info(
+        "Normalisation factors: "
+        "%.6e (particle), %.6e (mesh; used), %.6e (mesh-mixed).",
+        norm_factor_part, norm_factor, norm_factor_meshes
+      );
+    }
+  } else
+  if (params.norm_convention == "mesh-mixed") {
+    norm_factor = norm_factor_meshes;
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.info(
+        "Normalisation factors: "
+        "%.6e (particle), %.6e (mesh), %.6e (mesh-mixed; used).",
+        norm_factor_part, norm_factor_mesh, norm_factor
+      );
+    }
+  }
+
+  return norm_factor;
+}
+
+/**
+ * @brief Read the list of data-source catalogue files for
+ *        batch measurements.
+ *
+ * Each line of the list file contains a catalogue file path
+ * (relative to @ref trv::ParameterSet::catalogue_dir unless absolute),
+ * optionally followed by an output tag, which by default is the
+ * catalogue file name stem preceded by an underscore.  Blank lines and
+ * lines starting with '#' are skipped.
+ *
+ * @param[in] list_filepath Catalogue list file path.
+ * @param[in] params Parameter set.
+ * @param[out] catalogue_files Data-source catalogue file paths.
+ * @param[out] output_tags Output tags.
  * @returns Exit status.
  */
-int main(int argc, char* argv[]) {
-#ifdef TRV_USE_LOGO
-  trv::sys::display_prog_notice();
-  // trv::sys::display_prog_licence();
-#endif  // TRV_USE_LOGO
+int _read_batch_list(
+  const std::string& list_filepath, trv::ParameterSet& params,
+  std::vector<std::string>& catalogue_files,
+  std::vector<std::string>& output_tags
+) {
+  std::ifstream fin(list_filepath.c_str());
+  if (!fin.is_open()) {return 1;}
+
+  std::string line_str;
+  while (std::getline(fin, line_str)) {
+    std::istringstream iss(line_str);
+    std::string catalogue_file, output_tag;
+    if (!(iss >> catalogue_file) || catalogue_file.find("#") == 0) {
+      continue;
+    }  // skip blank and comment lines
+
+    if (!(iss >> output_tag)) {
+      std::string stem = catalogue_file.substr(
+        catalogue_file.find_last_of("/") + 1
+      );
+      output_tag = "_" + stem.substr(0, stem.find_last_of("."));
+    }
+    if (catalogue_file.rfind("/", 0) != 0) {
+      catalogue_file = params.catalogue_dir + catalogue_file;
+    }
+
+    catalogue_files.push_back(catalogue_file);
+    output_tags.push_back(output_tag);
+  }
+
+  return catalogue_files.empty() ? 1 : 0;
+}
+
+/**
+ * @brief Measure two-point statistics for a batch of data-source
+ *        catalogues paired with the same random-source catalogue.
+ *
+ * The first data-source catalogue has been loaded and aligned together
+ * with the random-source catalogue, and its normalisation factors
+ * computed.  Each subsequent data-source catalogue is loaded and offset
+ * in the same way as the first one, and its normalisation factors are
+ * computed with the random-source catalogue, where the mesh-based
+ * normalisation is computed only once for unit alpha contrast.
+ * Random-source fields are reused (see @ref trv::TwoPointBatch) and
+ * one measurement file is saved for each data-source catalogue.
+ *
+ * @param params Parameter set.
+ * @param binning Binning.
+ * @param catalogue_data First (data-source) particle catalogue.
+ * @param los_data First (data-source) particle lines of sight.
+ * @param catalogue_rand (Random-source) particle catalogue.
+ * @param los_rand (Random-source) particle lines of sight.
+ * @param norm_factors First normalisation factors: {particle-based,
+ *                     mesh-based, mixed-mesh-based, used}.
+ * @param catalogue_files Data-source catalogue file paths.
+ * @param output_tags Output tags.
+ */
+void _measure_in_batch(
+  trv::ParameterSet& params, trv::Binning& binning,
+  trv::ParticleCatalogue& catalogue_data, trv::LineOfSight* los_data,
+  trv::ParticleCatalogue& catalogue_rand, trv::LineOfSight* los_rand,
+  const double norm_factors[4],
+  const std::vector<std::string>& catalogue_files,
+  const std::vector<std::string>& output_tags
+) {
+  trv::TwoPointBatch batch(catalogue_rand, los_rand, params);
+
+  // Mesh-based normalisation with unit alpha contrast.
+  double norm_factor_mesh_unit = 0.;
+  if (catalogue_files.size() > 1) {
+    norm_factor_mesh_unit = trv::calc_powspec_normalisation_from_mesh(
+      catalogue_rand, params, 1.
+    );
+  }
+
+  for (std::size_t icat = 0; icat < catalogue_files.size(); icat++) {
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.stat(
+        "[MAIN:TRV:B] Measuring data-source catalogue %zu of %zu: %s",
+        icat + 1, catalogue_files.size(), catalogue_files[icat].c_str()
+      );
+    }
+
+    trv::ParticleCatalogue catalogue_mock;  // subsequent catalogue
+    LineOfSightArray los_mock;              // subsequent catalogue LoS
+    trv::ParticleCatalogue* catalogue_ = &catalogue_data;
+    trv::LineOfSight* los_ = los_data;
+
+    double norm_factor_part = norm_factors[0];
+    double norm_factor_mesh = norm_factors[1];
+    double norm_factor_meshes = norm_factors[2];
+    double norm_factor = norm_factors[3];
+    if (icat > 0) {
+      if (catalogue_mock.load_catalogue_file(
+        catalogue_files[icat], params.catalogue_columns, params.volume
+      )) {
+        if (trv::sys::currTask == 0) {
+          trv::sys::logger.error(
+            "Failed to measure in batch: "
+            "unloadable data-source catalogue file."
+          );
+        }
+        throw trv::sys::IOError(
+          "Failed to measure in batch: "
+          "unloadable data-source catalogue file.\n"
+        );
+      }
+      // Lines of sight are computed before alignment.
+      los_mock = _compute_lines_of_sight(catalogue_mock, "data");
+      catalogue_mock.offset_coords(catalogue_rand.pos_offset);
+      _distribute_catalogue(catalogue_mock, los_mock, params);
+      los_ = los_mock.get();
+      catalogue_ = &catalogue_mock;
+
+      double alpha = catalogue_mock.wstotal / catalogue_rand.wstotal;
+      if (trv::sys::currTask == 0) {
+        trv::sys::logger.info("Alpha contrast: %.6e.", alpha);
+      }
+
+      norm_factor_part = trv::calc_powspec_normalisation_from_particles(
+        catalogue_rand, alpha
+      );
+      norm_factor_mesh = norm_factor_mesh_unit / std::pow(alpha, 2);
+      norm_factor_meshes = 0.;
+      if (params.norm_convention == "mesh-mixed") {
+        norm_factor_meshes = _calc_norm_factor_meshes(
+          catalogue_mock, catalogue_rand, params, alpha
+        );
+      }
+      norm_factor = _select_norm_factor(
+        params, norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      );
+    }
+
+    char save_filepath[1024];
+    std::FILE* save_fileptr = nullptr;
+    if (params.statistic_type == "powspec") {
+      std::snprintf(
+        save_filepath, sizeof(save_filepath), "%s/pk%d%s%s",
+        params.measurement_dir.c_str(), params.ELL,
+        params.output_tag.c_str(), output_tags[icat].c_str()
+      );
+      trv::PowspecMeasurements meas_powspec = batch.compute_powspec(
+        *catalogue_, los_, binning, norm_factor
+      );  // power spectrum
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, *catalogue_, catalogue_rand,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+        trv::io::print_measurement_datatab_to_file(
+          save_fileptr, params, meas_powspec
+        );
+        std::fclose(save_fileptr);
+      }
+    } else
+    if (params.statistic_type == "2pcf") {
+      std::snprintf(
+        save_filepath, sizeof(save_filepath), "%s/xi%d%s%s",
+        params.measurement_dir.c_str(), params.ELL,
+        params.output_tag.c_str(), output_tags[icat].c_str()
+      );
+      trv::TwoPCFMeasurements meas_2pcf = batch.compute_corrfunc(
+        *catalogue_, los_, binning, norm_factor
+      );  // two-point correlation function
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, *catalogue_, catalogue_rand,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+        trv::io::print_measurement_datatab_to_file(
+          save_fileptr, params, meas_2pcf
+        );
+        std::fclose(save_fileptr);
+      }
+    }
+
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.info("Measurements saved to: %s", save_filepath);
+    }
+  }
+}
+
+/**
+ * @brief Run the program for a single set of program arguments.
+ *
+ * See @ref main for the program arguments.  In persistent mode (as a
+ * job of the program in server mode), the mesh grid geometry,
+ * spherical harmonic tables and FFTW wisdom of the job are kept warm
+ * in @p warm_cache and memory for the next job instead of being
+ * cleaned up.
+ *
+ * @param args Program arguments (excluding the program name).
+ * @param warm_cache Shared objects kept warm between jobs (default is
+ *                   `nullptr`, i.e. not in persistent mode).
+ * @returns Exit status.
+ */
+int _run_program(
+  const std::vector<std::string>& args,
+  std::vector<std::shared_ptr<void>>* warm_cache = nullptr
+) {
+  bool persistent = (warm_cache != nullptr);  // persistent mode flag
 
   if (trv::sys::currTask == 0) {
     std::printf("%s\n", std::string(80, '>').c_str());
@@ -132,7 +520,7 @@ int main(int argc, char* argv[]) {
     trv::sys::logger.stat("[MAIN:TRV:A] Reading parameters...");
   }
 
-  if (argc < 2) {
+  if (args.empty()) {
     if (trv::sys::currTask == 0) {
       trv::sys::logger.error(
         "Failed to initialise program: missing parameter file."
@@ -143,8 +531,22 @@ int main(int argc, char* argv[]) {
     }
   }
 
-  trv::ParameterSet params;  // program parameters
-  if (params.read_from_file(argv[1])) {
+  bool dry_run = false;        // dry-run flag
+  bool checkpoint = false;     // checkpoint flag
+  bool resume = false;         // resumption flag
+  std::string batch_filepath;  // batch catalogue list file
+  for (std::size_t iarg = 1; iarg < args.size(); iarg++) {
+    if (args[iarg] == "--dry-run") {dry_run = true;}
+    if (args[iarg] == "--checkpoint") {checkpoint = true;}
+    if (args[iarg] == "--resume") {checkpoint = true; resume = true;}
+    if (args[iarg] == "--batch" && iarg + 1 < args.size()) {
+      batch_filepath = args[++iarg];
+    }
+  }
+
+  std::string param_filepath = args[0];  // parameter file path
+  trv::ParameterSet params;              // program parameters
+  if (params.read_from_file(param_filepath.data())) {
     if (trv::sys::currTask == 0) {
       trv::sys::logger.error(
         "Failed to initialise program: invalidated parameters."
@@ -155,8 +557,65 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  std::vector<std::string> batch_catalogue_files;  // batch catalogue files
+  std::vector<std::string> batch_output_tags;      // batch output tags
+  bool batch = !batch_filepath.empty();            // batch flag
+  if (batch) {
+    if (
+      params.catalogue_type != "survey"
+      || (params.statistic_type != "powspec" && params.statistic_type != "2pcf")
+    ) {
+      if (trv::sys::currTask == 0) {
+        trv::sys::logger.error(
+          "Batch measurements are only supported for two-point statistics "
+          "from survey-type catalogues: `statistic_type` = '%s'.",
+          params.statistic_type.c_str()
+        );
+      }
+      throw trv::sys::InvalidParameterError(
+        "Batch measurements are only supported for two-point statistics "
+        "from survey-type catalogues: `statistic_type` = '%s'.\n",
+        params.statistic_type.c_str()
+      );
+    }
+    if (_read_batch_list(
+      batch_filepath, params, batch_catalogue_files, batch_output_tags
+    )) {
+      if (trv::sys::currTask == 0) {
+        trv::sys::logger.error(
+          "Failed to initialise program: "
+          "unreadable or empty batch catalogue list file."
+        );
+      }
+      throw trv::sys::IOError(
+        "Failed to initialise program: "
+        "unreadable or empty batch catalogue list file.\n"
+      );
+    }
+    params.data_catalogue_file = batch_catalogue_files[0];
+  }
+
+  if (checkpoint) {
+    if (
+      params.catalogue_type != "survey" || params.statistic_type != "bispec"
+    ) {
+      if (trv::sys::currTask == 0) {
+        trv::sys::logger.error(
+          "Checkpoints are only supported for bispectrum measurements "
+          "from survey-type catalogues: `statistic_type` = '%s'.",
+          params.statistic_type.c_str()
+        );
+      }
+      throw trv::sys::InvalidParameterError(
+        "Checkpoints are only supported for bispectrum measurements "
+        "from survey-type catalogues: `statistic_type` = '%s'.\n",
+        params.statistic_type.c_str()
+      );
+    }
+  }
+
   trv::sys::make_write_dir(params.measurement_dir);
-  if (params.print_to_file()) {
+  if (trv::sys::currTask == 0 && params.print_to_file()) {
     if (trv::sys::currTask == 0) {
       trv::sys::logger.warn(
         "Failed to print used parameters to file "
@@ -251,6 +710,65 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  // ---------------------------------------------------------------------
+  // A.3 Memory planning
+  // ---------------------------------------------------------------------
+
+  trv::MemoryPlan plan = trv::plan_memory_usage(
+    params, catalogue_data.ntotal, catalogue_rand.ntotal
+  );  // memory plan
+
+  if (trv::sys::currTask == 0) {
+    trv::sys::logger.info(
+      "Estimated peak memory usage: %.3f gibibytes "
+      "(shell field caches in %s, spherical harmonic tables in %s); "
+      "estimated number of FFTs: %lld forward, %lld backward.",
+      plan.gbytes_peak, plan.shell_cache.c_str(), plan.ylm_tables.c_str(),
+      plan.count_fft, plan.count_ifft
+    );
+    if (!plan.within_limit) {
+      trv::sys::logger.warn(
+        "Estimated peak memory usage (%.3f gibibytes) exceeds "
+        "the memory limit (%.3f gibibytes) even with "
+        "lower-memory strategies.",
+        plan.gbytes_peak, params.memory_limit
+      );
+    }
+  }
+
+  if (dry_run) {
+    if (trv::sys::currTask == 0) {
+      trv::print_memory_plan(plan);
+      std::printf("%s\n", std::string(80, '<').c_str());
+    }
+
+    return 0;
+  }
+
+  // Acquire the shared objects of this job before releasing those of
+  // the previous job, so that any identical ones are reused.
+  if (persistent) {
+    std::vector<std::shared_ptr<void>> warm_cache_job;
+    warm_cache_job.push_back(
+      trv::WavevectorGeometry::ret_shared(params, params.ngrid[0], 0)
+    );
+    if (params.npoint == "3pt") {
+      bool ylm_stored = (params.ylm_tables != "none");
+      bool ylm_single = (params.ylm_tables == "single");
+      for (int ell : {params.ell1, params.ell2}) {
+        for (bool fourier : {true, false}) {
+          warm_cache_job.push_back(
+            trv::maths::SphericalHarmonicTable::ret_shared(
+              ell, fourier, params.boxsize, params.ngrid,
+              ylm_stored, ylm_single
+            )
+          );
+        }
+      }
+    }
+    *warm_cache = std::move(warm_cache_job);
+  }
+
   if (params.use_fftw_wisdom != "") {
     trv::sys::make_write_dir(params.use_fftw_wisdom);
   }
@@ -294,60 +812,14 @@ int main(int argc, char* argv[]) {
     }
   }
 
-  trv::LineOfSight* los_data = nullptr;
+  LineOfSightArray los_data;  // data-source LoS
   if (flag_data == "true") {
-    // data-source LoS
-    los_data = new trv::LineOfSight[catalogue_data.ntotal];
-    trv::sys::gbytesMem +=
-      trv::sys::size_in_gb<struct trv::LineOfSight>(catalogue_data.ntotal);
-    trv::sys::update_maxmem();
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-    for (int pid = 0; pid < catalogue_data.ntotal; pid++) {
-      double los_mag =
-        trv::maths::get_vec3d_magnitude(catalogue_data[pid].pos);
-
-      if (los_mag == 0.) {
-        trv::sys::logger.warn(
-          "A data-catalogue particle coincides with the origin."
-        );
-        los_mag = 1.;
-      }
-
-      los_data[pid].pos[0] = catalogue_data[pid].pos[0] / los_mag;
-      los_data[pid].pos[1] = catalogue_data[pid].pos[1] / los_mag;
-      los_data[pid].pos[2] = catalogue_data[pid].pos[2] / los_mag;
-    }
+    los_data = _compute_lines_of_sight(catalogue_data, "data");
   }
 
-  trv::LineOfSight* los_rand = nullptr;
+  LineOfSightArray los_rand;  // random-source LoS
   if (flag_rand == "true") {
-    // random-source LoS
-    los_rand = new trv::LineOfSight[catalogue_rand.ntotal];
-    trv::sys::gbytesMem +=
-      trv::sys::size_in_gb<struct trv::LineOfSight>(catalogue_rand.ntotal);
-    trv::sys::update_maxmem();
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-    for (int pid = 0; pid < catalogue_rand.ntotal; pid++) {
-      double los_mag =
-        trv::maths::get_vec3d_magnitude(catalogue_rand[pid].pos);
-
-      if (los_mag == 0.) {
-        trv::sys::logger.warn(
-          "A random-catalogue particle coincides with the origin."
-        );
-        los_mag = 1.;
-      }
-
-      los_rand[pid].pos[0] = catalogue_rand[pid].pos[0] / los_mag;
-      los_rand[pid].pos[1] = catalogue_rand[pid].pos[1] / los_mag;
-      los_rand[pid].pos[2] = catalogue_rand[pid].pos[2] / los_mag;
-    }
+    los_rand = _compute_lines_of_sight(catalogue_rand, "random");
   }
 
   if (params.catalogue_type != "none") {
@@ -426,6 +898,14 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  // Particles are assigned to mesh slabs only once aligned.
+  if (flag_data == "true") {
+    _distribute_catalogue(catalogue_data, los_data, params);
+  }
+  if (flag_rand == "true") {
+    _distribute_catalogue(catalogue_rand, los_rand, params);
+  }
+
   if (params.catalogue_type != "none") {
     if (trv::sys::currTask == 0) {
       trv::sys::logger.stat(
@@ -464,18 +944,14 @@ int main(int argc, char* argv[]) {
       catalogue_for_norm, params, alpha_for_norm
     );
     // Mixed-mesh normalisation is only implemented for
-    // paired survey-like catalogues.
-    if (params.catalogue_type == "survey") {
-      // Use default parameters for mixed-mesh normalisation in `pypower`.
-      const double PADDING = 0.1;
-      const double CELLSIZE = 10.;
-      const std::string ASSIGNMENT = "cic";
-      // Box size for normalisation is internally set and as such,
-      // the current alignment of the catalogues is not applicable, but
-      // this should have no effect on the normalisation.
-      norm_factor_meshes = trv::calc_powspec_normalisation_from_meshes(
-        catalogue_data, catalogue_rand, params, alpha,
-        PADDING, CELLSIZE, ASSIGNMENT
+    // paired survey-like catalogues (and only computed in batch
+    // measurements if used).
+    if (
+      params.catalogue_type == "survey"
+      && (!batch || params.norm_convention == "mesh-mixed")
+    ) {
+      norm_factor_meshes = _calc_norm_factor_meshes(
+        catalogue_data, catalogue_rand, params, alpha
       );
     }
   } else
@@ -490,46 +966,9 @@ int main(int argc, char* argv[]) {
 
   double norm_factor = 0.;
   if (params.npoint != "none") {
-    if (params.norm_convention == "none") {
-      norm_factor = 1.;
-      if (trv::sys::currTask == 0) {
-        trv::sys::logger.info(
-          "Normalisation factors: "
-          "%.6e (particle), %.6e (mesh), %.6e (mesh-mixed) (none used).",
-          norm_factor_part, norm_factor_mesh, norm_factor_meshes
-        );
-      }
-    } else
-    if (params.norm_convention == "particle") {
-      norm_factor = norm_factor_part;
-      if (trv::sys::currTask == 0) {
-        trv::sys::logger.info(
-          "Normalisation factors: "
-          "%.6e (particle; used), %.6e (mesh), %.6e (mesh-mixed).",
-          norm_factor, norm_factor_mesh, norm_factor_meshes
-        );
-      }
-    } else
-    if (params.norm_convention == "mesh") {
-      norm_factor = norm_factor_mesh;
-      if (trv::sys::currTask == 0) {
-        trv::sys::logger.info(
-          "Normalisation factors: "
-          "%.6e (particle), %.6e (mesh; used), %.6e (mesh-mixed).",
-          norm_factor_part, norm_factor, norm_factor_meshes
-        );
-      }
-    } else
-    if (params.norm_convention == "mesh-mixed") {
-      norm_factor = norm_factor_meshes;
-      if (trv::sys::currTask == 0) {
-        trv::sys::logger.info(
-          "Normalisation factors: "
-          "%.6e (particle), %.6e (mesh), %.6e (mesh-mixed; used).",
-          norm_factor_part, norm_factor_mesh, norm_factor
-        );
-      }
-    }
+    norm_factor = _select_norm_factor(
+      params, norm_factor_part, norm_factor_mesh, norm_factor_meshes
+    );
   }
 
   // ---------------------------------------------------------------------
@@ -537,6 +976,20 @@ int main(int argc, char* argv[]) {
   // ---------------------------------------------------------------------
 
   char save_filepath[1024];
+  if (batch) {
+    double norm_factors[4] = {
+      norm_factor_part, norm_factor_mesh, norm_factor_meshes, norm_factor
+    };
+    _measure_in_batch(
+      params, binning,
+      catalogue_data, los_data.get(), catalogue_rand, los_rand.get(),
+      norm_factors, batch_catalogue_files, batch_output_tags
+    );
+    std::snprintf(
+      save_filepath, sizeof(save_filepath), "%s",
+      params.measurement_dir.c_str()
+    );
+  } else
   if (params.statistic_type == "powspec") {
     std::snprintf(
       save_filepath, sizeof(save_filepath), "%s/pk%d%s",
@@ -546,29 +999,35 @@ int main(int argc, char* argv[]) {
     trv::PowspecMeasurements meas_powspec;  // power spectrum
     if (params.catalogue_type == "survey") {
       meas_powspec = trv::compute_powspec(
-        catalogue_data, catalogue_rand, los_data, los_rand,
+        catalogue_data, catalogue_rand, los_data.get(), los_rand.get(),
         params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data, catalogue_rand,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
-      );
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data, catalogue_rand,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
     } else
     if (params.catalogue_type == "sim") {
       meas_powspec = trv::compute_powspec_in_gpp_box(
         catalogue_data, params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
+    }
+    if (trv::sys::currTask == 0) {
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_powspec
       );
+      std::fclose(save_fileptr);
     }
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_powspec
-    );
-    std::fclose(save_fileptr);
   } else
   if (params.statistic_type == "2pcf") {
     std::snprintf(
@@ -579,29 +1038,35 @@ int main(int argc, char* argv[]) {
     trv::TwoPCFMeasurements meas_2pcf;  // two-point correlation function
     if (params.catalogue_type == "survey") {
       meas_2pcf = trv::compute_corrfunc(
-        catalogue_data, catalogue_rand, los_data, los_rand,
+        catalogue_data, catalogue_rand, los_data.get(), los_rand.get(),
         params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data, catalogue_rand,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
-      );
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data, catalogue_rand,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
     } else
     if (params.catalogue_type == "sim") {
       meas_2pcf = trv::compute_corrfunc_in_gpp_box(
         catalogue_data, params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
+    }
+    if (trv::sys::currTask == 0) {
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_2pcf
       );
+      std::fclose(save_fileptr);
     }
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_2pcf
-    );
-    std::fclose(save_fileptr);
   } else
   if (params.statistic_type == "2pcf-win") {
     std::snprintf(
@@ -610,17 +1075,19 @@ int main(int argc, char* argv[]) {
     );
 
     trv::TwoPCFWindowMeasurements meas_2pcf_win = trv::compute_corrfunc_window(
-      catalogue_rand, los_rand, params, binning, alpha, norm_factor
+      catalogue_rand, los_rand.get(), params, binning, alpha, norm_factor
     );  // two-point correlation function window
-    std::FILE* save_fileptr = std::fopen(save_filepath, "w");
-    trv::io::print_measurement_header_to_file(
-      save_fileptr, params, catalogue_rand,
-      norm_factor_part, norm_factor_mesh, norm_factor_meshes
-    );
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_2pcf_win
-    );
-    std::fclose(save_fileptr);
+    if (trv::sys::currTask == 0) {
+      std::FILE* save_fileptr = std::fopen(save_filepath, "w");
+      trv::io::print_measurement_header_to_file(
+        save_fileptr, params, catalogue_rand,
+        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      );
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_2pcf_win
+      );
+      std::fclose(save_fileptr);
+    }
   } else
   if (params.statistic_type == "bispec") {
     if (params.form == "full" || params.form == "diag") {
@@ -648,33 +1115,46 @@ int main(int argc, char* argv[]) {
         params.output_tag.c_str()
       );
     }
+    std::string checkpoint_filepath =
+      checkpoint ? std::string(save_filepath) + ".ckpt" : "";
     std::FILE* save_fileptr = nullptr;
     trv::BispecMeasurements meas_bispec;  // bispectrum
     if (params.catalogue_type == "survey") {
       meas_bispec = trv::compute_bispec(
-        catalogue_data, catalogue_rand, los_data, los_rand,
-        params, binning, norm_factor
-      );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data, catalogue_rand,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        catalogue_data, catalogue_rand, los_data.get(), los_rand.get(),
+        params, binning, norm_factor, checkpoint_filepath, resume
       );
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data, catalogue_rand,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
     } else
     if (params.catalogue_type == "sim") {
       meas_bispec = trv::compute_bispec_in_gpp_box(
         catalogue_data, params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
+    }
+    if (trv::sys::currTask == 0) {
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_bispec
       );
+      std::fclose(save_fileptr);
+    }
+
+    // Remove the checkpoint once the measurement is saved.
+    if (checkpoint && trv::sys::currTask == 0) {
+      std::remove(checkpoint_filepath.c_str());
     }
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_bispec
-    );
-    std::fclose(save_fileptr);
   } else
   if (params.statistic_type == "3pcf") {
     if (params.form == "full" || params.form == "diag") {
@@ -706,29 +1186,35 @@ int main(int argc, char* argv[]) {
     trv::ThreePCFMeasurements meas_3pcf;  // three-point correlation function
     if (params.catalogue_type == "survey") {
       meas_3pcf = trv::compute_3pcf(
-        catalogue_data, catalogue_rand, los_data, los_rand,
+        catalogue_data, catalogue_rand, los_data.get(), los_rand.get(),
         params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data, catalogue_rand,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
-      );
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data, catalogue_rand,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
     } else
     if (params.catalogue_type == "sim") {
       meas_3pcf = trv::compute_3pcf_in_gpp_box(
         catalogue_data, params, binning, norm_factor
       );
-      save_fileptr = std::fopen(save_filepath, "w");
-      trv::io::print_measurement_header_to_file(
-        save_fileptr, params, catalogue_data,
-        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      if (trv::sys::currTask == 0) {
+        save_fileptr = std::fopen(save_filepath, "w");
+        trv::io::print_measurement_header_to_file(
+          save_fileptr, params, catalogue_data,
+          norm_factor_part, norm_factor_mesh, norm_factor_meshes
+        );
+      }
+    }
+    if (trv::sys::currTask == 0) {
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_3pcf
       );
+      std::fclose(save_fileptr);
     }
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_3pcf
-    );
-    std::fclose(save_fileptr);
   } else
   if (params.statistic_type == "3pcf-win") {
     if (params.form == "full" || params.form == "diag") {
@@ -759,17 +1245,19 @@ int main(int argc, char* argv[]) {
     bool wa = false;
 
     trv::ThreePCFWindowMeasurements meas_3pcf_win = trv::compute_3pcf_window(
-      catalogue_rand, los_rand, params, binning, alpha, norm_factor, wa
+      catalogue_rand, los_rand.get(), params, binning, alpha, norm_factor, wa
     );  // three-point correlation function window
-    std::FILE* save_fileptr = std::fopen(save_filepath, "w");
-    trv::io::print_measurement_header_to_file(
-      save_fileptr, params, catalogue_rand,
-      norm_factor_part, norm_factor_mesh, norm_factor_meshes
-    );
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_3pcf_win
-    );
-    std::fclose(save_fileptr);
+    if (trv::sys::currTask == 0) {
+      std::FILE* save_fileptr = std::fopen(save_filepath, "w");
+      trv::io::print_measurement_header_to_file(
+        save_fileptr, params, catalogue_rand,
+        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      );
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_3pcf_win
+      );
+      std::fclose(save_fileptr);
+    }
   } else
   if (params.statistic_type == "3pcf-win-wa") {
     if (params.form == "full" || params.form == "diag") {
@@ -805,20 +1293,22 @@ int main(int argc, char* argv[]) {
 
     trv::ThreePCFWindowMeasurements meas_3pcf_win_wa =
       trv::compute_3pcf_window(
-        catalogue_rand, los_rand, params, binning, alpha, norm_factor, wa
+        catalogue_rand, los_rand.get(), params, binning, alpha, norm_factor, wa
       );  // three-point correlation function window wide-angle corrections
-    std::FILE* save_fileptr = std::fopen(save_filepath, "w");
-    trv::io::print_measurement_header_to_file(
-      save_fileptr, params, catalogue_rand,
-      norm_factor_part, norm_factor_mesh, norm_factor_meshes
-    );
-    trv::io::print_measurement_datatab_to_file(
-      save_fileptr, params, meas_3pcf_win_wa
-    );
-    std::fclose(save_fileptr);
+    if (trv::sys::currTask == 0) {
+      std::FILE* save_fileptr = std::fopen(save_filepath, "w");
+      trv::io::print_measurement_header_to_file(
+        save_fileptr, params, catalogue_rand,
+        norm_factor_part, norm_factor_mesh, norm_factor_meshes
+      );
+      trv::io::print_measurement_datatab_to_file(
+        save_fileptr, params, meas_3pcf_win_wa
+      );
+      std::fclose(save_fileptr);
+    }
   }
 
-  if (params.save_binned_vectors != "") {
+  if (params.save_binned_vectors != "" && trv::sys::currTask == 0) {
     trv::FieldStats binning_meshgrid(params, false);
     trv::BinnedVectors binned_vectors = binning_meshgrid.record_binned_vectors(
       binning, params.save_binned_vectors
@@ -843,25 +1333,22 @@ int main(int argc, char* argv[]) {
     trv::sys::logger.stat("[MAIN:TRV:C] Data objects are being cleared.");
   }
 
-  // Clear persistent and dynamic memory.
+  // Clear persistent (unless kept warm) and dynamic memory.
+  if (!persistent) {
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
-  fftw_cleanup_threads();
+    fftw_cleanup_threads();
+    fftwf_cleanup_threads();
 #else  // !TRV_USE_OMP || !TRV_USE_FFTWOMP
-  fftw_cleanup();
+    fftw_cleanup();
+    fftwf_cleanup();
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+  }
 
   catalogue_data.finalise_particles();
   catalogue_rand.finalise_particles();
 
-  if (los_data != nullptr) {
-    delete[] los_data; los_data = nullptr;
-  }
-  if (los_rand != nullptr) {
-    delete[] los_rand; los_rand = nullptr;
-  }
-  trv::sys::gbytesMem -= trv::sys::size_in_gb<struct trv::LineOfSight>(
-    (catalogue_data.ntotal + catalogue_rand.ntotal)
-  );
+  los_data.reset();
+  los_rand.reset();
 
   if (trv::sys::count_fft > 0 || trv::sys::count_ifft > 0) {
     if (trv::sys::currTask == 0) {
@@ -893,7 +1380,8 @@ int main(int argc, char* argv[]) {
       trv::sys::gbytesMaxMem
     );
   }
-  if (trv::sys::gbytesMem > 0.) {
+  // Shared objects kept warm are not counted as uncleared memory.
+  if (trv::sys::gbytesMem > 0. && !persistent) {
     if (trv::sys::currTask == 0) {
       trv::sys::logger.warn(
         "Uncleared dynamically allocated memory: %.1f gibibytes.",
@@ -908,3 +1396,304 @@ int main(int argc, char* argv[]) {
 
   return 0;
 }
+
+/**
+ * @brief Run a job of the program in server mode.
+ *
+ * The program output of the job is redirected to the client connection
+ * and ends with a status line tagged by @ref trv::sys::JOB_STATUS_TAG.
+ * The job is run in its client working directory.
+ *
+ * @param fd_client Client connection socket file descriptor.
+ * @param cwd Working directory of the job.
+ * @param args Program arguments of the job.
+ * @param warm_cache Shared objects kept warm between jobs.
+ * @returns Exit status of the job.
+ */
+int _run_job(
+  int fd_client, const std::string& cwd, const std::vector<std::string>& args,
+  std::vector<std::shared_ptr<void>>* warm_cache
+) {
+  std::vector<char> cwd_server(4096);  // server working directory
+  if (getcwd(cwd_server.data(), cwd_server.size()) == nullptr) {
+    cwd_server[0] = '\0';
+  }
+
+  std::fflush(stdout);
+  int fd_stdout = dup(STDOUT_FILENO);
+  dup2(fd_client, STDOUT_FILENO);
+
+  // Reset per-job tracking.
+  trv::sys::gbytesMaxMem = trv::sys::gbytesMem;
+  trv::sys::count_fft = 0;
+  trv::sys::count_ifft = 0;
+  trv::sys::max_count_rgrid = trv::sys::count_rgrid;
+  trv::sys::max_count_cgrid = trv::sys::count_cgrid;
+  trv::sys::max_count_grid = trv::sys::count_grid;
+
+  int status = 1;  // job exit status
+  if (chdir(cwd.c_str()) == 0) {
+    try {
+      status = _run_program(args, warm_cache);
+    } catch (const std::exception& e) {
+      std::printf("%s", e.what());
+      status = 1;
+    }
+  } else {
+    std::printf(
+      "Failed to change to job working directory: %s\n", cwd.c_str()
+    );
+  }
+
+  std::printf("%s %d\n", trv::sys::JOB_STATUS_TAG.c_str(), status);
+  std::fflush(stdout);
+  dup2(fd_stdout, STDOUT_FILENO);
+  close(fd_stdout);
+
+  trv::sys::logger.reset_level(trv::sys::LogLevel::NSET);
+
+  if (cwd_server[0] != '\0' && chdir(cwd_server.data()) != 0) {
+    trv::sys::logger.warn("Failed to restore server working directory.");
+  }
+
+  return status;
+}
+
+/**
+ * @brief Serve jobs of the program submitted to a local socket.
+ *
+ * Usage: triumvirate --serve <socket-path> [--concurrency <n>]
+ *                    [--keep-buffers]
+ *
+ * Each job is submitted by a client (e.g. `trvclient`) with the
+ * program arguments (see @ref main), and its program output is
+ * streamed back to the client.  Jobs are run sequentially in the
+ * server process by default, where the mesh grid geometry, spherical
+ * harmonic tables and FFTW wisdom are kept warm between jobs.
+ * With `--keep-buffers` (and on glibc only), freed mesh grid buffers
+ * are also kept mapped for reuse by the next job, so the memory
+ * footprint of the server process does not shrink between jobs.
+ * With `--concurrency`, up to @f$ n > 1 @f$ jobs are run concurrently,
+ * each in a forked worker process which does not share warm objects
+ * with other jobs.  The server is shut down by
+ * a job with the program argument @ref trv::sys::JOB_SHUTDOWN_ARG.
+ * Clients that do not send a complete job request line within
+ * @ref trv::sys::JOB_REQUEST_TIMEOUT seconds are dropped.
+ * As jobs are run with the server's user privileges, the socket is only
+ * accessible to its owner (see @ref trv::sys::listen_on_socket).
+ *
+ * @param args Program arguments (excluding the program name).
+ * @returns Exit status.
+ */
+int _serve_jobs(const std::vector<std::string>& args) {
+  if (args.size() < 2) {
+    trv::sys::logger.error(
+      "Failed to start server: missing socket file path."
+    );
+    throw trv::sys::IOError(
+      "Failed to start server: missing socket file path.\n"
+    );
+  }
+  std::string socket_path = args[1];  // socket file path
+
+  int concurrency = 1;       // maximum number of concurrent jobs
+  bool keep_buffers = false;  // keep freed buffers flag
+  for (std::size_t iarg = 2; iarg < args.size(); iarg++) {
+    if (args[iarg] == "--concurrency" && iarg + 1 < args.size()) {
+      concurrency = std::atoi(args[++iarg].c_str());
+    }
+    if (args[iarg] == "--keep-buffers") {keep_buffers = true;}
+  }
+  if (concurrency < 1) {
+    trv::sys::logger.error(
+      "Invalid job concurrency: %d (must be positive).", concurrency
+    );
+    throw trv::sys::InvalidParameterError(
+      "Invalid job concurrency: %d (must be positive).\n", concurrency
+    );
+  }
+
+  // Jobs in server mode are run by a single task.
+  if (trv::sys::numTasks > 1) {
+    if (trv::sys::currTask == 0) {
+      trv::sys::logger.error(
+        "Server mode is unsupported with multiple MPI tasks."
+      );
+    }
+    throw trv::sys::UnimplementedError(
+      "Server mode is unsupported with multiple MPI tasks.\n"
+    );
+  }
+
+  // Ignore disconnected clients.
+  std::signal(SIGPIPE, SIG_IGN);
+
+#ifdef __GLIBC__
+  // Keep freed mesh grid buffers mapped for reuse by the next job.
+  if (keep_buffers && concurrency == 1) {
+    mallopt(M_MMAP_MAX, 0);
+    mallopt(M_TRIM_THRESHOLD, -1);
+  }
+#endif  // __GLIBC__
+
+  int fd_server = trv::sys::listen_on_socket(socket_path);
+
+  trv::sys::logger.stat(
+    "Serving jobs on socket '%s' (concurrency: %d).",
+    socket_path.c_str(), concurrency
+  );
+
+  std::vector<std::shared_ptr<void>> warm_cache;  // shared objects kept warm
+  int nworkers = 0;                               // number of live workers
+  int count_jobs = 0;                             // number of jobs
+  bool serving = true;                            // serving flag
+  while (serving) {
+    // Reap finished workers, and wait for one if all are busy.
+    while (nworkers > 0) {
+      int options = (nworkers < concurrency) ? WNOHANG : 0;
+      if (waitpid(-1, nullptr, options) <= 0) {break;}
+      nworkers--;
+    }
+
+    int fd_client = accept(fd_server, nullptr, nullptr);
+    if (fd_client < 0) {
+      if (errno == EINTR) {continue;}
+      trv::sys::logger.warn(
+        "Failed to accept client connection: %s.", std::strerror(errno)
+      );
+      continue;
+    }
+
+    // Clients that do not send a complete job request in time are
+    // dropped, so that an idle client cannot stall the server.
+    std::string request;           // job request line
+    std::string cwd;               // job working directory
+    std::vector<std::string> job;  // job program arguments
+    if (
+      !trv::sys::read_line(
+        fd_client, request, trv::sys::JOB_REQUEST_TIMEOUT
+      )
+      || !trv::sys::parse_job_request(request, cwd, job)
+    ) {
+      trv::sys::write_line(fd_client, "Malformed job request.");
+      trv::sys::write_line(fd_client, trv::sys::JOB_STATUS_TAG + " 1");
+      close(fd_client);
+      continue;
+    }
+
+    if (job[0] == trv::sys::JOB_SHUTDOWN_ARG) {
+      trv::sys::logger.stat("Server is shutting down.");
+      trv::sys::write_line(fd_client, trv::sys::JOB_STATUS_TAG + " 0");
+      close(fd_client);
+      serving = false;
+      continue;
+    }
+
+    count_jobs++;
+    trv::sys::logger.stat(
+      "Running job %d: '%s' in '%s'.",
+      count_jobs, job[0].c_str(), cwd.c_str()
+    );
+
+    if (concurrency == 1) {
+      int status = _run_job(fd_client, cwd, job, &warm_cache);
+      trv::sys::logger.stat(
+        "Finished job %d with exit status %d.", count_jobs, status
+      );
+    } else {
+      std::fflush(stdout);  // avoid duplicated buffered output
+      pid_t pid = fork();
+      if (pid == 0) {
+        close(fd_server);
+        int status = _run_job(fd_client, cwd, job, &warm_cache);
+        close(fd_client);
+        _exit(status);
+      }
+      if (pid < 0) {
+        trv::sys::write_line(fd_client, "Failed to start job worker.");
+        trv::sys::write_line(fd_client, trv::sys::JOB_STATUS_TAG + " 1");
+      } else {
+        nworkers++;
+      }
+    }
+
+    close(fd_client);
+  }
+
+  while (nworkers > 0 && waitpid(-1, nullptr, 0) > 0) {nworkers--;}
+
+  close(fd_server);
+  unlink(socket_path.c_str());
+
+  warm_cache.clear();
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftw_cleanup_threads();
+  fftwf_cleanup_threads();
+#else  // !TRV_USE_OMP || !TRV_USE_FFTWOMP
+  fftw_cleanup();
+  fftwf_cleanup();
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+
+  trv::sys::logger.stat("Served %d job(s).", count_jobs);
+
+  return 0;
+}
+
+/**
+ * @brief A 'black-box' program for measuring two- and three-point
+ *        clustering statistics.
+ *
+ * Usage: triumvirate <parameter-file> [--dry-run] [--batch <list-file>]
+ *                    [--checkpoint] [--resume]
+ *        triumvirate --serve <socket-path> [--concurrency <n>]
+ *                    [--keep-buffers]
+ *
+ * With `--dry-run`, the memory plan of the measurement is printed
+ * (see @ref trv::plan_memory_usage) after the catalogues are read,
+ * and the program exits before any measurement.
+ *
+ * With `--batch`, two-point statistics are measured from survey-type
+ * catalogues for each data-source catalogue listed in the list file
+ * (see @ref _read_batch_list) in place of `data_catalogue_file`, paired
+ * with the same random-source catalogue whose fields are only computed
+ * once (see @ref _measure_in_batch).  The measurement file name of each
+ * data-source catalogue has its output tag appended.  The mixed-mesh
+ * normalisation, which depends on the data-source catalogue, is only
+ * computed if it is used.
+ *
+ * With `--checkpoint`, bispectrum measurements from survey-type
+ * catalogues save a checkpoint after each computed term to the
+ * measurement file path with the '.ckpt' extension appended, which is
+ * removed once the measurement file is saved.  With `--resume` (which
+ * implies `--checkpoint`), the measurement is resumed from the
+ * checkpoint if it exists, provided that the parameters and catalogues
+ * are unchanged (see @ref trv::compute_bispec).
+ *
+ * With `--serve`, the program runs in server mode and measures jobs
+ * submitted to a local socket (see @ref _serve_jobs).
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
+ * @returns Exit status.
+ */
+int main(int argc, char* argv[]) {
+  trv::sys::init_mpi(&argc, &argv);
+
+#ifdef TRV_USE_LOGO
+  trv::sys::display_prog_notice();
+  // trv::sys::display_prog_licence();
+#endif  // TRV_USE_LOGO
+
+  std::vector<std::string> args(argv + 1, argv + argc);  // program arguments
+
+  int status = 0;  // exit status
+  if (!args.empty() && args[0] == "--serve") {
+    status = _serve_jobs(args);
+  } else {
+    status = _run_program(args);
+  }
+
+  trv::sys::finalise_mpi();
+
+  return status;
+}
@@ -0,0 +1,127 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file trvclient.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Submit jobs to the Triumvirate program in server mode.
+ *
+ * Usage: trvclient <socket-path> <parameter-file> [--dry-run]
+ *                  [--batch <list-file>]
+ *        trvclient <socket-path> --shutdown
+ *
+ * The parameter file is validated before the job is submitted to
+ * the server listening on the socket (started with
+ * `triumvirate --serve <socket-path>`).  The program output of the job
+ * is streamed to the standard output, and the exit status is that of
+ * the job.
+ */
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "jobqueue.hpp"
+
+/**
+ * @brief Submit a job to the program in server mode.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
+ * @returns Exit status.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::fprintf(
+      stderr,
+      "Usage: %s <socket-path> <parameter-file> [--dry-run] "
+      "[--batch <list-file>]\n"
+      "       %s <socket-path> --shutdown\n",
+      argv[0], argv[0]
+    );
+    return 1;
+  }
+
+  std::string socket_path = argv[1];
+  std::vector<std::string> args(argv + 2, argv + argc);
+
+  if (args[0] != trv::sys::JOB_SHUTDOWN_ARG) {
+    std::string param_filepath = args[0];
+    trv::ParameterSet params;
+    try {
+      // Reading from file ends with `trv::ParameterSet::validate`,
+      // which derives parameters in place and so is not repeated.
+      if (params.read_from_file(param_filepath.data())) {
+        std::fprintf(
+          stderr, "Invalid parameter file: %s\n", args[0].c_str()
+        );
+        return 1;
+      }
+    } catch (const std::exception& e) {
+      std::fprintf(stderr, "%s", e.what());
+      return 1;
+    }
+  }
+
+  std::vector<char> cwd(4096);
+  if (getcwd(cwd.data(), cwd.size()) == nullptr) {
+    std::fprintf(stderr, "Failed to get the current working directory.\n");
+    return 1;
+  }
+
+  int fd = -1;
+  try {
+    fd = trv::sys::connect_to_socket(socket_path);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "%s", e.what());
+    return 1;
+  }
+  if (!trv::sys::write_line(
+    fd, trv::sys::compose_job_request(cwd.data(), args)
+  )) {
+    std::fprintf(stderr, "Failed to submit job to server.\n");
+    close(fd);
+    return 1;
+  }
+
+  int status = 1;
+  std::string line;
+  while (trv::sys::read_line(fd, line)) {
+    if (line.compare(
+      0, trv::sys::JOB_STATUS_TAG.size(), trv::sys::JOB_STATUS_TAG
+    ) == 0) {
+      status = std::atoi(
+        line.substr(trv::sys::JOB_STATUS_TAG.size()).c_str()
+      );
+      break;
+    }
+    std::printf("%s\n", line.c_str());
+    std::fflush(stdout);
+  }
+
+  close(fd);
+
+  return status;
+}
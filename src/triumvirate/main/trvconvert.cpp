@@ -0,0 +1,102 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file trvconvert.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Convert plain-text catalogue files to binary catalogue files.
+ *
+ * Usage: trvconvert <text-file> <catalogue-columns> [<binary-file>]
+ *                   [--float32]
+ *
+ * If the binary catalogue file path is not given, it is derived from
+ * the plain-text catalogue file path by replacing its extension with
+ * @ref trv::BINARY_CATALOGUE_EXT.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "monitor.hpp"
+#include "particles.hpp"
+
+/**
+ * @brief Convert a plain-text catalogue file to a binary catalogue file.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
+ * @returns Exit status.
+ */
+int main(int argc, char* argv[]) {
+  std::vector<std::string> args;
+  bool single_precision = false;
+  for (int iarg = 1; iarg < argc; iarg++) {
+    std::string arg = argv[iarg];
+    if (arg == "--float32") {
+      single_precision = true;
+    } else {
+      args.push_back(arg);
+    }
+  }
+
+  if (args.size() < 2 || args.size() > 3) {
+    std::fprintf(
+      stderr,
+      "Usage: %s <text-file> <catalogue-columns> [<binary-file>] "
+      "[--float32]\n",
+      argv[0]
+    );
+    return 1;
+  }
+
+  std::string text_filepath = args[0];
+  std::string catalogue_columns = args[1];
+  std::string binary_filepath;
+  if (args.size() == 3) {
+    binary_filepath = args[2];
+  } else {
+    std::size_t pos_ext = text_filepath.find_last_of('.');
+    std::size_t pos_dir = text_filepath.find_last_of('/');
+    if (
+      pos_ext == std::string::npos
+      || (pos_dir != std::string::npos && pos_ext < pos_dir)
+    ) {
+      pos_ext = text_filepath.size();
+    }
+    binary_filepath =
+      text_filepath.substr(0, pos_ext) + trv::BINARY_CATALOGUE_EXT;
+  }
+
+  trv::sys::logger.stat(
+    "Converting catalogue file '%s' to binary catalogue file '%s'...",
+    text_filepath.c_str(), binary_filepath.c_str()
+  );
+
+  long long nrows = trv::ParticleCatalogue::convert_catalogue_file(
+    text_filepath, catalogue_columns, binary_filepath, single_precision
+  );
+
+  trv::sys::logger.stat(
+    "... converted catalogue file with %lld rows (%s precision).",
+    nrows, single_precision ? "single" : "double"
+  );
+
+  return 0;
+}
@@ -0,0 +1,199 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file trvwisdom.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ * @brief Pre-generate FFTW wisdom in the wisdom cache for mesh grids.
+ *
+ * Usage: trvwisdom <grid-sizes> [--wisdom-dir <dir>]
+ *                  [--scheme <fftw-scheme>] [--fft-batch <n>] [--float32]
+ *
+ * The grid sizes are comma-separated, each either a single grid number
+ * for cubic mesh grids or three grid numbers joined by 'x'
+ * (e.g. '256,512x512x1024').  The wisdom cache directory defaults to
+ * 'auto' (see @ref trv::ParameterSet::ret_fftw_wisdom_dir_default), and
+ * the FFTW scheme defaults to 'measure' ('patient' is also accepted).
+ * Wisdom is generated for the complex-to-complex and real-to-complex
+ * transforms (and their inverses) shared by mesh fields, and for the
+ * batched forward transforms of mesh fields with or without interlacing
+ * in batches of up to `--fft-batch` fields (default 1; see
+ * @ref trv::ParameterSet::fft_batch), in single precision with
+ * `--float32` and otherwise in double precision, with the number of
+ * threads of the current environment.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "field.hpp"
+
+/**
+ * @brief Pre-generate FFTW wisdom for a list of mesh grids.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
+ * @returns Exit status.
+ */
+int main(int argc, char* argv[]) {
+  std::string grid_sizes;
+  std::string wisdom_dir = "auto";
+  std::string fftw_scheme = "measure";
+  int fft_batch = 1;
+  bool single_precision = false;
+  for (int iarg = 1; iarg < argc; iarg++) {
+    std::string arg = argv[iarg];
+    if (arg == "--wisdom-dir" && iarg + 1 < argc) {
+      wisdom_dir = argv[++iarg];
+    } else
+    if (arg == "--scheme" && iarg + 1 < argc) {
+      fftw_scheme = argv[++iarg];
+    } else
+    if (arg == "--fft-batch" && iarg + 1 < argc) {
+      fft_batch = std::atoi(argv[++iarg]);
+    } else
+    if (arg == "--float32") {
+      single_precision = true;
+    } else
+    if (grid_sizes.empty()) {
+      grid_sizes = arg;
+    } else {
+      grid_sizes.clear();
+      break;
+    }
+  }
+
+  if (
+    grid_sizes.empty()
+    || (fftw_scheme != "measure" && fftw_scheme != "patient")
+    || fft_batch < 1
+  ) {
+    std::fprintf(
+      stderr,
+      "Usage: %s <grid-sizes> [--wisdom-dir <dir>] "
+      "[--scheme {measure,patient}] [--fft-batch <n>] [--float32]\n",
+      argv[0]
+    );
+    return 1;
+  }
+
+  // Parse comma-separated grid sizes.
+  std::vector<std::vector<int>> ngrids;
+  std::stringstream grid_sizes_ss(grid_sizes);
+  std::string grid_size;
+  while (std::getline(grid_sizes_ss, grid_size, ',')) {
+    int ngrid[3] = {0, 0, 0};
+    int nparsed = std::sscanf(
+      grid_size.c_str(), "%dx%dx%d", &ngrid[0], &ngrid[1], &ngrid[2]
+    );
+    if (nparsed == 1) {ngrid[1] = ngrid[2] = ngrid[0];}
+    if (
+      (nparsed != 1 && nparsed != 3)
+      || ngrid[0] < 2 || ngrid[1] < 2 || ngrid[2] < 2
+    ) {
+      std::fprintf(stderr, "Invalid grid size: %s\n", grid_size.c_str());
+      return 1;
+    }
+    ngrids.push_back({ngrid[0], ngrid[1], ngrid[2]});
+  }
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftw_init_threads();
+  fftwf_init_threads();
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+
+  // Batch sizes of batched transforms: a single field (with its shadow
+  // field if interlacing is used) for each mesh field, and up to
+  // `fft_batch` fields (and their shadow fields) for mesh field batches.
+  std::set<int> nbatches;
+  for (int nfields = 1; nfields <= fft_batch; nfields++) {
+    nbatches.insert(nfields);
+    nbatches.insert(2*nfields);
+  }
+
+  trv::ParameterSet params;
+  params.fftw_scheme = fftw_scheme;
+  params.fft_batch = fft_batch;
+  params.fftw_planner_flag =
+    (fftw_scheme == "patient") ? FFTW_PATIENT : FFTW_MEASURE;
+  params.use_fftw_wisdom = (wisdom_dir == "auto")
+    ? trv::ParameterSet::ret_fftw_wisdom_dir_default()
+    : wisdom_dir + "/";
+  params.verbose = 20;  // STAT
+
+  trv::sys::logger.reset_level(params.verbose);
+
+  for (const std::vector<int>& ngrid : ngrids) {
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      params.ngrid[iaxis] = ngrid[iaxis];
+    }
+    params.nmesh = static_cast<long long>(ngrid[0]) * ngrid[1] * ngrid[2];
+
+    trv::sys::logger.stat(
+      "Generating FFTW wisdom for %dx%dx%d mesh grids (%s, %s precision)...",
+      ngrid[0], ngrid[1], ngrid[2], fftw_scheme.c_str(),
+      single_precision ? "single" : "double"
+    );
+
+    // Plans are generated (and wisdom exported) by the mesh field pool
+    // exactly as for mesh fields in measurements.
+    trv::MeshFieldPool pool(params);
+    for (bool r2c : {false, true}) {
+      if (single_precision) {
+        fftwf_plan transform, inv_transform;
+        pool.ret_plans(r2c, transform, inv_transform);
+        for (int nbatch : nbatches) {
+          pool.ret_batch_plan_sp(r2c, nbatch);
+        }
+      } else {
+        fftw_plan transform, inv_transform;
+        pool.ret_plans(r2c, transform, inv_transform);
+        for (int nbatch : nbatches) {
+          pool.ret_batch_plan(r2c, nbatch);
+        }
+      }
+    }
+
+    // Export the forward wisdom once all forward transforms are planned,
+    // as planning from imported wisdom for small mesh grids may be too
+    // quick for new wisdom to be detected and exported.
+    trv::export_fftw_wisdom(params, FFTW_FORWARD, false, 0., single_precision);
+
+    trv::sys::logger.stat(
+      "... generated FFTW wisdom: %s",
+      params.ret_fftw_wisdom_filepath(FFTW_FORWARD, single_precision).c_str()
+    );
+  }
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftw_cleanup_threads();
+  fftwf_cleanup_threads();
+#else  // !TRV_USE_OMP || !TRV_USE_FFTWOMP
+  fftw_cleanup();
+  fftwf_cleanup();
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+
+  return 0;
+}
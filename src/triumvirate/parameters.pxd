@@ -34,6 +34,8 @@ cdef extern from "include/parameters.hpp":
 
         string assignment
         string interlace
+        string assignment_engine
+        string precision
         int assignment_order
 
         # -- Measurement -------------------------------------------------
@@ -47,6 +49,7 @@ cdef extern from "include/parameters.hpp":
         string norm_convention
 
         string binning
+        string binning_reduction
 
         int ell1
         int ell2
@@ -68,6 +71,8 @@ cdef extern from "include/parameters.hpp":
         string use_fftw_wisdom
         string fftw_wisdom_file_f
         string fftw_wisdom_file_b
+        int fft_batch
+        double memory_limit
         # string save_binned_vectors
         int verbose
 
@@ -42,6 +42,8 @@ _TMPL_PARAM_DICT = {
     'padfactor': None,
     'assignment': 'tsc',
     'interlace': False,
+    'assignment_engine': 'atomic',
+    'precision': 'double',
     'catalogue_type': None,
     'statistic_type': None,
     'degrees': {'ell1': None, 'ell2': None, 'ELL': None},
@@ -49,11 +51,14 @@ _TMPL_PARAM_DICT = {
     'form': 'diag',
     'norm_convention': 'particle',
     'binning': 'lin',
+    'binning_reduction': 'thread',
     'range': [None, None],
     'num_bins': None,
     'idx_bin': None,
     'fftw_scheme': 'measure',
     'use_fftw_wisdom': False,
+    'fft_batch': 1,
+    'memory_limit': 0.,
     'save_binned_vectors': False,
     'verbose': 20,
 }
@@ -398,6 +403,12 @@ cdef class ParameterSet:
         if self._params['interlace'] is not None:  # possibly convert from bool
             self.thisptr.interlace = \
                 str(self._params['interlace']).lower().encode('utf-8')
+        if self._params['assignment_engine'] is not None:
+            self.thisptr.assignment_engine = \
+                self._params['assignment_engine'].lower().encode('utf-8')
+        if self._params['precision'] is not None:
+            self.thisptr.precision = \
+                self._params['precision'].lower().encode('utf-8')
 
         # Attribute derived parameters.
         self.thisptr.volume = np.prod(list(self._params['boxsize'].values()))
@@ -465,6 +476,9 @@ cdef class ParameterSet:
         if self._params['binning'] is not None:
             self.thisptr.binning = \
                 self._params['binning'].lower().encode('utf-8')
+        if self._params['binning_reduction'] is not None:
+            self.thisptr.binning_reduction = \
+                self._params['binning_reduction'].lower().encode('utf-8')
 
         # Attribute otherwise-derived parameters.
         assignment_order_ = self._params.get('assignment_order', 0)
@@ -491,6 +505,16 @@ cdef class ParameterSet:
             self.thisptr.use_fftw_wisdom = \
                 self._params['use_fftw_wisdom'].encode('utf-8')
 
+        if self._params['fft_batch'] is None:
+            self.thisptr.fft_batch = 1
+        else:
+            self.thisptr.fft_batch = self._params['fft_batch']
+
+        if self._params['memory_limit'] is None:
+            self.thisptr.memory_limit = 0.
+        else:
+            self.thisptr.memory_limit = self._params['memory_limit']
+
         if self._params['verbose'] is None:
             self.thisptr.verbose = 20
         else:
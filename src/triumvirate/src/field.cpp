@@ -32,227 +32,926 @@ namespace trvm = trv::maths;
 namespace trv {
 
 // ***********************************************************************
-// Mesh field
+// FFTW wisdom
+// ***********************************************************************
+
+bool import_fftw_wisdom(trv::ParameterSet& params, int sign, bool single) {
+  std::string wisdom_filepath = params.ret_fftw_wisdom_filepath(sign, single);
+  if (wisdom_filepath.empty()) {return false;}
+
+  std::string& wisdom_file_in_memory =
+    single ? trvs::fftwf_wisdom_file : trvs::fftw_wisdom_file;
+  if (wisdom_file_in_memory == wisdom_filepath) {return true;}
+
+  // Forget wisdom planned under any other key.
+  if (single) {
+    fftwf_forget_wisdom();
+  } else {
+    fftw_forget_wisdom();
+  }
+  wisdom_file_in_memory.clear();
+
+  int imported = single
+    ? fftwf_import_wisdom_from_filename(wisdom_filepath.c_str())
+    : fftw_import_wisdom_from_filename(wisdom_filepath.c_str());
+  if (!imported) {
+    if (trvs::currTask == 0) {
+      trvs::logger.info(
+        "No FFTW wisdom file could be imported: %s", wisdom_filepath.c_str()
+      );
+    }
+    return false;
+  }
+
+  wisdom_file_in_memory = wisdom_filepath;
+
+  if (trvs::currTask == 0) {
+    trvs::logger.info(
+      "FFTW wisdom file has been imported: %s", wisdom_filepath.c_str()
+    );
+  }
+
+  return true;
+}
+
+void export_fftw_wisdom(
+  trv::ParameterSet& params, int sign, bool imported, double plan_time,
+  bool single
+) {
+  std::string wisdom_filepath = params.ret_fftw_wisdom_filepath(sign, single);
+  if (wisdom_filepath.empty()) {return;}
+  // Planning from wisdom takes negligible time, so slower planning
+  // indicates new wisdom.
+  if (imported && plan_time <= 0.1) {return;}
+
+  trvs::make_write_dir(params.use_fftw_wisdom);
+
+  std::string wisdom_filepath_tmp =
+    wisdom_filepath + ".tmp" + std::to_string(getpid());
+  int exported = single
+    ? fftwf_export_wisdom_to_filename(wisdom_filepath_tmp.c_str())
+    : fftw_export_wisdom_to_filename(wisdom_filepath_tmp.c_str());
+  if (
+    !exported
+    || std::rename(wisdom_filepath_tmp.c_str(), wisdom_filepath.c_str()) != 0
+  ) {
+    std::remove(wisdom_filepath_tmp.c_str());
+    if (trvs::currTask == 0) {
+      trvs::logger.warn(
+        "Failed to export FFTW wisdom file: %s", wisdom_filepath.c_str()
+      );
+    }
+    return;
+  }
+
+  if (single) {
+    trvs::fftwf_wisdom_file = wisdom_filepath;
+  } else {
+    trvs::fftw_wisdom_file = wisdom_filepath;
+  }
+
+  if (trvs::currTask == 0) {
+    trvs::logger.info(
+      "FFTW wisdom file has been exported: %s", wisdom_filepath.c_str()
+    );
+  }
+}
+
+
+// ***********************************************************************
+// Mesh field pool
 // ***********************************************************************
 
 // -----------------------------------------------------------------------
 // Life cycle
 // -----------------------------------------------------------------------
 
-MeshField::MeshField(
-  trv::ParameterSet& params, bool plan_ini, const std::string& name
-) {
-  // Attach the full parameter set to @ref trv::MeshField.
+MeshFieldPool::MeshFieldPool(trv::ParameterSet& params) {
   this->params = params;
-  this->name = name;
+}
 
-  trvs::logger.reset_level(params.verbose);
+MeshFieldPool::~MeshFieldPool() {
+  if (this->plan_c2c_ini) {
+    fftw_destroy_plan(this->transform_c2c);
+    fftw_destroy_plan(this->inv_transform_c2c);
+  }
+  if (this->plan_r2c_ini) {
+    fftw_destroy_plan(this->transform_r2c);
+    fftw_destroy_plan(this->inv_transform_r2c);
+  }
+  for (auto& batch_plan : this->batch_plans) {
+    if (batch_plan.second != nullptr) {fftw_destroy_plan(batch_plan.second);}
+  }
+  if (this->plan_c2c_sp_ini) {
+    fftwf_destroy_plan(this->transform_c2c_sp);
+    fftwf_destroy_plan(this->inv_transform_c2c_sp);
+  }
+  if (this->plan_r2c_sp_ini) {
+    fftwf_destroy_plan(this->transform_r2c_sp);
+    fftwf_destroy_plan(this->inv_transform_r2c_sp);
+  }
+  for (auto& batch_plan : this->batch_plans_sp) {
+    if (batch_plan.second != nullptr) {
+      fftwf_destroy_plan(batch_plan.second);
+    }
+  }
+  delete this->slab_transform; this->slab_transform = nullptr;
+  delete this->slab_inv_transform; this->slab_inv_transform = nullptr;
 
-  // Initialise the field (and its shadow field if interlacing is used)
-  // and increase allocated memory.
-  this->field = fftw_alloc_complex(this->params.nmesh);
+  for (std::size_t ibuf = 0; ibuf < this->buffers.size(); ibuf++) {
+    fftw_free(this->buffers[ibuf]); this->buffers[ibuf] = nullptr;
+    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(
+      this->buffer_sizes[ibuf]
+    );
+  }
 
-  trvs::count_cgrid += 1;
-  trvs::count_grid += 1;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->params.nmesh);
+  if (this->nbuffers > 0 && trvs::currTask == 0) {
+    trvs::logger.debug(
+      "Mesh field pool released %d buffers (%.3f GiB).",
+      this->nbuffers, this->gbytes
+    );
+  }
+}
+
+
+// -----------------------------------------------------------------------
+// Buffers & plans
+// -----------------------------------------------------------------------
+
+fftw_complex* MeshFieldPool::acquire_buffer(long long nelem) {
+  for (std::size_t ibuf = 0; ibuf < this->buffers.size(); ibuf++) {
+    if (!this->buffer_used[ibuf] && this->buffer_sizes[ibuf] == nelem) {
+      this->buffer_used[ibuf] = true;
+      return this->buffers[ibuf];
+    }
+  }
+
+  fftw_complex* buffer = fftw_alloc_complex(nelem);
+
+  // Pre-fault the buffer by touching every element with the same
+  // thread layout as subsequent field operations.
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+  for (long long gid = 0; gid < nelem; gid++) {
+    buffer[gid][0] = 0.;
+    buffer[gid][1] = 0.;
+  }
+
+  this->buffers.push_back(buffer);
+  this->buffer_sizes.push_back(nelem);
+  this->buffer_used.push_back(true);
+
+  this->nbuffers += 1;
+  this->gbytes += trvs::size_in_gb<fftw_complex>(nelem);
+
+  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(nelem);
   trvs::update_maxmem();
 
-  if (this->params.interlace == "true") {
-    this->field_s = fftw_alloc_complex(this->params.nmesh);
+  return buffer;
+}
 
-    trvs::count_cgrid += 1;
-    trvs::count_grid += 1;
-    trvs::update_maxcntgrid();
-    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->params.nmesh);
-    trvs::update_maxmem();
+void MeshFieldPool::release_buffer(fftw_complex* buffer) {
+  for (std::size_t ibuf = 0; ibuf < this->buffers.size(); ibuf++) {
+    if (this->buffers[ibuf] == buffer) {
+      this->buffer_used[ibuf] = false;
+      return;
+    }
   }
+}
 
-  this->reset_density_field();  // initialise; likely redundant but safe
+fftwf_complex* MeshFieldPool::acquire_buffer_sp(long long nelem) {
+  // Two single-precision elements occupy one double-precision element.
+  return reinterpret_cast<fftwf_complex*>(
+    this->acquire_buffer((nelem + 1) / 2)
+  );
+}
+
+void MeshFieldPool::release_buffer(fftwf_complex* buffer) {
+  this->release_buffer(reinterpret_cast<fftw_complex*>(buffer));
+}
+
+void MeshFieldPool::ret_plans(
+  bool r2c, fftw_plan& transform, fftw_plan& inv_transform
+) {
+  bool& plan_ini = r2c ? this->plan_r2c_ini : this->plan_c2c_ini;
+  fftw_plan& transform_ = r2c ? this->transform_r2c : this->transform_c2c;
+  fftw_plan& inv_transform_ =
+    r2c ? this->inv_transform_r2c : this->inv_transform_c2c;
+
+  if (!plan_ini) {
+    // Plan on a temporary buffer (whose values are overwritten by
+    // planning), as pooled fields hold their shadow fields in the same
+    // buffer and would not reuse a single-mesh buffer.
+    long long nelem = this->ret_mesh_size(r2c);
+    fftw_complex* buffer = fftw_alloc_complex(nelem);
+
+    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(nelem);
+    trvs::update_maxmem();
 
-  // Initialise FFTW plans.
-  if (plan_ini) {
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
     fftw_plan_with_nthreads(omp_get_max_threads());
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
-    bool import_fftw_wisdom_f = false;
-    bool import_fftw_wisdom_b = false;
-    bool export_fftw_wisdom_f = false;
-    bool export_fftw_wisdom_b = false;
-    std::FILE* fftw_wisdom_file_f = nullptr;
-    std::FILE* fftw_wisdom_file_b = nullptr;
-
-    if (this->params.use_fftw_wisdom != "") {
-      if (!trv::sys::fftw_wisdom_f_imported) {
-        fftw_wisdom_file_f =
-          std::fopen(this->params.fftw_wisdom_file_f.c_str(), "r");
-        if (fftw_wisdom_file_f != nullptr) {
-          import_fftw_wisdom_f = true;
-          export_fftw_wisdom_f = false;
-          if (this->params.fftw_scheme == "patient") {
-            if (trvs::currTask == 0) {
-              trvs::logger.warn(
-                "FFTW planner flag is set to `FFTW_PATIENT`. "
-                "Ensure that the FFTW wisdom file '%s' imported has been "
-                "generated with an equivalent or higher planner flag.",
-                this->params.fftw_wisdom_file_f.c_str()
-              );
-            }
-          }
-        } else {
-          import_fftw_wisdom_f = false;
-          export_fftw_wisdom_f = true;
-          if (trvs::currTask == 0) {
-            trvs::logger.info(
-              "No FFTW wisdom file for forward transforms "
-              "could be imported: %s",
-              this->params.fftw_wisdom_file_f.c_str()
-            );
-          }
-        }
-      }
-
-      if (!trv::sys::fftw_wisdom_b_imported) {
-        fftw_wisdom_file_b =
-          fopen(this->params.fftw_wisdom_file_b.c_str(), "r");
-        if (fftw_wisdom_file_b != nullptr) {
-          import_fftw_wisdom_b = true;
-          export_fftw_wisdom_b = false;
-          if (this->params.fftw_scheme == "patient") {
-            if (trvs::currTask == 0) {
-              trvs::logger.warn(
-                "FFTW planner flag is set to `FFTW_PATIENT`. "
-                "Ensure that the FFTW wisdom file '%s' imported has been "
-                "generated with an equivalent or higher planner flag.",
-                this->params.fftw_wisdom_file_b.c_str()
-              );
-            }
-          }
-        } else {
-          import_fftw_wisdom_b = false;
-          export_fftw_wisdom_b = true;
-          if (trvs::currTask == 0) {
-            trvs::logger.info(
-              "No FFTW wisdom file for backward transforms "
-              "could be imported: %s",
-              this->params.fftw_wisdom_file_b.c_str()
-            );
-          }
-        }
-      }
+    bool wisdom_f = trv::import_fftw_wisdom(this->params, FFTW_FORWARD);
+    auto pre_plan_f_timept = std::chrono::steady_clock::now();
+    if (r2c) {
+      transform_ = fftw_plan_dft_r2c_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        reinterpret_cast<double*>(buffer), buffer,
+        this->params.fftw_planner_flag
+      );
+    } else {
+      transform_ = fftw_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        buffer, buffer,
+        FFTW_FORWARD, this->params.fftw_planner_flag
+      );
     }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_FORWARD, wisdom_f,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_f_timept
+      ).count()
+    );
 
-    if (import_fftw_wisdom_f) {
-      fftw_import_wisdom_from_filename(
-        this->params.fftw_wisdom_file_f.c_str()
+    bool wisdom_b = trv::import_fftw_wisdom(this->params, FFTW_BACKWARD);
+    auto pre_plan_b_timept = std::chrono::steady_clock::now();
+    if (r2c) {
+      inv_transform_ = fftw_plan_dft_c2r_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        buffer, reinterpret_cast<double*>(buffer),
+        this->params.fftw_planner_flag
+      );
+    } else {
+      inv_transform_ = fftw_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        buffer, buffer,
+        FFTW_BACKWARD, this->params.fftw_planner_flag
       );
-      trv::sys::fftw_wisdom_f_imported = true;
-      if (trvs::currTask == 0) {
-        trvs::logger.info(
-          "FFTW wisdom file for forward transforms has been imported: %s",
-          this->params.fftw_wisdom_file_f.c_str()
-        );
-      }
     }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_BACKWARD, wisdom_b,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_b_timept
+      ).count()
+    );
+    plan_ini = true;
 
-    auto pre_plan_f_timept = std::chrono::system_clock::now();
-    this->transform = fftw_plan_dft_3d(
-      this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
-      this->field, this->field,
+    fftw_free(buffer);
+    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(nelem);
+  }
+
+  transform = transform_;
+  inv_transform = inv_transform_;
+}
+
+fftw_plan MeshFieldPool::ret_batch_plan(bool r2c, int nbatch) {
+  std::pair<bool, int> key(r2c, nbatch);
+  if (this->batch_plans.count(key)) {
+    return this->batch_plans[key];
+  }
+
+  // The distance between meshes in the FFTW advanced interface is
+  // an `int`, so very large meshes are not batched.
+  long long nstride = this->ret_mesh_stride(this->ret_mesh_size(r2c));
+  if ((r2c ? 2*nstride : nstride) > INT_MAX) {
+    this->batch_plans[key] = nullptr;
+    return nullptr;
+  }
+
+  // Plan on a pooled buffer, which is released for reuse immediately
+  // (its values are overwritten by planning).
+  fftw_complex* buffer = this->acquire_buffer(nbatch * nstride);
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftw_plan_with_nthreads(omp_get_max_threads());
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+  bool wisdom = trv::import_fftw_wisdom(this->params, FFTW_FORWARD);
+  auto pre_plan_timept = std::chrono::steady_clock::now();
+  fftw_plan transform;
+  if (r2c) {
+    // In-place real-to-complex meshes are padded along the last dimension.
+    int nembed_r[3] = {
+      this->params.ngrid[0], this->params.ngrid[1],
+      2*(this->params.ngrid[2]/2 + 1)
+    };
+    int nembed_c[3] = {
+      this->params.ngrid[0], this->params.ngrid[1],
+      this->params.ngrid[2]/2 + 1
+    };
+    transform = fftw_plan_many_dft_r2c(
+      3, this->params.ngrid, nbatch,
+      reinterpret_cast<double*>(buffer), nembed_r, 1, int(2*nstride),
+      buffer, nembed_c, 1, int(nstride),
+      this->params.fftw_planner_flag
+    );
+  } else {
+    transform = fftw_plan_many_dft(
+      3, this->params.ngrid, nbatch,
+      buffer, nullptr, 1, int(nstride),
+      buffer, nullptr, 1, int(nstride),
       FFTW_FORWARD, this->params.fftw_planner_flag
     );
-    auto post_plan_f_timept = std::chrono::system_clock::now();
+  }
+  trv::export_fftw_wisdom(
+    this->params, FFTW_FORWARD, wisdom,
+    std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - pre_plan_timept
+    ).count()
+  );
 
-    double plan_f_time = std::chrono::duration<double>(
-      post_plan_f_timept - pre_plan_f_timept
-    ).count();
-    if (import_fftw_wisdom_f && plan_f_time > 1.) {
-      if (trvs::currTask == 0) {
-        trvs::logger.warn(
-          "FFTW plan for forward transforms took %.3f (> 1.) seconds "
-          "despite importing wisdom file, which may have been created "
-          "under different runtime conditions. "
-          "A new wisdom file will be exported.",
-          plan_f_time
-        );
-      }
-      export_fftw_wisdom_f = true;
-    }
+  this->release_buffer(buffer);
+
+  this->batch_plans[key] = transform;
+
+  return transform;
+}
 
-    if (export_fftw_wisdom_f) {
-      fftw_export_wisdom_to_filename(
-        this->params.fftw_wisdom_file_f.c_str()
+void MeshFieldPool::ret_plans(
+  bool r2c, fftwf_plan& transform, fftwf_plan& inv_transform
+) {
+  bool& plan_ini = r2c ? this->plan_r2c_sp_ini : this->plan_c2c_sp_ini;
+  fftwf_plan& transform_ =
+    r2c ? this->transform_r2c_sp : this->transform_c2c_sp;
+  fftwf_plan& inv_transform_ =
+    r2c ? this->inv_transform_r2c_sp : this->inv_transform_c2c_sp;
+
+  if (!plan_ini) {
+    // Plan on a temporary buffer as for double-precision plans.
+    long long nelem = this->ret_mesh_size(r2c);
+    fftwf_complex* buffer = fftwf_alloc_complex(nelem);
+
+    trvs::gbytesMem += trvs::size_in_gb<fftwf_complex>(nelem);
+    trvs::update_maxmem();
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+    fftwf_plan_with_nthreads(omp_get_max_threads());
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+    bool wisdom_f = trv::import_fftw_wisdom(this->params, FFTW_FORWARD, true);
+    auto pre_plan_f_timept = std::chrono::steady_clock::now();
+    if (r2c) {
+      transform_ = fftwf_plan_dft_r2c_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        reinterpret_cast<float*>(buffer), buffer,
+        this->params.fftw_planner_flag
+      );
+    } else {
+      transform_ = fftwf_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        buffer, buffer,
+        FFTW_FORWARD, this->params.fftw_planner_flag
       );
-      if (trvs::currTask == 0) {
-        trvs::logger.info(
-          "FFTW wisdom file for forward transforms has been exported: %s",
-          this->params.fftw_wisdom_file_f.c_str()
-        );
-      }
-      trv::sys::fftw_wisdom_f_imported = true;
     }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_FORWARD, wisdom_f,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_f_timept
+      ).count(),
+      true
+    );
 
-    if (import_fftw_wisdom_b) {
-      fftw_import_wisdom_from_filename(
-        this->params.fftw_wisdom_file_b.c_str()
+    bool wisdom_b =
+      trv::import_fftw_wisdom(this->params, FFTW_BACKWARD, true);
+    auto pre_plan_b_timept = std::chrono::steady_clock::now();
+    if (r2c) {
+      inv_transform_ = fftwf_plan_dft_c2r_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        buffer, reinterpret_cast<float*>(buffer),
+        this->params.fftw_planner_flag
+      );
+    } else {
+      inv_transform_ = fftwf_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        buffer, buffer,
+        FFTW_BACKWARD, this->params.fftw_planner_flag
       );
-      trv::sys::fftw_wisdom_b_imported = true;
-      if (trvs::currTask == 0) {
-        trvs::logger.info(
-          "FFTW wisdom file for backward transforms has been imported: %s",
-          this->params.fftw_wisdom_file_b.c_str()
-        );
-      }
     }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_BACKWARD, wisdom_b,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_b_timept
+      ).count(),
+      true
+    );
+    plan_ini = true;
 
-    auto pre_plan_b_timept = std::chrono::system_clock::now();
-    this->inv_transform = fftw_plan_dft_3d(
-      this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
-      this->field, this->field,
-      FFTW_BACKWARD, this->params.fftw_planner_flag
+    fftwf_free(buffer);
+    trvs::gbytesMem -= trvs::size_in_gb<fftwf_complex>(nelem);
+  }
+
+  transform = transform_;
+  inv_transform = inv_transform_;
+}
+
+fftwf_plan MeshFieldPool::ret_batch_plan_sp(bool r2c, int nbatch) {
+  std::pair<bool, int> key(r2c, nbatch);
+  if (this->batch_plans_sp.count(key)) {
+    return this->batch_plans_sp[key];
+  }
+
+  long long nstride = this->ret_mesh_stride(this->ret_mesh_size(r2c), true);
+  if ((r2c ? 2*nstride : nstride) > INT_MAX) {
+    this->batch_plans_sp[key] = nullptr;
+    return nullptr;
+  }
+
+  fftwf_complex* buffer = this->acquire_buffer_sp(nbatch * nstride);
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftwf_plan_with_nthreads(omp_get_max_threads());
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+  bool wisdom = trv::import_fftw_wisdom(this->params, FFTW_FORWARD, true);
+  auto pre_plan_timept = std::chrono::steady_clock::now();
+  fftwf_plan transform;
+  if (r2c) {
+    int nembed_r[3] = {
+      this->params.ngrid[0], this->params.ngrid[1],
+      2*(this->params.ngrid[2]/2 + 1)
+    };
+    int nembed_c[3] = {
+      this->params.ngrid[0], this->params.ngrid[1],
+      this->params.ngrid[2]/2 + 1
+    };
+    transform = fftwf_plan_many_dft_r2c(
+      3, this->params.ngrid, nbatch,
+      reinterpret_cast<float*>(buffer), nembed_r, 1, int(2*nstride),
+      buffer, nembed_c, 1, int(nstride),
+      this->params.fftw_planner_flag
     );
-    auto post_plan_b_timept = std::chrono::system_clock::now();
+  } else {
+    transform = fftwf_plan_many_dft(
+      3, this->params.ngrid, nbatch,
+      buffer, nullptr, 1, int(nstride),
+      buffer, nullptr, 1, int(nstride),
+      FFTW_FORWARD, this->params.fftw_planner_flag
+    );
+  }
+  trv::export_fftw_wisdom(
+    this->params, FFTW_FORWARD, wisdom,
+    std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - pre_plan_timept
+    ).count(),
+    true
+  );
 
-    double plan_b_time = std::chrono::duration<double>(
-      post_plan_b_timept - pre_plan_b_timept
-    ).count();
-    if (import_fftw_wisdom_b && plan_b_time > 1.) {
-      if (trvs::currTask == 0) {
-        trvs::logger.warn(
-          "FFTW plan for backward transforms took %.3f (> 1.) seconds "
-          "despite importing wisdom file, which may have been created "
-          "under different runtime conditions. "
-          "A new wisdom file will be exported.",
-          plan_b_time
-        );
+  this->release_buffer(buffer);
+
+  this->batch_plans_sp[key] = transform;
+
+  return transform;
+}
+
+long long MeshFieldPool::ret_mesh_size(bool r2c) {
+  return r2c
+    ? static_cast<long long>(this->params.ngrid[0])
+      * this->params.ngrid[1] * (this->params.ngrid[2]/2 + 1)
+    : this->params.nmesh;
+}
+
+long long MeshFieldPool::ret_mesh_stride(long long nelem, bool single) {
+  const long long nalign =
+    64 / (single ? sizeof(fftwf_complex) : sizeof(fftw_complex));
+  return (nelem + nalign - 1) / nalign * nalign;
+}
+
+void MeshFieldPool::ret_slab_plans(
+  trv::SlabFFTPlan*& transform, trv::SlabFFTPlan*& inv_transform
+) {
+  if (this->slab_transform == nullptr) {
+    this->slab_transform = new trv::SlabFFTPlan(
+      this->params.ngrid, FFTW_FORWARD, this->params.fftw_planner_flag
+    );
+    this->slab_inv_transform = new trv::SlabFFTPlan(
+      this->params.ngrid, FFTW_BACKWARD, this->params.fftw_planner_flag
+    );
+  }
+
+  transform = this->slab_transform;
+  inv_transform = this->slab_inv_transform;
+}
+
+
+// ***********************************************************************
+// Wavevector geometry
+// ***********************************************************************
+
+// -----------------------------------------------------------------------
+// Life cycle
+// -----------------------------------------------------------------------
+
+WavevectorGeometry::WavevectorGeometry(
+  trv::ParameterSet& params, int n0_local, int i0_start
+) {
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->ngrid[iaxis] = params.ngrid[iaxis];
+    this->boxsize[iaxis] = params.boxsize[iaxis];
+  }
+  this->assignment_order = params.assignment_order;
+  this->n0_local = n0_local;
+  this->i0_start = i0_start;
+  this->nmesh_local = static_cast<long long>(n0_local)
+    * this->ngrid[1] * this->ngrid[2];
+
+  if (trvs::currTask == 0) {
+    trvs::logger.debug(
+      "Computing wavevector geometry for assignment order %d.",
+      this->assignment_order
+    );
+  }
+
+  trvs::gbytesMem += trvs::size_in_gb<double>(
+    2 * (this->ngrid[0] + this->ngrid[1] + this->ngrid[2])
+  );
+  trvs::update_maxmem();
+
+  const double dk[3] = {
+    2.*M_PI / this->boxsize[0],
+    2.*M_PI / this->boxsize[1],
+    2.*M_PI / this->boxsize[2]
+  };
+
+  // Tabulate the separable squared wavenumber and assignment window
+  // along each axis.
+  std::vector<double>* ksq_axes[3] = {
+    &this->ksq_x, &this->ksq_y, &this->ksq_z
+  };
+  std::vector<double>* window_axes[3] = {
+    &this->window_x, &this->window_y, &this->window_z
+  };
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    std::vector<double>& ksq_axis = *ksq_axes[iaxis];
+    std::vector<double>& window_axis = *window_axes[iaxis];
+    ksq_axis.resize(this->ngrid[iaxis]);
+    window_axis.resize(this->ngrid[iaxis]);
+    for (int i = 0; i < this->ngrid[iaxis]; i++) {
+      // Shift the grid index on the discrete Fourier mesh grid.
+      int i_ = (i < this->ngrid[iaxis]/2) ? i : i - this->ngrid[iaxis];
+
+      double k_ = i_ * dk[iaxis];
+      ksq_axis[i] = k_ * k_;
+
+      // Note sin(u) / u -> 1 as u -> 0.
+      double u = M_PI * i_ / double(this->ngrid[iaxis]);
+      double wk = (i_ != 0) ? std::sin(u) / u : 1.;
+
+      window_axis[i] = std::pow(wk, this->assignment_order);
+    }
+  }
+}
+
+WavevectorGeometry::~WavevectorGeometry() {
+  trvs::gbytesMem -= trvs::size_in_gb<double>(
+    2 * (this->ngrid[0] + this->ngrid[1] + this->ngrid[2])
+  );
+  trvs::gbytesMem -= trvs::size_in_gb<double>(
+    static_cast<long long>(this->kmag_unique.size())
+  );
+  trvs::gbytesMem -= trvs::size_in_gb<int>(
+    static_cast<long long>(this->kmag_unique_index.size())
+  );
+}
+
+std::shared_ptr<WavevectorGeometry> WavevectorGeometry::ret_shared(
+  trv::ParameterSet& params, int n0_local, int i0_start
+) {
+  // The most recently computed geometry is shared while it is held.
+  static std::weak_ptr<WavevectorGeometry> shared_geometry;
+
+  std::shared_ptr<WavevectorGeometry> kgeom = shared_geometry.lock();
+  if (
+    kgeom != nullptr
+    && kgeom->ngrid[0] == params.ngrid[0]
+    && kgeom->ngrid[1] == params.ngrid[1]
+    && kgeom->ngrid[2] == params.ngrid[2]
+    && kgeom->boxsize[0] == params.boxsize[0]
+    && kgeom->boxsize[1] == params.boxsize[1]
+    && kgeom->boxsize[2] == params.boxsize[2]
+    && kgeom->assignment_order == params.assignment_order
+    && kgeom->n0_local == n0_local
+    && kgeom->i0_start == i0_start
+  ) {
+    return kgeom;
+  }
+
+  kgeom = std::make_shared<WavevectorGeometry>(params, n0_local, i0_start);
+  shared_geometry = kgeom;
+
+  return kgeom;
+}
+
+
+// -----------------------------------------------------------------------
+// Unique wavevector magnitudes
+// -----------------------------------------------------------------------
+
+const std::vector<double>& WavevectorGeometry::ret_unique_kmag() {
+  if (!this->kmag_unique_index.empty()) {
+    return this->kmag_unique;
+  }
+
+  // The absolute shifted grid index in each dimension ranges over
+  // [0, n - n/2].
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->noctant[iaxis] = this->ngrid[iaxis] - this->ngrid[iaxis]/2 + 1;
+  }
+
+  const long long noctant_tot = static_cast<long long>(this->noctant[0])
+    * this->noctant[1] * this->noctant[2];
+
+  const double dk[3] = {
+    2.*M_PI / this->boxsize[0],
+    2.*M_PI / this->boxsize[1],
+    2.*M_PI / this->boxsize[2]
+  };
+
+  // Compute the magnitudes in the same way as in the constructor
+  // so that they match exactly.
+  std::vector<double> kmag_octant(noctant_tot);
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(3)
+#endif  // TRV_USE_OMP
+  for (int i = 0; i < this->noctant[0]; i++) {
+    for (int j = 0; j < this->noctant[1]; j++) {
+      for (int k = 0; k < this->noctant[2]; k++) {
+        long long idx_octant =
+          (i * static_cast<long long>(this->noctant[1]) + j)
+          * this->noctant[2] + k;
+
+        double kv[3] = {i * dk[0], j * dk[1], k * dk[2]};
+
+        kmag_octant[idx_octant] = trvm::get_vec3d_magnitude(kv);
       }
-      export_fftw_wisdom_b = true;
     }
+  }
+
+  this->kmag_unique = kmag_octant;
+  std::sort(this->kmag_unique.begin(), this->kmag_unique.end());
+  this->kmag_unique.erase(
+    std::unique(this->kmag_unique.begin(), this->kmag_unique.end()),
+    this->kmag_unique.end()
+  );
+  this->kmag_unique.shrink_to_fit();
+
+  this->kmag_unique_index.resize(noctant_tot);
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for
+#endif  // TRV_USE_OMP
+  for (long long idx_octant = 0; idx_octant < noctant_tot; idx_octant++) {
+    this->kmag_unique_index[idx_octant] = int(
+      std::lower_bound(
+        this->kmag_unique.begin(), this->kmag_unique.end(),
+        kmag_octant[idx_octant]
+      ) - this->kmag_unique.begin()
+    );
+  }
+
+  trvs::gbytesMem += trvs::size_in_gb<double>(
+    static_cast<long long>(this->kmag_unique.size())
+  );
+  trvs::gbytesMem += trvs::size_in_gb<int>(
+    static_cast<long long>(this->kmag_unique_index.size())
+  );
+  trvs::update_maxmem();
+
+  return this->kmag_unique;
+}
+
+
+// ***********************************************************************
+// Mesh field
+// ***********************************************************************
+
+// -----------------------------------------------------------------------
+// Storage precision
+// -----------------------------------------------------------------------
+
+template<typename Op>
+auto MeshField::apply_to_fields(Op&& op) {
+  if (this->single) {return op(this->field_sp, this->field_s_sp);}
+  return op(this->field, this->field_s);
+}
+
+template<typename Op>
+auto MeshField::apply_to_fields(MeshField& other, Op&& op) {
+  if (this->single) {
+    return op(
+      this->field_sp, this->field_s_sp, other.field_sp, other.field_s_sp
+    );
+  }
+  return op(this->field, this->field_s, other.field, other.field_s);
+}
+
+
+// -----------------------------------------------------------------------
+// Life cycle
+// -----------------------------------------------------------------------
+
+MeshField::MeshField(
+  trv::ParameterSet& params, bool plan_ini, const std::string& name,
+  bool r2c
+) {
+  // Attach the full parameter set to @ref trv::MeshField.
+  this->params = params;
+  this->name = name;
+
+  trvs::logger.reset_level(params.verbose);
+
+  // Decompose the mesh into slabs along the x-axis across tasks.
+  // A slab-decomposed field is always complex-to-complex and in
+  // double precision.
+  trvs::allocate_slab(this->params.ngrid[0], this->n0_local, this->i0_start);
+  this->nmesh_local = static_cast<long long>(this->n0_local)
+    * this->params.ngrid[1] * this->params.ngrid[2];
+  this->distributed = (trvs::numTasks > 1);
+  this->r2c = r2c && !this->distributed;
+  this->single = (this->params.precision == "single") && !this->distributed;
+
+  // Initialise the field (and its shadow field if interlacing is used)
+  // and increase allocated memory.  A real-to-complex field only needs
+  // the half-complex mesh, which is counted as a real grid.
+  if (this->r2c) {
+    this->nmesh_alloc = static_cast<long long>(this->params.ngrid[0])
+      * this->params.ngrid[1] * (this->params.ngrid[2]/2 + 1);
+  } else {
+    this->nmesh_alloc = this->nmesh_local;
+  }
+
+  const double gbytes_alloc = this->single
+    ? trvs::size_in_gb<fftwf_complex>(this->nmesh_alloc)
+    : trvs::size_in_gb<fftw_complex>(this->nmesh_alloc);
+
+  if (this->single) {
+    this->field = nullptr;
+    this->field_sp = fftwf_alloc_complex(this->nmesh_alloc);
+  } else {
+    this->field = fftw_alloc_complex(this->nmesh_alloc);
+  }
+
+  if (this->r2c) {
+    trvs::count_rgrid += 1;
+    trvs::count_grid += .5;
+  } else {
+    trvs::count_cgrid += 1;
+    trvs::count_grid += 1;
+  }
+  trvs::update_maxcntgrid();
+  trvs::gbytesMem += gbytes_alloc;
+  trvs::update_maxmem();
+
+  if (this->params.interlace == "true") {
+    if (this->single) {
+      this->field_s_sp = fftwf_alloc_complex(this->nmesh_alloc);
+    } else {
+      this->field_s = fftw_alloc_complex(this->nmesh_alloc);
+    }
+
+    if (this->r2c) {
+      trvs::count_rgrid += 1;
+      trvs::count_grid += .5;
+    } else {
+      trvs::count_cgrid += 1;
+      trvs::count_grid += 1;
+    }
+    trvs::update_maxcntgrid();
+    trvs::gbytesMem += gbytes_alloc;
+    trvs::update_maxmem();
+  }
 
-    if (export_fftw_wisdom_b) {
-      fftw_export_wisdom_to_filename(
-        this->params.fftw_wisdom_file_b.c_str()
+  this->reset_density_field();  // initialise; likely redundant but safe
+
+  // Initialise FFTW plans.  Slab-decomposed transforms are planned
+  // per task, so FFTW wisdom files are not used.
+  if (plan_ini && this->distributed) {
+    this->slab_transform = new trv::SlabFFTPlan(
+      this->params.ngrid, FFTW_FORWARD, this->params.fftw_planner_flag
+    );
+    this->slab_inv_transform = new trv::SlabFFTPlan(
+      this->params.ngrid, FFTW_BACKWARD, this->params.fftw_planner_flag
+    );
+    this->plan_ini = true;
+  } else
+  if (plan_ini && this->single) {
+    // The shadow field is transformed with the same plan executed on
+    // new arrays.
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+    fftwf_plan_with_nthreads(omp_get_max_threads());
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+    bool wisdom_f = trv::import_fftw_wisdom(this->params, FFTW_FORWARD, true);
+    auto pre_plan_f_timept = std::chrono::steady_clock::now();
+    if (this->r2c) {
+      this->transform_sp = fftwf_plan_dft_r2c_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        reinterpret_cast<float*>(this->field_sp), this->field_sp,
+        this->params.fftw_planner_flag
       );
-      if (trvs::currTask == 0) {
-        trvs::logger.info(
-          "FFTW wisdom file for backward transforms has been exported: %s",
-          this->params.fftw_wisdom_file_b.c_str()
+    } else {
+      this->transform_sp = fftwf_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        this->field_sp, this->field_sp,
+        FFTW_FORWARD, this->params.fftw_planner_flag
+      );
+    }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_FORWARD, wisdom_f,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_f_timept
+      ).count(),
+      true
+    );
+
+    bool wisdom_b =
+      trv::import_fftw_wisdom(this->params, FFTW_BACKWARD, true);
+    auto pre_plan_b_timept = std::chrono::steady_clock::now();
+    if (this->r2c) {
+      this->inv_transform_sp = fftwf_plan_dft_c2r_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        this->field_sp, reinterpret_cast<float*>(this->field_sp),
+        this->params.fftw_planner_flag
+      );
+    } else {
+      this->inv_transform_sp = fftwf_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        this->field_sp, this->field_sp,
+        FFTW_BACKWARD, this->params.fftw_planner_flag
+      );
+    }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_BACKWARD, wisdom_b,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_b_timept
+      ).count(),
+      true
+    );
+    this->plan_ini = true;
+  } else
+  if (plan_ini) {
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+    fftw_plan_with_nthreads(omp_get_max_threads());
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+    bool wisdom_f = trv::import_fftw_wisdom(this->params, FFTW_FORWARD);
+    auto pre_plan_f_timept = std::chrono::steady_clock::now();
+    if (this->r2c) {
+      this->transform = fftw_plan_dft_r2c_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        reinterpret_cast<double*>(this->field), this->field,
+        this->params.fftw_planner_flag
+      );
+    } else {
+      this->transform = fftw_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        this->field, this->field,
+        FFTW_FORWARD, this->params.fftw_planner_flag
+      );
+    }
+    // Plan the shadow field transform with the forward wisdom, before
+    // it is exported and replaced by the backward wisdom.
+    if (this->params.interlace == "true") {
+      if (this->r2c) {
+        this->transform_s = fftw_plan_dft_r2c_3d(
+          this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+          reinterpret_cast<double*>(this->field_s), this->field_s,
+          this->params.fftw_planner_flag
+        );
+      } else {
+        this->transform_s = fftw_plan_dft_3d(
+          this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+          this->field_s, this->field_s,
+          FFTW_FORWARD, this->params.fftw_planner_flag
         );
       }
-      trv::sys::fftw_wisdom_b_imported = true;
     }
+    trv::export_fftw_wisdom(
+      this->params, FFTW_FORWARD, wisdom_f,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_f_timept
+      ).count()
+    );
 
-    if (this->params.interlace == "true") {
-      this->transform_s = fftw_plan_dft_3d(
+    bool wisdom_b = trv::import_fftw_wisdom(this->params, FFTW_BACKWARD);
+    auto pre_plan_b_timept = std::chrono::steady_clock::now();
+    if (this->r2c) {
+      this->inv_transform = fftw_plan_dft_c2r_3d(
         this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
-        this->field_s, this->field_s,
-        FFTW_FORWARD, this->params.fftw_planner_flag
+        this->field, reinterpret_cast<double*>(this->field),
+        this->params.fftw_planner_flag
+      );
+    } else {
+      this->inv_transform = fftw_plan_dft_3d(
+        this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
+        this->field, this->field,
+        FFTW_BACKWARD, this->params.fftw_planner_flag
       );
     }
-    this->plan_ini = true;
+    trv::export_fftw_wisdom(
+      this->params, FFTW_BACKWARD, wisdom_b,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_b_timept
+      ).count()
+    );
 
-    if (fftw_wisdom_file_f != nullptr) {std::fclose(fftw_wisdom_file_f);}
-    if (fftw_wisdom_file_b != nullptr) {std::fclose(fftw_wisdom_file_b);}
+    this->plan_ini = true;
   }
 
   // Calculate grid sizes in configuration space.
@@ -281,8 +980,15 @@ MeshField::MeshField(
 
   trvs::logger.reset_level(params.verbose);
 
+  // External FFTW plans are for the full mesh, which is not decomposed.
+  this->n0_local = this->params.ngrid[0];
+  this->i0_start = 0;
+  this->nmesh_local = this->params.nmesh;
+
   // Initialise the field (and its shadow field if interlacing is used)
   // and increase allocated memory.
+  this->nmesh_alloc = this->params.nmesh;
+
   this->field = fftw_alloc_complex(this->params.nmesh);
 
   trvs::count_cgrid += 1;
@@ -296,20 +1002,134 @@ MeshField::MeshField(
 
     trvs::count_cgrid += 1;
     trvs::count_grid += 1;
-    trvs::update_maxcntgrid();
-    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->params.nmesh);
-    trvs::update_maxmem();
+    trvs::update_maxcntgrid();
+    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->params.nmesh);
+    trvs::update_maxmem();
+  }
+
+  this->reset_density_field();  // initialise; likely redundant but safe
+
+  // Initialise FFTW plans.
+  this->transform = transform;
+  this->inv_transform = inv_transform;
+  if (this->params.interlace == "true") {
+    this->transform_s = transform;
+  }
+  this->plan_ext = true;
+
+  // Calculate grid sizes in configuration space.
+  this->dr[0] = this->params.boxsize[0] / this->params.ngrid[0];
+  this->dr[1] = this->params.boxsize[1] / this->params.ngrid[1];
+  this->dr[2] = this->params.boxsize[2] / this->params.ngrid[2];
+
+  // Calculate fundamental wavenumbers in Fourier space.
+  this->dk[0] = 2.*M_PI / this->params.boxsize[0];
+  this->dk[1] = 2.*M_PI / this->params.boxsize[1];
+  this->dk[2] = 2.*M_PI / this->params.boxsize[2];
+
+  // Calculate mesh volume and mesh grid cell volume.
+  this->vol = this->params.volume;
+  this->vol_cell = this->vol / double(this->params.nmesh);
+}
+
+MeshField::MeshField(
+  trv::ParameterSet& params, trv::MeshFieldPool& pool,
+  const std::string& name, bool r2c
+) : MeshField(params, pool, name, r2c, nullptr) {}
+
+MeshField::MeshField(
+  trv::ParameterSet& params, trv::MeshFieldPool& pool,
+  const std::string& name, bool r2c, void* buffer
+) {
+  // Attach the full parameter set to @ref trv::MeshField.
+  this->params = params;
+  this->name = name;
+
+  trvs::logger.reset_level(params.verbose);
+
+  // Decompose the mesh into slabs along the x-axis across tasks.
+  // A slab-decomposed field is always complex-to-complex and in
+  // double precision.
+  trvs::allocate_slab(this->params.ngrid[0], this->n0_local, this->i0_start);
+  this->nmesh_local = static_cast<long long>(this->n0_local)
+    * this->params.ngrid[1] * this->params.ngrid[2];
+  this->distributed = (trvs::numTasks > 1);
+  this->r2c = r2c && !this->distributed;
+  this->single = (this->params.precision == "single") && !this->distributed;
+
+  if (this->r2c) {
+    this->nmesh_alloc = static_cast<long long>(this->params.ngrid[0])
+      * this->params.ngrid[1] * (this->params.ngrid[2]/2 + 1);
+  } else {
+    this->nmesh_alloc = this->nmesh_local;
+  }
+
+  const int nmesh_field = (this->params.interlace == "true") ? 2 : 1;
+  const long long nstride = trv::MeshFieldPool::ret_mesh_stride(
+    this->nmesh_alloc, this->single
+  );
+
+  // Share FFTW plans from the pool.  These are obtained before the
+  // buffers so that any buffer used for planning is reused below.
+  if (this->distributed) {
+    pool.ret_slab_plans(this->slab_transform, this->slab_inv_transform);
+  } else
+  if (this->single) {
+    pool.ret_plans(this->r2c, this->transform_sp, this->inv_transform_sp);
+    this->batch_transform_sp = pool.ret_batch_plan_sp(this->r2c, nmesh_field);
+  } else {
+    pool.ret_plans(this->r2c, this->transform, this->inv_transform);
+    this->transform_s = this->transform;
+    this->batch_transform = pool.ret_batch_plan(this->r2c, nmesh_field);
+  }
+  this->plan_ext = true;
+
+  // Acquire the field (and its shadow field if interlacing is used)
+  // contiguously from the pool, which accounts for the allocated memory,
+  // unless the buffer is external.
+  this->pool = &pool;
+
+  if (buffer != nullptr) {
+    this->buffer_ext = true;
+  }
+  if (this->single) {
+    this->field = nullptr;
+    this->field_sp = (buffer != nullptr)
+      ? static_cast<fftwf_complex*>(buffer)
+      : pool.acquire_buffer_sp(nmesh_field * nstride);
+  } else {
+    this->field = (buffer != nullptr)
+      ? static_cast<fftw_complex*>(buffer)
+      : pool.acquire_buffer(nmesh_field * nstride);
+  }
+
+  if (this->r2c) {
+    trvs::count_rgrid += 1;
+    trvs::count_grid += .5;
+  } else {
+    trvs::count_cgrid += 1;
+    trvs::count_grid += 1;
   }
+  trvs::update_maxcntgrid();
 
-  this->reset_density_field();  // initialise; likely redundant but safe
-
-  // Initialise FFTW plans.
-  this->transform = transform;
-  this->inv_transform = inv_transform;
   if (this->params.interlace == "true") {
-    this->transform_s = transform;
+    if (this->single) {
+      this->field_s_sp = this->field_sp + nstride;
+    } else {
+      this->field_s = this->field + nstride;
+    }
+
+    if (this->r2c) {
+      trvs::count_rgrid += 1;
+      trvs::count_grid += .5;
+    } else {
+      trvs::count_cgrid += 1;
+      trvs::count_grid += 1;
+    }
+    trvs::update_maxcntgrid();
   }
-  this->plan_ext = true;
+
+  this->reset_density_field();
 
   // Calculate grid sizes in configuration space.
   this->dr[0] = this->params.boxsize[0] / this->params.ngrid[0];
@@ -327,6 +1147,14 @@ MeshField::MeshField(
 }
 
 MeshField::~MeshField() {
+  if (this->plan_ini && this->distributed) {
+    delete this->slab_transform; this->slab_transform = nullptr;
+    delete this->slab_inv_transform; this->slab_inv_transform = nullptr;
+  } else
+  if (this->plan_ini && this->single) {
+    fftwf_destroy_plan(this->transform_sp);
+    fftwf_destroy_plan(this->inv_transform_sp);
+  } else
   if (this->plan_ini) {
     fftw_destroy_plan(this->transform);
     fftw_destroy_plan(this->inv_transform);
@@ -335,43 +1163,90 @@ MeshField::~MeshField() {
     }
   }
 
-  if (this->window_assign_order != -1) {
-    trvs::count_rgrid -= 1;
-    trvs::count_grid -= .5;
-    trvs::gbytesMem -= trvs::size_in_gb<double>(this->params.nmesh);
+  // Pooled buffers (holding both the field and its shadow) are returned
+  // to the pool, which accounts for their memory, unless they are
+  // external.
+  if (this->field_sp != nullptr) {
+    if (this->pool != nullptr) {
+      if (!this->buffer_ext) {this->pool->release_buffer(this->field_sp);}
+    } else {
+      fftwf_free(this->field_sp);
+      trvs::gbytesMem -= trvs::size_in_gb<fftwf_complex>(this->nmesh_alloc);
+    }
+    this->field_sp = nullptr;
+    if (this->r2c) {
+      trvs::count_rgrid -= 1;
+      trvs::count_grid -= .5;
+    } else {
+      trvs::count_cgrid -= 1;
+      trvs::count_grid -= 1;
+    }
+  }
+  if (this->field_s_sp != nullptr) {
+    if (this->pool == nullptr) {
+      fftwf_free(this->field_s_sp);
+      trvs::gbytesMem -= trvs::size_in_gb<fftwf_complex>(this->nmesh_alloc);
+    }
+    this->field_s_sp = nullptr;
+    if (this->r2c) {
+      trvs::count_rgrid -= 1;
+      trvs::count_grid -= .5;
+    } else {
+      trvs::count_cgrid -= 1;
+      trvs::count_grid -= 1;
+    }
   }
-
   if (this->field != nullptr) {
-    fftw_free(this->field); this->field = nullptr;
-    trvs::count_cgrid -= 1;
-    trvs::count_grid -= 1;
-    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->params.nmesh);
+    if (this->pool != nullptr) {
+      if (!this->buffer_ext) {this->pool->release_buffer(this->field);}
+    } else {
+      fftw_free(this->field);
+      trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->nmesh_alloc);
+    }
+    this->field = nullptr;
+    if (this->r2c) {
+      trvs::count_rgrid -= 1;
+      trvs::count_grid -= .5;
+    } else {
+      trvs::count_cgrid -= 1;
+      trvs::count_grid -= 1;
+    }
   }
   if (this->field_s != nullptr) {
-    fftw_free(this->field_s); this->field_s = nullptr;
-    trvs::count_cgrid -= 1;
-    trvs::count_grid -= 1;
-    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->params.nmesh);
+    if (this->pool == nullptr) {
+      fftw_free(this->field_s);
+      trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->nmesh_alloc);
+    }
+    this->field_s = nullptr;
+    if (this->r2c) {
+      trvs::count_rgrid -= 1;
+      trvs::count_grid -= .5;
+    } else {
+      trvs::count_cgrid -= 1;
+      trvs::count_grid -= 1;
+    }
   }
 }
 
 void MeshField::reset_density_field() {
+  this->apply_to_fields([this](auto* field, auto* field_s) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] = 0.;
-    this->field[gid][1] = 0.;
-  }
-  if (this->params.interlace == "true") {
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] = 0.;
+      field[gid][1] = 0.;
+    }
+    if (this->params.interlace == "true") {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-    for (long long gid = 0; gid < this->params.nmesh; gid++) {
-      this->field_s[gid][0] = 0.;
-      this->field_s[gid][1] = 0.;
+      for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+        field_s[gid][0] = 0.;
+        field_s[gid][1] = 0.;
+      }
     }
-  }
+  });
 }
 
 
@@ -383,6 +1258,54 @@ const fftw_complex& MeshField::operator[](long long gid) {
   return this->field[gid];
 }
 
+std::complex<double> MeshField::ret_fourier_mode(int i, int j, int k) {
+  return this->apply_to_fields([&](auto* field, auto* field_s) {
+    if (!this->r2c || k <= this->params.ngrid[2]/2) {
+      long long idx_grid = this->ret_fourier_grid_index(i, j, k);
+      return std::complex<double>(field[idx_grid][0], field[idx_grid][1]);
+    }
+
+    // Recover the mode from its Hermitian conjugate, i.e. f(-k) = f(k)^*.
+    int i_conj = (i == 0) ? 0 : this->params.ngrid[0] - i;
+    int j_conj = (j == 0) ? 0 : this->params.ngrid[1] - j;
+    int k_conj = this->params.ngrid[2] - k;
+
+    long long idx_grid =
+      this->ret_fourier_grid_index(i_conj, j_conj, k_conj);
+    std::complex<double> fk(field[idx_grid][0], - field[idx_grid][1]);
+
+    // The interlacing phase factor is not Hermitian along any axis where
+    // the shifted grid indices of the mode and its conjugate do not sum
+    // to zero, i.e. on the Nyquist plane for an even number of grid cells
+    // or at the middle index pair for an odd number.  If there is an odd
+    // number of such axes, the sign of the shadow field contribution is
+    // restored to agree with the complex-to-complex transform.
+    if (this->params.interlace == "true") {
+      int ijk[3] = {i, j, k};
+      int ijk_conj[3] = {i_conj, j_conj, k_conj};
+      int nunpaired = 0;
+      double arg = 0.;
+      for (int iaxis = 0; iaxis < 3; iaxis++) {
+        int ngrid = this->params.ngrid[iaxis];
+        int idx = (ijk[iaxis] < ngrid/2) ? ijk[iaxis] : ijk[iaxis] - ngrid;
+        int idx_conj = (ijk_conj[iaxis] < ngrid/2)
+          ? ijk_conj[iaxis] : ijk_conj[iaxis] - ngrid;
+        if (idx + idx_conj != 0) {nunpaired++;}
+        arg += M_PI * double(idx) / ngrid;
+      }
+
+      if (nunpaired % 2 == 1) {
+        std::complex<double> fk_s(
+          field_s[idx_grid][0], - field_s[idx_grid][1]
+        );
+        fk += std::complex<double>(std::cos(arg), std::sin(arg)) * fk_s;
+      }
+    }
+
+    return fk;
+  });
+}
+
 
 // -----------------------------------------------------------------------
 // Mesh grid properties
@@ -390,11 +1313,28 @@ const fftw_complex& MeshField::operator[](long long gid) {
 
 long long MeshField::ret_grid_index(int i, int j, int k) {
   long long idx_grid =
-    (i * static_cast<long long>(this->params.ngrid[1]) + j)
+    ((i - this->i0_start) * static_cast<long long>(this->params.ngrid[1]) + j)
     * this->params.ngrid[2] + k;
   return idx_grid;
 }
 
+long long MeshField::ret_fourier_grid_index(int i, int j, int k) {
+  if (!this->r2c) {
+    return this->ret_grid_index(i, j, k);
+  }
+  long long idx_grid =
+    (i * static_cast<long long>(this->params.ngrid[1]) + j)
+    * (this->params.ngrid[2]/2 + 1) + k;
+  return idx_grid;
+}
+
+long long MeshField::ret_real_grid_index(int i, int j, int k) {
+  long long idx_grid =
+    (i * static_cast<long long>(this->params.ngrid[1]) + j)
+    * 2 * (this->params.ngrid[2]/2 + 1) + k;
+  return idx_grid;
+}
+
 void MeshField::shift_grid_indices_fourier(int& i, int& j, int& k) {
   i = (i < this->params.ngrid[0]/2) ? i : i - this->params.ngrid[0];
   j = (j < this->params.ngrid[1]/2) ? j : j - this->params.ngrid[1];
@@ -419,6 +1359,15 @@ void MeshField::get_grid_wavevector(int i, int j, int k, double kvec[3]) {
     k * this->dk[2] : (k - this->params.ngrid[2]) * this->dk[2];
 }
 
+trv::WavevectorGeometry& MeshField::ret_kgeometry() {
+  if (this->kgeom == nullptr) {
+    this->kgeom = trv::WavevectorGeometry::ret_shared(
+      this->params, this->n0_local, this->i0_start
+    );
+  }
+  return *this->kgeom;
+}
+
 
 // -----------------------------------------------------------------------
 // Mesh assignment
@@ -473,368 +1422,197 @@ void MeshField::assign_weighted_field_to_mesh(
   }
 }
 
-void MeshField::assign_weighted_field_to_mesh_ngp(
-  ParticleCatalogue& particles, fftw_complex* weight
+template<>
+void MeshField::set_assignment_stencil<1>(
+  double loc_grid, int ngrid, int ijk[1], double win[1]
 ) {
-  // Set interpolation order, i.e. number of grids, per dimension,
-  // to which a single particle is assigned.
-  const int order = 1;
+  // Carefully set covered sampling window grid indices.
+  int idx_grid = int(loc_grid);
+  if (loc_grid - idx_grid >= 0.5) {
+    idx_grid = (idx_grid == ngrid - 1) ? 0 : idx_grid + 1;
+  }
 
-  // Here the field is given by Σᵢ wᵢ δᴰ(x - xᵢ),
-  // where δᴰ ↔ δᴷ / dV, dV =: `vol_cell`.
-  const double inv_vol_cell = 1 / this->vol_cell;
+  ijk[0] = idx_grid;
 
-  // Reset field values to zero.
-  this->reset_density_field();
+  // Set sampling window value (only 0th element as ``order == 1``).
+  win[0] = 1.;
+}
 
-  // Perform assignment.
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
-    int ijk[order][3];     // grid index coordinates of covered grid cells
-    double win[order][3];  // sampling window
-    long long gid = 0;     // flattened grid cell index
+template<>
+void MeshField::set_assignment_stencil<2>(
+  double loc_grid, int ngrid, int ijk[2], double win[2]
+) {
+  // Carefully set covered sampling window grid indices.
+  int idx_grid = int(loc_grid);
 
-    for (int iaxis = 0; iaxis < 3; iaxis++) {
-      // Carefully set covered sampling window grid indices.
-      double loc_grid = this->params.ngrid[iaxis] *
-        particles[pid].pos[iaxis] / this->params.boxsize[iaxis];
-
-      int idx_grid = int(loc_grid);
-      if (loc_grid - idx_grid >= 0.5) {
-        idx_grid = (idx_grid == this->params.ngrid[iaxis] - 1)
-          ? 0 : idx_grid + 1;
-      }
+  ijk[0] = idx_grid;
+  ijk[1] = (idx_grid == ngrid - 1) ? 0 : idx_grid + 1;
 
-      ijk[0][iaxis] = idx_grid;
+  // Set sampling window value (up to the 1st element as `order == 2`).
+  double s = loc_grid - idx_grid;  // particle-to-grid grid-index distance
 
-      // Set sampling window value (only 0th element as ``order == 1``).
-      win[0][iaxis] = 1.;
-    }
+  win[0] = 1. - s;
+  win[1] = s;
+}
 
-    for (int iloc = 0; iloc < order; iloc++) {
-      for (int jloc = 0; jloc < order; jloc++) {
-        for (int kloc = 0; kloc < order; kloc++) {
-          gid = this->ret_grid_index(
-            ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-          );
-          if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-            this->field[gid][0] += inv_vol_cell
-              * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-OMP_ATOMIC
-            this->field[gid][1] += inv_vol_cell
-              * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-          }
-        }
-      }
-    }
+template<>
+void MeshField::set_assignment_stencil<3>(
+  double loc_grid, int ngrid, int ijk[3], double win[3]
+) {
+  // Carefully set covered sampling window grid indices.
+  int idx_grid = int(loc_grid);
+
+  if (loc_grid - idx_grid < 0.5) {
+    ijk[0] = (idx_grid == 0) ? ngrid - 1 : idx_grid - 1;
+    ijk[1] = idx_grid;
+    ijk[2] = (idx_grid == ngrid - 1) ? 0 : idx_grid + 1;
+  } else {
+    ijk[0] = idx_grid;
+    ijk[1] = (idx_grid == ngrid - 1) ? 0 : idx_grid + 1;
+    ijk[2] = (ijk[1] == ngrid - 1) ? 0 : ijk[1] + 1;
   }
 
-  // Perform interlacing if needed.
-  if (this->params.interlace == "true") {
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-    for (int pid = 0; pid < particles.ntotal; pid++) {
-      int ijk[order][3];
-      double win[order][3];
-      long long gid = 0;
+  // Set sampling window value (up to the 2nd element as `order == 3`).
+  double s = loc_grid - idx_grid;
 
-      for (int iaxis = 0; iaxis < 3; iaxis++) {
-        // Apply a half-grid shift and impose the periodic boundary condition.
-        double loc_grid = this->params.ngrid[iaxis]
-          * particles[pid].pos[iaxis] / this->params.boxsize[iaxis] + 0.5;
+  if (s < 0.5) {
+    win[0] = 1./2 * (1./2 - s) * (1./2 - s);
+    win[1] = 3./4 - s * s;
+    win[2] = 1./2 * (1./2 + s) * (1./2 + s);
+  } else {
+    s = 1 - s;
+    win[0] = 1./2 * (1./2 + s) * (1./2 + s);
+    win[1] = 3./4 - s * s;
+    win[2] = 1./2 * (1./2 - s) * (1./2 - s);
+  }
+}
 
-        if (loc_grid > this->params.ngrid[iaxis]) {
-          loc_grid -= this->params.ngrid[iaxis];
-        }
+template<>
+void MeshField::set_assignment_stencil<4>(
+  double loc_grid, int ngrid, int ijk[4], double win[4]
+) {
+  // Carefully set covered sampling window grid indices.
+  int idx_grid = int(loc_grid);
 
-        int idx_grid = int(loc_grid);
-        if (loc_grid - idx_grid >= 0.5) {
-          idx_grid = (idx_grid == this->params.ngrid[iaxis] - 1)
-            ? 0 : idx_grid + 1;
-        }
+  ijk[0] = (idx_grid == 0) ? ngrid - 1 : idx_grid - 1;
+  ijk[1] = idx_grid;
+  ijk[2] = (idx_grid == ngrid - 1) ? 0 : idx_grid + 1;
+  ijk[3] = (ijk[2] == ngrid - 1) ? 0 : ijk[2] + 1;
 
-        ijk[0][iaxis] = idx_grid;
+  // Set sampling window value (up to the 3rd element as `order == 4`).
+  double s = loc_grid - idx_grid;
 
-        win[0][iaxis] = 1.;
-      }
+  win[0] = 1./6 * (1. - s) * (1. - s) * (1. - s);
+  win[1] = 1./6 * (4. - 6. * s * s + 3. * s * s * s);
+  win[2] = 1./6 * (
+    4. - 6. * (1. - s) * (1. - s) + 3. * (1. - s) * (1. - s) * (1. - s)
+  );
+  win[3] = 1./6 * s * s * s;
+}
 
-      for (int iloc = 0; iloc < order; iloc++) {
-        for (int jloc = 0; jloc < order; jloc++) {
-          for (int kloc = 0; kloc < order; kloc++) {
-            gid = this->ret_grid_index(
-              ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-            );
-            if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-              this->field_s[gid][0] += inv_vol_cell
-                * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-OMP_ATOMIC
-              this->field_s[gid][1] += inv_vol_cell
-                * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-            }
-          }
-        }
+template<int order>
+void MeshField::get_assignment_stencil(
+  const double pos[3], bool shift, int ijk[3][order], double win[3][order]
+) {
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    double loc_grid = this->params.ngrid[iaxis]
+      * pos[iaxis] / this->params.boxsize[iaxis];
+
+    // Apply a half-grid shift and impose the periodic boundary condition.
+    if (shift) {
+      loc_grid += 0.5;
+      if (loc_grid > this->params.ngrid[iaxis]) {
+        loc_grid -= this->params.ngrid[iaxis];
       }
     }
+
+    MeshField::set_assignment_stencil<order>(
+      loc_grid, this->params.ngrid[iaxis], ijk[iaxis], win[iaxis]
+    );
   }
 }
 
-void MeshField::assign_weighted_field_to_mesh_cic(
+template<int order>
+void MeshField::assign_weighted_field_to_mesh_by_order(
   ParticleCatalogue& particles, fftw_complex* weight
 ) {
-  // Set interpolation order, i.e. number of grids, per dimension,
-  // to which a single particle is assigned.
-  const int order = 2;
-
-  // Here the field is given by Σᵢ wᵢ δᴰ(x - xᵢ),
-  // where δᴰ ↔ δᴷ / dV, dV =: `vol_cell`.
-  const double inv_vol_cell = 1 / this->vol_cell;
-
   // Reset field values to zero.
   this->reset_density_field();
 
-  // Perform assignment.
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
-    int ijk[order][3];     // grid index coordinates of covered grid cells
-    double win[order][3];  // sampling window
-    long long gid = 0;     // flattened grid cell index
-
-    for (int iaxis = 0; iaxis < 3; iaxis++) {
-      // Carefully set covered sampling window grid indices.
-      double loc_grid = this->params.ngrid[iaxis]
-        * particles[pid].pos[iaxis] / this->params.boxsize[iaxis];
-
-      int idx_grid = int(loc_grid);
-
-      ijk[0][iaxis] = idx_grid;
-      ijk[1][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-        ? 0 : idx_grid + 1;
-
-      // Set sampling window value (up to the 1st element as `order == 2`).
-      double s = loc_grid - idx_grid;  // particle-to-grid grid-index distance
-
-      win[0][iaxis] = 1. - s;
-      win[1][iaxis] = s;
-    }
-
-    for (int iloc = 0; iloc < order; iloc++) {
-      for (int jloc = 0; jloc < order; jloc++) {
-        for (int kloc = 0; kloc < order; kloc++) {
-          gid = this->ret_grid_index(
-            ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-          );
-          if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-            this->field[gid][0] += inv_vol_cell
-              * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-OMP_ATOMIC
-            this->field[gid][1] += inv_vol_cell
-              * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-          }
-        }
-      }
-    }
-  }
-
-  // Perform interlacing if needed.
-  if (this->params.interlace == "true") {
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-    for (int pid = 0; pid < particles.ntotal; pid++) {
-      int ijk[order][3];
-      double win[order][3];
-      long long gid = 0;
-
-      for (int iaxis = 0; iaxis < 3; iaxis++) {
-        // Apply a half-grid shift and impose the periodic boundary condition.
-        double loc_grid = this->params.ngrid[iaxis]
-          * particles[pid].pos[iaxis] / this->params.boxsize[iaxis] + 0.5;
-
-        if (loc_grid > this->params.ngrid[iaxis]) {
-          loc_grid -= this->params.ngrid[iaxis];
-        }
-
-        int idx_grid = int(loc_grid);
-
-        ijk[0][iaxis] = idx_grid;
-        ijk[1][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-          ? 0 : idx_grid + 1;
-
-        double s = loc_grid - idx_grid;
-        win[0][iaxis] = 1. - s;
-        win[1][iaxis] = s;
+  // Perform assignment (and interlacing if needed).
+  this->apply_to_fields([&](auto* field, auto* field_s) {
+    if (this->params.assignment_engine == "slab") {
+      this->assign_weighted_field_to_mesh_slab<order>(
+        particles, weight, field, false
+      );
+      if (this->params.interlace == "true") {
+        this->assign_weighted_field_to_mesh_slab<order>(
+          particles, weight, field_s, true
+        );
       }
-
-      for (int iloc = 0; iloc < order; iloc++) {
-        for (int jloc = 0; jloc < order; jloc++) {
-          for (int kloc = 0; kloc < order; kloc++) {
-            gid = this->ret_grid_index(
-              ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-            );
-            if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-              this->field_s[gid][0] += inv_vol_cell
-                * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-OMP_ATOMIC
-              this->field_s[gid][1] += inv_vol_cell
-                * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-            }
-          }
-        }
+    } else {
+      this->assign_weighted_field_to_mesh_atomic<order>(
+        particles, weight, field, false
+      );
+      if (this->params.interlace == "true") {
+        this->assign_weighted_field_to_mesh_atomic<order>(
+          particles, weight, field_s, true
+        );
       }
     }
-  }
+  });
 }
 
-void MeshField::assign_weighted_field_to_mesh_tsc(
-  ParticleCatalogue& particles, fftw_complex* weight
+template<int order, typename T>
+void MeshField::assign_weighted_field_to_mesh_atomic(
+  ParticleCatalogue& particles, fftw_complex* weight,
+  T* mesh, bool shift
 ) {
-  // Set interpolation order, i.e. number of grids, per dimension,
-  // to which a single particle is assigned.
-  const int order = 3;
-
   // Here the field is given by Σᵢ wᵢ δᴰ(x - xᵢ),
   // where δᴰ ↔ δᴷ / dV, dV =: `vol_cell`.
   const double inv_vol_cell = 1 / this->vol_cell;
 
-  // Reset field values to zero.
-  this->reset_density_field();
+  // A real-to-complex field is assigned real values only.
+  using real_t = typename std::remove_extent<T>::type;
+  real_t* mesh_real = reinterpret_cast<real_t*>(mesh);
 
-  // Perform assignment.
 #ifdef TRV_USE_OMP
 #pragma omp parallel for
 #endif  // TRV_USE_OMP
   for (int pid = 0; pid < particles.ntotal; pid++) {
-    int ijk[order][3];     // grid index coordinates of covered grid cells
-    double win[order][3];  // sampling window
+    int ijk[3][order];     // grid index coordinates of covered grid cells
+    double win[3][order];  // sampling window
     long long gid = 0;     // flattened grid cell index
 
-    for (int iaxis = 0; iaxis < 3; iaxis++) {
-      // Carefully set covered sampling window grid indices.
-      double loc_grid = this->params.ngrid[iaxis]
-        * particles[pid].pos[iaxis] / this->params.boxsize[iaxis];
-
-      int idx_grid = int(loc_grid);
-
-      if (loc_grid - idx_grid < 0.5) {
-        ijk[0][iaxis] = (idx_grid == 0)
-          ? this->params.ngrid[iaxis] - 1 : idx_grid - 1;
-        ijk[1][iaxis] = idx_grid;
-        ijk[2][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-          ? 0 : idx_grid + 1;
-      } else {
-        ijk[0][iaxis] = idx_grid;
-        ijk[1][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-          ? 0 : idx_grid + 1;
-        ijk[2][iaxis] = (ijk[1][iaxis] == this->params.ngrid[iaxis] - 1)
-          ? 0 : ijk[1][iaxis] + 1;
-      }
-
-      // Set sampling window value (up to the 2nd element as `order == 3`).
-      double s = loc_grid - idx_grid;
-
-      if (s < 0.5) {
-        win[0][iaxis] = 1./2 * (1./2 - s) * (1./2 - s);
-        win[1][iaxis] = 3./4 - s * s;
-        win[2][iaxis] = 1./2 * (1./2 + s) * (1./2 + s);
-      } else {
-        s = 1 - s;
-        win[0][iaxis] = 1./2 * (1./2 + s) * (1./2 + s);
-        win[1][iaxis] = 3./4 - s * s;
-        win[2][iaxis] = 1./2 * (1./2 - s) * (1./2 - s);
-      }
-    }
+    this->get_assignment_stencil<order>(particles[pid].pos, shift, ijk, win);
 
     for (int iloc = 0; iloc < order; iloc++) {
+      // Only grid cells in the local slab are assigned to.
+      if (ijk[0][iloc] < this->i0_start
+          || ijk[0][iloc] >= this->i0_start + this->n0_local) {continue;}
+
       for (int jloc = 0; jloc < order; jloc++) {
         for (int kloc = 0; kloc < order; kloc++) {
-          gid = this->ret_grid_index(
-            ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-          );
-          if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-            this->field[gid][0] += inv_vol_cell
-              * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
+          if (this->r2c) {
+            gid = this->ret_real_grid_index(
+              ijk[0][iloc], ijk[1][jloc], ijk[2][kloc]
+            );
+            if (0 <= gid && gid < 2*this->nmesh_alloc) {
 OMP_ATOMIC
-            this->field[gid][1] += inv_vol_cell
-              * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
+              mesh_real[gid] += inv_vol_cell * weight[pid][0]
+                * win[0][iloc] * win[1][jloc] * win[2][kloc];
+            }
+            continue;
           }
-        }
-      }
-    }
-  }
-
-  // Perform interlacing if needed.
-  if (this->params.interlace == "true") {
-#ifdef TRV_USE_OMP
-#pragma omp parallel for
-#endif  // TRV_USE_OMP
-    for (int pid = 0; pid < particles.ntotal; pid++) {
-      int ijk[order][3];
-      double win[order][3];
-      long long gid = 0;
-
-      for (int iaxis = 0; iaxis < 3; iaxis++) {
-        // Apply a half-grid shift and impose the periodic boundary condition.
-        double loc_grid = this->params.ngrid[iaxis]
-          * particles[pid].pos[iaxis] / this->params.boxsize[iaxis] + 0.5;
-
-        if (loc_grid > this->params.ngrid[iaxis]) {
-          loc_grid -= this->params.ngrid[iaxis];
-        }
-
-        int idx_grid = int(loc_grid);
-
-        if (loc_grid - idx_grid < 0.5) {
-          ijk[0][iaxis] = (idx_grid == 0)
-            ? this->params.ngrid[iaxis] - 1 : idx_grid - 1;
-          ijk[1][iaxis] = idx_grid;
-          ijk[2][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-            ? 0 : idx_grid + 1;
-        } else {
-          ijk[0][iaxis] = idx_grid;
-          ijk[1][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-            ? 0 : ijk[0][iaxis] + 1;
-          ijk[2][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-            ? 0 : ijk[1][iaxis] + 1;
-        }
-
-        double s = loc_grid - idx_grid;
-
-        if (s < 0.5) {
-          win[0][iaxis] = 1./2 * (1./2 - s) * (1./2 - s);
-          win[1][iaxis] = 3./4 - s * s;
-          win[2][iaxis] = 1./2 * (1./2 + s) * (1./2 + s);
-        } else {
-          s = 1 - s;
-          win[0][iaxis] = 1./2 * (1./2 + s) * (1./2 + s);
-          win[1][iaxis] = 3./4 - s * s;
-          win[2][iaxis] = 1./2 * (1./2 - s) * (1./2 - s);
-        }
-      }
 
-      for (int iloc = 0; iloc < order; iloc++) {
-        for (int jloc = 0; jloc < order; jloc++) {
-          for (int kloc = 0; kloc < order; kloc++) {
-            gid = this->ret_grid_index(
-              ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-            );
-            if (0 <= gid && gid < this->params.nmesh) {
+          gid = this->ret_grid_index(ijk[0][iloc], ijk[1][jloc], ijk[2][kloc]);
+          if (0 <= gid && gid < this->nmesh_local) {
 OMP_ATOMIC
-              this->field_s[gid][0] += inv_vol_cell
-                * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
+            mesh[gid][0] += inv_vol_cell
+              * weight[pid][0] * win[0][iloc] * win[1][jloc] * win[2][kloc];
 OMP_ATOMIC
-              this->field_s[gid][1] += inv_vol_cell
-                * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-            }
+            mesh[gid][1] += inv_vol_cell
+              * weight[pid][1] * win[0][iloc] * win[1][jloc] * win[2][kloc];
           }
         }
       }
@@ -842,131 +1620,207 @@ OMP_ATOMIC
   }
 }
 
-void MeshField::assign_weighted_field_to_mesh_pcs(
-  ParticleCatalogue& particles, fftw_complex* weight
+template<int order, typename T>
+void MeshField::assign_weighted_field_to_mesh_slab(
+  ParticleCatalogue& particles, fftw_complex* weight,
+  T* mesh, bool shift
 ) {
-  // Set interpolation order, i.e. number of grids, per dimension,
-  // to which a single particle is assigned.
-  const int order = 4;
-
   // Here the field is given by Σᵢ wᵢ δᴰ(x - xᵢ),
   // where δᴰ ↔ δᴷ / dV, dV =: `vol_cell`.
   const double inv_vol_cell = 1 / this->vol_cell;
 
-  // Reset field values to zero.
-  this->reset_density_field();
+  // Partition the mesh into slabs along the x-axis each at least as thick
+  // as the sampling window stencil (the last slab absorbs the remainder).
+  const int nslab = std::max(this->params.ngrid[0] / order, 1);
+
+  // Colour the slabs so that slabs of the same colour are never adjacent,
+  // where the last slab is adjacent to the first by periodic wrapping.
+  auto get_slab_colour = [nslab](int islab) {
+    if (nslab > 1 && nslab % 2 == 1 && islab == nslab - 1) {return 2;}
+    return islab % 2;
+  };
+  const int ncolour = 3;
+
+  // Bucket particles by slab with a stable counting sort, such that
+  // particles in the same slab are painted in order of their indices.
+  int nthreads = 1;
+#ifdef TRV_USE_OMP
+  nthreads = omp_get_max_threads();
+#endif  // TRV_USE_OMP
+
+  std::vector<int> slab_ids(particles.ntotal);
+  std::vector<int> pids_sorted(particles.ntotal);
+  std::vector<long long> slab_offsets(
+    static_cast<long long>(nthreads) * nslab, 0
+  );
+  std::vector<long long> slab_starts(nslab + 1, 0);
+
+  // Count the sorting buffers (including per-thread slab counts).
+  const double gbytes_sort =
+    trvs::size_in_gb<int>(2 * particles.ntotal)
+    + trvs::size_in_gb<long long>(
+      static_cast<long long>(nthreads) * nslab + nslab + 1
+    );
+
+  trvs::gbytesMem += gbytes_sort;
+  trvs::update_maxmem();
 
-  // Perform assignment.
 #ifdef TRV_USE_OMP
-#pragma omp parallel for
+#pragma omp parallel
+#endif  // TRV_USE_OMP
+  {
+    int tid = 0, nthreads_team = 1;
+#ifdef TRV_USE_OMP
+    tid = omp_get_thread_num();
+    nthreads_team = omp_get_num_threads();
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
-    int ijk[order][3];     // grid index coordinates of covered grid cells
-    double win[order][3];  // sampling window
-    long long gid = 0;     // flattened grid cell index
 
-    for (int iaxis = 0; iaxis < 3; iaxis++) {
-      // Carefully set covered sampling window grid indices.
-      double loc_grid = this->params.ngrid[iaxis]
-        * particles[pid].pos[iaxis] / this->params.boxsize[iaxis];
-
-      int idx_grid = int(loc_grid);
-
-      ijk[0][iaxis] = (idx_grid == 0)
-        ? this->params.ngrid[iaxis] - 1 : idx_grid - 1;
-      ijk[1][iaxis] = idx_grid;
-      ijk[2][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-        ? 0 : idx_grid + 1;
-      ijk[3][iaxis] = (ijk[2][iaxis] == this->params.ngrid[iaxis] - 1)
-        ? 0 : ijk[2][iaxis] + 1;
-
-      // Set sampling window value (up to the 2nd element as `order == 3`).
-      double s = loc_grid - idx_grid;
-
-      win[0][iaxis] = 1./6 * (1. - s) * (1. - s) * (1. - s);
-      win[1][iaxis] = 1./6 * (4. - 6. * s * s + 3. * s * s * s);
-      win[2][iaxis] = 1./6 * (
-        4. - 6. * (1. - s) * (1. - s) + 3. * (1. - s) * (1. - s) * (1. - s)
-      );
-      win[3][iaxis] = 1./6 * s * s * s;
+    const int pid_begin = static_cast<long long>(particles.ntotal)
+      * tid / nthreads_team;
+    const int pid_end = static_cast<long long>(particles.ntotal)
+      * (tid + 1) / nthreads_team;
+
+    long long* slab_counts_thread = &slab_offsets[
+      static_cast<long long>(tid) * nslab
+    ];
+
+    for (int pid = pid_begin; pid < pid_end; pid++) {
+      int ijk[3][order];
+      double win[3][order];
+      this->get_assignment_stencil<order>(particles[pid].pos, shift, ijk, win);
+
+      // Stencils of particles outside the box are clamped to the edge
+      // slabs, as any grid cell they cover also lies in those slabs.
+      int islab = ijk[0][0] / order;
+      islab = (ijk[0][0] < 0) ? 0 : std::min(islab, nslab - 1);
+
+      slab_ids[pid] = islab;
+      slab_counts_thread[islab]++;
     }
 
-    for (int iloc = 0; iloc < order; iloc++) {
-      for (int jloc = 0; jloc < order; jloc++) {
-        for (int kloc = 0; kloc < order; kloc++) {
-          gid = this->ret_grid_index(
-            ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-          );
-          if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-            this->field[gid][0] += inv_vol_cell
-              * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-OMP_ATOMIC
-            this->field[gid][1] += inv_vol_cell
-              * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-          }
+#ifdef TRV_USE_OMP
+#pragma omp barrier
+#pragma omp single
+#endif  // TRV_USE_OMP
+    {
+      long long offset = 0;
+      for (int islab = 0; islab < nslab; islab++) {
+        slab_starts[islab] = offset;
+        for (int ithread = 0; ithread < nthreads_team; ithread++) {
+          long long& count =
+            slab_offsets[static_cast<long long>(ithread) * nslab + islab];
+          long long count_thread = count;
+          count = offset;
+          offset += count_thread;
         }
       }
+      slab_starts[nslab] = offset;
+    }
+
+    for (int pid = pid_begin; pid < pid_end; pid++) {
+      pids_sorted[slab_counts_thread[slab_ids[pid]]++] = pid;
     }
   }
 
-  // Perform interlacing if needed.
-  if (this->params.interlace == "true") {
+  // Paint slabs of the same colour concurrently.  A real-to-complex
+  // field is assigned real values only.
+  using real_t = typename std::remove_extent<T>::type;
+  real_t* mesh_real = reinterpret_cast<real_t*>(mesh);
+
+  for (int icolour = 0; icolour < ncolour; icolour++) {
 #ifdef TRV_USE_OMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(dynamic)
 #endif  // TRV_USE_OMP
-    for (int pid = 0; pid < particles.ntotal; pid++) {
-      int ijk[order][3];
-      double win[order][3];
-      long long gid = 0;
+    for (int islab = 0; islab < nslab; islab++) {
+      if (get_slab_colour(islab) != icolour) {continue;}
 
-      for (int iaxis = 0; iaxis < 3; iaxis++) {
-        // Apply a half-grid shift and impose the periodic boundary condition.
-        double loc_grid = this->params.ngrid[iaxis]
-          * particles[pid].pos[iaxis] / this->params.boxsize[iaxis] + 0.5;
+      for (long long idx = slab_starts[islab]; idx < slab_starts[islab + 1];
+           idx++) {
+        int pid = pids_sorted[idx];
 
-        if (loc_grid > this->params.ngrid[iaxis]) {
-          loc_grid -= this->params.ngrid[iaxis];
-        }
+        int ijk[3][order];     // grid index coordinates of covered grid cells
+        double win[3][order];  // sampling window
+        long long gid = 0;     // flattened grid cell index
 
-        int idx_grid = int(loc_grid);
-
-        ijk[0][iaxis] = (idx_grid == 0)
-          ? this->params.ngrid[iaxis] - 1 : idx_grid - 1;
-        ijk[1][iaxis] = idx_grid;
-        ijk[2][iaxis] = (idx_grid == this->params.ngrid[iaxis] - 1)
-          ? 0 : idx_grid + 1;
-        ijk[3][iaxis] = (ijk[2][iaxis] == this->params.ngrid[iaxis] - 1)
-          ? 0 : ijk[2][iaxis] + 1;
-        double s = loc_grid - idx_grid;
-
-        win[0][iaxis] = 1./6 * (1. - s) * (1. - s) * (1. - s);
-        win[1][iaxis] = 1./6 * (4. - 6. * s * s + 3. * s * s * s);
-        win[2][iaxis] = 1./6 * (
-          4. - 6. * (1. - s) * (1. - s) + 3. * (1. - s) * (1. - s) * (1. - s)
+        this->get_assignment_stencil<order>(
+          particles[pid].pos, shift, ijk, win
         );
-        win[3][iaxis] = 1./6 * s * s * s;
-      }
 
-      for (int iloc = 0; iloc < order; iloc++) {
-        for (int jloc = 0; jloc < order; jloc++) {
-          for (int kloc = 0; kloc < order; kloc++) {
-            gid = this->ret_grid_index(
-              ijk[iloc][0], ijk[jloc][1], ijk[kloc][2]
-            );
-            if (0 <= gid && gid < this->params.nmesh) {
-OMP_ATOMIC
-              this->field_s[gid][0] += inv_vol_cell
-                * weight[pid][0] * win[iloc][0] * win[jloc][1] * win[kloc][2];
-OMP_ATOMIC
-              this->field_s[gid][1] += inv_vol_cell
-                * weight[pid][1] * win[iloc][0] * win[jloc][1] * win[kloc][2];
+        for (int iloc = 0; iloc < order; iloc++) {
+          // Only grid cells in the local slab are assigned to.
+          if (ijk[0][iloc] < this->i0_start
+              || ijk[0][iloc] >= this->i0_start + this->n0_local) {continue;}
+
+          for (int jloc = 0; jloc < order; jloc++) {
+            for (int kloc = 0; kloc < order; kloc++) {
+              if (this->r2c) {
+                gid = this->ret_real_grid_index(
+                  ijk[0][iloc], ijk[1][jloc], ijk[2][kloc]
+                );
+                if (0 <= gid && gid < 2*this->nmesh_alloc) {
+                  mesh_real[gid] += inv_vol_cell * weight[pid][0]
+                    * win[0][iloc] * win[1][jloc] * win[2][kloc];
+                }
+                continue;
+              }
+
+              gid = this->ret_grid_index(
+                ijk[0][iloc], ijk[1][jloc], ijk[2][kloc]
+              );
+              if (0 <= gid && gid < this->nmesh_local) {
+                mesh[gid][0] += inv_vol_cell * weight[pid][0]
+                  * win[0][iloc] * win[1][jloc] * win[2][kloc];
+                mesh[gid][1] += inv_vol_cell * weight[pid][1]
+                  * win[0][iloc] * win[1][jloc] * win[2][kloc];
+              }
             }
           }
         }
       }
     }
   }
+
+  trvs::gbytesMem -= gbytes_sort;
+}
+
+void MeshField::assign_weighted_field_to_mesh_ngp(
+  ParticleCatalogue& particles, fftw_complex* weight
+) {
+  // Set interpolation order, i.e. number of grids, per dimension,
+  // to which a single particle is assigned.
+  const int order = 1;
+
+  this->assign_weighted_field_to_mesh_by_order<order>(particles, weight);
+}
+
+void MeshField::assign_weighted_field_to_mesh_cic(
+  ParticleCatalogue& particles, fftw_complex* weight
+) {
+  // Set interpolation order, i.e. number of grids, per dimension,
+  // to which a single particle is assigned.
+  const int order = 2;
+
+  this->assign_weighted_field_to_mesh_by_order<order>(particles, weight);
+}
+
+void MeshField::assign_weighted_field_to_mesh_tsc(
+  ParticleCatalogue& particles, fftw_complex* weight
+) {
+  // Set interpolation order, i.e. number of grids, per dimension,
+  // to which a single particle is assigned.
+  const int order = 3;
+
+  this->assign_weighted_field_to_mesh_by_order<order>(particles, weight);
+}
+
+void MeshField::assign_weighted_field_to_mesh_pcs(
+  ParticleCatalogue& particles, fftw_complex* weight
+) {
+  // Set interpolation order, i.e. number of grids, per dimension,
+  // to which a single particle is assigned.
+  const int order = 4;
+
+  this->assign_weighted_field_to_mesh_by_order<order>(particles, weight);
 }
 
 double MeshField::calc_assignment_window_in_fourier(
@@ -986,9 +1840,8 @@ double MeshField::calc_assignment_window_in_fourier(
   }
 
   // Return the pre-computed window value.
-  if (order == this->window_assign_order) {
-    long long idx_grid = this->ret_grid_index(i, j, k);
-    return this->window[idx_grid];
+  if (this->kgeom != nullptr && order == this->kgeom->assignment_order) {
+    return this->kgeom->ret_window(i, j, k);
   }
 
   this->shift_grid_indices_fourier(i, j, k);
@@ -1007,57 +1860,6 @@ double MeshField::calc_assignment_window_in_fourier(
   return std::pow(wk, order);
 }
 
-void MeshField::compute_assignment_window_in_fourier(int order) {
-  if (order < 0) {
-    if (trvs::currTask == 0) {
-      trvs::logger.error(
-        "Invalid window assignment order: %d. Must be non-negative.",
-        order
-      );
-    }
-    throw trvs::InvalidParameterError(
-      "Invalid window assignment order: %d. Must be non-negative.\n",
-      order
-    );
-  }
-
-  if (this->window_assign_order == order) {return;}  // if computed already
-
-  if (trvs::currTask == 0) {
-    trvs::logger.debug(
-      "Computing interpolation window in Fourier space "
-      "for assignment order %d.",
-      order
-    );
-  }
-
-  if (this->window_assign_order == -1) {
-    this->window.resize(this->params.nmesh, 0.);  // if not yet initialised
-
-    trvs::count_rgrid += 1;
-    trvs::count_grid += .5;
-    trvs::update_maxcntgrid();
-    trvs::gbytesMem += trvs::size_in_gb<double>(this->params.nmesh);
-    trvs::update_maxmem();
-  }
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for collapse(3)
-#endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
-    for (int j = 0; j < this->params.ngrid[1]; j++) {
-      for (int k = 0; k < this->params.ngrid[2]; k++) {
-        long long idx_grid = this->ret_grid_index(i, j, k);
-        this->window[idx_grid] = this->calc_assignment_window_in_fourier(
-          i, j, k, order
-        );
-      }
-    }
-  }
-
-  this->window_assign_order = order;  // set assignment order/flag
-}
-
 
 // -----------------------------------------------------------------------
 // Field computations
@@ -1092,15 +1894,29 @@ void MeshField::compute_unweighted_field_fluctuations_insitu(
   this->compute_unweighted_field(particles);
 
   // Subtract the global mean density to compute fluctuations, i.e. δn.
-  double nbar = double(particles.ntotal) / this->vol;
+  double nbar = double(particles.ntotal_global) / this->vol;
 
+  this->apply_to_fields([&](auto* field, auto* /* field_s */) {
+    if (this->r2c) {
+      // Both components hold real values (padding is left unused).
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] -= nbar;
-    // this->field[gid][1] -= 0.; (unused)
-  }
+      for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+        field[gid][0] -= nbar;
+        field[gid][1] -= nbar;
+      }
+      return;
+    }
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+    for (long long gid = 0; gid < this->nmesh_local; gid++) {
+      field[gid][0] -= nbar;
+      // field[gid][1] -= 0.; (unused)
+    }
+  });
 }
 
 void MeshField::compute_ylm_wgtd_field(
@@ -1110,79 +1926,109 @@ void MeshField::compute_ylm_wgtd_field(
 ) {
   fftw_complex* weight_kern = nullptr;
 
-  // Compute the weighted data-source field.
-  weight_kern = fftw_alloc_complex(particles_data.ntotal);
+  // Compute the weighted random-source field.
+  weight_kern = fftw_alloc_complex(particles_rand.ntotal);
 
-  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(particles_data.ntotal);
+  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(particles_rand.ntotal);
   trvs::update_maxmem();
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles_data.ntotal; pid++) {
+  for (int pid = 0; pid < particles_rand.ntotal; pid++) {
     double los_[3] = {
-      los_data[pid].pos[0], los_data[pid].pos[1], los_data[pid].pos[2]
+      los_rand[pid].pos[0], los_rand[pid].pos[1], los_rand[pid].pos[2]
     };
 
     std::complex<double> ylm = trvm::SphericalHarmonicCalculator::
       calc_reduced_spherical_harmonic(ell, m, los_);
 
-    weight_kern[pid][0] = ylm.real() * particles_data[pid].w;
-    weight_kern[pid][1] = ylm.imag() * particles_data[pid].w;
+    weight_kern[pid][0] = ylm.real() * particles_rand[pid].w;
+    weight_kern[pid][1] = ylm.imag() * particles_rand[pid].w;
   }
 
-  this->assign_weighted_field_to_mesh(particles_data, weight_kern);
+  MeshField field_rand(this->params, false, "`field_rand`", this->r2c);
+  field_rand.assign_weighted_field_to_mesh(particles_rand, weight_kern);
 
   fftw_free(weight_kern); weight_kern = nullptr;
 
-  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles_data.ntotal);
+  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles_rand.ntotal);
 
-  // Compute the weighted random-source field.
-  weight_kern = fftw_alloc_complex(particles_rand.ntotal);
+  // Compute the weighted data-source field and its fluctuations.
+  this->compute_ylm_wgtd_field(
+    particles_data, los_data, field_rand, alpha, ell, m
+  );
+}
 
-  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(particles_rand.ntotal);
+void MeshField::compute_ylm_wgtd_field(
+  ParticleCatalogue& particles_data, LineOfSight* los_data,
+  MeshField& field_rand, double alpha, int ell, int m
+) {
+  if (
+    field_rand.r2c != this->r2c || field_rand.single != this->single
+    || field_rand.nmesh_alloc != this->nmesh_alloc
+  ) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Random-source field has an incompatible mesh grid layout."
+      );
+    }
+    throw trvs::InvalidDataError(
+      "Random-source field has an incompatible mesh grid layout.\n"
+    );
+  }
+
+  fftw_complex* weight_kern = nullptr;
+
+  // Compute the weighted data-source field.
+  weight_kern = fftw_alloc_complex(particles_data.ntotal);
+
+  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(particles_data.ntotal);
   trvs::update_maxmem();
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles_rand.ntotal; pid++) {
+  for (int pid = 0; pid < particles_data.ntotal; pid++) {
     double los_[3] = {
-      los_rand[pid].pos[0], los_rand[pid].pos[1], los_rand[pid].pos[2]
+      los_data[pid].pos[0], los_data[pid].pos[1], los_data[pid].pos[2]
     };
 
     std::complex<double> ylm = trvm::SphericalHarmonicCalculator::
       calc_reduced_spherical_harmonic(ell, m, los_);
 
-    weight_kern[pid][0] = ylm.real() * particles_rand[pid].w;
-    weight_kern[pid][1] = ylm.imag() * particles_rand[pid].w;
+    weight_kern[pid][0] = ylm.real() * particles_data[pid].w;
+    weight_kern[pid][1] = ylm.imag() * particles_data[pid].w;
   }
 
-  MeshField field_rand(this->params, false, "`field_rand`");
-  field_rand.assign_weighted_field_to_mesh(particles_rand, weight_kern);
+  this->assign_weighted_field_to_mesh(particles_data, weight_kern);
 
   fftw_free(weight_kern); weight_kern = nullptr;
 
-  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles_rand.ntotal);
+  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles_data.ntotal);
 
   // Subtract to compute fluctuations, i.e. δn_LM.
+  this->apply_to_fields(field_rand, [&](
+    auto* field, auto* field_s, auto* field_r, auto* field_rs
+  ) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] -= alpha * field_rand[gid][0];
-    this->field[gid][1] -= alpha * field_rand[gid][1];
-  }
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] -= alpha * field_r[gid][0];
+      field[gid][1] -= alpha * field_r[gid][1];
+    }
 
-  if (this->params.interlace == "true") {
+    if (this->params.interlace == "true") {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-    for (long long gid = 0; gid < this->params.nmesh; gid++) {
-      this->field_s[gid][0] -= alpha * field_rand.field_s[gid][0];
-      this->field_s[gid][1] -= alpha * field_rand.field_s[gid][1];
+      for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+        field_s[gid][0] -= alpha * field_rs[gid][0];
+        field_s[gid][1] -= alpha * field_rs[gid][1];
+      }
     }
-  }
+  });
 }
 
 void MeshField::compute_ylm_wgtd_field(
@@ -1217,13 +2063,15 @@ void MeshField::compute_ylm_wgtd_field(
   trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles.ntotal);
 
   // Apply the normalising alpha contrast.
+  this->apply_to_fields([&](auto* field, auto* /* field_s */) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] *= alpha;
-    this->field[gid][1] *= alpha;
-  }
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] *= alpha;
+      field[gid][1] *= alpha;
+    }
+  });
 }
 
 void MeshField::compute_ylm_wgtd_quad_field(
@@ -1286,7 +2134,7 @@ void MeshField::compute_ylm_wgtd_quad_field(
     weight_kern[pid][1] = ylm.imag() * std::pow(particles_rand[pid].w, 2);
   }
 
-  MeshField field_rand(this->params, false, "`field_rand`");
+  MeshField field_rand(this->params, false, "`field_rand`", this->r2c);
   field_rand.assign_weighted_field_to_mesh(particles_rand, weight_kern);
 
   fftw_free(weight_kern); weight_kern = nullptr;
@@ -1294,23 +2142,27 @@ void MeshField::compute_ylm_wgtd_quad_field(
   trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles_rand.ntotal);
 
   // Add to compute quadratic fluctuations, i.e. N_LM.
+  this->apply_to_fields(field_rand, [&](
+    auto* field, auto* field_s, auto* field_r, auto* field_rs
+  ) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] += std::pow(alpha, 2) * field_rand[gid][0];
-    this->field[gid][1] += std::pow(alpha, 2) * field_rand[gid][1];
-  }
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] += std::pow(alpha, 2) * field_r[gid][0];
+      field[gid][1] += std::pow(alpha, 2) * field_r[gid][1];
+    }
 
-  if (this->params.interlace == "true") {
+    if (this->params.interlace == "true") {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-    for (long long gid = 0; gid < this->params.nmesh; gid++) {
-      this->field_s[gid][0] += std::pow(alpha, 2) * field_rand.field_s[gid][0];
-      this->field_s[gid][1] += std::pow(alpha, 2) * field_rand.field_s[gid][1];
+      for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+        field_s[gid][0] += std::pow(alpha, 2) * field_rs[gid][0];
+        field_s[gid][1] += std::pow(alpha, 2) * field_rs[gid][1];
+      }
     }
-  }
+  });
 }
 
 void MeshField::compute_ylm_wgtd_quad_field(
@@ -1348,13 +2200,15 @@ void MeshField::compute_ylm_wgtd_quad_field(
 
   // Apply mean-density matching normalisation (i.e. alpha contrast)
   // to compute N_LM.
+  this->apply_to_fields([&](auto* field, auto* /* field_s */) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] *= std::pow(alpha, 2);
-    this->field[gid][1] *= std::pow(alpha, 2);
-  }
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] *= std::pow(alpha, 2);
+      field[gid][1] *= std::pow(alpha, 2);
+    }
+  });
 }
 
 
@@ -1369,47 +2223,167 @@ void MeshField::fourier_transform() {
     );
   }
 
+  this->apply_fourier_volume_normalisation();
+
+  // Perform FFT.  A pooled field and its shadow field are contiguous and
+  // transformed together with a batched plan.
+  const bool interlace = (this->params.interlace == "true");
+  if (this->distributed) {
+    this->slab_transform->execute(this->field);
+    if (interlace) {this->slab_transform->execute(this->field_s);}
+  } else
+  if (this->single && this->batch_transform_sp != nullptr && this->r2c) {
+    fftwf_execute_dft_r2c(
+      this->batch_transform_sp,
+      reinterpret_cast<float*>(this->field_sp), this->field_sp
+    );
+  } else
+  if (this->single && this->batch_transform_sp != nullptr) {
+    fftwf_execute_dft(
+      this->batch_transform_sp, this->field_sp, this->field_sp
+    );
+  } else
+  if (this->single && this->r2c) {
+    fftwf_execute_dft_r2c(
+      this->transform_sp,
+      reinterpret_cast<float*>(this->field_sp), this->field_sp
+    );
+    if (interlace) {
+      fftwf_execute_dft_r2c(
+        this->transform_sp,
+        reinterpret_cast<float*>(this->field_s_sp), this->field_s_sp
+      );
+    }
+  } else
+  if (this->single) {
+    fftwf_execute_dft(this->transform_sp, this->field_sp, this->field_sp);
+    if (interlace) {
+      fftwf_execute_dft(
+        this->transform_sp, this->field_s_sp, this->field_s_sp
+      );
+    }
+  } else
+  if (this->batch_transform != nullptr && this->r2c) {
+    fftw_execute_dft_r2c(
+      this->batch_transform,
+      reinterpret_cast<double*>(this->field), this->field
+    );
+  } else
+  if (this->batch_transform != nullptr) {
+    fftw_execute_dft(this->batch_transform, this->field, this->field);
+  } else
+  if (this->plan_ext && this->r2c) {
+    fftw_execute_dft_r2c(
+      this->transform, reinterpret_cast<double*>(this->field), this->field
+    );
+    if (interlace) {
+      fftw_execute_dft_r2c(
+        this->transform_s,
+        reinterpret_cast<double*>(this->field_s), this->field_s
+      );
+    }
+  } else
+  if (this->plan_ext) {
+    fftw_execute_dft(this->transform, this->field, this->field);
+    if (interlace) {
+      fftw_execute_dft(this->transform_s, this->field_s, this->field_s);
+    }
+  } else {
+    fftw_execute(this->transform);
+    if (interlace) {fftw_execute(this->transform_s);}
+  }
+  trvs::count_fft += interlace ? 2 : 1;
+
+  // Interlace with the shadow field.
+  if (interlace) {
+    this->interlace_shadow_field();
+  }
+}
+
+void MeshField::inv_fourier_transform() {
+  if (trvs::currTask == 0) {
+    trvs::logger.debug(
+      "Performing inverse Fourier transform of '%s'.", this->name.c_str()
+    );
+  }
+
+  // Apply inverse FFT volume normalisation, where ∫d³k/(2π)³ ↔ (1/V) Σᵢ,
+  // V =: `vol`.
+  this->apply_to_fields([this](auto* field, auto* /* field_s */) {
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] /= this->vol;
+      field[gid][1] /= this->vol;
+    }
+  });
+
+  // Perform inverse FFT.
+  if (this->distributed) {
+    this->slab_inv_transform->execute(this->field);
+  } else
+  if (this->single && this->r2c) {
+    fftwf_execute_dft_c2r(
+      this->inv_transform_sp,
+      this->field_sp, reinterpret_cast<float*>(this->field_sp)
+    );
+  } else
+  if (this->single) {
+    fftwf_execute_dft(
+      this->inv_transform_sp, this->field_sp, this->field_sp
+    );
+  } else
+  if (this->plan_ext && this->r2c) {
+    fftw_execute_dft_c2r(
+      this->inv_transform, this->field, reinterpret_cast<double*>(this->field)
+    );
+  } else
+  if (this->plan_ext) {
+    fftw_execute_dft(this->inv_transform, this->field, this->field);
+  } else {
+    fftw_execute(this->inv_transform);
+  }
+  trvs::count_ifft += 1;
+}
+
+
+void MeshField::apply_fourier_volume_normalisation() {
   // Apply FFT volume normalisation, where ∫d³x ↔ dV Σᵢ, dV =: `vol_cell`.
+  this->apply_to_fields([this](auto* field, auto* field_s) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] *= this->vol_cell;
-    this->field[gid][1] *= this->vol_cell;
-  }
-
-  // Perform FFT.
-  if (this->plan_ext) {
-    fftw_execute_dft(this->transform, this->field, this->field);
-  } else {
-    fftw_execute(this->transform);
-  }
-  trvs::count_fft += 1;
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] *= this->vol_cell;
+      field[gid][1] *= this->vol_cell;
+    }
 
-  // Interlace with the shadow field.
-  if (this->params.interlace == "true") {
+    if (this->params.interlace == "true") {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-    for (long long gid = 0; gid < this->params.nmesh; gid++) {
-      this->field_s[gid][0] *= this->vol_cell;
-      this->field_s[gid][1] *= this->vol_cell;
+      for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+        field_s[gid][0] *= this->vol_cell;
+        field_s[gid][1] *= this->vol_cell;
+      }
     }
+  });
+}
 
-    if (this->plan_ext) {
-      fftw_execute_dft(this->transform_s, this->field_s, this->field_s);
-    } else {
-      fftw_execute(this->transform_s);
-    }
-    trvs::count_fft += 1;
+void MeshField::interlace_shadow_field() {
+  // Only non-negative k_z modes are stored for a real-to-complex field.
+  const int ngrid_z = this->r2c
+    ? this->params.ngrid[2]/2 + 1 : this->params.ngrid[2];
 
+  this->apply_to_fields([&](auto* field, auto* field_s) {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for collapse(3)
 #endif  // TRV_USE_OMP
-    for (int i = 0; i < this->params.ngrid[0]; i++) {
+    for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
       for (int j = 0; j < this->params.ngrid[1]; j++) {
-        for (int k = 0; k < this->params.ngrid[2]; k++) {
-          long long idx_grid = this->ret_grid_index(i, j, k);
+        for (int k = 0; k < ngrid_z; k++) {
+          long long idx_grid = this->ret_fourier_grid_index(i, j, k);
 
           // Calculate the index vector representing the grid cell.
           double m[3];
@@ -1428,47 +2402,21 @@ void MeshField::fourier_transform() {
           // sign of `arg`.
           double arg = M_PI * (m[0] + m[1] + m[2]);
 
-          this->field[idx_grid][0] +=
-            std::cos(arg) * this->field_s[idx_grid][0]
-            - std::sin(arg) * this->field_s[idx_grid][1]
+          field[idx_grid][0] +=
+            std::cos(arg) * field_s[idx_grid][0]
+            - std::sin(arg) * field_s[idx_grid][1]
           ;
-          this->field[idx_grid][1] +=
-            std::sin(arg) * this->field_s[idx_grid][0]
-            + std::cos(arg) * this->field_s[idx_grid][1]
+          field[idx_grid][1] +=
+            std::sin(arg) * field_s[idx_grid][0]
+            + std::cos(arg) * field_s[idx_grid][1]
           ;
 
-          this->field[idx_grid][0] /= 2.;
-          this->field[idx_grid][1] /= 2.;
+          field[idx_grid][0] /= 2.;
+          field[idx_grid][1] /= 2.;
         }
       }
     }
-  }
-}
-
-void MeshField::inv_fourier_transform() {
-  if (trvs::currTask == 0) {
-    trvs::logger.debug(
-      "Performing inverse Fourier transform of '%s'.", this->name.c_str()
-    );
-  }
-
-  // Apply inverse FFT volume normalisation, where ∫d³k/(2π)³ ↔ (1/V) Σᵢ,
-  // V =: `vol`.
-#ifdef TRV_USE_OMP
-#pragma omp parallel for simd
-#endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    this->field[gid][0] /= this->vol;
-    this->field[gid][1] /= this->vol;
-  }
-
-  // Perform inverse FFT.
-  if (this->plan_ext) {
-    fftw_execute_dft(this->inv_transform, this->field, this->field);
-  } else {
-    fftw_execute(this->inv_transform);
-  }
-  trvs::count_ifft += 1;
+  });
 }
 
 
@@ -1489,7 +2437,7 @@ void MeshField::apply_wide_angle_pow_law_kernel() {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for collapse(3)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = this->ret_grid_index(i, j, k);
@@ -1502,6 +2450,22 @@ void MeshField::apply_wide_angle_pow_law_kernel() {
         if (r_ < eps_r) {
           // this->field[idx_grid][0] *= 0.; (unused)
           // this->field[idx_grid][1] *= 0.; (unused)
+        } else
+        if (this->single && this->r2c) {
+          reinterpret_cast<float*>(this->field_sp)[
+            this->ret_real_grid_index(i, j, k)
+          ] *= std::pow(r_, - this->params.i_wa - this->params.j_wa);
+        } else
+        if (this->single) {
+          this->field_sp[idx_grid][0] *=
+            std::pow(r_, - this->params.i_wa - this->params.j_wa);
+          this->field_sp[idx_grid][1] *=
+            std::pow(r_, - this->params.i_wa - this->params.j_wa);
+        } else
+        if (this->r2c) {
+          reinterpret_cast<double*>(this->field)[
+            this->ret_real_grid_index(i, j, k)
+          ] *= std::pow(r_, - this->params.i_wa - this->params.j_wa);
         } else {
           this->field[idx_grid][0] *=
             std::pow(r_, - this->params.i_wa - this->params.j_wa);
@@ -1520,20 +2484,62 @@ void MeshField::apply_assignment_compensation() {
     );
   }
 
-  this->compute_assignment_window_in_fourier(this->params.assignment_order);
+  const trv::WavevectorGeometry& kgeom = this->ret_kgeometry();
+
+  // Only non-negative k_z modes are stored for a real-to-complex field.
+  const int ngrid_z = this->r2c
+    ? this->params.ngrid[2]/2 + 1 : this->params.ngrid[2];
 
+  this->apply_to_fields([&](auto* field, auto* /* field_s */) {
 #ifdef TRV_USE_OMP
-#pragma omp parallel for collapse(3)
+#pragma omp parallel for collapse(2)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
-    for (int j = 0; j < this->params.ngrid[1]; j++) {
-      for (int k = 0; k < this->params.ngrid[2]; k++) {
-        long long idx_grid = this->ret_grid_index(i, j, k);
-        this->field[idx_grid][0] /= this->window[idx_grid];
-        this->field[idx_grid][1] /= this->window[idx_grid];
+    for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
+      for (int j = 0; j < this->params.ngrid[1]; j++) {
+        double win_xy = kgeom.window_x[i] * kgeom.window_y[j];
+        for (int k = 0; k < ngrid_z; k++) {
+          long long idx_mode = this->ret_fourier_grid_index(i, j, k);
+          double win = win_xy * kgeom.window_z[k];
+          field[idx_mode][0] /= win;
+          field[idx_mode][1] /= win;
+        }
       }
     }
+  });
+}
+
+void MeshField::apply_order_negation(int M) {
+  if (trvs::currTask == 0) {
+    trvs::logger.debug(
+      "Negating the order of '%s' (M = %d).", this->name.c_str(), M
+    );
   }
+
+  const double sign = (M % 2 == 0) ? 1. : -1.;
+
+  // Both components in half-complex storage of a real-to-complex field
+  // hold real values, which are their own complex conjugates.
+  const double sign_imag = this->r2c ? sign : - sign;
+
+  this->apply_to_fields([&](auto* field, auto* field_s) {
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+    for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+      field[gid][0] *= sign;
+      field[gid][1] *= sign_imag;
+    }
+
+    if (this->params.interlace == "true") {
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+      for (long long gid = 0; gid < this->nmesh_alloc; gid++) {
+        field_s[gid][0] *= sign;
+        field_s[gid][1] *= sign_imag;
+      }
+    }
+  });
 }
 
 
@@ -1542,7 +2548,8 @@ void MeshField::apply_assignment_compensation() {
 // -----------------------------------------------------------------------
 
 void MeshField::inv_fourier_transform_ylm_wgtd_field_band_limited(
-  MeshField& field_fourier, std::vector< std::complex<double> >& ylm,
+  MeshField& field_fourier,
+  const trvm::SphericalHarmonicTable& ylm, const int m,
   double k_lower, double k_upper,
   double& k_eff, int& nmodes
 ) {
@@ -1563,34 +2570,34 @@ void MeshField::inv_fourier_transform_ylm_wgtd_field_band_limited(
   k_eff = 0.;
   nmodes = 0;
 
-  // Perform wavevector mode binning in the band.
-  this->compute_assignment_window_in_fourier(this->params.assignment_order);
+  // Perform wavevector mode binning in the band.  The wavevector
+  // geometry is also retained by the Fourier-space field, which
+  // typically outlives this field.
+  field_fourier.ret_kgeometry();
+  const trv::WavevectorGeometry& kgeom = this->ret_kgeometry();
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for collapse(3) reduction(+:k_eff, nmodes)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = this->ret_grid_index(i, j, k);
 
-        double kv[3];
-        this->get_grid_wavevector(i, j, k, kv);
-
-        double k_ = trvm::get_vec3d_magnitude(kv);
+        double k_ = kgeom.ret_kmag(i, j, k);
 
         // Determine the grid cell contribution to the band.
         if (k_lower <= k_ && k_ < k_upper) {
-          std::complex<double> fk(
-            field_fourier[idx_grid][0], field_fourier[idx_grid][1]
-          );
+          std::complex<double> fk = field_fourier.ret_fourier_mode(i, j, k);
 
           // Apply assignment compensation.
-          fk /= this->window[idx_grid];
+          fk /= kgeom.ret_window(i, j, k);
 
           // Weight the field.
-          this->field[idx_grid][0] = (ylm[idx_grid] * fk).real();
-          this->field[idx_grid][1] = (ylm[idx_grid] * fk).imag();
+          std::complex<double> ylm_fk = ylm.eval(m, i, j, k) * fk;
+
+          this->field[idx_grid][0] = ylm_fk.real();
+          this->field[idx_grid][1] = ylm_fk.imag();
 
           k_eff += k_;
           nmodes++;
@@ -1604,7 +2611,14 @@ void MeshField::inv_fourier_transform_ylm_wgtd_field_band_limited(
     }
   }
 
+  // Sum contributions to the band from all slabs.
+  trvs::allreduce_sum(&k_eff, 1);
+  trvs::allreduce_sum(&nmodes, 1);
+
   // Perform inverse FFT.
+  if (this->distributed) {
+    this->slab_inv_transform->execute(this->field);
+  } else
   if (this->plan_ext) {
     fftw_execute_dft(this->inv_transform, this->field, this->field);
   } else {
@@ -1616,7 +2630,7 @@ void MeshField::inv_fourier_transform_ylm_wgtd_field_band_limited(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
+  for (long long gid = 0; gid < this->nmesh_local; gid++) {
     this->field[gid][0] /= double(nmodes);
     this->field[gid][1] /= double(nmodes);
   }
@@ -1626,8 +2640,8 @@ void MeshField::inv_fourier_transform_ylm_wgtd_field_band_limited(
 
 void MeshField::inv_fourier_transform_sjl_ylm_wgtd_field(
     MeshField& field_fourier,
-    std::vector< std::complex<double> >& ylm,
-    trvm::SphericalBesselCalculator& sjl,
+    const trvm::SphericalHarmonicTable& ylm, const int m,
+    const trvm::SphericalBesselCalculator& sjl,
     double r
 ) {
   if (trvs::currTask == 0) {
@@ -1638,109 +2652,536 @@ void MeshField::inv_fourier_transform_sjl_ylm_wgtd_field(
     );
   }
 
-  // The nested for-loops below cover all grid point computations
-  // so this is redundant.
-  // // Reset field values to zero.
-  // this->reset_density_field();
-
-  // Compute the field weighted by the spherical Bessel function and
-  // reduced spherical harmonics.
-  this->compute_assignment_window_in_fourier(this->params.assignment_order);
+  // The nested for-loops below cover all grid point computations
+  // so this is redundant.
+  // // Reset field values to zero.
+  // this->reset_density_field();
+
+  // Compute the field weighted by the spherical Bessel function and
+  // reduced spherical harmonics.
+  field_fourier.ret_kgeometry();
+  trv::WavevectorGeometry& kgeom = this->ret_kgeometry();
+
+  // Evaluate the spherical Bessel function once per unique wavevector
+  // magnitude.
+  std::vector<double> sjl_unique;
+  sjl.eval_batch(kgeom.ret_unique_kmag(), r, sjl_unique);
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(3)
+#endif  // TRV_USE_OMP
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
+    for (int j = 0; j < this->params.ngrid[1]; j++) {
+      for (int k = 0; k < this->params.ngrid[2]; k++) {
+        long long idx_grid = this->ret_grid_index(i, j, k);
+
+        double sj = sjl_unique[kgeom.ret_unique_kmag_index(i, j, k)];
+
+        // Apply assignment compensation.
+        std::complex<double> fk = field_fourier.ret_fourier_mode(i, j, k);
+
+        fk /= kgeom.ret_window(i, j, k);
+
+        // Weight the field including the volume normalisation,
+        // where ∫d³k/(2π)³ ↔ (1/V) Σᵢ, V =: `vol`.
+        std::complex<double> ylm_fk = ylm.eval(m, i, j, k) * fk;
+
+        this->field[idx_grid][0] = sj * ylm_fk.real() / this->vol;
+        this->field[idx_grid][1] = sj * ylm_fk.imag() / this->vol;
+      }
+    }
+  }
+
+  // Perform inverse FFT.
+  if (this->distributed) {
+    this->slab_inv_transform->execute(this->field);
+  } else
+  if (this->plan_ext) {
+    fftw_execute_dft(this->inv_transform, this->field, this->field);
+  } else {
+    fftw_execute(this->inv_transform);
+  }
+  trvs::count_ifft += 1;
+}
+
+
+// -----------------------------------------------------------------------
+// Misc
+// -----------------------------------------------------------------------
+
+double MeshField::calc_grid_based_powlaw_norm(
+  ParticleCatalogue& particles, int order
+) {
+  // Initialise the weight field.
+  fftw_complex* weight = nullptr;
+
+  weight = fftw_alloc_complex(particles.ntotal);
+
+  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(particles.ntotal);
+  trvs::update_maxmem();
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+  for (int pid = 0; pid < particles.ntotal; pid++) {
+    weight[pid][0] = particles[pid].w;
+    weight[pid][1] = 0.;
+  }
+
+  // Compute the weighted field.
+  this->assign_weighted_field_to_mesh(particles, weight);
+
+  fftw_free(weight); weight = nullptr;
+
+  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles.ntotal);
+
+  // Compute normalisation volume integral, where ∫d³x ↔ dV Σᵢ,
+  // dV =: `vol_cell`.
+  double vol_int = 0.;
+
+  if (this->r2c) {
+    double* field_real = reinterpret_cast<double*>(this->field);
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(3) reduction(+:vol_int)
+#endif  // TRV_USE_OMP
+    for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
+      for (int j = 0; j < this->params.ngrid[1]; j++) {
+        for (int k = 0; k < this->params.ngrid[2]; k++) {
+          vol_int += std::pow(
+            field_real[this->ret_real_grid_index(i, j, k)], order
+          );
+        }
+      }
+    }
+  } else {
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd reduction(+:vol_int)
+#endif  // TRV_USE_OMP
+    for (long long gid = 0; gid < this->nmesh_local; gid++) {
+      vol_int += std::pow(this->field[gid][0], order);
+    }
+  }
+
+  trvs::allreduce_sum(&vol_int, 1);
+
+  vol_int *= this->vol_cell;
+
+  double norm_factor = 1. / vol_int;
+
+  return norm_factor;
+}
+
+
+// ***********************************************************************
+// Mesh field batch
+// ***********************************************************************
+
+// -----------------------------------------------------------------------
+// Life cycle
+// -----------------------------------------------------------------------
+
+MeshFieldBatch::MeshFieldBatch(
+  trv::ParameterSet& params, trv::MeshFieldPool& pool,
+  const std::vector<std::string>& names, bool r2c
+) {
+  this->nfields = int(names.size());
+  this->pool = &pool;
+
+  // Determine the field size in the same way as for each mesh field.
+  int n0_local, i0_start;
+  trvs::allocate_slab(params.ngrid[0], n0_local, i0_start);
+  bool distributed = (trvs::numTasks > 1);
+  this->r2c = r2c && !distributed;
+  this->single = (params.precision == "single") && !distributed;
+
+  long long nmesh_alloc = distributed
+    ? static_cast<long long>(n0_local) * params.ngrid[1] * params.ngrid[2]
+    : pool.ret_mesh_size(this->r2c);
+  long long nstride = trv::MeshFieldPool::ret_mesh_stride(
+    nmesh_alloc, this->single
+  );
+
+  this->interlace = (params.interlace == "true");
+  const int nmesh_field = this->interlace ? 2 : 1;
+
+  // Share the batched FFTW plan from the pool.  This is obtained before
+  // the buffer so that any buffer used for planning is reused below.
+  if (this->single) {
+    this->transform_sp = pool.ret_batch_plan_sp(
+      this->r2c, this->nfields * nmesh_field
+    );
+  } else
+  if (!distributed) {
+    this->transform = pool.ret_batch_plan(
+      this->r2c, this->nfields * nmesh_field
+    );
+  }
+
+  // Acquire a contiguous buffer for all fields (and their shadow fields
+  // if interlacing is used).
+  if (this->single) {
+    this->buffer_sp = pool.acquire_buffer_sp(
+      this->nfields * nmesh_field * nstride
+    );
+  } else {
+    this->buffer = pool.acquire_buffer(
+      this->nfields * nmesh_field * nstride
+    );
+  }
+  for (int ifield = 0; ifield < this->nfields; ifield++) {
+    void* buffer_field = this->single
+      ? static_cast<void*>(this->buffer_sp + ifield * nmesh_field * nstride)
+      : static_cast<void*>(this->buffer + ifield * nmesh_field * nstride);
+    this->fields.push_back(new trv::MeshField(
+      params, pool, names[ifield], this->r2c, buffer_field
+    ));
+  }
+}
+
+MeshFieldBatch::~MeshFieldBatch() {
+  for (int ifield = 0; ifield < this->nfields; ifield++) {
+    delete this->fields[ifield]; this->fields[ifield] = nullptr;
+  }
+  if (this->single) {
+    this->pool->release_buffer(this->buffer_sp); this->buffer_sp = nullptr;
+  } else {
+    this->pool->release_buffer(this->buffer); this->buffer = nullptr;
+  }
+}
+
+
+// -----------------------------------------------------------------------
+// Operators & reserved methods
+// -----------------------------------------------------------------------
+
+trv::MeshField& MeshFieldBatch::operator[](int ifield) {
+  return *this->fields[ifield];
+}
+
+
+// -----------------------------------------------------------------------
+// Field transforms
+// -----------------------------------------------------------------------
+
+void MeshFieldBatch::fourier_transform() {
+  if (this->transform == nullptr && this->transform_sp == nullptr) {
+    for (int ifield = 0; ifield < this->nfields; ifield++) {
+      this->fields[ifield]->fourier_transform();
+    }
+    return;
+  }
+
+  if (trvs::currTask == 0) {
+    trvs::logger.debug(
+      "Performing batched Fourier transform of %d fields.", this->nfields
+    );
+  }
+
+  for (int ifield = 0; ifield < this->nfields; ifield++) {
+    this->fields[ifield]->apply_fourier_volume_normalisation();
+  }
+
+  // Perform batched FFT.
+  if (this->single && this->r2c) {
+    fftwf_execute_dft_r2c(
+      this->transform_sp,
+      reinterpret_cast<float*>(this->buffer_sp), this->buffer_sp
+    );
+  } else
+  if (this->single) {
+    fftwf_execute_dft(this->transform_sp, this->buffer_sp, this->buffer_sp);
+  } else
+  if (this->r2c) {
+    fftw_execute_dft_r2c(
+      this->transform, reinterpret_cast<double*>(this->buffer), this->buffer
+    );
+  } else {
+    fftw_execute_dft(this->transform, this->buffer, this->buffer);
+  }
+
+  // Interlace with the shadow fields.
+  if (this->interlace) {
+    trvs::count_fft += 2 * this->nfields;
+    for (int ifield = 0; ifield < this->nfields; ifield++) {
+      this->fields[ifield]->interlace_shadow_field();
+    }
+  } else {
+    trvs::count_fft += this->nfields;
+  }
+}
+
+
+// ***********************************************************************
+// Shell field cache
+// ***********************************************************************
+
+// -----------------------------------------------------------------------
+// Life cycle
+// -----------------------------------------------------------------------
+
+ShellFieldCache::ShellFieldCache(
+  trv::ParameterSet& params, int num_shells, const std::string& name
+) {
+  this->name = name;
+  this->num_shells = num_shells;
+
+  // Match the slab decomposition of mesh fields.
+  int n0_local, i0_start;
+  trvs::allocate_slab(params.ngrid[0], n0_local, i0_start);
+  this->nmesh = static_cast<long long>(n0_local)
+    * params.ngrid[1] * params.ngrid[2];
+  this->k_eff.resize(num_shells, 0.);
+  this->nmodes.resize(num_shells, 0);
+
+  long long ncells = this->nmesh * this->num_shells;
+  this->nbytes = sizeof(fftw_complex) * static_cast<std::size_t>(ncells);
+
+  // Spill to a disk-backed memory map if so planned (see
+  // @ref trv::plan_memory_usage) or if the cache does not fit in
+  // the available physical memory.
+  this->spilled = (params.shell_cache == "disk");
+
+  long npages_avail = sysconf(_SC_AVPHYS_PAGES);
+  long pagesize = sysconf(_SC_PAGESIZE);
+  if (!this->spilled && npages_avail > 0 && pagesize > 0) {
+    double nbytes_avail = double(npages_avail) * double(pagesize);
+    this->spilled = double(this->nbytes) > nbytes_avail;
+  }
+
+  if (!this->spilled) {
+    this->cache = fftw_alloc_complex(ncells);
+
+    trvs::count_cgrid += this->num_shells;
+    trvs::count_grid += this->num_shells;
+    trvs::update_maxcntgrid();
+    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(ncells);
+    trvs::update_maxmem();
+    return;
+  }
+
+  std::string spill_dir = params.measurement_dir.empty()
+    ? std::string(".") : params.measurement_dir;
+  std::string spill_template = spill_dir + "/.trv_shell_cache_XXXXXX";
+  std::vector<char> spill_path(
+    spill_template.begin(), spill_template.end()
+  );
+  spill_path.push_back('\0');
+
+  int fd = mkstemp(spill_path.data());
+  if (fd < 0) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Failed to create spill file for '%s' in directory: %s",
+        this->name.c_str(), spill_dir.c_str()
+      );
+    }
+    throw trvs::IOError(
+      "Failed to create spill file for '%s' in directory: %s\n",
+      this->name.c_str(), spill_dir.c_str()
+    );
+  }
+  unlink(spill_path.data());
+
+  void* addr = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(this->nbytes)) == 0) {
+    addr = mmap(
+      nullptr, this->nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0
+    );
+  }
+  close(fd);
 
-#ifdef TRV_USE_OMP
-#pragma omp parallel
-#endif  // TRV_USE_OMP
-{
-  // Create thread-private copies of the spherical Bessel function calculator.
-  trvm::SphericalBesselCalculator sjl_thread(sjl);
+  if (addr == MAP_FAILED) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Failed to map spill file for '%s' (%.3f GiB).",
+        this->name.c_str(), double(this->nbytes) / 1073741824.
+      );
+    }
+    throw trvs::IOError(
+      "Failed to map spill file for '%s' (%.3f GiB).\n",
+      this->name.c_str(), double(this->nbytes) / 1073741824.
+    );
+  }
 
-#ifdef TRV_USE_OMP
-#pragma omp for collapse(3)
-#endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
-    for (int j = 0; j < this->params.ngrid[1]; j++) {
-      for (int k = 0; k < this->params.ngrid[2]; k++) {
-        long long idx_grid = this->ret_grid_index(i, j, k);
+  this->cache = static_cast<fftw_complex*>(addr);
 
-        double kv[3];
-        this->get_grid_wavevector(i, j, k, kv);
+  if (trvs::currTask == 0) {
+    trvs::logger.info(
+      "Spilled '%s' to a disk-backed memory map (%.3f GiB).",
+      this->name.c_str(), double(this->nbytes) / 1073741824.
+    );
+  }
+}
 
-        double k_ = trvm::get_vec3d_magnitude(kv);
+ShellFieldCache::~ShellFieldCache() {
+  if (this->cache == nullptr) {return;}
 
-        // Apply assignment compensation.
-        std::complex<double> fk(
-          field_fourier[idx_grid][0], field_fourier[idx_grid][1]
-        );
+  if (this->spilled) {
+    munmap(this->cache, this->nbytes);
+  } else {
+    fftw_free(this->cache);
 
-        fk /= this->window[idx_grid];
+    long long ncells = this->nmesh * this->num_shells;
 
-        // Weight the field including the volume normalisation,
-        // where ∫d³k/(2π)³ ↔ (1/V) Σᵢ, V =: `vol`.
-        this->field[idx_grid][0] =
-          sjl_thread.eval(k_ * r) * (ylm[idx_grid] * fk).real() / this->vol;
-        this->field[idx_grid][1] =
-          sjl_thread.eval(k_ * r) * (ylm[idx_grid] * fk).imag() / this->vol;
-      }
-    }
+    trvs::count_cgrid -= this->num_shells;
+    trvs::count_grid -= this->num_shells;
+    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(ncells);
   }
+  this->cache = nullptr;
 }
 
-  // Perform inverse FFT.
-  if (this->plan_ext) {
-    fftw_execute_dft(this->inv_transform, this->field, this->field);
-  } else {
-    fftw_execute(this->inv_transform);
-  }
-  trvs::count_ifft += 1;
+const fftw_complex* ShellFieldCache::operator[](int ishell) const {
+  return this->cache + static_cast<long long>(ishell) * this->nmesh;
 }
 
 
 // -----------------------------------------------------------------------
-// Misc
+// Computation
 // -----------------------------------------------------------------------
 
-double MeshField::calc_grid_based_powlaw_norm(
-  ParticleCatalogue& particles, int order
+void ShellFieldCache::compute_shell_fields(
+  MeshField& field_fourier,
+  const trvm::SphericalHarmonicTable& ylm, const int m,
+  trv::Binning& binning, MeshField& workspace
 ) {
-  // Initialise the weight field.
-  fftw_complex* weight = nullptr;
-
-  weight = fftw_alloc_complex(particles.ntotal);
+  for (int ishell = 0; ishell < this->num_shells; ishell++) {
+    workspace.inv_fourier_transform_ylm_wgtd_field_band_limited(
+      field_fourier, ylm, m,
+      binning.bin_edges[ishell], binning.bin_edges[ishell + 1],
+      this->k_eff[ishell], this->nmodes[ishell]
+    );
 
-  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(particles.ntotal);
-  trvs::update_maxmem();
+    fftw_complex* shell_field =
+      this->cache + static_cast<long long>(ishell) * this->nmesh;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
-    weight[pid][0] = particles[pid].w;
-    weight[pid][1] = 0.;
+    for (long long gid = 0; gid < this->nmesh; gid++) {
+      shell_field[gid][0] = workspace[gid][0];
+      shell_field[gid][1] = workspace[gid][1];
+    }
   }
+}
 
-  // Compute the weighted field.
-  this->assign_weighted_field_to_mesh(particles, weight);
+void ShellFieldCache::compute_sjl_fields(
+  MeshField& field_fourier,
+  const trvm::SphericalHarmonicTable& ylm, const int m,
+  const trvm::SphericalBesselCalculator& sjl,
+  const std::vector<double>& r, MeshField& workspace
+) {
+  for (int ishell = 0; ishell < this->num_shells; ishell++) {
+    workspace.inv_fourier_transform_sjl_ylm_wgtd_field(
+      field_fourier, ylm, m, sjl, r[ishell]
+    );
 
-  fftw_free(weight); weight = nullptr;
+    fftw_complex* shell_field =
+      this->cache + static_cast<long long>(ishell) * this->nmesh;
 
-  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(particles.ntotal);
+#ifdef TRV_USE_OMP
+#pragma omp parallel for simd
+#endif  // TRV_USE_OMP
+    for (long long gid = 0; gid < this->nmesh; gid++) {
+      shell_field[gid][0] = workspace[gid][0];
+      shell_field[gid][1] = workspace[gid][1];
+    }
+  }
+}
 
-  // Compute normalisation volume integral, where ∫d³x ↔ dV Σᵢ,
-  // dV =: `vol_cell`.
-  double vol_int = 0.;
 
+// ***********************************************************************
+// Binned reduction
+// ***********************************************************************
+
+BinnedReduction::BinnedReduction(
+  trv::Binning& binning, int n_sample, double d_sample,
+  int ncomp, int nplanes, const std::string& reduction
+) {
+  this->num_bins = binning.num_bins;
+  this->ncomp = ncomp;
+  this->ordered = (reduction == "ordered");
+  this->n_sample = n_sample;
+  this->d_sample = d_sample;
+
+  // Assign fine samples to bins, where only the fine samples around
+  // each bin are scanned but their membership is tested exactly.
+  this->sample_bins.assign(n_sample, -1);
+  for (int ibin = 0; ibin < binning.num_bins; ibin++) {
+    double coord_lower = binning.bin_edges[ibin];
+    double coord_upper = binning.bin_edges[ibin + 1];
+    int i_lower = std::max(0, int(coord_lower / d_sample) - 1);
+    for (int i = i_lower; i < n_sample; i++) {
+      double coord = i * d_sample;
+      if (coord >= coord_upper) {break;}
+      if (this->sample_bins[i] == -1 && coord_lower <= coord) {
+        this->sample_bins[i] = ibin;
+      }
+    }
+  }
+
+  // Set up partial bins, each padded to whole cache lines (of 64 bytes)
+  // to avoid false sharing between threads.
+  if (this->ordered) {
+    this->npartials = nplanes;
+  } else {
 #ifdef TRV_USE_OMP
-#pragma omp parallel for simd reduction(+:vol_int)
+    this->npartials = omp_get_max_threads();
+#else   // !TRV_USE_OMP
+    this->npartials = 1;
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < this->params.nmesh; gid++) {
-    vol_int += std::pow(this->field[gid][0], order);
   }
 
-  vol_int *= this->vol_cell;
+  this->stride_counts = (this->num_bins + 15) / 16 * 16;
+  this->stride_sums = (this->num_bins * this->ncomp + 7) / 8 * 8;
 
-  double norm_factor = 1. / vol_int;
+  this->partial_counts.assign(
+    static_cast<std::size_t>(this->npartials) * this->stride_counts, 0
+  );
+  this->partial_sums.assign(
+    static_cast<std::size_t>(this->npartials) * this->stride_sums, 0.
+  );
+}
 
-  return norm_factor;
+int BinnedReduction::ret_partial_index(int iplane) {
+  if (this->ordered) {return iplane;}
+#ifdef TRV_USE_OMP
+  return omp_get_thread_num();
+#else   // !TRV_USE_OMP
+  return 0;
+#endif  // TRV_USE_OMP
+}
+
+int* BinnedReduction::ret_partial_counts(int iplane) {
+  return this->partial_counts.data()
+    + static_cast<std::size_t>(this->ret_partial_index(iplane))
+      * this->stride_counts;
+}
+
+double* BinnedReduction::ret_partial_sums(int iplane) {
+  return this->partial_sums.data()
+    + static_cast<std::size_t>(this->ret_partial_index(iplane))
+      * this->stride_sums;
+}
+
+void BinnedReduction::reduce(
+  std::vector<int>& counts, std::vector<double>& sums
+) {
+  counts.assign(this->num_bins, 0);
+  sums.assign(this->num_bins * this->ncomp, 0.);
+
+  for (int ipart = 0; ipart < this->npartials; ipart++) {
+    const int* counts_part = this->partial_counts.data()
+      + static_cast<std::size_t>(ipart) * this->stride_counts;
+    const double* sums_part = this->partial_sums.data()
+      + static_cast<std::size_t>(ipart) * this->stride_sums;
+    for (int ibin = 0; ibin < this->num_bins; ibin++) {
+      counts[ibin] += counts_part[ibin];
+    }
+    for (int icomp = 0; icomp < this->num_bins * this->ncomp; icomp++) {
+      sums[icomp] += sums_part[icomp];
+    }
+  }
 }
 
 
@@ -1771,24 +3212,53 @@ FieldStats::FieldStats(trv::ParameterSet& params, bool plan_ini){
   this->vol = this->params.volume;
   this->vol_cell = this->vol / double(this->params.nmesh);
 
-  // Set up FFTW plans.
+  // Match the slab decomposition of mesh fields.
+  trvs::allocate_slab(this->params.ngrid[0], this->n0_local, this->i0_start);
+  this->nmesh_local = static_cast<long long>(this->n0_local)
+    * this->params.ngrid[1] * this->params.ngrid[2];
+
+  // Set up FFTW plans.  Slab-decomposed transforms are planned per
+  // task, so FFTW wisdom files are not used.
+  if (plan_ini && trvs::numTasks > 1) {
+    this->twopt_3d = fftw_alloc_complex(this->nmesh_local);
+
+    trvs::count_cgrid += 1;
+    trvs::count_grid += 1;
+    trvs::update_maxcntgrid();
+    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->nmesh_local);
+    trvs::update_maxmem();
+
+    this->slab_inv_transform = new trv::SlabFFTPlan(
+      this->params.ngrid, FFTW_BACKWARD, this->params.fftw_planner_flag
+    );
+
+    this->plan_ini = true;
+  } else
   if (plan_ini) {
-    this->twopt_3d = fftw_alloc_complex(this->params.nmesh);
+    this->twopt_3d = fftw_alloc_complex(this->nmesh_local);
 
     trvs::count_cgrid += 1;
     trvs::count_grid += 1;
     trvs::update_maxcntgrid();
-    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->params.nmesh);
+    trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->nmesh_local);
     trvs::update_maxmem();
 
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
     fftw_plan_with_nthreads(omp_get_max_threads());
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+    bool wisdom_b = trv::import_fftw_wisdom(this->params, FFTW_BACKWARD);
+    auto pre_plan_b_timept = std::chrono::steady_clock::now();
     this->inv_transform = fftw_plan_dft_3d(
       this->params.ngrid[0], this->params.ngrid[1], this->params.ngrid[2],
       this->twopt_3d, this->twopt_3d,
       FFTW_BACKWARD, this->params.fftw_planner_flag
     );
+    trv::export_fftw_wisdom(
+      this->params, FFTW_BACKWARD, wisdom_b,
+      std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - pre_plan_b_timept
+      ).count()
+    );
 
     this->plan_ini = true;
   }
@@ -1796,17 +3266,21 @@ FieldStats::FieldStats(trv::ParameterSet& params, bool plan_ini){
 
 FieldStats::~FieldStats() {
   if (this->alias_ini) {
-    trvs::count_rgrid -= 1;
-    trvs::count_grid -= .5;
-    trvs::gbytesMem -= trvs::size_in_gb<double>(this->params.nmesh);
+    trvs::gbytesMem -= trvs::size_in_gb<double>(
+      this->params.ngrid[0] + this->params.ngrid[1] + this->params.ngrid[2]
+    );
   }
 
   if (this->plan_ini) {
-    fftw_destroy_plan(this->inv_transform);
+    if (this->slab_inv_transform != nullptr) {
+      delete this->slab_inv_transform; this->slab_inv_transform = nullptr;
+    } else {
+      fftw_destroy_plan(this->inv_transform);
+    }
     fftw_free(this->twopt_3d); this->twopt_3d = nullptr;
     trvs::count_cgrid -= 1;
     trvs::count_grid -= 1;
-    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->params.nmesh);
+    trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->nmesh_local);
   }
 }
 
@@ -1868,7 +3342,7 @@ bool FieldStats::if_fields_compatible(
 
 long long FieldStats::ret_grid_index(int i, int j, int k) {
   long long idx_grid =
-    (i * static_cast<long long>(this->params.ngrid[1]) + j)
+    ((i - this->i0_start) * static_cast<long long>(this->params.ngrid[1]) + j)
     * this->params.ngrid[2] + k;
   return idx_grid;
 }
@@ -2091,53 +3565,23 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_fourier(
     );
   }
 
-  // auto ret_grid_index = [&field_a](int i, int j, int k) {
-  //   return field_a.ret_grid_index(i, j, k);
-  // };
-
-  auto ret_grid_wavevector = [&field_a](int i, int j, int k, double kvec[3]) {
-    field_a.get_grid_wavevector(i, j, k, kvec);
-  };
+  // Reuse the wavevector geometry of the first mesh field.
+  field_a.ret_kgeometry();
+  this->kgeom = field_a.kgeom;
+  const trv::WavevectorGeometry& kgeom = *this->kgeom;
 
   this->compute_shotnoise_aliasing();
 
-  std::function<double(int, int, int)> calc_shotnoise_aliasing = [this](
-    int i, int j, int k
-  ) {
-    long long idx_grid = ret_grid_index(i, j, k);
-    return this->alias_sn[idx_grid];
-  };
-
-  std::function<double(int, int, int)> calc_win_pk, calc_win_sn;
-  int assignment_order = this->params.assignment_order;
-  if (this->params.interlace == "true") {
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_win_pk;
-  } else
-  if (this->params.interlace == "false") {
+  // Select grid corrections: with interlacing, both are the assignment
+  // window product W(k)², and otherwise the shot-noise aliasing function.
+  const bool win_sn_interlaced = (this->params.interlace == "true");
 #ifndef DBG_FLAG_NOAC
-    calc_win_sn = calc_shotnoise_aliasing;
-    calc_win_pk = calc_win_sn;
+  const bool win_pk_interlaced = win_sn_interlaced;
 #else   // !DBG_FLAG_NOAC
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_shotnoise_aliasing;
+  const bool win_pk_interlaced = true;
 #endif  // !DBG_FLAG_NOAC
-  }
 
   // Perform fine binning.
-  // NOTE: Dynamically allocate owing to size.
   // CAVEAT: Discretionary choices such that 0.0 < k < 10.0.
   const int n_sample = 1e6;
   const double dk_sample = 1.e-5;
@@ -2150,102 +3594,84 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_fourier(
     }
   }
 
-  int* nmodes_sample = new int[n_sample];
-  double* k_sample = new double[n_sample];
-  double* pk_sample_real = new double[n_sample];
-  double* pk_sample_imag = new double[n_sample];
-  double* sn_sample_real = new double[n_sample];
-  double* sn_sample_imag = new double[n_sample];
-  std::complex<double>* pk_sample = new std::complex<double>[n_sample];
-  std::complex<double>* sn_sample = new std::complex<double>[n_sample];
-  for (int i = 0; i < n_sample; i++) {
-    nmodes_sample[i] = 0;
-    k_sample[i] = 0.;
-    pk_sample_real[i] = 0.;
-    pk_sample_imag[i] = 0.;
-    sn_sample_real[i] = 0.;
-    sn_sample_imag[i] = 0.;
-  }
+  // Bin contributions by their wavevector mode fine samples, with
+  // components {k, Re pk, Im pk, Re sn, Im sn}.
+  trv::BinnedReduction reduction(
+    kbinning, n_sample, dk_sample, 5, this->n0_local,
+    this->params.binning_reduction
+  );
 
   this->reset_stats();
 
 #ifdef TRV_USE_OMP
-#pragma omp parallel for collapse(3)
+#pragma omp parallel for schedule(static)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
+    int* nmodes_part = reduction.ret_partial_counts(i - this->i0_start);
+    double* sums_part = reduction.ret_partial_sums(i - this->i0_start);
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
-        long long idx_grid = ret_grid_index(i, j, k);
+        long long idx_grid = this->ret_grid_index(i, j, k);
 
-        double kv[3];
-        ret_grid_wavevector(i, j, k, kv);
+        double k_ = kgeom.ret_kmag(i, j, k);
 
-        double k_ = trvm::get_vec3d_magnitude(kv);
+        int ibin = reduction.ret_bin_index(k_);
+        if (ibin != -1) {
+          std::complex<double> fa = field_a.ret_fourier_mode(i, j, k);
+          std::complex<double> fb = field_b.ret_fourier_mode(i, j, k);
 
-        int idx_k = int(k_ / dk_sample);
-        if (0 <= idx_k && idx_k < n_sample) {
-          std::complex<double> fa(field_a[idx_grid][0], field_a[idx_grid][1]);
-          std::complex<double> fb(field_b[idx_grid][0], field_b[idx_grid][1]);
+          double alias_sn_ = this->ret_shotnoise_aliasing(i, j, k);
+          double win = kgeom.ret_window(i, j, k);
+          double win2 = win * win;
 
           std::complex<double> pk_mode = fa * std::conj(fb);
-          std::complex<double> sn_mode =
-            shotnoise_amp * calc_shotnoise_aliasing(i, j, k);
+          std::complex<double> sn_mode = shotnoise_amp * alias_sn_;
 
           // Apply grid corrections.
-          double win_pk = calc_win_pk(i, j, k);
-          double win_sn = calc_win_sn(i, j, k);
+          double win_pk = win_pk_interlaced ? win2 : alias_sn_;
+          double win_sn = win_sn_interlaced ? win2 : alias_sn_;
 
           pk_mode /= win_pk;
           sn_mode /= win_sn;
 
           // Weight by reduced spherical harmonics.
+          double kv[3];
+          field_a.get_grid_wavevector(i, j, k, kv);
+
           std::complex<double> ylm = trvm::SphericalHarmonicCalculator::
             calc_reduced_spherical_harmonic(ell, m, kv);
 
           pk_mode *= ylm;
           sn_mode *= ylm;
 
-          double pk_mode_real = pk_mode.real();
-          double pk_mode_imag = pk_mode.imag();
-          double sn_mode_real = sn_mode.real();
-          double sn_mode_imag = sn_mode.imag();
-
           // Add contribution.
-OMP_ATOMIC
-          nmodes_sample[idx_k]++;
-OMP_ATOMIC
-          k_sample[idx_k] += k_;
-OMP_ATOMIC
-          pk_sample_real[idx_k] += pk_mode_real;
-OMP_ATOMIC
-          pk_sample_imag[idx_k] += pk_mode_imag;
-OMP_ATOMIC
-          sn_sample_real[idx_k] += sn_mode_real;
-OMP_ATOMIC
-          sn_sample_imag[idx_k] += sn_mode_imag;
+          nmodes_part[ibin]++;
+          sums_part[5*ibin] += k_;
+          sums_part[5*ibin + 1] += pk_mode.real();
+          sums_part[5*ibin + 2] += pk_mode.imag();
+          sums_part[5*ibin + 3] += sn_mode.real();
+          sums_part[5*ibin + 4] += sn_mode.imag();
         }
       }
     }
   }
 
-  for (int i = 0; i < n_sample; i++) {
-    pk_sample[i] = pk_sample_real[i] + trvm::M_I * pk_sample_imag[i];
-    sn_sample[i] = sn_sample_real[i] + trvm::M_I * sn_sample_imag[i];
-  }
+  std::vector<int> nmodes_binned;
+  std::vector<double> sums_binned;
+  reduction.reduce(nmodes_binned, sums_binned);
+
+  // Sum binned contributions from all slabs.
+  trvs::allreduce_sum(nmodes_binned.data(), kbinning.num_bins);
+  trvs::allreduce_sum(sums_binned.data(), 5*kbinning.num_bins);
 
   // Perform binning.
   for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
-    double k_lower = kbinning.bin_edges[ibin];
-    double k_upper = kbinning.bin_edges[ibin + 1];
-    for (int i = 0; i < n_sample; i++) {
-      double k_ = i * dk_sample;
-      if (k_lower <= k_ && k_ < k_upper) {
-        this->nmodes[ibin] += nmodes_sample[i];
-        this->k[ibin] += k_sample[i];
-        this->pk[ibin] += pk_sample[i];
-        this->sn[ibin] += sn_sample[i];
-      }
-    }
+    this->nmodes[ibin] = nmodes_binned[ibin];
+    this->k[ibin] = sums_binned[5*ibin];
+    this->pk[ibin] =
+      sums_binned[5*ibin + 1] + trvm::M_I * sums_binned[5*ibin + 2];
+    this->sn[ibin] =
+      sums_binned[5*ibin + 3] + trvm::M_I * sums_binned[5*ibin + 4];
 
     if (this->nmodes[ibin] != 0) {
       this->k[ibin] /= double(this->nmodes[ibin]);
@@ -2257,15 +3683,6 @@ OMP_ATOMIC
       this->sn[ibin] = 0.;
     }
   }
-
-  delete[] nmodes_sample;
-  delete[] k_sample;
-  delete[] pk_sample_real;
-  delete[] pk_sample_imag;
-  delete[] sn_sample_real;
-  delete[] sn_sample_imag;
-  delete[] pk_sample;
-  delete[] sn_sample;
 }
 
 void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
@@ -2295,42 +3712,21 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
     field_a.get_grid_pos_vector(i, j, k, rvec);
   };
 
-  this->compute_shotnoise_aliasing();
+  // Reuse the wavevector geometry of the first mesh field.
+  field_a.ret_kgeometry();
+  this->kgeom = field_a.kgeom;
+  const trv::WavevectorGeometry& kgeom = *this->kgeom;
 
-  std::function<double(int, int, int)> calc_shotnoise_aliasing = [this](
-    int i, int j, int k
-  ) {
-    long long idx_grid = ret_grid_index(i, j, k);
-    return this->alias_sn[idx_grid];
-  };
+  this->compute_shotnoise_aliasing();
 
-  std::function<double(int, int, int)> calc_win_pk, calc_win_sn;
-  int assignment_order = this->params.assignment_order;
-  if (this->params.interlace == "true") {
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_win_pk;
-  } else
-  if (this->params.interlace == "false") {
+  // Select grid corrections: with interlacing, both are the assignment
+  // window product W(k)², and otherwise the shot-noise aliasing function.
+  const bool win_sn_interlaced = (this->params.interlace == "true");
 #ifndef DBG_FLAG_NOAC
-    calc_win_sn = calc_shotnoise_aliasing;
-    calc_win_pk = calc_win_sn;
+  const bool win_pk_interlaced = win_sn_interlaced;
 #else   // !DBG_FLAG_NOAC
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_shotnoise_aliasing;
+  const bool win_pk_interlaced = true;
 #endif  // !DBG_FLAG_NOAC
-  }
 
 // The nested for-loops below cover all grid point computations so this
 // is redundant.
@@ -2345,21 +3741,24 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
 //   }  // likely redundant but safe
 
   // Compute shot noise--subtracted mode powers on mesh grids.
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = ret_grid_index(i, j, k);
 
-        std::complex<double> fa(field_a[idx_grid][0], field_a[idx_grid][1]);
-        std::complex<double> fb(field_b[idx_grid][0], field_b[idx_grid][1]);
+        std::complex<double> fa = field_a.ret_fourier_mode(i, j, k);
+        std::complex<double> fb = field_b.ret_fourier_mode(i, j, k);
+
+        double alias_sn_ = this->ret_shotnoise_aliasing(i, j, k);
+        double win = kgeom.ret_window(i, j, k);
+        double win2 = win * win;
 
         std::complex<double> pk_mode = fa * std::conj(fb);
-        std::complex<double> sn_mode =
-          shotnoise_amp * calc_shotnoise_aliasing(i, j, k);
+        std::complex<double> sn_mode = shotnoise_amp * alias_sn_;
 
         // Apply grid corrections.
-        double win_pk = calc_win_pk(i, j, k);
-        double win_sn = calc_win_sn(i, j, k);
+        double win_pk = win_pk_interlaced ? win2 : alias_sn_;
+        double win_sn = win_sn_interlaced ? win2 : alias_sn_;
 
         pk_mode /= win_pk;
         sn_mode /= win_sn;
@@ -2373,15 +3772,20 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
   }
 
   // Inverse Fourier transform.
+  if (this->slab_inv_transform != nullptr) {
+    this->slab_inv_transform->execute(this->twopt_3d);
+  } else
   if (this->plan_ini) {
     fftw_execute(this->inv_transform);
+  } else
+  if (field_a.distributed) {
+    field_a.slab_inv_transform->execute(this->twopt_3d);
   } else {
     fftw_execute_dft(field_a.inv_transform, twopt_3d, twopt_3d);
   }
   trvs::count_ifft += 1;
 
   // Perform fine binning.
-  // NOTE: Dynamically allocate owing to size.
   // CAVEAT: Discretionary choices such that 0 < r < 100k.
   const int n_sample = 1e6;
   const double dr_sample = 1.e-1;
@@ -2394,24 +3798,21 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
     }
   }
 
-  int* npairs_sample = new int[n_sample];
-  double* r_sample = new double[n_sample];
-  double* xi_sample_real = new double[n_sample];
-  double* xi_sample_imag = new double[n_sample];
-  std::complex<double>* xi_sample = new std::complex<double>[n_sample];
-  for (int i = 0; i < n_sample; i++) {
-    npairs_sample[i] = 0;
-    r_sample[i] = 0.;
-    xi_sample_real[i] = 0.;
-    xi_sample_imag[i] = 0.;
-  }
+  // Bin contributions by their separation fine samples, with
+  // components {r, Re xi, Im xi}.
+  trv::BinnedReduction reduction(
+    rbinning, n_sample, dr_sample, 3, this->n0_local,
+    this->params.binning_reduction
+  );
 
   this->reset_stats();
 
 #ifdef TRV_USE_OMP
-#pragma omp parallel for collapse(3)
+#pragma omp parallel for schedule(static)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
+    int* npairs_part = reduction.ret_partial_counts(i - this->i0_start);
+    double* sums_part = reduction.ret_partial_sums(i - this->i0_start);
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = ret_grid_index(i, j, k);
@@ -2421,8 +3822,8 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
 
         double r_ = trvm::get_vec3d_magnitude(rv);
 
-        int idx_r = int(r_ / dr_sample);
-        if (0 <= idx_r && idx_r < n_sample) {
+        int ibin = reduction.ret_bin_index(r_);
+        if (ibin != -1) {
           std::complex<double> xi_pair(
             this->twopt_3d[idx_grid][0], this->twopt_3d[idx_grid][1]
           );
@@ -2433,39 +3834,30 @@ void FieldStats::compute_ylm_wgtd_2pt_stats_in_config(
 
           xi_pair *= ylm;
 
-          double xi_pair_real = xi_pair.real();
-          double xi_pair_imag = xi_pair.imag();
-
           // Add contribution.
-OMP_ATOMIC
-          npairs_sample[idx_r]++;
-OMP_ATOMIC
-          r_sample[idx_r] += r_;
-OMP_ATOMIC
-          xi_sample_real[idx_r] += xi_pair_real;
-OMP_ATOMIC
-          xi_sample_imag[idx_r] += xi_pair_imag;
+          npairs_part[ibin]++;
+          sums_part[3*ibin] += r_;
+          sums_part[3*ibin + 1] += xi_pair.real();
+          sums_part[3*ibin + 2] += xi_pair.imag();
         }
       }
     }
   }
 
-  for (int i = 0; i < n_sample; i++) {
-    xi_sample[i] = xi_sample_real[i] + trvm::M_I * xi_sample_imag[i];
-  }
+  std::vector<int> npairs_binned;
+  std::vector<double> sums_binned;
+  reduction.reduce(npairs_binned, sums_binned);
+
+  // Sum binned contributions from all slabs.
+  trvs::allreduce_sum(npairs_binned.data(), rbinning.num_bins);
+  trvs::allreduce_sum(sums_binned.data(), 3*rbinning.num_bins);
 
   // Perform binning.
   for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
-    double r_lower = rbinning.bin_edges[ibin];
-    double r_upper = rbinning.bin_edges[ibin + 1];
-    for (int i = 0; i < n_sample; i++) {
-      double r_ = i * dr_sample;
-      if (r_lower <= r_ && r_ < r_upper) {
-        this->npairs[ibin] += npairs_sample[i];
-        this->r[ibin] += r_sample[i];
-        this->xi[ibin] += xi_sample[i];
-      }
-    }
+    this->npairs[ibin] = npairs_binned[ibin];
+    this->r[ibin] = sums_binned[3*ibin];
+    this->xi[ibin] =
+      sums_binned[3*ibin + 1] + trvm::M_I * sums_binned[3*ibin + 2];
 
     if (this->npairs[ibin] != 0) {
       this->r[ibin] /= double(this->npairs[ibin]);
@@ -2477,17 +3869,12 @@ OMP_ATOMIC
     }
   }
 
-  delete[] npairs_sample;
-  delete[] r_sample;
-  delete[] xi_sample_real;
-  delete[] xi_sample_imag;
-  delete[] xi_sample;
 }
 
 void FieldStats::compute_uncoupled_shotnoise_for_3pcf(
   MeshField& field_a, MeshField& field_b,
-  std::vector< std::complex<double> >& ylm_a,
-  std::vector< std::complex<double> >& ylm_b,
+  const trvm::SphericalHarmonicTable& ylm_a, const int m_a,
+  const trvm::SphericalHarmonicTable& ylm_b, const int m_b,
   std::complex<double> shotnoise_amp,
   trv::Binning& rbinning
 ) {
@@ -2518,42 +3905,21 @@ void FieldStats::compute_uncoupled_shotnoise_for_3pcf(
     field_a.get_grid_pos_vector(i, j, k, rvec);
   };
 
-  this->compute_shotnoise_aliasing();
+  // Reuse the wavevector geometry of the first mesh field.
+  field_a.ret_kgeometry();
+  this->kgeom = field_a.kgeom;
+  const trv::WavevectorGeometry& kgeom = *this->kgeom;
 
-  std::function<double(int, int, int)> calc_shotnoise_aliasing = [this](
-    int i, int j, int k
-  ) {
-    long long idx_grid = ret_grid_index(i, j, k);
-    return this->alias_sn[idx_grid];
-  };
+  this->compute_shotnoise_aliasing();
 
-  std::function<double(int, int, int)> calc_win_pk, calc_win_sn;
-  int assignment_order = this->params.assignment_order;
-  if (this->params.interlace == "true") {
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_win_pk;
-  } else
-  if (this->params.interlace == "false") {
+  // Select grid corrections: with interlacing, both are the assignment
+  // window product W(k)², and otherwise the shot-noise aliasing function.
+  const bool win_sn_interlaced = (this->params.interlace == "true");
 #ifndef DBG_FLAG_NOAC
-    calc_win_sn = calc_shotnoise_aliasing;
-    calc_win_pk = calc_win_sn;
+  const bool win_pk_interlaced = win_sn_interlaced;
 #else   // !DBG_FLAG_NOAC
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_shotnoise_aliasing;
+  const bool win_pk_interlaced = true;
 #endif  // !DBG_FLAG_NOAC
-  }
 
 // The nested for-loops below cover all grid point computations so this
 // is redundant.
@@ -2571,21 +3937,24 @@ void FieldStats::compute_uncoupled_shotnoise_for_3pcf(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for collapse(3)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = ret_grid_index(i, j, k);
 
-        std::complex<double> fa(field_a[idx_grid][0], field_a[idx_grid][1]);
-        std::complex<double> fb(field_b[idx_grid][0], field_b[idx_grid][1]);
+        std::complex<double> fa = field_a.ret_fourier_mode(i, j, k);
+        std::complex<double> fb = field_b.ret_fourier_mode(i, j, k);
+
+        double alias_sn_ = this->ret_shotnoise_aliasing(i, j, k);
+        double win = kgeom.ret_window(i, j, k);
+        double win2 = win * win;
 
         std::complex<double> pk_mode = fa * std::conj(fb);
-        std::complex<double> sn_mode =
-          shotnoise_amp * calc_shotnoise_aliasing(i, j, k);
+        std::complex<double> sn_mode = shotnoise_amp * alias_sn_;
 
         // Apply grid corrections.
-        double win_pk = calc_win_pk(i, j, k);
-        double win_sn = calc_win_sn(i, j, k);
+        double win_pk = win_pk_interlaced ? win2 : alias_sn_;
+        double win_sn = win_sn_interlaced ? win2 : alias_sn_;
 
         pk_mode /= win_pk;
         sn_mode /= win_sn;
@@ -2599,37 +3968,39 @@ void FieldStats::compute_uncoupled_shotnoise_for_3pcf(
   }
 
   // Inverse Fourier transform.
+  if (this->slab_inv_transform != nullptr) {
+    this->slab_inv_transform->execute(this->twopt_3d);
+  } else
   if (this->plan_ini) {
     fftw_execute(this->inv_transform);
+  } else
+  if (field_a.distributed) {
+    field_a.slab_inv_transform->execute(this->twopt_3d);
   } else {
     fftw_execute_dft(field_a.inv_transform, twopt_3d, twopt_3d);
   }
   trvs::count_ifft += 1;
 
   // Perform fine binning.
-  // NOTE: Dynamically allocate owing to size.
   // CAVEAT: Discretionary choices such that 0 < r < 100k.
   const int n_sample = 1e5;
   const double dr_sample = 1.;
 
-  int* npairs_sample = new int[n_sample];
-  double* r_sample = new double[n_sample];
-  double* xi_sample_real = new double[n_sample];
-  double* xi_sample_imag = new double[n_sample];
-  std::complex<double>* xi_sample = new std::complex<double>[n_sample];
-  for (int i = 0; i < n_sample; i++) {
-    npairs_sample[i] = 0;
-    r_sample[i] = 0.;
-    xi_sample_real[i] = 0.;
-    xi_sample_imag[i] = 0.;
-  }
+  // Bin contributions by their separation fine samples, with
+  // components {r, Re xi, Im xi}.
+  trv::BinnedReduction reduction(
+    rbinning, n_sample, dr_sample, 3, this->n0_local,
+    this->params.binning_reduction
+  );
 
   this->reset_stats();
 
 #ifdef TRV_USE_OMP
-#pragma omp parallel for collapse(3)
+#pragma omp parallel for schedule(static)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
+    int* npairs_part = reduction.ret_partial_counts(i - this->i0_start);
+    double* sums_part = reduction.ret_partial_sums(i - this->i0_start);
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = ret_grid_index(i, j, k);
@@ -2639,48 +4010,39 @@ void FieldStats::compute_uncoupled_shotnoise_for_3pcf(
 
         double r_ = trvm::get_vec3d_magnitude(rv);
 
-        int idx_r = int(r_ / dr_sample);
-        if (0 <= idx_r && idx_r < n_sample) {
+        int ibin = reduction.ret_bin_index(r_);
+        if (ibin != -1) {
           std::complex<double> xi_pair(
             this->twopt_3d[idx_grid][0], this->twopt_3d[idx_grid][1]
           );
 
           // Weight by reduced spherical harmonics.
-          xi_pair *= ylm_a[idx_grid] * ylm_b[idx_grid];
-
-          double xi_pair_real = xi_pair.real();
-          double xi_pair_imag = xi_pair.imag();
+          xi_pair *= ylm_a.eval(m_a, i, j, k) * ylm_b.eval(m_b, i, j, k);
 
           // Add contribution.
-OMP_ATOMIC
-          npairs_sample[idx_r]++;
-OMP_ATOMIC
-          r_sample[idx_r] += r_;
-OMP_ATOMIC
-          xi_sample_real[idx_r] += xi_pair_real;
-OMP_ATOMIC
-          xi_sample_imag[idx_r] += xi_pair_imag;
+          npairs_part[ibin]++;
+          sums_part[3*ibin] += r_;
+          sums_part[3*ibin + 1] += xi_pair.real();
+          sums_part[3*ibin + 2] += xi_pair.imag();
         }
       }
     }
   }
 
-  for (int i = 0; i < n_sample; i++) {
-    xi_sample[i] = xi_sample_real[i] + trvm::M_I * xi_sample_imag[i];
-  }
+  std::vector<int> npairs_binned;
+  std::vector<double> sums_binned;
+  reduction.reduce(npairs_binned, sums_binned);
+
+  // Sum binned contributions from all slabs.
+  trvs::allreduce_sum(npairs_binned.data(), rbinning.num_bins);
+  trvs::allreduce_sum(sums_binned.data(), 3*rbinning.num_bins);
 
   // Perform binning.
   for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
-    double r_lower = rbinning.bin_edges[ibin];
-    double r_upper = rbinning.bin_edges[ibin + 1];
-    for (int i = 0; i < n_sample; i++) {
-      double r_ = i * dr_sample;
-      if (r_lower <= r_ && r_ < r_upper) {
-        this->npairs[ibin] += npairs_sample[i];
-        this->r[ibin] += r_sample[i];
-        this->xi[ibin] += xi_sample[i];
-      }
-    }
+    this->npairs[ibin] = npairs_binned[ibin];
+    this->r[ibin] = sums_binned[3*ibin];
+    this->xi[ibin] =
+      sums_binned[3*ibin + 1] + trvm::M_I * sums_binned[3*ibin + 2];
 
     if (this->npairs[ibin] != 0) {
       this->r[ibin] /= double(this->npairs[ibin]);
@@ -2702,19 +4064,15 @@ OMP_ATOMIC
     }
   }
 
-  delete[] npairs_sample;
-  delete[] r_sample;
-  delete[] xi_sample_real;
-  delete[] xi_sample_imag;
-  delete[] xi_sample;
 }
 
 std::complex<double> \
 FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
   MeshField& field_a, MeshField& field_b,
-  std::vector< std::complex<double> >& ylm_a,
-  std::vector< std::complex<double> >& ylm_b,
-  trvm::SphericalBesselCalculator& sj_a, trvm::SphericalBesselCalculator& sj_b,
+  const trvm::SphericalHarmonicTable& ylm_a, const int m_a,
+  const trvm::SphericalHarmonicTable& ylm_b, const int m_b,
+  const trvm::SphericalBesselCalculator& sj_a,
+  const trvm::SphericalBesselCalculator& sj_b,
   std::complex<double> shotnoise_amp,
   double k_a, double k_b
 ) {
@@ -2747,42 +4105,21 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
     field_a.get_grid_pos_vector(i, j, k, rvec);
   };
 
-  this->compute_shotnoise_aliasing();
+  // Reuse the wavevector geometry of the first mesh field.
+  field_a.ret_kgeometry();
+  this->kgeom = field_a.kgeom;
+  const trv::WavevectorGeometry& kgeom = *this->kgeom;
 
-  std::function<double(int, int, int)> calc_shotnoise_aliasing = [this](
-    int i, int j, int k
-  ) {
-    long long idx_grid = ret_grid_index(i, j, k);
-    return this->alias_sn[idx_grid];
-  };
+  this->compute_shotnoise_aliasing();
 
-  std::function<double(int, int, int)> calc_win_pk, calc_win_sn;
-  int assignment_order = this->params.assignment_order;
-  if (this->params.interlace == "true") {
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_win_pk;
-  } else
-  if (this->params.interlace == "false") {
+  // Select grid corrections: with interlacing, both are the assignment
+  // window product W(k)², and otherwise the shot-noise aliasing function.
+  const bool win_sn_interlaced = (this->params.interlace == "true");
 #ifndef DBG_FLAG_NOAC
-    calc_win_sn = calc_shotnoise_aliasing;
-    calc_win_pk = calc_win_sn;
+  const bool win_pk_interlaced = win_sn_interlaced;
 #else   // !DBG_FLAG_NOAC
-    calc_win_pk = [&field_a, &field_b, &assignment_order](
-      int i, int j, int k
-    ) {
-      return
-        field_a.calc_assignment_window_in_fourier(i, j, k, assignment_order)
-        * field_b.calc_assignment_window_in_fourier(i, j, k, assignment_order);
-    };
-    calc_win_sn = calc_shotnoise_aliasing;
+  const bool win_pk_interlaced = true;
 #endif  // !DBG_FLAG_NOAC
-  }
 
 // The nested for-loops below cover all grid point computations so this
 // is redundant.
@@ -2800,21 +4137,24 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for collapse(3)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = ret_grid_index(i, j, k);
 
-        std::complex<double> fa(field_a[idx_grid][0], field_a[idx_grid][1]);
-        std::complex<double> fb(field_b[idx_grid][0], field_b[idx_grid][1]);
+        std::complex<double> fa = field_a.ret_fourier_mode(i, j, k);
+        std::complex<double> fb = field_b.ret_fourier_mode(i, j, k);
+
+        double alias_sn_ = this->ret_shotnoise_aliasing(i, j, k);
+        double win = kgeom.ret_window(i, j, k);
+        double win2 = win * win;
 
         std::complex<double> pk_mode = fa * std::conj(fb);
-        std::complex<double> sn_mode =
-          shotnoise_amp * calc_shotnoise_aliasing(i, j, k);
+        std::complex<double> sn_mode = shotnoise_amp * alias_sn_;
 
         // Apply grid corrections.
-        double win_pk = calc_win_pk(i, j, k);
-        double win_sn = calc_win_sn(i, j, k);
+        double win_pk = win_pk_interlaced ? win2 : alias_sn_;
+        double win_sn = win_sn_interlaced ? win2 : alias_sn_;
 
         pk_mode /= win_pk;
         sn_mode /= win_sn;
@@ -2828,8 +4168,14 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
   }
 
   // Inverse Fourier transform.
+  if (this->slab_inv_transform != nullptr) {
+    this->slab_inv_transform->execute(this->twopt_3d);
+  } else
   if (this->plan_ini) {
     fftw_execute(this->inv_transform);
+  } else
+  if (field_a.distributed) {
+    field_a.slab_inv_transform->execute(this->twopt_3d);
   } else {
     fftw_execute_dft(field_a.inv_transform, twopt_3d, twopt_3d);
   }
@@ -2840,17 +4186,9 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
   double S_ij_k_real = 0., S_ij_k_imag = 0.;
 
 #ifdef TRV_USE_OMP
-#pragma omp parallel reduction(+:S_ij_k_real, S_ij_k_imag)
-#endif  // TRV_USE_OMP
-{
-  // Create thread-private copies of the spherical Bessel function calculator.
-  trvm::SphericalBesselCalculator sj_a_thread(sj_a);
-  trvm::SphericalBesselCalculator sj_b_thread(sj_b);
-
-#ifdef TRV_USE_OMP
-#pragma omp for collapse(3)
+#pragma omp parallel for collapse(3) reduction(+:S_ij_k_real, S_ij_k_imag)
 #endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
+  for (int i = this->i0_start; i < this->i0_start + this->n0_local; i++) {
     for (int j = 0; j < this->params.ngrid[1]; j++) {
       for (int k = 0; k < this->params.ngrid[2]; k++) {
         long long idx_grid = ret_grid_index(i, j, k);
@@ -2860,14 +4198,15 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
 
         double r_ = trvm::get_vec3d_magnitude(rv);
 
-        double ja = sj_a_thread.eval(k_a * r_);
-        double jb = sj_b_thread.eval(k_b * r_);
+        double ja = sj_a.eval(k_a * r_);
+        double jb = sj_b.eval(k_b * r_);
 
         std::complex<double> S_ij_k_3d(
           this->twopt_3d[idx_grid][0], this->twopt_3d[idx_grid][1]
         );
 
-        S_ij_k_3d *= ja * jb * ylm_a[idx_grid] * ylm_b[idx_grid];
+        S_ij_k_3d *= ja * jb
+          * ylm_a.eval(m_a, i, j, k) * ylm_b.eval(m_b, i, j, k);
 
         double S_ij_k_3d_real = S_ij_k_3d.real();
         double S_ij_k_3d_imag = S_ij_k_3d.imag();
@@ -2877,9 +4216,12 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
       }
     }
   }
-}
 
-  std::complex<double> S_ij_k(S_ij_k_real, S_ij_k_imag);
+  // Sum contributions from all slabs.
+  double S_ij_k_parts[2] = {S_ij_k_real, S_ij_k_imag};
+  trvs::allreduce_sum(S_ij_k_parts, 2);
+
+  std::complex<double> S_ij_k(S_ij_k_parts[0], S_ij_k_parts[1]);
 
   S_ij_k *= this->vol_cell;
 
@@ -2891,27 +4233,18 @@ FieldStats::compute_uncoupled_shotnoise_for_bispec_per_bin(
 // Sampling corrections
 // -----------------------------------------------------------------------
 
-std::function<double(int, int, int)> FieldStats::ret_calc_shotnoise_aliasing()
-{
+std::function<double(double)> FieldStats::ret_calc_shotnoise_aliasing() {
   if (this->params.assignment == "ngp") {
-    return [this](int i, int j, int k) {
-      return calc_shotnoise_aliasing_ngp(i, j, k);
-    };
+    return [this](double s2) {return calc_shotnoise_aliasing_ngp(s2);};
   }
   if (this->params.assignment == "cic") {
-    return [this](int i, int j, int k) {
-      return calc_shotnoise_aliasing_cic(i, j, k);
-    };
+    return [this](double s2) {return calc_shotnoise_aliasing_cic(s2);};
   }
   if (this->params.assignment == "tsc") {
-    return [this](int i, int j, int k) {
-      return calc_shotnoise_aliasing_tsc(i, j, k);
-    };
+    return [this](double s2) {return calc_shotnoise_aliasing_tsc(s2);};
   }
   if (this->params.assignment == "pcs") {
-    return [this](int i, int j, int k) {
-      return calc_shotnoise_aliasing_pcs(i, j, k);
-    };
+    return [this](double s2) {return calc_shotnoise_aliasing_pcs(s2);};
   }
 
   if (trvs::currTask == 0) {
@@ -2924,47 +4257,30 @@ std::function<double(int, int, int)> FieldStats::ret_calc_shotnoise_aliasing()
   );
 }
 
-void FieldStats::get_shotnoise_aliasing_sin2(
-  int i, int j, int k, double& cx2, double& cy2, double& cz2
-) {
-  this->shift_grid_indices_fourier(i, j, k);
+double FieldStats::ret_shotnoise_aliasing_sin2(int i, int iaxis) {
+  // Shift the grid index on the discrete Fourier mesh grid.
+  const int ngrid = this->params.ngrid[iaxis];
+  i = (i < ngrid/2) ? i : i - ngrid;
 
-  double u_x = M_PI * i / double(this->params.ngrid[0]);
-  double u_y = M_PI * j / double(this->params.ngrid[1]);
-  double u_z = M_PI * k / double(this->params.ngrid[2]);
+  double u = M_PI * i / double(ngrid);
 
-  cx2 = (i != 0) ? std::sin(u_x) * std::sin(u_x) : 0.;
-  cy2 = (j != 0) ? std::sin(u_y) * std::sin(u_y) : 0.;
-  cz2 = (k != 0) ? std::sin(u_z) * std::sin(u_z) : 0.;
+  return (i != 0) ? std::sin(u) * std::sin(u) : 0.;
 }
 
-double FieldStats::calc_shotnoise_aliasing_ngp(int i, int j, int k) {
+double FieldStats::calc_shotnoise_aliasing_ngp(double s2) {
   return 1.;
 }
 
-double FieldStats::calc_shotnoise_aliasing_cic(int i, int j, int k) {
-  double cx2, cy2, cz2;
-  this->get_shotnoise_aliasing_sin2(i, j, k, cx2, cy2, cz2);
-
-  return (1. - 2./3. * cx2) * (1. - 2./3. * cy2) * (1. - 2./3. * cz2);
+double FieldStats::calc_shotnoise_aliasing_cic(double s2) {
+  return 1. - 2./3. * s2;
 }
 
-double FieldStats::calc_shotnoise_aliasing_tsc(int i, int j, int k) {
-  double cx2, cy2, cz2;
-  this->get_shotnoise_aliasing_sin2(i, j, k, cx2, cy2, cz2);
-
-  return (1. - cx2 + 2./15. * cx2 * cx2)
-    * (1. - cy2 + 2./15. * cy2 * cy2)
-    * (1. - cz2 + 2./15. * cz2 * cz2);
+double FieldStats::calc_shotnoise_aliasing_tsc(double s2) {
+  return 1. - s2 + 2./15. * s2 * s2;
 }
 
-double FieldStats::calc_shotnoise_aliasing_pcs(int i, int j, int k) {
-  double cx2, cy2, cz2;
-  this->get_shotnoise_aliasing_sin2(i, j, k, cx2, cy2, cz2);
-
-  return (1. - 4./3. * cx2 + 2./5. * cx2 * cx2 - 4./315. * cx2 * cx2 * cx2)
-    * (1. - 4./3. * cy2 + 2./5. * cy2 * cy2 - 4./315. * cy2 * cy2 * cy2)
-    * (1. - 4./3. * cz2 + 2./5. * cz2 * cz2 - 4./315. * cz2 * cz2 * cz2);
+double FieldStats::calc_shotnoise_aliasing_pcs(double s2) {
+  return 1. - 4./3. * s2 + 2./5. * s2 * s2 - 4./315. * s2 * s2 * s2;
 }
 
 void FieldStats::compute_shotnoise_aliasing() {
@@ -2978,29 +4294,28 @@ void FieldStats::compute_shotnoise_aliasing() {
     );
   }
 
-  this->alias_sn.resize(this->params.nmesh, 0.);  // initialise
-
-  trvs::count_rgrid += 1;
-  trvs::count_grid += .5;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem += trvs::size_in_gb<double>(this->params.nmesh);
-  trvs::update_maxmem();
-
-  std::function<double(int, int, int)> calc_shotnoise_aliasing =
+  std::function<double(double)> calc_shotnoise_aliasing =
     this->ret_calc_shotnoise_aliasing();
 
-#ifdef TRV_USE_OMP
-#pragma omp parallel for collapse(3)
-#endif  // TRV_USE_OMP
-  for (int i = 0; i < this->params.ngrid[0]; i++) {
-    for (int j = 0; j < this->params.ngrid[1]; j++) {
-      for (int k = 0; k < this->params.ngrid[2]; k++) {
-        long long idx_grid = ret_grid_index(i, j, k);
-        this->alias_sn[idx_grid] = calc_shotnoise_aliasing(i, j, k);
-      }
+  // Tabulate the separable aliasing function factor along each axis.
+  std::vector<double>* alias_sn_axes[3] = {
+    &this->alias_sn_x, &this->alias_sn_y, &this->alias_sn_z
+  };
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    std::vector<double>& alias_sn_axis = *alias_sn_axes[iaxis];
+    alias_sn_axis.resize(this->params.ngrid[iaxis]);
+    for (int i = 0; i < this->params.ngrid[iaxis]; i++) {
+      alias_sn_axis[i] = calc_shotnoise_aliasing(
+        this->ret_shotnoise_aliasing_sin2(i, iaxis)
+      );
     }
   }
 
+  trvs::gbytesMem += trvs::size_in_gb<double>(
+    this->params.ngrid[0] + this->params.ngrid[1] + this->params.ngrid[2]
+  );
+  trvs::update_maxmem();
+
   this->alias_ini = true;  // set aliasing flag
 }
 
@@ -112,7 +112,7 @@ void print_measurement_header_to_file(
     fileptr,
     "%s Data catalogue size: ntotal = %d, wtotal = %.3f, wstotal = %.3f\n",
     comment_delimiter,
-    catalogue_data.ntotal, catalogue_data.wtotal, catalogue_data.wstotal
+    catalogue_data.ntotal_global, catalogue_data.wtotal, catalogue_data.wstotal
   );
   std::fprintf(
     fileptr,
@@ -132,7 +132,7 @@ void print_measurement_header_to_file(
     fileptr,
     "%s Random catalogue size: ntotal = %d, wtotal = %.3f, wstotal = %.3f\n",
     comment_delimiter,
-    catalogue_rand.ntotal, catalogue_rand.wtotal, catalogue_rand.wstotal
+    catalogue_rand.ntotal_global, catalogue_rand.wtotal, catalogue_rand.wstotal
   );
   std::fprintf(
     fileptr,
@@ -220,7 +220,8 @@ void print_measurement_header_to_file(
   std::fprintf(
     fileptr,
     "%s Catalogue size: ntotal = %d, wtotal = %.3f, wstotal = %.3f\n",
-    comment_delimiter, catalogue.ntotal, catalogue.wtotal, catalogue.wstotal
+    comment_delimiter,
+    catalogue.ntotal_global, catalogue.wtotal, catalogue.wstotal
   );
   std::fprintf(
     fileptr,
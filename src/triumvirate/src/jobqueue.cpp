@@ -0,0 +1,248 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file jobqueue.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ *
+ */
+
+#include "jobqueue.hpp"
+
+namespace trv {
+namespace sys {
+
+// ***********************************************************************
+// Socket connections
+// ***********************************************************************
+
+int listen_on_socket(const std::string& socket_path, int backlog) {
+  sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_path.empty() || socket_path.size() >= sizeof(addr.sun_path)) {
+    if (currTask == 0) {
+      logger.error(
+        "Invalid socket file path (empty or too long): '%s'.",
+        socket_path.c_str()
+      );
+    }
+    throw IOError(
+      "Invalid socket file path (empty or too long): '%s'.\n",
+      socket_path.c_str()
+    );
+  }
+  std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    if (currTask == 0) {
+      logger.error("Failed to create socket: %s.", std::strerror(errno));
+    }
+    throw IOError("Failed to create socket: %s.\n", std::strerror(errno));
+  }
+
+  // Remove any stale socket file, but never any other file at the path
+  // (e.g. a parameter file passed by mistake).
+  struct stat path_stat;
+  if (lstat(socket_path.c_str(), &path_stat) == 0) {
+    if (!S_ISSOCK(path_stat.st_mode)) {
+      close(fd);
+      if (currTask == 0) {
+        logger.error(
+          "Socket file path is occupied by a non-socket file: '%s'.",
+          socket_path.c_str()
+        );
+      }
+      throw IOError(
+        "Socket file path is occupied by a non-socket file: '%s'.\n",
+        socket_path.c_str()
+      );
+    }
+    unlink(socket_path.c_str());
+  }
+
+  // Restrict the socket to the owner, as jobs are run with the server's
+  // user privileges.
+  mode_t umask_prev = umask(0077);
+  int status_bind =
+    bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  umask(umask_prev);
+
+  if (status_bind < 0 || listen(fd, backlog) < 0) {
+    int errno_ = errno;
+    close(fd);
+    if (currTask == 0) {
+      logger.error(
+        "Failed to listen on socket '%s': %s.",
+        socket_path.c_str(), std::strerror(errno_)
+      );
+    }
+    throw IOError(
+      "Failed to listen on socket '%s': %s.\n",
+      socket_path.c_str(), std::strerror(errno_)
+    );
+  }
+
+  return fd;
+}
+
+int connect_to_socket(const std::string& socket_path) {
+  sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_path.empty() || socket_path.size() >= sizeof(addr.sun_path)) {
+    if (currTask == 0) {
+      logger.error(
+        "Invalid socket file path (empty or too long): '%s'.",
+        socket_path.c_str()
+      );
+    }
+    throw IOError(
+      "Invalid socket file path (empty or too long): '%s'.\n",
+      socket_path.c_str()
+    );
+  }
+  std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    if (currTask == 0) {
+      logger.error("Failed to create socket: %s.", std::strerror(errno));
+    }
+    throw IOError("Failed to create socket: %s.\n", std::strerror(errno));
+  }
+
+  if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+    int errno_ = errno;
+    close(fd);
+    if (currTask == 0) {
+      logger.error(
+        "Failed to connect to socket '%s': %s.",
+        socket_path.c_str(), std::strerror(errno_)
+      );
+    }
+    throw IOError(
+      "Failed to connect to socket '%s': %s.\n",
+      socket_path.c_str(), std::strerror(errno_)
+    );
+  }
+
+  return fd;
+}
+
+bool read_line(int fd, std::string& line, int timeout) {
+  line.clear();
+
+  // The timeout applies to the whole line, so that a client sending
+  // a partial line cannot stall the reader indefinitely.
+  auto deadline = std::chrono::steady_clock::now()
+    + std::chrono::seconds(timeout);
+
+  char c;
+  bool read_any = false;
+  while (true) {
+    if (timeout > 0) {
+      long long wait_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline - std::chrono::steady_clock::now()
+        ).count();
+      if (wait_ms <= 0) {return false;}
+
+      pollfd pfd = {fd, POLLIN, 0};
+      int npoll = poll(&pfd, 1, static_cast<int>(wait_ms));
+      if (npoll < 0 && errno == EINTR) {continue;}
+      if (npoll <= 0) {return false;}  // timeout or error
+    }
+
+    ssize_t nread = read(fd, &c, 1);
+    if (nread < 0 && errno == EINTR) {continue;}
+    if (nread < 0) {return false;}  // error
+    if (nread == 0) {break;}        // end of connection
+
+    read_any = true;
+    if (c == '\n') {break;}
+    line.push_back(c);
+  }
+
+  return read_any;
+}
+
+bool write_line(int fd, const std::string& line) {
+  std::string buf = line + "\n";
+
+  std::size_t nwritten = 0;
+  while (nwritten < buf.size()) {
+    ssize_t nwritten_ = write(
+      fd, buf.data() + nwritten, buf.size() - nwritten
+    );
+    if (nwritten_ < 0 && errno == EINTR) {continue;}
+    if (nwritten_ <= 0) {return false;}
+    nwritten += nwritten_;
+  }
+
+  return true;
+}
+
+
+// ***********************************************************************
+// Job requests
+// ***********************************************************************
+
+std::string compose_job_request(
+  const std::string& cwd, const std::vector<std::string>& args
+) {
+  std::string request = cwd;
+  for (const std::string& arg : args) {
+    request += "\t" + arg;
+  }
+
+  return request;
+}
+
+bool parse_job_request(
+  const std::string& request, std::string& cwd,
+  std::vector<std::string>& args
+) {
+  cwd.clear();
+  args.clear();
+
+  std::size_t pos = 0;
+  bool first = true;
+  while (pos <= request.size()) {
+    std::size_t pos_tab = request.find('\t', pos);
+    if (pos_tab == std::string::npos) {pos_tab = request.size();}
+
+    std::string field = request.substr(pos, pos_tab - pos);
+    if (first) {
+      cwd = field;
+      first = false;
+    } else
+    if (!field.empty()) {
+      args.push_back(field);
+    }
+
+    pos = pos_tab + 1;
+  }
+
+  return !cwd.empty() && !args.empty();
+}
+
+}  // namespace trv::sys
+}  // namespace trv
@@ -299,6 +299,234 @@ store_reduced_spherical_harmonic_in_config_space(
   }
 }
 
+SphericalHarmonicTable::SphericalHarmonicTable(
+  const int ell, bool fourier,
+  const double boxsize[3], const int ngrid[3], bool stored, bool single
+) : ell(ell), fourier(fourier), stored(stored), single(single) {
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->boxsize[iaxis] = boxsize[iaxis];
+    this->ngrid[iaxis] = ngrid[iaxis];
+  }
+  this->nmesh = static_cast<long long>(ngrid[0]) * ngrid[1] * ngrid[2];
+
+  // Determine the fundamental wavenumber or the grid cell size
+  // in each dimension.
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->dv[iaxis] = fourier ?
+      2.*M_PI / boxsize[iaxis] : boxsize[iaxis] / double(ngrid[iaxis]);
+  }
+
+  // Set up the recurrence coefficients of the normalised associated
+  // Legendre polynomials P̄_l^m(μ) = Q_l^m(μ) (1 - μ²)^(m/2), where
+  // Q_m^m = - √((2m + 1)/(2m)) Q_(m-1)^(m-1) with Q_0^0 = 1/√(4π),
+  // Q_(m+1)^m = √(2m + 3) μ Q_m^m and
+  // Q_l^m = a_l^m (μ Q_(l-1)^m - b_l^m Q_(l-2)^m).
+  this->qmm.resize(ell + 1);
+  this->a_lm.assign((ell + 1) * (ell + 1), 0.);
+  this->b_lm.assign((ell + 1) * (ell + 1), 0.);
+
+  this->qmm[0] = 1. / std::sqrt(4.*M_PI);
+  for (int m = 1; m <= ell; m++) {
+    this->qmm[m] = - std::sqrt((2.*m + 1.) / (2.*m)) * this->qmm[m - 1];
+  }
+  for (int m = 0; m <= ell; m++) {
+    for (int l = m + 2; l <= ell; l++) {
+      this->a_lm[m * (ell + 1) + l] = std::sqrt(
+        (4.*l*l - 1.) / double(l*l - m*m)
+      );
+      this->b_lm[m * (ell + 1) + l] = std::sqrt(
+        double((l - 1)*(l - 1) - m*m) / (4.*(l - 1)*(l - 1) - 1.)
+      );
+    }
+  }
+
+  // Normalise to the reduced form.
+  this->norm = std::sqrt(4.*M_PI / (2.*ell + 1.));
+
+  // The trivial case y_0^0 = 1 is not stored.
+  this->ncomp = (ell == 0 || !stored) ? 0 : 2*ell + 1;
+  if (this->ncomp == 0) {return;}
+
+  if (trvs::currTask == 0) {
+    trvs::logger.debug(
+      "Computing reduced spherical harmonics of degree %d in %s space.",
+      ell, fourier ? "Fourier" : "configuration"
+    );
+  }
+
+  const long long ncomps = this->ncomp * this->nmesh;
+  if (this->single) {
+    this->comps_sp.resize(ncomps);
+    trvs::gbytesMem += trvs::size_in_gb<float>(ncomps);
+  } else {
+    this->comps.resize(ncomps);
+    trvs::gbytesMem += trvs::size_in_gb<double>(ncomps);
+  }
+  trvs::update_maxmem();
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(3)
+#endif  // TRV_USE_OMP
+  for (int i = 0; i < ngrid[0]; i++) {
+    for (int j = 0; j < ngrid[1]; j++) {
+      for (int k = 0; k < ngrid[2]; k++) {
+        long long idx_grid =
+          (i * static_cast<long long>(ngrid[1]) + j) * ngrid[2] + k;
+
+        for (int m = 0; m <= ell; m++) {
+          std::complex<double> ylm = this->calc_nonneg_order(m, i, j, k);
+          if (m == 0) {
+            this->set_comp(0, idx_grid, ylm.real());
+          } else {
+            this->set_comp(2*m - 1, idx_grid, ylm.real());
+            this->set_comp(2*m, idx_grid, ylm.imag());
+          }
+        }
+      }
+    }
+  }
+}
+
+SphericalHarmonicTable::~SphericalHarmonicTable() {
+  const long long ncomps = this->ncomp * this->nmesh;
+  if (this->single) {
+    trvs::gbytesMem -= trvs::size_in_gb<float>(ncomps);
+  } else {
+    trvs::gbytesMem -= trvs::size_in_gb<double>(ncomps);
+  }
+}
+
+std::complex<double> SphericalHarmonicTable::calc_nonneg_order(
+  const int m, int i, int j, int k
+) const {
+  // CAVEAT: Discretionary choice such that eps = 1.e-9 as in
+  // `SphericalHarmonicCalculator::calc_reduced_spherical_harmonic`.
+  const double eps = 1.e-9;
+
+  // This conforms to the FFT array-ordering convention as in
+  // `SphericalHarmonicCalculator::store_reduced_spherical_harmonic_*`.
+  double vec[3];
+  vec[0] = (i < this->ngrid[0]/2) ?
+    i * this->dv[0] : (i - this->ngrid[0]) * this->dv[0];
+  vec[1] = (j < this->ngrid[1]/2) ?
+    j * this->dv[1] : (j - this->ngrid[1]) * this->dv[1];
+  vec[2] = (k < this->ngrid[2]/2) ?
+    k * this->dv[2] : (k - this->ngrid[2]) * this->dv[2];
+
+  double vec_mod = std::sqrt(
+    vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]
+  );
+
+  // Return zero in the trivial case.
+  if (vec_mod < eps) {return 0.;}
+
+  // Compute y_l^m = √(4π/(2l + 1)) P̄_l^m(μ) exp(-imϕ) for m >= 0,
+  // where (1 - μ²)^(m/2) exp(-imϕ) = ((x - iy) / r)^m.
+  const int ell = this->ell;
+
+  double mu = vec[2] / vec_mod;
+
+  double q_lm_2 = this->qmm[m];
+  double q_lm = q_lm_2;
+  if (m < ell) {
+    double q_lm_1 = std::sqrt(2.*m + 3.) * mu * q_lm_2;
+    q_lm = q_lm_1;
+    for (int l = m + 2; l <= ell; l++) {
+      q_lm = this->a_lm[m * (ell + 1) + l]
+        * (mu * q_lm_1 - this->b_lm[m * (ell + 1) + l] * q_lm_2);
+      q_lm_2 = q_lm_1;
+      q_lm_1 = q_lm;
+    }
+  }
+
+  std::complex<double> phase_unit(vec[0] / vec_mod, - vec[1] / vec_mod);
+  std::complex<double> phase(1., 0.);
+  for (int m_ = 0; m_ < m; m_++) {
+    phase *= phase_unit;
+  }
+
+  return this->norm * q_lm * phase;
+}
+
+std::shared_ptr<SphericalHarmonicTable> SphericalHarmonicTable::ret_shared(
+  const int ell, bool fourier,
+  const double boxsize[3], const int ngrid[3], bool stored, bool single
+) {
+  // Tables are shared while they are held.
+  static std::vector< std::weak_ptr<SphericalHarmonicTable> > shared_tables;
+
+  std::shared_ptr<SphericalHarmonicTable> table = nullptr;
+  for (auto it = shared_tables.begin(); it != shared_tables.end(); ) {
+    std::shared_ptr<SphericalHarmonicTable> table_ = it->lock();
+    if (table_ == nullptr) {
+      it = shared_tables.erase(it);
+      continue;
+    }
+    if (
+      table_->ell == ell
+      && table_->fourier == fourier
+      && table_->stored == stored
+      && table_->single == single
+      && table_->boxsize[0] == boxsize[0]
+      && table_->boxsize[1] == boxsize[1]
+      && table_->boxsize[2] == boxsize[2]
+      && table_->ngrid[0] == ngrid[0]
+      && table_->ngrid[1] == ngrid[1]
+      && table_->ngrid[2] == ngrid[2]
+    ) {
+      table = table_;
+    }
+    ++it;
+  }
+  if (table != nullptr) {return table;}
+
+  table = std::make_shared<SphericalHarmonicTable>(
+    ell, fourier, boxsize, ngrid, stored, single
+  );
+  shared_tables.push_back(table);
+
+  return table;
+}
+
+double SphericalHarmonicTable::calc_size_in_gb(
+  const int ell, const int ngrid[3], bool single
+) {
+  const long long ncomps = ((ell == 0) ? 0 : 2*ell + 1)
+    * (static_cast<long long>(ngrid[0]) * ngrid[1] * ngrid[2]);
+  return single ?
+    trvs::size_in_gb<float>(ncomps) : trvs::size_in_gb<double>(ncomps);
+}
+
+void SphericalHarmonicTable::store_reduced_spherical_harmonic(
+  const int m, std::vector< std::complex<double> >& ylm_out
+) const {
+  if (std::abs(m) > this->ell) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Order m = %d is out of range for degree ell = %d.", m, this->ell
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Order m = %d is out of range for degree ell = %d.\n", m, this->ell
+    );
+  }
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(3)
+#endif  // TRV_USE_OMP
+  for (int i = 0; i < this->ngrid[0]; i++) {
+    for (int j = 0; j < this->ngrid[1]; j++) {
+      for (int k = 0; k < this->ngrid[2]; k++) {
+        long long idx_grid =
+          (i * static_cast<long long>(this->ngrid[1]) + j) * this->ngrid[2]
+          + k;
+
+        ylm_out[idx_grid] = this->eval(m, i, j, k);
+      }
+    }
+  }
+}
+
 
 // ***********************************************************************
 // Spherical Bessel function
@@ -315,60 +543,98 @@ SphericalBesselCalculator::SphericalBesselCalculator(
   const double xmax = this->split;  // maximum of interpolation range
   const double dx = this->step;     // interpolation step size
 
-  int nsample = int((xmax - xmin)/dx) + 1;  // interpolation sample number
+  this->nsample = int((xmax - xmin)/dx) + 1;
+
+  const int nsample = this->nsample;
 
-  // Initialise and evaluate at sample points.
-  double* x = new double[nsample];
-  double* j_ell = new double[nsample];
+  // Evaluate at sample points.
+  std::vector<double> j_ell(nsample);
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for
 #endif  // TRV_USE_OMP
   for (int i = 0; i < nsample; i++) {
-    x[i] = xmin + dx * i;
-    j_ell[i] = gsl_sf_bessel_jl(this->order, x[i]);
+    j_ell[i] = gsl_sf_bessel_jl(this->order, xmin + dx * i);
   }
 
-  // Initialise the interpolator using cubic spline and the accelerator.
-  this->accel = gsl_interp_accel_alloc();
-  this->spline = gsl_spline_alloc(gsl_interp_cspline, nsample);
+  // Solve for the scaled second derivatives C_i = y''_i Δx^2 / 6 of the
+  // natural cubic spline, which satisfy the tridiagonal system
+  // C_{i-1} + 4 C_i + C_{i+1} = y_{i+1} - 2 y_i + y_{i-1}
+  // with C_0 = C_{n-1} = 0, by forward elimination and back substitution.
+  std::vector<double> c_ell(nsample, 0.);
+  std::vector<double> diag(nsample, 4.);
+  for (int i = 1; i < nsample - 1; i++) {
+    c_ell[i] = j_ell[i + 1] - 2. * j_ell[i] + j_ell[i - 1];
+  }
+  for (int i = 2; i < nsample - 1; i++) {
+    double w = 1. / diag[i - 1];
+    diag[i] -= w;
+    c_ell[i] -= w * c_ell[i - 1];
+  }
+  for (int i = nsample - 2; i > 0; i--) {
+    c_ell[i] = (c_ell[i] - c_ell[i + 1]) / diag[i];
+  }
 
-  gsl_spline_init(this->spline, x, j_ell, nsample);
+  // Interleave sampled values and coefficients so that each interpolation
+  // reads a single contiguous block.
+  std::vector<double> table_(2 * nsample);
+  for (int i = 0; i < nsample; i++) {
+    table_[2*i] = j_ell[i];
+    table_[2*i + 1] = c_ell[i];
+  }
 
-  delete[] x; delete[] j_ell;
+  this->table = std::make_shared< const std::vector<double> >(
+    std::move(table_)
+  );
 }
 
-SphericalBesselCalculator::SphericalBesselCalculator(
-  const SphericalBesselCalculator& other
-) {
-  this->order = other.order;
-  this->split = other.split;
-  this->step = other.step;
+double SphericalBesselCalculator::interpolate(double x) const {
+  const double* tab = this->table->data();
 
-  this->accel = gsl_interp_accel_alloc();
-  this->spline = gsl_spline_alloc(gsl_interp_cspline, other.spline->size);
+  double t = x / this->step;
+  int i = int(t);
+  i = (i < this->nsample - 2) ? i : this->nsample - 2;
 
-  gsl_spline_init(
-    this->spline, other.spline->x, other.spline->y, other.spline->size
-  );
-}
+  double b = t - i;
+  double a = 1. - b;
 
-SphericalBesselCalculator::~SphericalBesselCalculator() {
-  if (this->accel != nullptr) {
-    gsl_interp_accel_free(this->accel); this->accel = nullptr;
-  }
-
-  if (this->spline != nullptr) {
-    gsl_spline_free(this->spline); this->spline = nullptr;
-  }
+  const double* node = tab + 2*i;
+  return a * node[0] + b * node[2]
+    + (a * a - 1.) * a * node[1] + (b * b - 1.) * b * node[3];
 }
 
-double SphericalBesselCalculator::eval(double x) {
+double SphericalBesselCalculator::eval(double x) const {
   if (x >= this->split) {
     return gsl_sf_bessel_jl(this->order, x);
   } else {
-    // NOTE: This is a computational bottleneck.
-    return gsl_spline_eval(this->spline, x, this->accel);
+    return this->interpolate(x);
+  }
+}
+
+void SphericalBesselCalculator::eval_batch(
+  const std::vector<double>& x, double scale, std::vector<double>& j_ell
+) const {
+  const int nx = int(x.size());
+
+  j_ell.resize(nx);
+
+  // Interpolate all arguments (clamped to the interpolation range)
+  // in a branch-free pass, before direct evaluation of the few arguments
+  // beyond the split.
+  const double xclamp = (this->nsample - 1) * this->step;
+  for (int ix = 0; ix < nx; ix++) {
+    double x_ = scale * x[ix];
+    j_ell[ix] = this->interpolate((x_ < xclamp) ? x_ : xclamp);
+  }
+
+  for (int ix = 0; ix < nx; ix++) {
+    double x_ = scale * x[ix];
+    if (x_ >= this->split) {
+      j_ell[ix] = gsl_sf_bessel_jl(this->order, x_);
+    } else
+    if (x_ >= xclamp) {
+      j_ell[ix] = this->interpolate(x_);
+    }
   }
 }
 
@@ -42,6 +42,7 @@ namespace sys {
 // ***********************************************************************
 
 int currTask = 0;
+int numTasks = 1;
 
 double gbytesMem = 0.;
 double gbytesMaxMem = 0.;
@@ -56,8 +57,8 @@ float max_count_grid = 0.;
 int count_fft = 0;
 int count_ifft = 0;
 
-bool fftw_wisdom_f_imported = false;
-bool fftw_wisdom_b_imported = false;
+std::string fftw_wisdom_file;
+std::string fftwf_wisdom_file;
 
 auto clockStart = std::chrono::steady_clock::now();  ///< program starting time
 
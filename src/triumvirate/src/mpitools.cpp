@@ -0,0 +1,445 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file mpitools.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ *
+ */
+
+#include "mpitools.hpp"
+
+namespace trvs = trv::sys;
+
+namespace trv {
+
+// ***********************************************************************
+// MPI environment
+// ***********************************************************************
+
+namespace sys {
+
+void init_mpi(int* argc, char*** argv) {
+#ifdef TRV_USE_MPI
+  MPI_Init(argc, argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &currTask);
+  MPI_Comm_size(MPI_COMM_WORLD, &numTasks);
+#endif  // TRV_USE_MPI
+}
+
+void finalise_mpi() {
+#ifdef TRV_USE_MPI
+  MPI_Finalize();
+#endif  // TRV_USE_MPI
+}
+
+void allocate_share(
+  long long ntotal, long long& n_local, long long& i_start, int task
+) {
+  if (task < 0) {task = currTask;}
+
+  // Share the remaining items amongst the remaining tasks in order.
+  long long ntotal_toassign = ntotal;
+  int ntask_toassign = numTasks;
+  i_start = 0;
+  for (int itask = 0; itask <= task; itask++) {
+    n_local = ntotal_toassign / ntask_toassign;
+    if (itask < task) {
+      i_start += n_local;
+      ntotal_toassign -= n_local;
+      ntask_toassign--;
+    }
+  }
+}
+
+void allocate_slab(int ngrid, int& n_local, int& i_start, int task) {
+  if (ngrid < numTasks) {
+    if (currTask == 0) {
+      logger.error(
+        "Grid number %d is less than the number of MPI tasks %d.",
+        ngrid, numTasks
+      );
+    }
+    throw InvalidParameterError(
+      "Grid number %d is less than the number of MPI tasks %d.\n",
+      ngrid, numTasks
+    );
+  }
+
+  long long n_local_ = 0, i_start_ = 0;
+  allocate_share(ngrid, n_local_, i_start_, task);
+  n_local = static_cast<int>(n_local_);
+  i_start = static_cast<int>(i_start_);
+}
+
+void allreduce_sum(double* data, int count) {
+#ifdef TRV_USE_MPI
+  if (numTasks > 1) {
+    MPI_Allreduce(
+      MPI_IN_PLACE, data, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD
+    );
+  }
+#endif  // TRV_USE_MPI
+}
+
+void allreduce_sum(int* data, int count) {
+#ifdef TRV_USE_MPI
+  if (numTasks > 1) {
+    MPI_Allreduce(
+      MPI_IN_PLACE, data, count, MPI_INT, MPI_SUM, MPI_COMM_WORLD
+    );
+  }
+#endif  // TRV_USE_MPI
+}
+
+void allreduce_sum(long long* data, int count) {
+#ifdef TRV_USE_MPI
+  if (numTasks > 1) {
+    MPI_Allreduce(
+      MPI_IN_PLACE, data, count, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD
+    );
+  }
+#endif  // TRV_USE_MPI
+}
+
+void allreduce_min(double* data, int count) {
+#ifdef TRV_USE_MPI
+  if (numTasks > 1) {
+    MPI_Allreduce(
+      MPI_IN_PLACE, data, count, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD
+    );
+  }
+#endif  // TRV_USE_MPI
+}
+
+void allreduce_max(double* data, int count) {
+#ifdef TRV_USE_MPI
+  if (numTasks > 1) {
+    MPI_Allreduce(
+      MPI_IN_PLACE, data, count, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD
+    );
+  }
+#endif  // TRV_USE_MPI
+}
+
+void exchange_values(
+  const std::vector<double>& sendbuf,
+  const std::vector<long long>& sendcounts,
+  std::vector<double>& recvbuf
+) {
+#ifdef TRV_USE_MPI
+  if (numTasks > 1) {
+    std::vector<long long> recvcounts(numTasks);
+    MPI_Alltoall(
+      sendcounts.data(), 1, MPI_LONG_LONG,
+      recvcounts.data(), 1, MPI_LONG_LONG, MPI_COMM_WORLD
+    );
+
+    // Block sizes are passed to MPI as `int`, so must not overflow.
+    std::vector<int> scounts(numTasks), sdispls(numTasks);
+    std::vector<int> rcounts(numTasks), rdispls(numTasks);
+    long long sdispl = 0, rdispl = 0;
+    for (int itask = 0; itask < numTasks; itask++) {
+      if (sdispl + sendcounts[itask] > INT_MAX
+          || rdispl + recvcounts[itask] > INT_MAX) {
+        if (currTask == 0) {
+          logger.error(
+            "Catalogue share is too large for MPI exchanges. "
+            "Use more MPI tasks."
+          );
+        }
+        throw InvalidParameterError(
+          "Catalogue share is too large for MPI exchanges. "
+          "Use more MPI tasks.\n"
+        );
+      }
+      scounts[itask] = static_cast<int>(sendcounts[itask]);
+      rcounts[itask] = static_cast<int>(recvcounts[itask]);
+      sdispls[itask] = static_cast<int>(sdispl);
+      rdispls[itask] = static_cast<int>(rdispl);
+      sdispl += sendcounts[itask];
+      rdispl += recvcounts[itask];
+    }
+
+    recvbuf.resize(rdispl);
+    MPI_Alltoallv(
+      sendbuf.data(), scounts.data(), sdispls.data(), MPI_DOUBLE,
+      recvbuf.data(), rcounts.data(), rdispls.data(), MPI_DOUBLE,
+      MPI_COMM_WORLD
+    );
+    return;
+  }
+#endif  // TRV_USE_MPI
+
+  // With a single task, the only block is copied locally.
+  recvbuf = sendbuf;
+}
+
+}  // namespace trv::sys
+
+
+// ***********************************************************************
+// Slab-decomposed FFT
+// ***********************************************************************
+
+SlabFFTPlan::SlabFFTPlan(
+  const int ngrid[3], int sign, unsigned planner_flag
+) {
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->ngrid[iaxis] = ngrid[iaxis];
+  }
+
+  // Decompose the mesh grid into slabs along both the first dimension
+  // (input/output) and the second dimension (transposed).
+  this->n0_locals.resize(trvs::numTasks);
+  this->i0_starts.resize(trvs::numTasks);
+  this->n1_locals.resize(trvs::numTasks);
+  this->j1_starts.resize(trvs::numTasks);
+  for (int itask = 0; itask < trvs::numTasks; itask++) {
+    trvs::allocate_slab(
+      ngrid[0], this->n0_locals[itask], this->i0_starts[itask], itask
+    );
+    trvs::allocate_slab(
+      ngrid[1], this->n1_locals[itask], this->j1_starts[itask], itask
+    );
+  }
+  this->n0_local = this->n0_locals[trvs::currTask];
+  this->i0_start = this->i0_starts[trvs::currTask];
+  this->n1_local = this->n1_locals[trvs::currTask];
+  this->j1_start = this->j1_starts[trvs::currTask];
+
+  this->nbuffer = std::max(
+    static_cast<long long>(this->n0_local) * ngrid[1] * ngrid[2],
+    static_cast<long long>(this->n1_local) * ngrid[2] * ngrid[0]
+  );
+
+  // Plan in-place transforms on a scratch buffer, which are later
+  // executed on other (equally aligned) arrays.
+  fftw_complex* buffer = fftw_alloc_complex(this->nbuffer);
+
+  trvs::gbytesMem += trvs::size_in_gb<fftw_complex>(this->nbuffer);
+  trvs::update_maxmem();
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftw_plan_with_nthreads(omp_get_max_threads());
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+
+  int n_yz[2] = {ngrid[1], ngrid[2]};
+  int dist_yz = ngrid[1] * ngrid[2];
+  this->plan_yz = fftw_plan_many_dft(
+    2, n_yz, this->n0_local,
+    buffer, nullptr, 1, dist_yz,
+    buffer, nullptr, 1, dist_yz,
+    sign, planner_flag
+  );
+
+  int n_x[1] = {ngrid[0]};
+  int dist_x = ngrid[0];
+  this->plan_x = fftw_plan_many_dft(
+    1, n_x, this->n1_local * ngrid[2],
+    buffer, nullptr, 1, dist_x,
+    buffer, nullptr, 1, dist_x,
+    sign, planner_flag
+  );
+
+  fftw_free(buffer); buffer = nullptr;
+
+  trvs::gbytesMem -= trvs::size_in_gb<fftw_complex>(this->nbuffer);
+}
+
+SlabFFTPlan::~SlabFFTPlan() {
+  fftw_destroy_plan(this->plan_yz);
+  fftw_destroy_plan(this->plan_x);
+}
+
+long long SlabFFTPlan::ret_local_size() {
+  return static_cast<long long>(this->n0_local)
+    * this->ngrid[1] * this->ngrid[2];
+}
+
+void SlabFFTPlan::execute(fftw_complex* grid) {
+  const int ntasks = trvs::numTasks;
+  const long long n0 = this->ngrid[0];
+  const long long n1 = this->ngrid[1];
+  const long long n2 = this->ngrid[2];
+
+  // Set up the block sizes and offsets for the transposes, where blocks
+  // are exchanged between the first-dimension slab of each task and
+  // the second-dimension slab of each task.
+  std::vector<long long> counts_x2y(ntasks), offsets_x2y(ntasks);
+  std::vector<long long> counts_y2x(ntasks), offsets_y2x(ntasks);
+  long long offset_x2y = 0, offset_y2x = 0;
+  for (int itask = 0; itask < ntasks; itask++) {
+    counts_x2y[itask] = this->n0_local * this->n1_locals[itask] * n2;
+    counts_y2x[itask] = this->n0_locals[itask] * this->n1_local * n2;
+    offsets_x2y[itask] = offset_x2y;
+    offsets_y2x[itask] = offset_y2x;
+    offset_x2y += counts_x2y[itask];
+    offset_y2x += counts_y2x[itask];
+  }
+
+  fftw_complex* buffer_a = fftw_alloc_complex(this->nbuffer);
+  fftw_complex* buffer_b = fftw_alloc_complex(this->nbuffer);
+
+  trvs::gbytesMem += 2 * trvs::size_in_gb<fftw_complex>(this->nbuffer);
+  trvs::update_maxmem();
+
+  // Perform 2-d FFTs in the last two dimensions of the local slab.
+  fftw_execute_dft(this->plan_yz, grid, grid);
+
+  // Pack blocks by destination task as [i_local][j_block][k].
+  for (int itask = 0; itask < ntasks; itask++) {
+    const long long n1_block = this->n1_locals[itask];
+    const long long j1_block = this->j1_starts[itask];
+    fftw_complex* block = buffer_a + offsets_x2y[itask];
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(2)
+#endif  // TRV_USE_OMP
+    for (long long il = 0; il < this->n0_local; il++) {
+      for (long long jl = 0; jl < n1_block; jl++) {
+        for (long long k = 0; k < n2; k++) {
+          long long idx_block = (il * n1_block + jl) * n2 + k;
+          long long idx_grid = (il * n1 + j1_block + jl) * n2 + k;
+          block[idx_block][0] = grid[idx_grid][0];
+          block[idx_block][1] = grid[idx_grid][1];
+        }
+      }
+    }
+  }
+
+  this->exchange(buffer_a, buffer_b, counts_x2y, counts_y2x);
+
+  // Unpack blocks by source task into the transposed layout
+  // [j_local][k][i], and perform 1-d FFTs in the first dimension.
+  for (int itask = 0; itask < ntasks; itask++) {
+    const long long n0_block = this->n0_locals[itask];
+    const long long i0_block = this->i0_starts[itask];
+    const fftw_complex* block = buffer_b + offsets_y2x[itask];
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(2)
+#endif  // TRV_USE_OMP
+    for (long long il = 0; il < n0_block; il++) {
+      for (long long jl = 0; jl < this->n1_local; jl++) {
+        for (long long k = 0; k < n2; k++) {
+          long long idx_block = (il * this->n1_local + jl) * n2 + k;
+          long long idx_trans = (jl * n2 + k) * n0 + i0_block + il;
+          buffer_a[idx_trans][0] = block[idx_block][0];
+          buffer_a[idx_trans][1] = block[idx_block][1];
+        }
+      }
+    }
+  }
+
+  fftw_execute_dft(this->plan_x, buffer_a, buffer_a);
+
+  // Pack blocks by destination task as [i_block][j_local][k].
+  for (int itask = 0; itask < ntasks; itask++) {
+    const long long n0_block = this->n0_locals[itask];
+    const long long i0_block = this->i0_starts[itask];
+    fftw_complex* block = buffer_b + offsets_y2x[itask];
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(2)
+#endif  // TRV_USE_OMP
+    for (long long il = 0; il < n0_block; il++) {
+      for (long long jl = 0; jl < this->n1_local; jl++) {
+        for (long long k = 0; k < n2; k++) {
+          long long idx_block = (il * this->n1_local + jl) * n2 + k;
+          long long idx_trans = (jl * n2 + k) * n0 + i0_block + il;
+          block[idx_block][0] = buffer_a[idx_trans][0];
+          block[idx_block][1] = buffer_a[idx_trans][1];
+        }
+      }
+    }
+  }
+
+  this->exchange(buffer_b, buffer_a, counts_y2x, counts_x2y);
+
+  // Unpack blocks by source task back into the local slab.
+  for (int itask = 0; itask < ntasks; itask++) {
+    const long long n1_block = this->n1_locals[itask];
+    const long long j1_block = this->j1_starts[itask];
+    const fftw_complex* block = buffer_a + offsets_x2y[itask];
+#ifdef TRV_USE_OMP
+#pragma omp parallel for collapse(2)
+#endif  // TRV_USE_OMP
+    for (long long il = 0; il < this->n0_local; il++) {
+      for (long long jl = 0; jl < n1_block; jl++) {
+        for (long long k = 0; k < n2; k++) {
+          long long idx_block = (il * n1_block + jl) * n2 + k;
+          long long idx_grid = (il * n1 + j1_block + jl) * n2 + k;
+          grid[idx_grid][0] = block[idx_block][0];
+          grid[idx_grid][1] = block[idx_block][1];
+        }
+      }
+    }
+  }
+
+  fftw_free(buffer_a); buffer_a = nullptr;
+  fftw_free(buffer_b); buffer_b = nullptr;
+
+  trvs::gbytesMem -= 2 * trvs::size_in_gb<fftw_complex>(this->nbuffer);
+}
+
+void SlabFFTPlan::exchange(
+  fftw_complex* sendbuf, fftw_complex* recvbuf,
+  const std::vector<long long>& sendcounts,
+  const std::vector<long long>& recvcounts
+) {
+#ifdef TRV_USE_MPI
+  if (trvs::numTasks > 1) {
+    // Block sizes are passed to MPI as `int`, so must not overflow.
+    std::vector<int> scounts(trvs::numTasks), sdispls(trvs::numTasks);
+    std::vector<int> rcounts(trvs::numTasks), rdispls(trvs::numTasks);
+    long long sdispl = 0, rdispl = 0;
+    for (int itask = 0; itask < trvs::numTasks; itask++) {
+      if (sdispl + sendcounts[itask] > INT_MAX
+          || rdispl + recvcounts[itask] > INT_MAX) {
+        if (trvs::currTask == 0) {
+          trvs::logger.error(
+            "Local mesh slab is too large for MPI transposes. "
+            "Use more MPI tasks."
+          );
+        }
+        throw trvs::InvalidParameterError(
+          "Local mesh slab is too large for MPI transposes. "
+          "Use more MPI tasks.\n"
+        );
+      }
+      scounts[itask] = static_cast<int>(sendcounts[itask]);
+      rcounts[itask] = static_cast<int>(recvcounts[itask]);
+      sdispls[itask] = static_cast<int>(sdispl);
+      rdispls[itask] = static_cast<int>(rdispl);
+      sdispl += sendcounts[itask];
+      rdispl += recvcounts[itask];
+    }
+
+    MPI_Alltoallv(
+      sendbuf, scounts.data(), sdispls.data(), MPI_C_DOUBLE_COMPLEX,
+      recvbuf, rcounts.data(), rdispls.data(), MPI_C_DOUBLE_COMPLEX,
+      MPI_COMM_WORLD
+    );
+    return;
+  }
+#endif  // TRV_USE_MPI
+
+  // With a single task, the only block is copied locally.
+  std::memcpy(recvbuf, sendbuf, sendcounts[0] * sizeof(fftw_complex));
+}
+
+}  // namespace trv
@@ -49,6 +49,8 @@ ParameterSet::ParameterSet(const ParameterSet& other) {
   this->padfactor = other.padfactor;
   this->assignment = other.assignment;
   this->interlace = other.interlace;
+  this->assignment_engine = other.assignment_engine;
+  this->precision = other.precision;
   this->volume = other.volume;
   this->nmesh = other.nmesh;
   this->assignment_order = other.assignment_order;
@@ -64,8 +66,10 @@ ParameterSet::ParameterSet(const ParameterSet& other) {
   this->i_wa = other.i_wa;
   this->j_wa = other.j_wa;
   this->form = other.form;
+  this->shape = other.shape;
   this->norm_convention = other.norm_convention;
   this->binning = other.binning;
+  this->binning_reduction = other.binning_reduction;
   this->bin_min = other.bin_min;
   this->bin_max = other.bin_max;
   this->num_bins = other.num_bins;
@@ -73,6 +77,10 @@ ParameterSet::ParameterSet(const ParameterSet& other) {
 
   // Copy misc parameters.
   this->fftw_scheme = other.fftw_scheme;
+  this->fft_batch = other.fft_batch;
+  this->memory_limit = other.memory_limit;
+  this->shell_cache = other.shell_cache;
+  this->ylm_tables = other.ylm_tables;
   this->fftw_planner_flag = other.fftw_planner_flag;
   this->use_fftw_wisdom = other.use_fftw_wisdom;
   this->fftw_wisdom_file_f = other.fftw_wisdom_file_f;
@@ -106,12 +114,15 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
   char padscale_[16] = "";
   char assignment_[16] = "";
   char interlace_[16] = "";
+  char assignment_engine_[16] = "";
+  char precision_[16] = "";
 
   char catalogue_type_[16] = "";
   char statistic_type_[16] = "";
   char form_[16] = "";
   char norm_convention_[16] = "";
   char binning_[16] = "";
+  char binning_reduction_[16] = "";
 
   char fftw_scheme_[16] = "";
   char use_fftw_wisdom_[1024] = "";
@@ -144,7 +155,12 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
     auto scan_par_str = [line_str, dummy_str, dummy_equal](
       const char* par_name, const char* fmt, const char* par_value
     ) {
-      if (line_str.find(par_name) != std::string::npos) {
+      // Match the parameter name exactly, as some are prefixes of others.
+      char par_name_[1024];
+      if (
+        std::sscanf(line_str.data(), "%1023s", par_name_) == 1
+        && std::strcmp(par_name_, par_name) == 0
+      ) {
         std::sscanf(
           line_str.data(), fmt, dummy_str, dummy_equal, par_value
         );
@@ -211,6 +227,10 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
 
     scan_par_str("assignment", "%1023s %1023s %1023s", assignment_);
     scan_par_str("interlace", "%1023s %1023s %1023s", interlace_);
+    scan_par_str(
+      "assignment_engine", "%1023s %1023s %1023s", assignment_engine_
+    );
+    scan_par_str("precision", "%1023s %1023s %1023s", precision_);
 
     // -- Measurement ----------------------------------------------------
 
@@ -219,6 +239,9 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
     scan_par_str("form", "%1023s %1023s %1023s", form_);
     scan_par_str("norm_convention", "%1023s %1023s %1023s", norm_convention_);
     scan_par_str("binning", "%1023s %1023s %1023s", binning_);
+    scan_par_str(
+      "binning_reduction", "%1023s %1023s %1023s", binning_reduction_
+    );
 
     if (line_str.find("ell1") != std::string::npos) {
       std::sscanf(
@@ -286,6 +309,18 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
       "save_binned_vectors", "%1023s %1023s %1023s", save_binned_vectors_
     );
 
+    if (line_str.find("fft_batch") != std::string::npos) {
+      std::sscanf(
+        line_str.data(), "%1023s %1023s %d",
+        dummy_str, dummy_equal, &this->fft_batch
+      );
+    }
+    if (line_str.find("memory_limit") != std::string::npos) {
+      std::sscanf(
+        line_str.data(), "%1023s %1023s %lg",
+        dummy_str, dummy_equal, &this->memory_limit
+      );
+    }
     if (line_str.find("verbose") != std::string::npos) {
       std::sscanf(
         line_str.data(), "%1023s %1023s %d",
@@ -312,12 +347,15 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
   this->padscale = padscale_;
   this->assignment = assignment_;
   this->interlace = interlace_;
+  this->assignment_engine = assignment_engine_;
+  this->precision = precision_;
 
   this->catalogue_type = catalogue_type_;
   this->statistic_type = statistic_type_;
   this->form = form_;
   this->norm_convention = norm_convention_;
   this->binning = binning_;
+  this->binning_reduction = binning_reduction_;
 
   this->fftw_scheme = fftw_scheme_;
   this->use_fftw_wisdom = use_fftw_wisdom_;
@@ -366,12 +404,15 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
   debug_par_str("padscale", this->padscale);
   debug_par_str("assignment", this->assignment);
   debug_par_str("interlace", this->interlace);
+  debug_par_str("assignment_engine", this->assignment_engine);
+  debug_par_str("precision", this->precision);
 
   debug_par_str("catalogue_type", this->catalogue_type);
   debug_par_str("statistic_type", this->statistic_type);
   debug_par_str("form", this->form);
   debug_par_str("norm_convention", this->norm_convention);
   debug_par_str("binning", this->binning);
+  debug_par_str("binning_reduction", this->binning_reduction);
 
   debug_par_str("fftw_scheme", this->fftw_scheme);
   debug_par_str("use_fftw_wisdom", this->use_fftw_wisdom);
@@ -391,6 +432,7 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
 
   debug_par_int("num_bins", this->num_bins);
   debug_par_int("idx_bin", this->idx_bin);
+  debug_par_int("fft_batch", this->fft_batch);
 
   debug_par_double("boxsize[0]", this->boxsize[0]);
   debug_par_double("boxsize[1]", this->boxsize[1]);
@@ -399,6 +441,7 @@ int ParameterSet::read_from_file(char* parameter_filepath) {
   debug_par_double("padfactor", this->padfactor);
   debug_par_double("bin_min", this->bin_min);
   debug_par_double("bin_max", this->bin_max);
+  debug_par_double("memory_limit", this->memory_limit);
 #endif  // DBG_PARS
 
   return this->validate();
@@ -541,6 +584,42 @@ int ParameterSet::validate() {
       this->interlace.c_str()
     );
   }
+  if (this->assignment_engine == "") {
+    this->assignment_engine = "atomic";  // transmutation
+  }
+  if (
+    this->assignment_engine != "atomic" && this->assignment_engine != "slab"
+  ) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Mesh assignment engine must be 'atomic' or 'slab': "
+        "`assignment_engine` = '%s'.",
+        this->assignment_engine.c_str()
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Mesh assignment engine must be 'atomic' or 'slab': "
+      "`assignment_engine` = '%s'.\n",
+      this->assignment_engine.c_str()
+    );
+  }
+  if (this->precision == "") {
+    this->precision = "double";  // transmutation
+  }
+  if (this->precision != "double" && this->precision != "single") {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Mesh field precision must be 'double' or 'single': "
+        "`precision` = '%s'.",
+        this->precision.c_str()
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Mesh field precision must be 'double' or 'single': "
+      "`precision` = '%s'.\n",
+      this->precision.c_str()
+    );
+  }
 
   if (this->statistic_type == "powspec") {
     this->npoint = "2pt"; this->space = "fourier";  // derivation
@@ -579,6 +658,20 @@ int ParameterSet::validate() {
     );
 #endif  // !TRV_EXTCALL
   }
+  if (this->precision == "single" && this->npoint == "3pt") {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Single-precision mesh fields are only supported for "
+        "two-point statistics: `statistic_type` = '%s'.",
+        this->statistic_type.c_str()
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Single-precision mesh fields are only supported for "
+      "two-point statistics: `statistic_type` = '%s'.\n",
+      this->statistic_type.c_str()
+    );
+  }
   if (!(
     this->form == "full"
     || this->form == "diag"
@@ -653,6 +746,26 @@ int ParameterSet::validate() {
       this->binning.c_str()
     );
   }
+  if (this->binning_reduction == "") {
+    this->binning_reduction = "thread";  // transmutation
+  }
+  if (
+    this->binning_reduction != "thread"
+    && this->binning_reduction != "ordered"
+  ) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Binned reduction must be 'thread' or 'ordered': "
+        "`binning_reduction` = '%s'.",
+        this->binning_reduction.c_str()
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Binned reduction must be 'thread' or 'ordered': "
+      "`binning_reduction` = '%s'.\n",
+      this->binning_reduction.c_str()
+    );
+  }
 
   if (this->fftw_scheme == "estimate") {
     this->fftw_planner_flag = FFTW_ESTIMATE;  // derivation
@@ -676,9 +789,33 @@ int ParameterSet::validate() {
     );
   }
 
+  if (this->fft_batch < 1) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Number of batched FFT fields `fft_batch` must be >= 1."
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Number of batched FFT fields `fft_batch` must be >= 1.\n"
+    );
+  }
+
+  if (this->memory_limit < 0.) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Memory limit `memory_limit` must be >= 0.");
+    }
+    throw trvs::InvalidParameterError(
+      "Memory limit `memory_limit` must be >= 0.\n"
+    );
+  }
+
   if (this->use_fftw_wisdom == "false" || this->use_fftw_wisdom == "") {
     this->use_fftw_wisdom = "";  // transmutation
-  } else {
+  } else
+  if (this->use_fftw_wisdom == "auto") {
+    this->use_fftw_wisdom = ret_fftw_wisdom_dir_default();  // transmutation
+  } else
+  if (this->use_fftw_wisdom.back() != '/') {
     this->use_fftw_wisdom += "/";  // transmutation
   }
 
@@ -699,42 +836,13 @@ int ParameterSet::validate() {
         this->fftw_scheme.c_str()
       );
     }
-
-    char fftw_wisdom_file_f_[1024];
-    char fftw_wisdom_file_b_[1024];
-
-#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
-    std::snprintf(
-      fftw_wisdom_file_f_, sizeof(fftw_wisdom_file_f_),
-      "%sfftw_omp_cif_%dx%dx%d.wisdom",
-      this->use_fftw_wisdom.c_str(),
-      this->ngrid[0], this->ngrid[1], this->ngrid[2]
-    );
-    std::snprintf(
-      fftw_wisdom_file_b_, sizeof(fftw_wisdom_file_b_),
-      "%sfftw_omp_cib_%dx%dx%d.wisdom",
-      this->use_fftw_wisdom.c_str(),
-      this->ngrid[0], this->ngrid[1], this->ngrid[2]
-    );
-#else  // !TRV_USE_OMP || !TRV_USE_FFTWOMP
-    std::snprintf(
-      fftw_wisdom_file_f_, sizeof(fftw_wisdom_file_f_),
-      "%sfftw_cif_%dx%dx%d.wisdom",
-      this->use_fftw_wisdom.c_str(),
-      this->ngrid[0], this->ngrid[1], this->ngrid[2]
-    );
-    std::snprintf(
-      fftw_wisdom_file_b_, sizeof(fftw_wisdom_file_b_),
-      "%sfftw_cib_%dx%dx%d.wisdom",
-      this->use_fftw_wisdom.c_str(),
-      this->ngrid[0], this->ngrid[1], this->ngrid[2]
-    );
-#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
-
-    this->fftw_wisdom_file_f = fftw_wisdom_file_f_;
-    this->fftw_wisdom_file_b = fftw_wisdom_file_b_;
   }
 
+  this->fftw_wisdom_file_f =
+    this->ret_fftw_wisdom_filepath(FFTW_FORWARD);  // derivation
+  this->fftw_wisdom_file_b =
+    this->ret_fftw_wisdom_filepath(FFTW_BACKWARD);  // derivation
+
   char default_bvec_sfilepath[1024];
   std::snprintf(
     default_bvec_sfilepath, sizeof(default_bvec_sfilepath),
@@ -1025,6 +1133,8 @@ int ParameterSet::print_to_file(char* out_parameter_filepath) {
 
   print_par_str("assignment = %s\n", this->assignment);
   print_par_str("interlace = %s\n", this->interlace);
+  print_par_str("assignment_engine = %s\n", this->assignment_engine);
+  print_par_str("precision = %s\n", this->precision);
   print_par_int("assignment_order = %d\n", this->assignment_order);
 
   print_par_str("catalogue_type = %s\n", this->catalogue_type);
@@ -1042,6 +1152,7 @@ int ParameterSet::print_to_file(char* out_parameter_filepath) {
   print_par_str("form = %s\n", this->form);
   print_par_str("norm_convention = %s\n", this->norm_convention);
   print_par_str("binning = %s\n", this->binning);
+  print_par_str("binning_reduction = %s\n", this->binning_reduction);
   print_par_str("shape = %s\n", this->shape);
 
   print_par_double("bin_min = %.4f\n", this->bin_min);
@@ -1053,6 +1164,8 @@ int ParameterSet::print_to_file(char* out_parameter_filepath) {
   print_par_str("use_fftw_wisdom = %s\n", this->use_fftw_wisdom.c_str());
   print_par_str("fftw_wisdom_file_f = %s\n", this->fftw_wisdom_file_f.c_str());
   print_par_str("fftw_wisdom_file_b = %s\n", this->fftw_wisdom_file_b.c_str());
+  print_par_int("fft_batch = %d\n", this->fft_batch);
+  print_par_double("memory_limit = %.4f\n", this->memory_limit);
   print_par_str("save_binned_vectors = %s\n", this->save_binned_vectors);
   print_par_int("verbose = %d\n", this->verbose);
   print_par_int("fftw_planner_flag = %d\n", this->fftw_planner_flag);
@@ -1079,4 +1192,121 @@ int ParameterSet::print_to_file() {
   return ParameterSet::print_to_file(ofilepath);
 }
 
+std::uint64_t ParameterSet::ret_hash() {
+  // Define convenience function for composing parameters.
+  std::string params_str;
+  auto add_par_str = [&params_str](
+    const char* par_name, const std::string& par_val
+  ) {
+    params_str += std::string(par_name) + " = " + par_val + "\n";
+  };
+  auto add_par_num = [&params_str](
+    const char* par_name, double par_val
+  ) {
+    char par_val_str[32];
+    std::snprintf(par_val_str, sizeof(par_val_str), "%.17g", par_val);
+    params_str += std::string(par_name) + " = " + par_val_str + "\n";
+  };
+
+  // Compose parameters.
+  add_par_str("catalogue_dir", this->catalogue_dir);
+  add_par_str("data_catalogue_file", this->data_catalogue_file);
+  add_par_str("rand_catalogue_file", this->rand_catalogue_file);
+  add_par_str("catalogue_columns", this->catalogue_columns);
+
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    add_par_num("boxsize", this->boxsize[iaxis]);
+    add_par_num("ngrid", this->ngrid[iaxis]);
+  }
+
+  add_par_str("alignment", this->alignment);
+  add_par_str("padscale", this->padscale);
+  add_par_num("padfactor", this->padfactor);
+
+  add_par_str("assignment", this->assignment);
+  add_par_str("interlace", this->interlace);
+  add_par_str("assignment_engine", this->assignment_engine);
+  add_par_str("precision", this->precision);
+
+  add_par_str("catalogue_type", this->catalogue_type);
+  add_par_str("statistic_type", this->statistic_type);
+
+  add_par_num("ell1", this->ell1);
+  add_par_num("ell2", this->ell2);
+  add_par_num("ELL", this->ELL);
+
+  add_par_num("i_wa", this->i_wa);
+  add_par_num("j_wa", this->j_wa);
+
+  add_par_str("form", this->form);
+  add_par_str("norm_convention", this->norm_convention);
+  add_par_str("binning", this->binning);
+  add_par_str("binning_reduction", this->binning_reduction);
+
+  add_par_num("bin_min", this->bin_min);
+  add_par_num("bin_max", this->bin_max);
+  add_par_num("num_bins", this->num_bins);
+  add_par_num("idx_bin", this->idx_bin);
+
+  // Hash with the 64-bit FNV-1a algorithm.
+  std::uint64_t hash = 14695981039346656037ULL;  // FNV offset basis
+  for (unsigned char c : params_str) {
+    hash ^= c;
+    hash *= 1099511628211ULL;  // FNV prime
+  }
+
+  return hash;
+}
+
+std::string ParameterSet::ret_fftw_wisdom_filepath(int sign, bool single) {
+  if (this->use_fftw_wisdom == "") {return "";}
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  int nthreads = omp_get_max_threads();
+#else  // !TRV_USE_OMP || !TRV_USE_FFTWOMP
+  int nthreads = 1;
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+
+  // Keep only file-name-safe characters of the FFTW version string.
+  std::string version = fftw_version;
+  for (char& c : version) {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.') {c = '-';}
+  }
+
+  char wisdom_filepath[1024];
+  std::snprintf(
+    wisdom_filepath, sizeof(wisdom_filepath),
+    "%s%s_ci%s_%dx%dx%d_t%d_%s_%s.wisdom",
+    this->use_fftw_wisdom.c_str(),
+    single ? "fftwf" : "fftw", (sign == FFTW_FORWARD) ? "f" : "b",
+    this->ngrid[0], this->ngrid[1], this->ngrid[2],
+    nthreads, this->fftw_scheme.c_str(), version.c_str()
+  );
+
+  return std::string(wisdom_filepath);
+}
+
+std::string ParameterSet::ret_fftw_wisdom_dir_default() {
+  const char* wisdom_dir = std::getenv("TRV_FFTW_WISDOM_DIR");
+  if (wisdom_dir != nullptr && wisdom_dir[0] != '\0') {
+    std::string wisdom_dir_ = wisdom_dir;
+    if (wisdom_dir_.back() != '/') {wisdom_dir_ += "/";}
+    return wisdom_dir_;
+  }
+
+  std::string cache_dir;
+  const char* xdg_cache_home = std::getenv("XDG_CACHE_HOME");
+  const char* home = std::getenv("HOME");
+  if (xdg_cache_home != nullptr && xdg_cache_home[0] != '\0') {
+    cache_dir = xdg_cache_home;
+  } else
+  if (home != nullptr && home[0] != '\0') {
+    cache_dir = std::string(home) + "/.cache";
+  } else {
+    cache_dir = ".cache";
+  }
+
+  return cache_dir + "/triumvirate/fftw_wisdom/";
+}
+
 }  // namespace trv
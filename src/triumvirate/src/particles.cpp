@@ -42,20 +42,26 @@ ParticleCatalogue::ParticleCatalogue(int verbose) {
   // Set default values (likely redundant but safe).
   this->pdata = nullptr;
   this->ntotal = 0;
+  this->ntotal_owned = 0;
+  this->ntotal_global = 0;
   this->wtotal = 0.;
   this->wstotal = 0.;
   for (int iaxis = 0; iaxis < 3; iaxis++) {
     this->pos_min[iaxis] = 0.;
     this->pos_max[iaxis] = 0.;
     this->pos_span[iaxis] = 0.;
+    this->pos_offset[iaxis] = 0.;
   }
 }
 
 ParticleCatalogue::~ParticleCatalogue() {this->finalise_particles();}
 
-void ParticleCatalogue::initialise_particles(const int num) {
-  // Check the total number of particles.
-  if (num <= 0) {
+void ParticleCatalogue::initialise_particles(
+  const int num, const int num_global
+) {
+  // Check the total number of particles, where a task may hold none
+  // of them.
+  if (num < 0 || (num_global < 0 ? num : num_global) <= 0) {
     if (trvs::currTask == 0) {
       trvs::logger.error("Number of particles is non-positive.");
     }
@@ -64,11 +70,13 @@ void ParticleCatalogue::initialise_particles(const int num) {
     );
   }
 
-  this->ntotal = num;
-
   // Renew particle data.
   this->reset_particles();
 
+  this->ntotal = num;
+  this->ntotal_owned = num;
+  this->ntotal_global = (num_global < 0) ? num : num_global;
+
   this->pdata = new ParticleData[this->ntotal];
   trvs::gbytesMem += trvs::size_in_gb<struct ParticleData>(this->ntotal);
   trvs::update_maxmem();
@@ -118,6 +126,17 @@ int ParticleCatalogue::load_catalogue_file(
   }
   this->source = "extfile:" + catalogue_filepath;
 
+  // Read binary catalogues, which are identified by the file extension.
+  std::size_t len_ext = BINARY_CATALOGUE_EXT.size();
+  if (
+    catalogue_filepath.size() > len_ext
+    && catalogue_filepath.compare(
+      catalogue_filepath.size() - len_ext, len_ext, BINARY_CATALOGUE_EXT
+    ) == 0
+  ) {
+    return this->load_catalogue_binary_file(catalogue_filepath, volume);
+  }
+
   // ---------------------------------------------------------------------
   // Columns & fields
   // ---------------------------------------------------------------------
@@ -146,6 +165,20 @@ int ParticleCatalogue::load_catalogue_file(
     }
   }
 
+  // Check for the coordinate columns.
+  if (name_indices[0] == -1 || name_indices[1] == -1 || name_indices[2] == -1) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Catalogue coordinate fields are unavailable (source=%s).",
+        this->source.c_str()
+      );
+    }
+    throw trvs::InvalidDataError(
+      "Catalogue coordinate fields are unavailable (source=%s).\n",
+      this->source.c_str()
+    );
+  }
+
   // Check for the 'nz' column.
   if (name_indices[3] == -1) {
     if (trvs::currTask == 0) {
@@ -161,94 +194,433 @@ int ParticleCatalogue::load_catalogue_file(
   // Data reading
   // ---------------------------------------------------------------------
 
-  std::ifstream fin;
+  auto time_start = std::chrono::steady_clock::now();
 
-  fin.open(catalogue_filepath.c_str(), std::ios::in);
-
-  if (fin.fail()) {
-    fin.close();
+  int fd = open(catalogue_filepath.c_str(), O_RDONLY);
+  struct stat fstatus;
+  if (fd < 0 || fstat(fd, &fstatus) != 0) {
+    if (fd >= 0) {close(fd);}
     if (trvs::currTask == 0) {
       trvs::logger.error("Failed to open file: %s", this->source.c_str());
     }
     throw trvs::IOError("Failed to open file: %s\n", this->source.c_str());
   }
 
-  // Initialise particle data.
-  int num_lines = 0;
-  std::string line_str;
-  while (std::getline(fin, line_str)) {
-    // Terminate at the end of file.
-    if (!fin) {break;}
+  std::size_t filesize = static_cast<std::size_t>(fstatus.st_size);
+
+  void* addr = nullptr;
+  if (filesize > 0) {
+    addr = mmap(nullptr, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+
+  if (addr == MAP_FAILED) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Failed to map file: %s", this->source.c_str());
+    }
+    throw trvs::IOError("Failed to map file: %s\n", this->source.c_str());
+  }
+  if (addr != nullptr) {
+    madvise(addr, filesize, MADV_SEQUENTIAL);
+  }
 
-    // Skip empty lines or comment lines.
-    if (line_str.empty() || line_str[0] == '#') {continue;}
+  const char* text = static_cast<const char*>(addr);
+
+  // Split the file into byte shares at line boundaries, one per task,
+  // and the share of the current task into byte ranges, one per thread.
+  auto align_to_line = [text, filesize](std::size_t pos) {
+    while (pos < filesize && pos > 0 && text[pos - 1] != '\n') {pos++;}
+    return pos;
+  };
+
+  std::size_t share_begin = align_to_line(
+    filesize / trvs::numTasks * trvs::currTask
+  );
+  std::size_t share_end = (trvs::currTask == trvs::numTasks - 1)
+    ? filesize
+    : align_to_line(filesize / trvs::numTasks * (trvs::currTask + 1));
+  std::size_t share_size = share_end - share_begin;
+
+#ifdef TRV_USE_OMP
+  int nranges = omp_get_max_threads();
+#else  // !TRV_USE_OMP
+  int nranges = 1;
+#endif  // TRV_USE_OMP
 
-    // Count the line as valid otherwise.
-    num_lines++;
+  std::vector<std::size_t> range_bounds(nranges + 1, share_end);
+  range_bounds[0] = share_begin;
+  for (int irange = 1; irange < nranges; irange++) {
+    range_bounds[irange] = align_to_line(std::max(
+      range_bounds[irange - 1], share_begin + share_size / nranges * irange
+    ));
   }
 
-  fin.close();
+  // Count the candidate rows (i.e. lines which are neither empty nor
+  // comments) in each range in parallel, so that particle data are
+  // allocated once and each range is parsed directly into place.
+  std::vector<long long> range_offsets(nranges + 1, 0);
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for schedule(static, 1)
+#endif  // TRV_USE_OMP
+  for (int irange = 0; irange < nranges; irange++) {
+    long long nrows_range = 0;
+
+    const char* pos = text + range_bounds[irange];
+    const char* end = text + range_bounds[irange + 1];
+    while (pos < end) {
+      const char* eol = static_cast<const char*>(
+        std::memchr(pos, '\n', end - pos)
+      );
+      if (eol == nullptr) {eol = end;}
+
+      if (!(pos == eol || *pos == '#' || (*pos == '\r' && pos + 1 == eol))) {
+        nrows_range++;
+      }
+
+      pos = eol + 1;
+    }
+
+    range_offsets[irange + 1] = nrows_range;
+  }
+
+  for (int irange = 0; irange < nranges; irange++) {
+    range_offsets[irange + 1] += range_offsets[irange];
+  }
+
+  long long nrows_global = range_offsets[nranges];
+  trvs::allreduce_sum(&nrows_global, 1);
+
+  // The file is unmapped before an empty catalogue is rejected.
+  if (nrows_global <= 0 && addr != nullptr) {
+    munmap(addr, filesize);
+  }
 
-  this->initialise_particles(num_lines);
+  this->initialise_particles(
+    int(range_offsets[nranges]), int(nrows_global)
+  );
 
-  // Set particle data.
   double nz_box_default = 0.;
   if (volume > 0.) {
-    nz_box_default = this->ntotal / volume;
+    nz_box_default = this->ntotal_global / volume;
   }
 
-  fin.open(catalogue_filepath.c_str(), std::ios::in);
+  // Parse each range into particle data from its offset in parallel.
+  int ncols_parsed = 1 + *std::max_element(
+    name_indices.begin(), name_indices.end()
+  );
 
-  int idx_line = 0;   // current line number
-  double nz, ws, wc;  // placeholder variables
-  double entry;       // data entry (per column per row)
-  while (std::getline(fin, line_str)) {  // std::string line_str;
-    // Terminate at the end of file.
-    if (!fin) {break;}
+  std::vector<long long> range_badline(nranges, -1);
 
-    // Skip empty lines or comment lines.
-    if (line_str.empty() || line_str[0] == '#') {continue;}
+#ifdef TRV_USE_OMP
+#pragma omp parallel for schedule(static, 1)
+#endif  // TRV_USE_OMP
+  for (int irange = 0; irange < nranges; irange++) {
+    long long pid = range_offsets[irange];
 
-    // Extract row entries.
-    std::vector<double> row;
+    std::vector<double> row(ncols_parsed);
 
-    std::stringstream ss(
-      line_str, std::ios_base::out | std::ios_base::in | std::ios_base::binary
+    const char* pos = text + range_bounds[irange];
+    const char* end = text + range_bounds[irange + 1];
+    while (pos < end) {
+      const char* eol = static_cast<const char*>(
+        std::memchr(pos, '\n', end - pos)
+      );
+      if (eol == nullptr) {eol = end;}
+
+      // Skip empty lines or comment lines.
+      if (pos == eol || *pos == '#' || (*pos == '\r' && pos + 1 == eol)) {
+        pos = eol + 1;
+        continue;
+      }
+
+      // Extract row entries up to the last column needed.
+      int icol = 0;
+      const char* cursor = pos;
+      while (icol < ncols_parsed) {
+        while (
+          cursor < eol
+          && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')
+        ) {
+          cursor++;
+        }
+        if (cursor == eol) {break;}
+#ifdef __cpp_lib_to_chars
+        if (*cursor == '+') {cursor++;}
+        std::from_chars_result res =
+          std::from_chars(cursor, eol, row[icol]);
+        if (res.ec != std::errc()) {break;}
+        cursor = res.ptr;
+#else  // !__cpp_lib_to_chars
+        char* next = nullptr;
+        row[icol] = std::strtod(cursor, &next);
+        if (next == cursor || next > eol) {break;}
+        cursor = next;
+#endif  // __cpp_lib_to_chars
+        icol++;
+      }
+
+      if (icol < ncols_parsed) {
+        range_badline[irange] = pos - text;
+        break;
+      }
+
+      // Set the current line as a particle, with missing 'nz' values
+      // set to the default value.
+      ParticleData& particle = this->pdata[pid];
+      particle.pos[0] = row[name_indices[0]];  // x
+      particle.pos[1] = row[name_indices[1]];  // y
+      particle.pos[2] = row[name_indices[2]];  // z
+      particle.nz = (name_indices[3] != -1)
+        ? row[name_indices[3]] : nz_box_default;
+      particle.ws = (name_indices[4] != -1) ? row[name_indices[4]] : 1.;
+      particle.wc = (name_indices[5] != -1) ? row[name_indices[5]] : 1.;
+      particle.w = particle.ws * particle.wc;
+      pid++;
+
+      pos = eol + 1;
+    }
+  }
+
+  if (addr != nullptr) {
+    munmap(addr, filesize);
+  }
+
+  // Malformed rows are gathered from all tasks (offset by one, with
+  // zero for none), so that all tasks reject the catalogue together.
+  std::vector<long long> task_badline(trvs::numTasks, 0);
+  for (int irange = 0; irange < nranges; irange++) {
+    if (range_badline[irange] != -1) {
+      task_badline[trvs::currTask] = range_badline[irange] + 1;
+      break;
+    }
+  }
+  trvs::allreduce_sum(task_badline.data(), trvs::numTasks);
+
+  for (int itask = 0; itask < trvs::numTasks; itask++) {
+    if (task_badline[itask] != 0) {
+      long long badline = task_badline[itask] - 1;
+      this->finalise_particles();
+      if (trvs::currTask == 0) {
+        trvs::logger.error(
+          "Malformed catalogue row at byte offset %lld (source=%s).",
+          badline, this->source.c_str()
+        );
+      }
+      throw trvs::InvalidDataError(
+        "Malformed catalogue row at byte offset %lld (source=%s).\n",
+        badline, this->source.c_str()
+      );
+    }
+  }
+
+  double time_elapsed = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - time_start
+  ).count();
+
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "Read %d catalogue rows in %.3f seconds (%.3e rows/s, source=%s).",
+      this->ntotal_global, time_elapsed,
+      (time_elapsed > 0.) ? this->ntotal_global / time_elapsed : 0.,
+      this->source.c_str()
     );
-    while (ss >> entry) {row.push_back(entry);}
+  }
 
-    // Add the current line as a particle.
-    this->pdata[idx_line].pos[0] = row[name_indices[0]];  // x
-    this->pdata[idx_line].pos[1] = row[name_indices[1]];  // y
-    this->pdata[idx_line].pos[2] = row[name_indices[2]];  // z
+  // ---------------------------------------------------------------------
+  // Catalogue properties
+  // ---------------------------------------------------------------------
 
-    if (name_indices[3] != -1) {
-      nz = row[name_indices[3]];
-    } else {
-      nz = nz_box_default;  // default value
+  // Calculate total weights.
+  this->calc_total_weights();
+
+  // Calculate particle extents.
+  this->calc_pos_extents();
+
+  return 0;
+}
+
+int ParticleCatalogue::load_catalogue_binary_file(
+  const std::string& catalogue_filepath, double volume
+) {
+  // ---------------------------------------------------------------------
+  // File mapping
+  // ---------------------------------------------------------------------
+
+  int fd = open(catalogue_filepath.c_str(), O_RDONLY);
+  struct stat fstatus;
+  if (fd < 0 || fstat(fd, &fstatus) != 0) {
+    if (fd >= 0) {close(fd);}
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Failed to open file: %s", this->source.c_str());
     }
+    throw trvs::IOError("Failed to open file: %s\n", this->source.c_str());
+  }
 
-    if (name_indices[4] != -1) {
-      ws = row[name_indices[4]];
-    } else {
-      ws = 1.;  // default value
+  std::size_t filesize = static_cast<std::size_t>(fstatus.st_size);
+
+  void* addr = MAP_FAILED;
+  if (filesize >= sizeof(BinaryCatalogueHeader)) {
+    addr = mmap(nullptr, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+
+  if (addr == MAP_FAILED) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Failed to map file: %s", this->source.c_str());
+    }
+    throw trvs::IOError("Failed to map file: %s\n", this->source.c_str());
+  }
+  madvise(addr, filesize, MADV_SEQUENTIAL);
+
+  const char* filedata = static_cast<const char*>(addr);
+
+  // ---------------------------------------------------------------------
+  // Header & columns
+  // ---------------------------------------------------------------------
+
+  BinaryCatalogueHeader header;
+  std::memcpy(&header, filedata, sizeof(BinaryCatalogueHeader));
+
+  std::size_t size_header = sizeof(BinaryCatalogueHeader)
+    + header.ncols * sizeof(BinaryCatalogueColumn);
+
+  bool valid_header =
+    std::memcmp(header.magic, BINARY_CATALOGUE_MAGIC, 8) == 0
+    && header.version == BINARY_CATALOGUE_VERSION
+    && size_header <= filesize
+    && 0 < header.nrows && header.nrows <= std::uint64_t(INT_MAX);
+
+  std::vector<BinaryCatalogueColumn> columns(valid_header ? header.ncols : 0);
+  for (std::uint32_t icol = 0; icol < columns.size(); icol++) {
+    std::memcpy(
+      &columns[icol],
+      filedata + sizeof(BinaryCatalogueHeader)
+        + icol * sizeof(BinaryCatalogueColumn),
+      sizeof(BinaryCatalogueColumn)
+    );
+    columns[icol].name[15] = '\0';
+
+    valid_header = valid_header
+      && (columns[icol].dtype == 4 || columns[icol].dtype == 8)
+      && columns[icol].offset >= size_header
+      && columns[icol].offset % columns[icol].dtype == 0
+      && columns[icol].offset <= filesize
+      && header.nrows * columns[icol].dtype
+        <= filesize - columns[icol].offset;  // avoid overflow
+  }
+
+  if (!valid_header) {
+    munmap(addr, filesize);
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Invalid binary catalogue file: %s", this->source.c_str()
+      );
     }
+    throw trvs::InvalidDataError(
+      "Invalid binary catalogue file: %s\n", this->source.c_str()
+    );
+  }
 
-    if (name_indices[5] != -1) {
-      wc = row[name_indices[5]];
+  // CAVEAT: Hard-coded ordered column names.
+  const std::vector<std::string> names_ordered = {
+    "x", "y", "z", "nz", "ws", "wc"
+  };
+
+  // CAVEAT: Default -1 index as a flag for unfound column names.
+  std::vector<int> name_indices(names_ordered.size(), -1);
+  for (int iname = 0; iname < int(names_ordered.size()); iname++) {
+    for (int icol = 0; icol < int(columns.size()); icol++) {
+      if (names_ordered[iname] == columns[icol].name) {
+        name_indices[iname] = icol;
+        break;
+      }
+    }
+  }
+
+  // Check for the coordinate columns.
+  if (name_indices[0] == -1 || name_indices[1] == -1 || name_indices[2] == -1) {
+    munmap(addr, filesize);
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Catalogue coordinate fields are unavailable (source=%s).",
+        this->source.c_str()
+      );
+    }
+    throw trvs::InvalidDataError(
+      "Catalogue coordinate fields are unavailable (source=%s).\n",
+      this->source.c_str()
+    );
+  }
+
+  // Check for the 'nz' column.
+  if (name_indices[3] == -1) {
+    if (trvs::currTask == 0) {
+      trvs::logger.warn(
+        "Catalogue 'nz' field is unavailable and "
+        "will be set to the mean density in the bounding box (source=%s).",
+        this->source.c_str()
+      );
+    }
+  }
+
+  // ---------------------------------------------------------------------
+  // Data conversion
+  // ---------------------------------------------------------------------
+
+  // Each task converts its own share of the rows.
+  long long nrows_local = 0, irow_start = 0;
+  trvs::allocate_share(
+    static_cast<long long>(header.nrows), nrows_local, irow_start
+  );
+
+  this->initialise_particles(int(nrows_local), int(header.nrows));
+
+  double nz_box_default = 0.;
+  if (volume > 0.) {
+    nz_box_default = this->ntotal_global / volume;
+  }
+
+  // Set up column data arrays by field, where missing fields take
+  // default values.
+  const double defaults[6] = {0., 0., 0., nz_box_default, 1., 1.};
+  const double* fields_f64[6] = {nullptr};
+  const float* fields_f32[6] = {nullptr};
+  for (int iname = 0; iname < int(names_ordered.size()); iname++) {
+    int icol = name_indices[iname];
+    if (icol == -1) {continue;}
+    const char* coldata = filedata + columns[icol].offset;
+    if (columns[icol].dtype == 8) {
+      fields_f64[iname] = reinterpret_cast<const double*>(coldata);
     } else {
-      wc = 1.;  // default value
+      fields_f32[iname] = reinterpret_cast<const float*>(coldata);
     }
+  }
 
-    this->pdata[idx_line].nz = nz;
-    this->pdata[idx_line].ws = ws;
-    this->pdata[idx_line].wc = wc;
-    this->pdata[idx_line].w = ws * wc;
+  auto get_field_value = [&](int iname, int pid) {
+    long long irow = irow_start + pid;
+    if (fields_f64[iname] != nullptr) {return fields_f64[iname][irow];}
+    if (fields_f32[iname] != nullptr) {
+      return double(fields_f32[iname][irow]);
+    }
+    return defaults[iname];
+  };
 
-    idx_line++;
+  // Convert column data arrays to particle data in bulk.
+#ifdef TRV_USE_OMP
+#pragma omp parallel for
+#endif  // TRV_USE_OMP
+  for (int pid = 0; pid < this->ntotal; pid++) {
+    this->pdata[pid].pos[0] = get_field_value(0, pid);
+    this->pdata[pid].pos[1] = get_field_value(1, pid);
+    this->pdata[pid].pos[2] = get_field_value(2, pid);
+    this->pdata[pid].nz = get_field_value(3, pid);
+    this->pdata[pid].ws = get_field_value(4, pid);
+    this->pdata[pid].wc = get_field_value(5, pid);
+    this->pdata[pid].w = this->pdata[pid].ws * this->pdata[pid].wc;
   }
 
-  fin.close();
+  munmap(addr, filesize);
 
   // ---------------------------------------------------------------------
   // Catalogue properties
@@ -263,6 +635,229 @@ int ParticleCatalogue::load_catalogue_file(
   return 0;
 }
 
+long long ParticleCatalogue::convert_catalogue_file(
+  const std::string& text_filepath,
+  const std::string& catalogue_columns,
+  const std::string& binary_filepath,
+  bool single_precision
+) {
+  // ---------------------------------------------------------------------
+  // Columns & fields
+  // ---------------------------------------------------------------------
+
+  // CAVEAT: Hard-coded ordered column names.
+  const std::vector<std::string> names_ordered = {
+    "x", "y", "z", "nz", "ws", "wc"
+  };
+
+  std::istringstream iss(catalogue_columns);
+  std::vector<std::string> colnames;
+  std::string name;
+  while (std::getline(iss, name, ',')) {
+    colnames.push_back(name);
+  }
+
+  // Only recognised fields are written, in the hard-coded order.
+  std::vector<std::string> names_written;
+  std::vector<int> col_indices;
+  for (const std::string& name_ordered : names_ordered) {
+    auto it = std::find(colnames.begin(), colnames.end(), name_ordered);
+    if (it != colnames.end()) {
+      names_written.push_back(name_ordered);
+      col_indices.push_back(int(std::distance(colnames.begin(), it)));
+    }
+  }
+  std::size_t ncols_parsed = 0;  // number of leading columns parsed
+  if (!col_indices.empty()) {
+    ncols_parsed = 1 + std::size_t(
+      *std::max_element(col_indices.begin(), col_indices.end())
+    );
+  }
+
+  // Skip empty lines or comment lines.
+  auto is_skipped = [](const std::string& line) {
+    return line.empty() || line[0] == '#' || line == "\r";
+  };
+
+  // ---------------------------------------------------------------------
+  // Row counting
+  // ---------------------------------------------------------------------
+
+  std::ifstream fin(text_filepath.c_str(), std::ios::in);
+  if (fin.fail()) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Failed to open file: %s", text_filepath.c_str());
+    }
+    throw trvs::IOError("Failed to open file: %s\n", text_filepath.c_str());
+  }
+
+  std::uint64_t nrows = 0;
+  std::string line_str;
+  while (std::getline(fin, line_str)) {
+    if (is_skipped(line_str)) {continue;}
+    nrows++;
+  }
+  fin.clear();
+  fin.seekg(0);
+
+  // Binary catalogue files with no rows are rejected by
+  // `ParticleCatalogue::load_catalogue_file`.
+  if (nrows == 0) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "No catalogue rows to convert (source=%s).", text_filepath.c_str()
+      );
+    }
+    throw trvs::IOError(
+      "No catalogue rows to convert (source=%s).\n", text_filepath.c_str()
+    );
+  }
+
+  // ---------------------------------------------------------------------
+  // Header & columns
+  // ---------------------------------------------------------------------
+
+  const std::uint32_t dtype = single_precision ? 4 : 8;
+  const std::uint64_t align = 64;
+
+  BinaryCatalogueHeader header;
+  std::memset(&header, 0, sizeof(BinaryCatalogueHeader));
+  std::memcpy(header.magic, BINARY_CATALOGUE_MAGIC, 8);
+  header.version = BINARY_CATALOGUE_VERSION;
+  header.ncols = std::uint32_t(names_written.size());
+  header.nrows = nrows;
+
+  std::vector<BinaryCatalogueColumn> columns(header.ncols);
+  std::uint64_t offset = sizeof(BinaryCatalogueHeader)
+    + header.ncols * sizeof(BinaryCatalogueColumn);
+  for (std::uint32_t icol = 0; icol < header.ncols; icol++) {
+    std::memset(&columns[icol], 0, sizeof(BinaryCatalogueColumn));
+    std::strncpy(
+      columns[icol].name, names_written[icol].c_str(),
+      sizeof(columns[icol].name) - 1
+    );
+    columns[icol].dtype = dtype;
+
+    offset = (offset + align - 1) / align * align;
+    columns[icol].offset = offset;
+    offset += nrows * dtype;
+  }
+
+  std::FILE* fout = std::fopen(binary_filepath.c_str(), "wb");
+  if (fout == nullptr) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Failed to create file: %s", binary_filepath.c_str()
+      );
+    }
+    throw trvs::IOError(
+      "Failed to create file: %s\n", binary_filepath.c_str()
+    );
+  }
+
+  bool success =
+    std::fwrite(&header, sizeof(BinaryCatalogueHeader), 1, fout) == 1
+    && (
+      header.ncols == 0
+      || std::fwrite(
+        columns.data(), sizeof(BinaryCatalogueColumn), header.ncols, fout
+      ) == header.ncols
+    );
+
+  // ---------------------------------------------------------------------
+  // Data conversion
+  // ---------------------------------------------------------------------
+
+  // Convert rows in chunks and write each column chunk at its offset.
+  const std::uint64_t nrows_chunk = 1 << 20;
+  std::vector< std::vector<double> > chunk(header.ncols);
+  std::vector<char> buffer;
+
+  auto flush_chunk = [&](std::uint64_t row_start) {
+    for (std::uint32_t icol = 0; icol < header.ncols && success; icol++) {
+      std::size_t nvals = chunk[icol].size();
+      buffer.resize(nvals * dtype);
+      if (single_precision) {
+        float* vals = reinterpret_cast<float*>(buffer.data());
+        for (std::size_t ival = 0; ival < nvals; ival++) {
+          vals[ival] = float(chunk[icol][ival]);
+        }
+      } else {
+        std::memcpy(buffer.data(), chunk[icol].data(), nvals * dtype);
+      }
+      success = std::fseek(
+        fout, long(columns[icol].offset + row_start * dtype), SEEK_SET
+      ) == 0
+        && std::fwrite(buffer.data(), dtype, nvals, fout) == nvals;
+      chunk[icol].clear();
+    }
+  };
+
+  std::uint64_t idx_row = 0, row_start = 0;
+  std::uint64_t idx_line = 0;
+  std::vector<double> row;
+  double entry;
+  while (success && std::getline(fin, line_str)) {
+    idx_line++;
+    if (is_skipped(line_str)) {continue;}
+
+    // Extract row entries up to the last column needed.
+    row.clear();
+    std::stringstream ss(
+      line_str, std::ios_base::out | std::ios_base::in | std::ios_base::binary
+    );
+    while (row.size() < ncols_parsed && ss >> entry) {row.push_back(entry);}
+
+    if (row.size() < ncols_parsed) {
+      std::fclose(fout);
+      std::remove(binary_filepath.c_str());
+      if (trvs::currTask == 0) {
+        trvs::logger.error(
+          "Malformed catalogue row at line %llu (source=%s): "
+          "%zu of %zu column entries parsed.",
+          static_cast<unsigned long long>(idx_line), text_filepath.c_str(),
+          row.size(), ncols_parsed
+        );
+      }
+      throw trvs::IOError(
+        "Malformed catalogue row at line %llu (source=%s): "
+        "%zu of %zu column entries parsed.\n",
+        static_cast<unsigned long long>(idx_line), text_filepath.c_str(),
+        row.size(), ncols_parsed
+      );
+    }
+
+    for (std::uint32_t icol = 0; icol < header.ncols; icol++) {
+      chunk[icol].push_back(row[col_indices[icol]]);
+    }
+
+    idx_row++;
+    if (idx_row - row_start == nrows_chunk) {
+      flush_chunk(row_start);
+      row_start = idx_row;
+    }
+  }
+  if (success && idx_row > row_start) {
+    flush_chunk(row_start);
+  }
+
+  fin.close();
+  success = (std::fclose(fout) == 0) && success;
+
+  if (!success) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Failed to write file: %s", binary_filepath.c_str()
+      );
+    }
+    throw trvs::IOError(
+      "Failed to write file: %s\n", binary_filepath.c_str()
+    );
+  }
+
+  return static_cast<long long>(nrows);
+}
+
 int ParticleCatalogue::load_particle_data(
   std::vector<double> x, std::vector<double> y, std::vector<double> z,
   std::vector<double> nz, std::vector<double> ws, std::vector<double> wc
@@ -333,19 +928,22 @@ void ParticleCatalogue::calc_total_weights() {
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd reduction(+:wtotal, wstotal)
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < this->ntotal; pid++) {
+  for (int pid = 0; pid < this->ntotal_owned; pid++) {
     wtotal += this->pdata[pid].w;
     wstotal += this->pdata[pid].ws;
   }
 
-  this->wtotal = wtotal;
-  this->wstotal = wstotal;
+  double wtotals[2] = {wtotal, wstotal};
+  trvs::allreduce_sum(wtotals, 2);
+
+  this->wtotal = wtotals[0];
+  this->wstotal = wtotals[1];
 
   if (trvs::currTask == 0) {
     trvs::logger.info(
       "Catalogue loaded: "
       "ntotal = %d, wtotal = %.3f, wstotal = %.3f (source=%s).",
-      this->ntotal, this->wtotal, this->wstotal, this->source.c_str()
+      this->ntotal_global, this->wtotal, this->wstotal, this->source.c_str()
     );
   }
 }
@@ -358,18 +956,19 @@ void ParticleCatalogue::calc_pos_extents(bool init) {
     throw trvs::InvalidDataError("Particle data are uninitialised.\n");
   }
 
-  // Initialise minimum and maximum values with the 0th particle's.
+  // Initialise minimum and maximum values with the extreme values,
+  // since a task may hold no particles.
   double pos_min[3], pos_max[3];
   for (int iaxis = 0; iaxis < 3; iaxis++) {
-    pos_min[iaxis] = this->pdata[0].pos[iaxis];
-    pos_max[iaxis] = this->pdata[0].pos[iaxis];
+    pos_min[iaxis] = std::numeric_limits<double>::max();
+    pos_max[iaxis] = std::numeric_limits<double>::lowest();
   }
 
   // Update minimum and maximum values partice by particle.
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(min:pos_min) reduction(max:pos_max)
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < this->ntotal; pid++) {
+  for (int pid = 0; pid < this->ntotal_owned; pid++) {
     for (int iaxis = 0; iaxis < 3; iaxis++) {
       pos_min[iaxis] = (pos_min[iaxis] < this->pdata[pid].pos[iaxis]) ?
         pos_min[iaxis] : this->pdata[pid].pos[iaxis];
@@ -378,6 +977,9 @@ void ParticleCatalogue::calc_pos_extents(bool init) {
     }
   }
 
+  trvs::allreduce_min(pos_min, 3);
+  trvs::allreduce_max(pos_max, 3);
+
   for (int iaxis = 0; iaxis < 3; iaxis++) {
     this->pos_min[iaxis] = pos_min[iaxis];
     this->pos_max[iaxis] = pos_max[iaxis];
@@ -420,6 +1022,9 @@ void ParticleCatalogue::offset_coords(const double dpos[3]) {
       this->pdata[pid].pos[iaxis] -= dpos[iaxis];
     }
   }
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->pos_offset[iaxis] += dpos[iaxis];
+  }
 
   this->calc_pos_extents();
 }
@@ -634,4 +1239,187 @@ void ParticleCatalogue::pad_grids(
   catalogue.offset_coords(dvec);
 }
 
+
+// ***********************************************************************
+// Distribution
+// ***********************************************************************
+
+void ParticleCatalogue::distribute_to_slabs(
+  const double boxsize[3], const int ngrid[3], int halo, LineOfSight*& los
+) {
+  if (trvs::numTasks == 1) {return;}
+
+  if (this->pdata == nullptr) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Particle data are uninitialised.");
+    }
+    throw trvs::InvalidDataError("Particle data are uninitialised.\n");
+  }
+
+  // Find the task owning each slab grid index in the first dimension.
+  std::vector<int> slab_tasks(ngrid[0]);
+  for (int itask = 0; itask < trvs::numTasks; itask++) {
+    int n0_local = 0, i0_start = 0;
+    trvs::allocate_slab(ngrid[0], n0_local, i0_start, itask);
+    for (int i = i0_start; i < i0_start + n0_local; i++) {
+      slab_tasks[i] = itask;
+    }
+  }
+
+  // Find the destination tasks of an owned particle, which are either
+  // its owner task or any other halo tasks.
+  auto get_dest_tasks = [&](int pid, bool owned, std::vector<int>& tasks) {
+    tasks.clear();
+
+    int i = int(std::floor(
+      ngrid[0] * this->pdata[pid].pos[0] / boxsize[0]
+    ));
+    i = ((i % ngrid[0]) + ngrid[0]) % ngrid[0];
+
+    int task_owner = slab_tasks[i];
+    if (owned) {
+      tasks.push_back(task_owner);
+      return;
+    }
+    for (int di = -halo; di <= halo; di++) {
+      int task = slab_tasks[((i + di) % ngrid[0] + ngrid[0]) % ngrid[0]];
+      if (task != task_owner
+          && std::find(tasks.begin(), tasks.end(), task) == tasks.end()) {
+        tasks.push_back(task);
+      }
+    }
+  };
+
+  // Particle records hold the particle data followed by any line of
+  // sight.
+  const int nfields = (los != nullptr) ? 10 : 7;
+
+  std::vector<double> recvbufs[2];  // owned and halo particles
+  std::vector<int> tasks;
+  for (int ipass = 0; ipass < 2; ipass++) {
+    bool owned = (ipass == 0);
+
+    std::vector<long long> sendcounts(trvs::numTasks, 0);
+    for (int pid = 0; pid < this->ntotal_owned; pid++) {
+      get_dest_tasks(pid, owned, tasks);
+      for (int task : tasks) {sendcounts[task] += nfields;}
+    }
+
+    std::vector<long long> sendoffsets(trvs::numTasks, 0);
+    for (int itask = 1; itask < trvs::numTasks; itask++) {
+      sendoffsets[itask] = sendoffsets[itask - 1] + sendcounts[itask - 1];
+    }
+
+    std::vector<double> sendbuf(
+      sendoffsets[trvs::numTasks - 1] + sendcounts[trvs::numTasks - 1]
+    );
+    for (int pid = 0; pid < this->ntotal_owned; pid++) {
+      get_dest_tasks(pid, owned, tasks);
+      for (int task : tasks) {
+        double* record = sendbuf.data() + sendoffsets[task];
+        record[0] = this->pdata[pid].pos[0];
+        record[1] = this->pdata[pid].pos[1];
+        record[2] = this->pdata[pid].pos[2];
+        record[3] = this->pdata[pid].nz;
+        record[4] = this->pdata[pid].ws;
+        record[5] = this->pdata[pid].wc;
+        record[6] = this->pdata[pid].w;
+        if (los != nullptr) {
+          record[7] = los[pid].pos[0];
+          record[8] = los[pid].pos[1];
+          record[9] = los[pid].pos[2];
+        }
+        sendoffsets[task] += nfields;
+      }
+    }
+
+    trvs::gbytesMem += trvs::size_in_gb<double>(
+      static_cast<long long>(sendbuf.size())
+    );
+    trvs::update_maxmem();
+
+    trvs::exchange_values(sendbuf, sendcounts, recvbufs[ipass]);
+
+    trvs::gbytesMem -= trvs::size_in_gb<double>(
+      static_cast<long long>(sendbuf.size())
+    );
+  }
+
+  // Renew particle data (and lines of sight) with the owned particles
+  // followed by the halo particles.
+  int ntotal_owned = int(recvbufs[0].size() / nfields);
+  int ntotal = ntotal_owned + int(recvbufs[1].size() / nfields);
+  int ntotal_old = this->ntotal;
+
+  this->reset_particles();
+
+  this->ntotal = ntotal;
+  this->ntotal_owned = ntotal_owned;
+
+  this->pdata = new ParticleData[this->ntotal];
+  trvs::gbytesMem += trvs::size_in_gb<struct ParticleData>(this->ntotal);
+  trvs::update_maxmem();
+
+  if (los != nullptr) {
+    delete[] los;
+    trvs::gbytesMem -= trvs::size_in_gb<struct LineOfSight>(ntotal_old);
+    los = new LineOfSight[this->ntotal];
+    trvs::gbytesMem += trvs::size_in_gb<struct LineOfSight>(this->ntotal);
+    trvs::update_maxmem();
+  }
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for
+#endif  // TRV_USE_OMP
+  for (int pid = 0; pid < this->ntotal; pid++) {
+    const double* record = (pid < ntotal_owned)
+      ? recvbufs[0].data() + static_cast<long long>(pid) * nfields
+      : recvbufs[1].data()
+        + static_cast<long long>(pid - ntotal_owned) * nfields;
+    this->pdata[pid].pos[0] = record[0];
+    this->pdata[pid].pos[1] = record[1];
+    this->pdata[pid].pos[2] = record[2];
+    this->pdata[pid].nz = record[3];
+    this->pdata[pid].ws = record[4];
+    this->pdata[pid].wc = record[5];
+    this->pdata[pid].w = record[6];
+    if (los != nullptr) {
+      los[pid].pos[0] = record[7];
+      los[pid].pos[1] = record[8];
+      los[pid].pos[2] = record[9];
+    }
+  }
+}
+
+void ParticleCatalogue::distribute_to_slabs(
+  const double boxsize[3], const int ngrid[3], int halo
+) {
+  LineOfSight* los = nullptr;
+  this->distribute_to_slabs(boxsize, ngrid, halo, los);
+}
+
+void ParticleCatalogue::copy_owned_particles(ParticleCatalogue& catalogue) {
+  this->source = catalogue.source;
+
+  this->initialise_particles(
+    catalogue.ntotal_owned, catalogue.ntotal_global
+  );
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel for
+#endif  // TRV_USE_OMP
+  for (int pid = 0; pid < this->ntotal; pid++) {
+    this->pdata[pid] = catalogue.pdata[pid];
+  }
+
+  this->wtotal = catalogue.wtotal;
+  this->wstotal = catalogue.wstotal;
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    this->pos_min[iaxis] = catalogue.pos_min[iaxis];
+    this->pos_max[iaxis] = catalogue.pos_max[iaxis];
+    this->pos_span[iaxis] = catalogue.pos_span[iaxis];
+    this->pos_offset[iaxis] = catalogue.pos_offset[iaxis];
+  }
+}
+
 }  // namespace trv
@@ -0,0 +1,333 @@
+// Copyright (C) [GPLv3 Licence]
+//
+// This file is part of the Triumvirate program. See the COPYRIGHT
+// and LICENCE files at the top-level directory of this distribution
+// for details of copyright and licensing.
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file planner.cpp
+ * @authors Mike S Wang (https://github.com/MikeSWang)
+ *
+ */
+
+#include "planner.hpp"
+
+namespace trvs = trv::sys;
+namespace trvm = trv::maths;
+
+namespace trv {
+
+trv::MemoryPlan estimate_memory_usage(
+  trv::ParameterSet& params, long long ntotal_data, long long ntotal_rand
+) {
+  trv::MemoryPlan plan;
+  plan.statistic_type = params.statistic_type;
+  plan.catalogue_type = params.catalogue_type;
+  plan.shell_cache = params.shell_cache;
+  plan.ylm_tables = params.ylm_tables;
+  plan.memory_limit = params.memory_limit;
+
+  // Catalogues are held throughout together with their lines of sight.
+  plan.gbytes_catalogues =
+    trvs::size_in_gb<struct trv::ParticleData>(ntotal_data + ntotal_rand)
+    + trvs::size_in_gb<struct trv::LineOfSight>(ntotal_data + ntotal_rand);
+
+  // A mesh field holds its shadow field if interlacing is used,
+  // and a real-to-complex mesh field only holds the half-complex mesh.
+  // A single-precision mesh field counts as half a mesh grid.
+  const int nfield = (params.interlace == "true") ? 2 : 1;
+  const double nfield_r2c = nfield
+    * double(params.ngrid[2]/2 + 1) / double(params.ngrid[2]);
+  const double precision_factor = (params.precision == "single") ? .5 : 1.;
+
+  const std::string& stat = params.statistic_type;
+  const bool sim = (params.catalogue_type == "sim");
+  const int nbins = params.num_bins;
+
+  // Fourier-space terms at negated orders are mirrored only if
+  // the wavenumber bins lie below the Nyquist wavenumber, and
+  // configuration-space terms only if the fields are Hermitian at all
+  // wavevector modes.
+  const bool mirrored = (stat == "powspec" || stat == "bispec")
+    ? trv::if_mirrored_in_fourier(params, params.bin_max)
+    : trv::if_mirrored_in_config(params);
+
+  double count_grid = 0.;
+  double count_grid_shells = 0.;
+  long long count_fft = 0, count_ifft = 0;
+
+  if (stat == "powspec" || stat == "2pcf" || stat == "2pcf-win") {
+    // δn_00(k) (real-to-complex).
+    count_grid = precision_factor * nfield_r2c;
+    count_fft = nfield;
+
+    if (stat != "powspec") {
+      count_grid += 1.;  // two-point statistics in configuration space
+    }
+
+    if (sim) {
+      count_ifft = (stat == "powspec") ? 0 : 1;
+    } else {
+      // Batches of δn_LM(k) over (non-negative) orders M.
+      int norders = mirrored ? params.ELL + 1 : 2*params.ELL + 1;
+      int nbatch = std::min(params.fft_batch, norders);
+      count_grid += precision_factor * nbatch
+        * ((params.ELL == 0) ? nfield_r2c : nfield);
+      count_fft += norders * nfield;
+
+      if (stat != "powspec") {
+        for (int M_ = mirrored ? 0 : - params.ELL; M_ <= params.ELL; M_++) {
+          for (int m1 = - params.ELL; m1 <= params.ELL; m1++) {
+            double coupling = trv::calc_coupling_coeff_2pt(
+              params.ELL, params.ELL, m1, M_
+            );
+            if (std::fabs(coupling) > trvm::eps_coupling) {count_ifft++;}
+          }
+        }
+      }
+    }
+  } else
+  if (
+    stat == "bispec" || stat == "3pcf"
+    || stat == "3pcf-win" || stat == "3pcf-win-wa"
+  ) {
+    const bool fourier = (stat == "bispec");
+
+    int dv_dim = 0;  // data vector dimension
+    if (params.shape == "diag" || params.shape == "row") {
+      dv_dim = nbins;
+    } else
+    if (params.shape == "off-diag") {
+      dv_dim = nbins - std::abs(params.idx_bin);
+    } else
+    if (params.shape == "full") {
+      dv_dim = nbins * nbins;
+    } else
+    if (params.shape == "triu") {
+      dv_dim = nbins * (nbins + 1) / 2;
+    }
+
+    // Count the non-vanishing pairs of orders (m₁, m₂), with orders M
+    // summed over for survey-type catalogues, and the non-vanishing
+    // terms (m₁, m₂, M).  For simulation-type catalogues, M = 0.
+    // As for the coupling coefficients, only the Wigner 3-j symbol with
+    // orders may vanish once the multipole coupling is valid.  Terms at
+    // orders with M < 0, or M = 0 and m₁ < 0, are added as the mirrored
+    // components of terms at the negated orders (if mirrored) and are
+    // counted separately.
+    int npairs = 0, npairs_shared = 0, nterms = 0;
+    int npairs_nonneg = 0, npairs_shared_nonneg = 0, nterms_nonneg = 0;
+    for (int m1_ = - params.ell1; m1_ <= params.ell1; m1_++) {
+      for (int m2_ = - params.ell2; m2_ <= params.ell2; m2_++) {
+        int nterms_pair = 0;
+        for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
+          if (sim && M_ != 0) {continue;}
+          double coupling = trvm::wigner_3j(
+            params.ell1, params.ell2, params.ELL, m1_, m2_, M_
+          );
+          if (std::fabs(coupling) > trvm::eps_coupling) {nterms_pair++;}
+        }
+        if (nterms_pair == 0) {continue;}
+
+        bool shared = (params.ell1 == params.ell2 && m1_ == m2_);
+
+        npairs++;
+        nterms += nterms_pair;
+        if (shared) {npairs_shared++;}
+
+        if (
+          mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+        ) {continue;}
+
+        npairs_nonneg++;
+        nterms_nonneg += nterms_pair;
+        if (shared) {npairs_shared_nonneg++;}
+      }
+    }
+
+    // δn_00(k) and N_00(k) (real-to-complex) and the shot-noise
+    // two-point statistic.
+    count_grid = 2*nfield_r2c + 1.;
+    count_fft = 2 * nfield;
+
+    if (fourier) {
+      // Pooled G_LM, F_lm_a, F_lm_b (and the batch of G_LM, δn_LM(k) and
+      // N_LM(k) for survey-type catalogues, where F_lm_a and F_lm_b are
+      // replaced by a single workspace field for shell field caches).
+      if (sim) {
+        count_grid += 3 * nfield;
+      } else
+      if (params.shape == "full" || params.shape == "triu") {
+        count_grid += 4 * nfield;
+      } else {
+        count_grid += 5 * nfield;
+      }
+
+      // Band-limited fields and uncoupled shot noise per bin.
+      int nifft_term = 0;
+      if (params.shape == "diag" || params.shape == "off-diag") {
+        nifft_term = 2 * dv_dim;
+      } else
+      if (params.shape == "row") {
+        nifft_term = 1 + dv_dim;
+      }
+      count_fft += nterms_nonneg * (sim ? 1 : 3) * nfield;
+      count_ifft += nterms_nonneg * (1 + nifft_term + dv_dim);
+
+      // Shell field caches for pairs of shells.
+      if (params.shape == "full" || params.shape == "triu") {
+        count_grid_shells = (
+          (params.ell1 == 0 && params.ell2 == 0) ? 1 : 2
+        ) * nbins;
+        count_ifft += (2*npairs_nonneg - npairs_shared_nonneg) * nbins;
+      }
+    } else {
+      // Pooled G_LM, F_lm_a and F_lm_b.
+      count_grid += 3 * nfield;
+
+      // Spherical-Bessel-weighted fields per bin (at both mirrored
+      // orders) and uncoupled shot noise.
+      int nifft_term = 0;
+      if (params.shape != "full" && params.shape != "triu") {
+        nifft_term = 2 * dv_dim;
+      }
+      if (sim) {
+        count_fft += npairs_nonneg * nfield;
+        count_ifft += npairs_nonneg * 2 + npairs * nifft_term;
+      } else {
+        count_fft += nterms_nonneg * 2 * nfield;
+        count_ifft += nterms_nonneg * 2 + nterms * nifft_term;
+      }
+
+      // Shell field caches for pairs of separation shells.
+      if (params.shape == "full" || params.shape == "triu") {
+        count_grid_shells = (
+          (params.ell1 == 0 && params.ell2 == 0) ? 1 : 2
+        ) * nbins;
+        count_ifft += (2*npairs - npairs_shared) * nbins;
+      }
+    }
+
+    // Reduced spherical harmonics of both degrees in Fourier and
+    // configuration space.
+    if (params.ylm_tables != "none") {
+      bool single = (params.ylm_tables == "single");
+      plan.gbytes_tables = 2 * trvm::SphericalHarmonicTable::calc_size_in_gb(
+        params.ell1, params.ngrid, single
+      );
+      if (params.ell2 != params.ell1) {
+        plan.gbytes_tables +=
+          2 * trvm::SphericalHarmonicTable::calc_size_in_gb(
+            params.ell2, params.ngrid, single
+          );
+      }
+    }
+  }
+
+  // Mesh grids are held in slabs by each task.
+  int n0_local = 0, i0_start = 0;
+  trvs::allocate_slab(params.ngrid[0], n0_local, i0_start);
+
+  const double gbytes_grid = trvs::size_in_gb<fftw_complex>(
+    static_cast<long long>(n0_local) * params.ngrid[1] * params.ngrid[2]
+  );
+
+  plan.count_grid = count_grid;
+  plan.count_grid_shells = count_grid_shells;
+  plan.gbytes_meshes = count_grid * gbytes_grid;
+  if (params.shell_cache == "disk") {
+    plan.gbytes_disk = count_grid_shells * gbytes_grid;
+  } else {
+    plan.gbytes_shells = count_grid_shells * gbytes_grid;
+  }
+  plan.gbytes_peak = plan.gbytes_catalogues + plan.gbytes_meshes
+    + plan.gbytes_shells + plan.gbytes_tables;
+  plan.count_fft = count_fft;
+  plan.count_ifft = count_ifft;
+
+  plan.within_limit =
+    params.memory_limit <= 0. || plan.gbytes_peak <= params.memory_limit;
+
+  return plan;
+}
+
+trv::MemoryPlan plan_memory_usage(
+  trv::ParameterSet& params, long long ntotal_data, long long ntotal_rand
+) {
+  params.shell_cache = "memory";
+  params.ylm_tables = "double";
+
+  trv::MemoryPlan plan = estimate_memory_usage(
+    params, ntotal_data, ntotal_rand
+  );
+
+  if (!plan.within_limit && plan.gbytes_shells > 0.) {
+    params.shell_cache = "disk";
+    plan = estimate_memory_usage(params, ntotal_data, ntotal_rand);
+  }
+  if (!plan.within_limit && plan.gbytes_tables > 0.) {
+    params.ylm_tables = "single";
+    plan = estimate_memory_usage(params, ntotal_data, ntotal_rand);
+  }
+  if (!plan.within_limit && plan.gbytes_tables > 0.) {
+    params.ylm_tables = "none";
+    plan = estimate_memory_usage(params, ntotal_data, ntotal_rand);
+  }
+
+  return plan;
+}
+
+void print_memory_plan(const trv::MemoryPlan& plan, std::FILE* fileptr) {
+  std::fprintf(
+    fileptr, "Memory plan for '%s' measurement from '%s' catalogues:\n",
+    plan.statistic_type.c_str(), plan.catalogue_type.c_str()
+  );
+  std::fprintf(
+    fileptr, "  catalogues and lines of sight:  %12.6f GiB\n",
+    plan.gbytes_catalogues
+  );
+  std::fprintf(
+    fileptr, "  mesh grids (%6.1f):            %12.6f GiB\n",
+    plan.count_grid, plan.gbytes_meshes
+  );
+  std::fprintf(
+    fileptr, "  shell field caches (%6.1f):    %12.6f GiB (%s)\n",
+    plan.count_grid_shells,
+    (plan.shell_cache == "disk") ? plan.gbytes_disk : plan.gbytes_shells,
+    plan.shell_cache.c_str()
+  );
+  std::fprintf(
+    fileptr, "  spherical harmonic tables:      %12.6f GiB (%s)\n",
+    plan.gbytes_tables, plan.ylm_tables.c_str()
+  );
+  std::fprintf(
+    fileptr, "  estimated peak memory usage:    %12.6f GiB\n",
+    plan.gbytes_peak
+  );
+  if (plan.memory_limit > 0.) {
+    std::fprintf(
+      fileptr, "  memory limit:                   %12.6f GiB (%s)\n",
+      plan.memory_limit, plan.within_limit ? "within" : "exceeded"
+    );
+  }
+  std::fprintf(
+    fileptr,
+    "  number of FFTs:                 %12lld forward, %lld backward\n",
+    plan.count_fft, plan.count_ifft
+  );
+}
+
+}  // namespace trv
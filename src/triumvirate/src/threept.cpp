@@ -81,11 +81,13 @@ double calc_bispec_normalisation_from_particles(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd reduction(+:norm)
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
+  for (int pid = 0; pid < particles.ntotal_owned; pid++) {
     norm += particles[pid].ws
       * std::pow(particles[pid].nz, 2) * std::pow(particles[pid].wc, 3);
   }
 
+  trvs::allreduce_sum(&norm, 1);
+
   if (norm == 0.) {
     if (trvs::currTask == 0) {
       trvs::logger.error(
@@ -132,7 +134,7 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:sn_data_real, sn_data_imag)
 #endif
-  for (int pid = 0; pid < particles_data.ntotal; pid++) {
+  for (int pid = 0; pid < particles_data.ntotal_owned; pid++) {
     double los_[3] = {
       los_data[pid].pos[0], los_data[pid].pos[1], los_data[pid].pos[2]
     };
@@ -148,14 +150,17 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
     sn_data_imag += sn_part_imag;
   }
 
-  std::complex<double> sn_data(sn_data_real, sn_data_imag);
+  double sn_data_parts[2] = {sn_data_real, sn_data_imag};
+  trvs::allreduce_sum(sn_data_parts, 2);
+
+  std::complex<double> sn_data(sn_data_parts[0], sn_data_parts[1]);
 
   double sn_rand_real = 0., sn_rand_imag = 0.;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:sn_rand_real, sn_rand_imag)
 #endif
-  for (int pid = 0; pid < particles_rand.ntotal; pid++) {
+  for (int pid = 0; pid < particles_rand.ntotal_owned; pid++) {
     double los_[3] = {
       los_rand[pid].pos[0], los_rand[pid].pos[1], los_rand[pid].pos[2]
     };
@@ -171,7 +176,10 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
     sn_rand_imag += sn_part_imag;
   }
 
-  std::complex<double> sn_rand(sn_rand_real, sn_rand_imag);
+  double sn_rand_parts[2] = {sn_rand_real, sn_rand_imag};
+  trvs::allreduce_sum(sn_rand_parts, 2);
+
+  std::complex<double> sn_rand(sn_rand_parts[0], sn_rand_parts[1]);
 
   return sn_data + std::pow(alpha, 3) * sn_rand;
 }
@@ -185,7 +193,7 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:sn_real, sn_imag)
 #endif
-  for (int pid = 0; pid < particles.ntotal; pid++) {
+  for (int pid = 0; pid < particles.ntotal_owned; pid++) {
     double los_[3] = {los[pid].pos[0], los[pid].pos[1], los[pid].pos[2]};
 
     std::complex<double> ylm = trvm::SphericalHarmonicCalculator::
@@ -199,12 +207,225 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_bispec(
     sn_imag += sn_part_imag;
   }
 
-  std::complex<double> sn(sn_real, sn_imag);
+  double sn_parts[2] = {sn_real, sn_imag};
+  trvs::allreduce_sum(sn_parts, 2);
+
+  std::complex<double> sn(sn_parts[0], sn_parts[1]);
 
   return std::pow(alpha, 3) * sn;
 }
 
 
+// ***********************************************************************
+// Shell field products
+// ***********************************************************************
+
+std::vector<std::complex<double>> calc_shell_field_products(
+  const ShellFieldCache& shells_a, const ShellFieldCache& shells_b,
+  MeshField& field, bool triu
+) {
+  const int nshells = shells_a.num_shells;
+  const long long nmesh = shells_a.nmesh;
+  const fftw_complex* field_ = &field[0];
+
+  // Tile mesh grid cells so that the tiles of all shell fields in
+  // both caches fit in the (per-core) cache.
+  const long long ncells_tile = 512;
+  const long long ntiles = (nmesh + ncells_tile - 1) / ncells_tile;
+
+  // Set up partial sums per thread, each padded to whole cache lines
+  // (of 64 bytes) to avoid false sharing between threads.
+#ifdef TRV_USE_OMP
+  const int npartials = omp_get_max_threads();
+#else   // !TRV_USE_OMP
+  const int npartials = 1;
+#endif  // TRV_USE_OMP
+  const long long stride = (2 * nshells * nshells + 7) / 8 * 8;
+  std::vector<double> partial_sums(npartials * stride, 0.);
+
+#ifdef TRV_USE_OMP
+#pragma omp parallel
+#endif  // TRV_USE_OMP
+  {
+#ifdef TRV_USE_OMP
+    double* sums_part = partial_sums.data() + omp_get_thread_num() * stride;
+#else   // !TRV_USE_OMP
+    double* sums_part = partial_sums.data();
+#endif  // TRV_USE_OMP
+
+    // Products of a shell field in the first cache with the third field
+    // over a tile, reused for all shells in the second cache.
+    std::vector<double> prod_real(ncells_tile), prod_imag(ncells_tile);
+
+#ifdef TRV_USE_OMP
+#pragma omp for schedule(static)
+#endif  // TRV_USE_OMP
+    for (long long itile = 0; itile < ntiles; itile++) {
+      const long long gid_start = itile * ncells_tile;
+      const long long ncells = std::min(ncells_tile, nmesh - gid_start);
+      const fftw_complex* field_tile = field_ + gid_start;
+
+      for (int ishell = 0; ishell < nshells; ishell++) {
+        const fftw_complex* shell_a_tile = shells_a[ishell] + gid_start;
+        for (long long icell = 0; icell < ncells; icell++) {
+          double a_re = shell_a_tile[icell][0];
+          double a_im = shell_a_tile[icell][1];
+          double c_re = field_tile[icell][0];
+          double c_im = field_tile[icell][1];
+          prod_real[icell] = a_re * c_re - a_im * c_im;
+          prod_imag[icell] = a_re * c_im + a_im * c_re;
+        }
+
+        int jshell_start = triu ? ishell : 0;
+        for (int jshell = jshell_start; jshell < nshells; jshell++) {
+          const fftw_complex* shell_b_tile = shells_b[jshell] + gid_start;
+
+          double sum_real = 0., sum_imag = 0.;
+          for (long long icell = 0; icell < ncells; icell++) {
+            double b_re = shell_b_tile[icell][0];
+            double b_im = shell_b_tile[icell][1];
+            sum_real += prod_real[icell] * b_re - prod_imag[icell] * b_im;
+            sum_imag += prod_real[icell] * b_im + prod_imag[icell] * b_re;
+          }
+
+          int ipair = ishell * nshells + jshell;
+          sums_part[2*ipair] += sum_real;
+          sums_part[2*ipair + 1] += sum_imag;
+        }
+      }
+    }
+  }
+
+  std::vector<std::complex<double>> products(nshells * nshells, 0.);
+  for (int ipart = 0; ipart < npartials; ipart++) {
+    const double* sums_part = partial_sums.data() + ipart * stride;
+    for (int ipair = 0; ipair < nshells * nshells; ipair++) {
+      products[ipair] += std::complex<double>(
+        sums_part[2*ipair], sums_part[2*ipair + 1]
+      );
+    }
+  }
+
+  // Sum products from all slabs.
+  trvs::allreduce_sum(
+    reinterpret_cast<double*>(products.data()), 2 * nshells * nshells
+  );
+
+  return products;
+}
+
+
+// ***********************************************************************
+// Checkpoints
+// ***********************************************************************
+
+void BispecCheckpoint::save(const std::string& filepath) const {
+  BispecCheckpointHeader header;
+  std::memset(&header, 0, sizeof(BispecCheckpointHeader));
+  std::memcpy(header.magic, BISPEC_CHECKPOINT_MAGIC, 8);
+  header.version = BISPEC_CHECKPOINT_VERSION;
+  header.dv_dim = this->dv_dim;
+  header.params_hash = this->params_hash;
+  header.idx_term = this->idx_term;
+  header.count_terms = this->count_terms;
+  header.norm_factor = this->norm_factor;
+
+  std::string filepath_tmp = filepath + ".tmp";
+
+  std::FILE* fout = std::fopen(filepath_tmp.c_str(), "wb");
+  if (fout == nullptr) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Failed to create file: %s", filepath_tmp.c_str());
+    }
+    throw trvs::IOError("Failed to create file: %s\n", filepath_tmp.c_str());
+  }
+
+  std::size_t ndv = this->dv_dim;
+  bool success =
+    std::fwrite(&header, sizeof(BispecCheckpointHeader), 1, fout) == 1
+    && std::fwrite(this->nmodes1_dv.data(), sizeof(int), ndv, fout) == ndv
+    && std::fwrite(this->nmodes2_dv.data(), sizeof(int), ndv, fout) == ndv
+    && std::fwrite(this->k1bin_dv.data(), sizeof(double), ndv, fout) == ndv
+    && std::fwrite(this->k2bin_dv.data(), sizeof(double), ndv, fout) == ndv
+    && std::fwrite(this->k1eff_dv.data(), sizeof(double), ndv, fout) == ndv
+    && std::fwrite(this->k2eff_dv.data(), sizeof(double), ndv, fout) == ndv
+    && std::fwrite(
+      this->bk_dv.data(), sizeof(std::complex<double>), ndv, fout
+    ) == ndv
+    && std::fwrite(
+      this->sn_dv.data(), sizeof(std::complex<double>), ndv, fout
+    ) == ndv;
+  success = (std::fclose(fout) == 0) && success;
+
+  // Replace any previous checkpoint file only when fully written.
+  if (!success || std::rename(filepath_tmp.c_str(), filepath.c_str()) != 0) {
+    std::remove(filepath_tmp.c_str());
+    if (trvs::currTask == 0) {
+      trvs::logger.error("Failed to write file: %s", filepath.c_str());
+    }
+    throw trvs::IOError("Failed to write file: %s\n", filepath.c_str());
+  }
+}
+
+bool BispecCheckpoint::load(const std::string& filepath) {
+  std::FILE* fin = std::fopen(filepath.c_str(), "rb");
+  if (fin == nullptr) {return false;}
+
+  BispecCheckpointHeader header;
+  bool success =
+    std::fread(&header, sizeof(BispecCheckpointHeader), 1, fin) == 1
+    && std::memcmp(header.magic, BISPEC_CHECKPOINT_MAGIC, 8) == 0
+    && header.version == BISPEC_CHECKPOINT_VERSION
+    && header.dv_dim >= 0;
+
+  if (success) {
+    this->dv_dim = header.dv_dim;
+    this->params_hash = header.params_hash;
+    this->idx_term = header.idx_term;
+    this->count_terms = header.count_terms;
+    this->norm_factor = header.norm_factor;
+
+    std::size_t ndv = this->dv_dim;
+    this->nmodes1_dv.resize(ndv);
+    this->nmodes2_dv.resize(ndv);
+    this->k1bin_dv.resize(ndv);
+    this->k2bin_dv.resize(ndv);
+    this->k1eff_dv.resize(ndv);
+    this->k2eff_dv.resize(ndv);
+    this->bk_dv.resize(ndv);
+    this->sn_dv.resize(ndv);
+
+    success =
+      std::fread(this->nmodes1_dv.data(), sizeof(int), ndv, fin) == ndv
+      && std::fread(this->nmodes2_dv.data(), sizeof(int), ndv, fin) == ndv
+      && std::fread(this->k1bin_dv.data(), sizeof(double), ndv, fin) == ndv
+      && std::fread(this->k2bin_dv.data(), sizeof(double), ndv, fin) == ndv
+      && std::fread(this->k1eff_dv.data(), sizeof(double), ndv, fin) == ndv
+      && std::fread(this->k2eff_dv.data(), sizeof(double), ndv, fin) == ndv
+      && std::fread(
+        this->bk_dv.data(), sizeof(std::complex<double>), ndv, fin
+      ) == ndv
+      && std::fread(
+        this->sn_dv.data(), sizeof(std::complex<double>), ndv, fin
+      ) == ndv;
+  }
+  std::fclose(fin);
+
+  if (!success) {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Invalid or truncated checkpoint file: %s", filepath.c_str()
+      );
+    }
+    throw trvs::IOError(
+      "Invalid or truncated checkpoint file: %s\n", filepath.c_str()
+    );
+  }
+
+  return true;
+}
+
+
 // ***********************************************************************
 // Full statistics
 // ***********************************************************************
@@ -218,7 +439,8 @@ trv::BispecMeasurements compute_bispec(
   ParticleCatalogue& catalogue_data, ParticleCatalogue& catalogue_rand,
   LineOfSight* los_data, LineOfSight* los_rand,
   trv::ParameterSet& params, trv::Binning& kbinning,
-  double norm_factor
+  double norm_factor,
+  const std::string& checkpoint_filepath, bool resume
 ) {
   trvs::logger.reset_level(params.verbose);
 
@@ -284,6 +506,76 @@ trv::BispecMeasurements compute_bispec(
     sn_dv[idx_dv] = 0.;
   }  // likely redundant but safe
 
+  // Set up checkpoints and restore the data vector components and the
+  // loop cursor when resuming.
+  bool checkpointing = !checkpoint_filepath.empty();
+
+  BispecCheckpoint checkpoint;
+  checkpoint.params_hash = params.ret_hash();
+  checkpoint.dv_dim = dv_dim;
+  checkpoint.norm_factor = norm_factor;
+
+  auto ret_idx_term = [&params](int m1, int m2, int M) {
+    return ((m1 + params.ell1) * (2*params.ell2 + 1) + (m2 + params.ell2))
+      * (2*params.ELL + 1) + (M + params.ELL);
+  };  // index of term at orders (m₁, m₂, M)
+
+  if (checkpointing && resume) {
+    BispecCheckpoint checkpoint_saved;
+    if (checkpoint_saved.load(checkpoint_filepath)) {
+      // The normalisation factor is checked as the parameter set hash
+      // does not cover changes to catalogue contents.
+      if (
+        checkpoint_saved.params_hash != checkpoint.params_hash
+        || checkpoint_saved.dv_dim != dv_dim
+        || std::fabs(checkpoint_saved.norm_factor - norm_factor)
+          > 1.e-8 * std::fabs(norm_factor)
+      ) {
+        if (trvs::currTask == 0) {
+          trvs::logger.error(
+            "Checkpoint does not match the bispectrum measurement "
+            "(parameters or catalogues have changed): %s",
+            checkpoint_filepath.c_str()
+          );
+        }
+        throw trvs::InvalidParameterError(
+          "Checkpoint does not match the bispectrum measurement "
+          "(parameters or catalogues have changed): %s\n",
+          checkpoint_filepath.c_str()
+        );
+      }
+
+      for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+        nmodes1_dv[idx_dv] = checkpoint_saved.nmodes1_dv[idx_dv];
+        nmodes2_dv[idx_dv] = checkpoint_saved.nmodes2_dv[idx_dv];
+        k1bin_dv[idx_dv] = checkpoint_saved.k1bin_dv[idx_dv];
+        k2bin_dv[idx_dv] = checkpoint_saved.k2bin_dv[idx_dv];
+        k1eff_dv[idx_dv] = checkpoint_saved.k1eff_dv[idx_dv];
+        k2eff_dv[idx_dv] = checkpoint_saved.k2eff_dv[idx_dv];
+        bk_dv[idx_dv] = checkpoint_saved.bk_dv[idx_dv];
+        sn_dv[idx_dv] = checkpoint_saved.sn_dv[idx_dv];
+      }
+      checkpoint.idx_term = checkpoint_saved.idx_term;
+      checkpoint.count_terms = checkpoint_saved.count_terms;
+
+      if (trvs::currTask == 0) {
+        trvs::logger.stat(
+          "Resuming bispectrum measurement from checkpoint "
+          "after %d computed terms: %s",
+          checkpoint.count_terms, checkpoint_filepath.c_str()
+        );
+      }
+    } else {
+      if (trvs::currTask == 0) {
+        trvs::logger.warn(
+          "No checkpoint to resume from; "
+          "bispectrum measurement starts from the first term: %s",
+          checkpoint_filepath.c_str()
+        );
+      }
+    }
+  }
+
   // ---------------------------------------------------------------------
   // Measurement
   // ---------------------------------------------------------------------
@@ -293,7 +585,7 @@ trv::BispecMeasurements compute_bispec(
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute common field quantities.
-  MeshField dn_00(params, true, "`dn_00`");  // δn_00(k)
+  MeshField dn_00(params, true, "`dn_00`", true);  // δn_00(k)
   dn_00.compute_ylm_wgtd_field(
     catalogue_data, catalogue_rand, los_data, los_rand, alpha, 0, 0
   );
@@ -303,7 +595,7 @@ trv::BispecMeasurements compute_bispec(
 
   double vol_cell = dn_00.vol_cell;
 
-  MeshField N_00(params, true, "`N_00`");  // N_00(k)
+  MeshField N_00(params, true, "`N_00`", true);  // N_00(k)
   N_00.compute_ylm_wgtd_quad_field(
     catalogue_data, catalogue_rand, los_data, los_rand, alpha, 0, 0
   );
@@ -313,21 +605,39 @@ trv::BispecMeasurements compute_bispec(
   trvm::SphericalBesselCalculator sj_b(params.ell2);  // j_l_b
 
   FieldStats stats_sn(params);
+  MeshFieldPool pool(params);  // reused by fields in loops
+
+  // Plan storage strategies within the memory limit (if any).
+  trv::plan_memory_usage(params, catalogue_data.ntotal, catalogue_rand.ntotal);
+
+  // Set up reduced-spherical-harmonic weights on mesh grids, with
+  // all orders either stored in tables (possibly in single precision)
+  // or evaluated on the fly.
+  bool ylm_stored = (params.ylm_tables != "none");
+  bool ylm_single = (params.ylm_tables == "single");
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
 
-  // Initialise reduced-spherical-harmonic weights on mesh grids.
-  std::vector< std::complex<double> > ylm_k_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_b(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_b(params.nmesh);
-  trvs::count_cgrid += 4;
-  trvs::count_grid += 4;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem +=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
-  trvs::update_maxmem();
+  // Terms at negated orders are added as mirrored components only if
+  // no wavevector modes on the Nyquist planes are binned.
+  const bool mirrored = if_mirrored_in_fourier(params, kbinning.bin_max);
 
   // Compute bispectrum terms including shot noise.
-  int count_terms = 0;
+  int count_terms = checkpoint.count_terms;
   for (int m1_ = - params.ell1; m1_ <= params.ell1; m1_++) {
     for (int m2_ = - params.ell2; m2_ <= params.ell2; m2_++) {
       // Check for if all Wigner-3j symbols are zero.
@@ -343,22 +653,42 @@ trv::BispecMeasurements compute_bispec(
       }
       if (flag_vanishing == "true") {continue;}
 
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_k_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_k_b
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_r_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_r_b
+      // Only compute terms at orders with M = - m₁ - m₂ > 0, or M = 0
+      // and m₁ ≥ 0, if terms at negated orders are added as their
+      // mirrored components.
+      if (
+        mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+      ) {continue;}
+      bool self_mirrored = !mirrored || (m1_ == 0 && m2_ == 0);
+
+      // Skip orders at which all terms have been computed before
+      // resumption.
+      if (ret_idx_term(m1_, m2_, params.ELL) < checkpoint.idx_term) {
+        continue;
+      }
+
+
+      // Cache band-limited fields in all shells for pairs of shells.
+      std::unique_ptr<ShellFieldCache> shells_a;   // F_lm_a shells
+      std::unique_ptr<ShellFieldCache> shells_b_;  // distinct F_lm_b shells
+      ShellFieldCache* shells_b = nullptr;         // F_lm_b shells
+      if (params.shape == "full" || params.shape == "triu") {
+        MeshField F_lm(params, pool, "`F_lm`");  // F_lm (workspace)
+
+        shells_a = std::make_unique<ShellFieldCache>(
+          params, kbinning.num_bins, "`F_lm_a` shells"
         );
+        shells_a->compute_shell_fields(dn_00, *ylm_k_a, m1_, kbinning, F_lm);
+        if (params.ell1 == params.ell2 && m1_ == m2_) {
+          shells_b = shells_a.get();
+        } else {
+          shells_b_ = std::make_unique<ShellFieldCache>(
+            params, kbinning.num_bins, "`F_lm_b` shells"
+          );
+          shells_b = shells_b_.get();
+          shells_b->compute_shell_fields(dn_00, *ylm_k_b, m2_, kbinning, F_lm);
+        }
+      }
 
       for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
         // Calculate the coupling coefficient.
@@ -367,223 +697,141 @@ trv::BispecMeasurements compute_bispec(
         );  // Wigner 3-j's
         if (std::fabs(coupling) < trvm::eps_coupling) {continue;}
 
+        int idx_term = ret_idx_term(m1_, m2_, M_);
+        if (idx_term < checkpoint.idx_term) {continue;}
+
         // ·······························································
         // Raw bispectrum
         // ·······························································
 
-        // Compute bispectrum components in eqs. (41) & (42) in the Paper.
-        MeshField G_LM(params, true, "`G_LM`");  // G_LM
+        // Compute fields for bispectrum components in eqs. (41) & (42)
+        // and shot noise components in eqs. (45) & (46) in the Paper,
+        // which are Fourier transformed in a batch.
+        MeshFieldBatch fields_LM(
+          params, pool, {"`G_LM`", "`dn_LM_for_sn`", "`N_LM`"}
+        );
+
+        MeshField& G_LM = fields_LM[0];  // G_LM
         G_LM.compute_ylm_wgtd_field(
           catalogue_data, catalogue_rand, los_data, los_rand, alpha,
           params.ELL, M_
         );
-        G_LM.fourier_transform();
-        G_LM.apply_assignment_compensation();
-        G_LM.inv_fourier_transform();
 
-        MeshField F_lm_a(params, true, "`F_lm_a`");  // F_lm_a
-        MeshField F_lm_b(params, true, "`F_lm_b`");  // F_lm_b
+        MeshField& dn_LM_for_sn = fields_LM[1];  // δn_LM(k) (for shot noise)
+        dn_LM_for_sn.compute_ylm_wgtd_field(
+          catalogue_data, catalogue_rand, los_data, los_rand, alpha,
+          params.ELL, M_
+        );
 
-        if (params.shape == "diag") {
-          for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
-            int ibin = idx_dv;
+        MeshField& N_LM = fields_LM[2];  // N_LM(k)
+        N_LM.compute_ylm_wgtd_quad_field(
+          catalogue_data, catalogue_rand, los_data, los_rand, alpha,
+          params.ELL, M_
+        );
 
-            double k_lower = kbinning.bin_edges[ibin];
-            double k_upper = kbinning.bin_edges[ibin + 1];
+        fields_LM.fourier_transform();
 
-            double k_eff_a_, k_eff_b_;
-            int nmodes_a_, nmodes_b_;
+        // Compute bispectrum components in eqs. (41) & (42) in the Paper.
+        G_LM.apply_assignment_compensation();
+        G_LM.inv_fourier_transform();
 
-            F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_a, k_lower, k_upper, k_eff_a_, nmodes_a_
-            );
-            F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_b, k_lower, k_upper, k_eff_b_, nmodes_b_
-            );
+        // Band-limited fields are only computed per data vector element
+        // for these shapes, as shell field caches are used otherwise.
+        if (
+          params.shape == "diag" || params.shape == "off-diag"
+          || params.shape == "row"
+        ) {
+          MeshField F_lm_a(params, pool, "`F_lm_a`");  // F_lm_a
+          MeshField F_lm_b(params, pool, "`F_lm_b`");  // F_lm_b
 
-            if (count_terms == 0) {
-              k1bin_dv[idx_dv] = kbinning.bin_centres[ibin];
-              k2bin_dv[idx_dv] = kbinning.bin_centres[ibin];
-              k1eff_dv[idx_dv] = k_eff_a_;
-              k2eff_dv[idx_dv] = k_eff_b_;
-              nmodes1_dv[idx_dv] = nmodes_a_;
-              nmodes2_dv[idx_dv] = nmodes_b_;
-            }
+          if (params.shape == "diag") {
+            for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+              int ibin = idx_dv;
 
-            // B_{l₁ l₂ L}^{m₁ m₂ M}
-            double bk_comp_real = 0., bk_comp_imag = 0.;
+              double k_lower = kbinning.bin_edges[ibin];
+              double k_upper = kbinning.bin_edges[ibin + 1];
 
-#ifdef TRV_USE_OMP
-#pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
-#endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
-              std::complex<double> F_lm_a_gridpt(
-                F_lm_a[gid][0], F_lm_a[gid][1]
+              double k_eff_a_, k_eff_b_;
+              int nmodes_a_, nmodes_b_;
+
+              F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
+                dn_00, *ylm_k_a, m1_, k_lower, k_upper, k_eff_a_, nmodes_a_
               );
-              std::complex<double> F_lm_b_gridpt(
-                F_lm_b[gid][0], F_lm_b[gid][1]
+              F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
+                dn_00, *ylm_k_b, m2_, k_lower, k_upper, k_eff_b_, nmodes_b_
               );
-              std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-              std::complex<double> bk_gridpt =
-                F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
-
-              bk_comp_real += bk_gridpt.real();
-              bk_comp_imag += bk_gridpt.imag();
-            }
-
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
-          }
-        }
-
-        if (params.shape == "off-diag") {
-          for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
-            int ibin_row, ibin_col;
-            if (params.idx_bin >= 0) {
-              ibin_row = idx_dv;
-              ibin_col = idx_dv + std::abs(params.idx_bin);
-            } else {
-              ibin_row = idx_dv + std::abs(params.idx_bin);
-              ibin_col = idx_dv;
-            }
-
-            double k_lower_a = kbinning.bin_edges[ibin_row];
-            double k_upper_a = kbinning.bin_edges[ibin_row + 1];
-            double k_lower_b = kbinning.bin_edges[ibin_col];
-            double k_upper_b = kbinning.bin_edges[ibin_col + 1];
-
-            double k_eff_a_, k_eff_b_;
-            int nmodes_a_, nmodes_b_;
-
-            F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-            );
-            F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
-            );
 
-            if (count_terms == 0) {
-              k1bin_dv[idx_dv] = kbinning.bin_centres[ibin_row];
-              k2bin_dv[idx_dv] = kbinning.bin_centres[ibin_col];
-              k1eff_dv[idx_dv] = k_eff_a_;
-              k2eff_dv[idx_dv] = k_eff_b_;
-              nmodes1_dv[idx_dv] = nmodes_a_;
-              nmodes2_dv[idx_dv] = nmodes_b_;
-            }
+              if (count_terms == 0) {
+                k1bin_dv[idx_dv] = kbinning.bin_centres[ibin];
+                k2bin_dv[idx_dv] = kbinning.bin_centres[ibin];
+                k1eff_dv[idx_dv] = k_eff_a_;
+                k2eff_dv[idx_dv] = k_eff_b_;
+                nmodes1_dv[idx_dv] = nmodes_a_;
+                nmodes2_dv[idx_dv] = nmodes_b_;
+              }
 
-            // B_{l₁ l₂ L}^{m₁ m₂ M}
-            double bk_comp_real = 0., bk_comp_imag = 0.;
+              // B_{l₁ l₂ L}^{m₁ m₂ M}
+              double bk_comp_real = 0., bk_comp_imag = 0.;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
-              std::complex<double> F_lm_a_gridpt(
-                F_lm_a[gid][0], F_lm_a[gid][1]
-              );
-              std::complex<double> F_lm_b_gridpt(
-                F_lm_b[gid][0], F_lm_b[gid][1]
-              );
-              std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-              std::complex<double> bk_gridpt =
-                F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
-
-              bk_comp_real += bk_gridpt.real();
-              bk_comp_imag += bk_gridpt.imag();
-            }
-
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
-          }
-        }
-
-        if (params.shape == "row") {
-          int ibin_row = params.idx_bin;
-
-          double k_lower_a = kbinning.bin_edges[ibin_row];
-          double k_upper_a = kbinning.bin_edges[ibin_row + 1];
-
-          double k_eff_a_;
-          int nmodes_a_;
-
-          F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-          );
-
-          for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
-            int ibin_col = idx_dv;
-
-            double k_lower_b = kbinning.bin_edges[ibin_col];
-            double k_upper_b = kbinning.bin_edges[ibin_col + 1];
-
-            double k_eff_b_;
-            int nmodes_b_;
+              for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
+                std::complex<double> F_lm_a_gridpt(
+                  F_lm_a[gid][0], F_lm_a[gid][1]
+                );
+                std::complex<double> F_lm_b_gridpt(
+                  F_lm_b[gid][0], F_lm_b[gid][1]
+                );
+                std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
+                std::complex<double> bk_gridpt =
+                  F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
 
-            F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
-            );
+                bk_comp_real += bk_gridpt.real();
+                bk_comp_imag += bk_gridpt.imag();
+              }
 
-            if (count_terms == 0) {
-              k1bin_dv[idx_dv] = kbinning.bin_centres[ibin_row];
-              k2bin_dv[idx_dv] = kbinning.bin_centres[ibin_col];
-              k1eff_dv[idx_dv] = k_eff_a_;
-              k2eff_dv[idx_dv] = k_eff_b_;
-              nmodes1_dv[idx_dv] = nmodes_a_;
-              nmodes2_dv[idx_dv] = nmodes_b_;
-            }
+              // Sum contributions from all slabs.
+              double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+              trvs::allreduce_sum(bk_comp, 2);
 
-            // B_{l₁ l₂ L}^{m₁ m₂ M}
-            double bk_comp_real = 0., bk_comp_imag = 0.;
+              std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
 
-#ifdef TRV_USE_OMP
-#pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
-#endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
-              std::complex<double> F_lm_a_gridpt(
-                F_lm_a[gid][0], F_lm_a[gid][1]
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_component, params.ell1 + params.ell2, self_mirrored
               );
-              std::complex<double> F_lm_b_gridpt(
-                F_lm_b[gid][0], F_lm_b[gid][1]
-              );
-              std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-              std::complex<double> bk_gridpt =
-                F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
-
-              bk_comp_real += bk_gridpt.real();
-              bk_comp_imag += bk_gridpt.imag();
             }
-
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
           }
-        }
 
-        if (params.shape == "full") {
-          for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-            for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-              int idx_dv = idx_row * params.num_bins + idx_col;
+          if (params.shape == "off-diag") {
+            for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+              int ibin_row, ibin_col;
+              if (params.idx_bin >= 0) {
+                ibin_row = idx_dv;
+                ibin_col = idx_dv + std::abs(params.idx_bin);
+              } else {
+                ibin_row = idx_dv + std::abs(params.idx_bin);
+                ibin_col = idx_dv;
+              }
 
-              double k_lower_a = kbinning.bin_edges[idx_row];
-              double k_upper_a = kbinning.bin_edges[idx_row + 1];
-              double k_lower_b = kbinning.bin_edges[idx_col];
-              double k_upper_b = kbinning.bin_edges[idx_col + 1];
+              double k_lower_a = kbinning.bin_edges[ibin_row];
+              double k_upper_a = kbinning.bin_edges[ibin_row + 1];
+              double k_lower_b = kbinning.bin_edges[ibin_col];
+              double k_upper_b = kbinning.bin_edges[ibin_col + 1];
 
               double k_eff_a_, k_eff_b_;
               int nmodes_a_, nmodes_b_;
 
               F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
+                dn_00, *ylm_k_a, m1_, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
               );
               F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
+                dn_00, *ylm_k_b, m2_, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
               );
 
               if (count_terms == 0) {
-                k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
-                k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
+                k1bin_dv[idx_dv] = kbinning.bin_centres[ibin_row];
+                k2bin_dv[idx_dv] = kbinning.bin_centres[ibin_col];
                 k1eff_dv[idx_dv] = k_eff_a_;
                 k2eff_dv[idx_dv] = k_eff_b_;
                 nmodes1_dv[idx_dv] = nmodes_a_;
@@ -596,7 +844,7 @@ trv::BispecMeasurements compute_bispec(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-              for (long long gid = 0; gid < params.nmesh; gid++) {
+              for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
                 std::complex<double> F_lm_a_gridpt(
                   F_lm_a[gid][0], F_lm_a[gid][1]
                 );
@@ -611,37 +859,47 @@ trv::BispecMeasurements compute_bispec(
                 bk_comp_imag += bk_gridpt.imag();
               }
 
-              std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+              // Sum contributions from all slabs.
+              double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+              trvs::allreduce_sum(bk_comp, 2);
+
+              std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
 
-              bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_component, params.ell1 + params.ell2, self_mirrored
+              );
             }
           }
-        }
 
-        if (params.shape == "triu") {
-          for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-            for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
-              int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
-                + (idx_col - idx_row);
+          if (params.shape == "row") {
+            int ibin_row = params.idx_bin;
 
-              double k_lower_a = kbinning.bin_edges[idx_row];
-              double k_upper_a = kbinning.bin_edges[idx_row + 1];
-              double k_lower_b = kbinning.bin_edges[idx_col];
-              double k_upper_b = kbinning.bin_edges[idx_col + 1];
+            double k_lower_a = kbinning.bin_edges[ibin_row];
+            double k_upper_a = kbinning.bin_edges[ibin_row + 1];
 
-              double k_eff_a_, k_eff_b_;
-              int nmodes_a_, nmodes_b_;
+            double k_eff_a_;
+            int nmodes_a_;
+
+            F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
+              dn_00, *ylm_k_a, m1_, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
+            );
+
+            for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+              int ibin_col = idx_dv;
+
+              double k_lower_b = kbinning.bin_edges[ibin_col];
+              double k_upper_b = kbinning.bin_edges[ibin_col + 1];
+
+              double k_eff_b_;
+              int nmodes_b_;
 
-              F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-              );
               F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
+                dn_00, *ylm_k_b, m2_, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
               );
 
               if (count_terms == 0) {
-                k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
-                k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
+                k1bin_dv[idx_dv] = kbinning.bin_centres[ibin_row];
+                k2bin_dv[idx_dv] = kbinning.bin_centres[ibin_col];
                 k1eff_dv[idx_dv] = k_eff_a_;
                 k2eff_dv[idx_dv] = k_eff_b_;
                 nmodes1_dv[idx_dv] = nmodes_a_;
@@ -654,7 +912,7 @@ trv::BispecMeasurements compute_bispec(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-              for (long long gid = 0; gid < params.nmesh; gid++) {
+              for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
                 std::complex<double> F_lm_a_gridpt(
                   F_lm_a[gid][0], F_lm_a[gid][1]
                 );
@@ -669,9 +927,68 @@ trv::BispecMeasurements compute_bispec(
                 bk_comp_imag += bk_gridpt.imag();
               }
 
-              std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+              // Sum contributions from all slabs.
+              double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+              trvs::allreduce_sum(bk_comp, 2);
+
+              std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
+
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_component, params.ell1 + params.ell2, self_mirrored
+              );
+            }
+          }
+        }
+
+        if (params.shape == "full") {
+          // B_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+          std::vector<std::complex<double>> bk_components =
+            trv::calc_shell_field_products(*shells_a, *shells_b, G_LM);
+
+          for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
+            for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
+              int idx_dv = idx_row * params.num_bins + idx_col;
+
+              if (count_terms == 0) {
+                k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
+                k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
+                k1eff_dv[idx_dv] = shells_a->k_eff[idx_row];
+                k2eff_dv[idx_dv] = shells_b->k_eff[idx_col];
+                nmodes1_dv[idx_dv] = shells_a->nmodes[idx_row];
+                nmodes2_dv[idx_dv] = shells_b->nmodes[idx_col];
+              }
+
+              int ipair = idx_row * params.num_bins + idx_col;
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_components[ipair], params.ell1 + params.ell2, self_mirrored
+              );
+            }
+          }
+        }
+
+        if (params.shape == "triu") {
+          // B_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+          std::vector<std::complex<double>> bk_components =
+            trv::calc_shell_field_products(*shells_a, *shells_b, G_LM, true);
+
+          for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
+            for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
+              int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
+                + (idx_col - idx_row);
 
-              bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+              if (count_terms == 0) {
+                k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
+                k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
+                k1eff_dv[idx_dv] = shells_a->k_eff[idx_row];
+                k2eff_dv[idx_dv] = shells_b->k_eff[idx_col];
+                nmodes1_dv[idx_dv] = shells_a->nmodes[idx_row];
+                nmodes2_dv[idx_dv] = shells_b->nmodes[idx_col];
+              }
+
+              int ipair = idx_row * params.num_bins + idx_col;
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_components[ipair], params.ell1 + params.ell2, self_mirrored
+              );
             }
           }
         }
@@ -681,22 +998,6 @@ trv::BispecMeasurements compute_bispec(
         // ·······························································
 
         // Compute shot noise components in eqs. (45) & (46) in the Paper.
-        MeshField dn_LM_for_sn(params, true, "`dn_LM_for_sn`");  // δn_LM(k)
-                                                                 // (for
-                                                                 // shot noise)
-        dn_LM_for_sn.compute_ylm_wgtd_field(
-          catalogue_data, catalogue_rand, los_data, los_rand, alpha,
-          params.ELL, M_
-        );
-        dn_LM_for_sn.fourier_transform();
-
-        MeshField N_LM(params, true, "`N_LM`");  // N_LM(k)
-        N_LM.compute_ylm_wgtd_quad_field(
-          catalogue_data, catalogue_rand, los_data, los_rand, alpha,
-          params.ELL, M_
-        );
-        N_LM.fourier_transform();
-
         std::complex<double> Sbar_LM = calc_ylm_wgtd_shotnoise_amp_for_bispec(
           catalogue_data, catalogue_rand, los_data, los_rand, alpha,
           params.ELL, M_
@@ -720,8 +1021,9 @@ trv::BispecMeasurements compute_bispec(
           if (params.shape == "diag") {
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               int ibin = idx_dv;
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin] - stats_sn.sn[ibin]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin] - stats_sn.sn[ibin],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
@@ -734,15 +1036,17 @@ trv::BispecMeasurements compute_bispec(
               } else {
                 ibin_row = idx_dv + std::abs(params.idx_bin);
               }
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin_row] - stats_sn.sn[ibin_row]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin_row] - stats_sn.sn[ibin_row],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
 
           if (params.shape == "row") {
-            std::complex<double> sn_row_ = coupling * (
-              stats_sn.pk[params.idx_bin] - stats_sn.sn[params.idx_bin]
+            std::complex<double> sn_row_ = coupling * add_mirrored_component(
+              stats_sn.pk[params.idx_bin] - stats_sn.sn[params.idx_bin],
+              params.ell1 + params.ell2, self_mirrored
             );
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               sn_dv[idx_dv] += sn_row_;
@@ -751,8 +1055,9 @@ trv::BispecMeasurements compute_bispec(
 
           if (params.shape == "full") {
             for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-              std::complex<double> sn_row_ = coupling * (
-                stats_sn.pk[idx_row] - stats_sn.sn[idx_row]
+              std::complex<double> sn_row_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_row] - stats_sn.sn[idx_row],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
                 int idx_dv = idx_row * params.num_bins + idx_col;
@@ -763,8 +1068,9 @@ trv::BispecMeasurements compute_bispec(
 
           if (params.shape == "triu") {
             for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-              std::complex<double> sn_row_ = coupling * (
-                stats_sn.pk[idx_row] - stats_sn.sn[idx_row]
+              std::complex<double> sn_row_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_row] - stats_sn.sn[idx_row],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
                 int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
@@ -784,8 +1090,9 @@ trv::BispecMeasurements compute_bispec(
           if (params.shape == "diag") {
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               int ibin = idx_dv;
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin] - stats_sn.sn[ibin]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin] - stats_sn.sn[ibin],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
@@ -798,8 +1105,9 @@ trv::BispecMeasurements compute_bispec(
               } else {
                 ibin_col = idx_dv;
               }
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
@@ -807,16 +1115,18 @@ trv::BispecMeasurements compute_bispec(
           if (params.shape == "row") {
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               int ibin_col = idx_dv;
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
 
           if (params.shape == "full") {
             for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-              std::complex<double> sn_col_ = coupling * (
-                stats_sn.pk[idx_col] - stats_sn.sn[idx_col]
+              std::complex<double> sn_col_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_col] - stats_sn.sn[idx_col],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_row = 0; idx_row <= params.num_bins; idx_row++) {
                 int idx_dv = idx_row * params.num_bins + idx_col;
@@ -827,8 +1137,9 @@ trv::BispecMeasurements compute_bispec(
 
           if (params.shape == "triu") {
             for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-              std::complex<double> sn_col_ = coupling * (
-                stats_sn.pk[idx_col] - stats_sn.sn[idx_col]
+              std::complex<double> sn_col_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_col] - stats_sn.sn[idx_col],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_row = 0; idx_row <= idx_col; idx_row++) {
                 int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
@@ -843,11 +1154,13 @@ trv::BispecMeasurements compute_bispec(
           double k_a = k1eff_dv[idx_dv];
           double k_b = k2eff_dv[idx_dv];
 
-          std::complex<double> S_ij_k = parity *
+          std::complex<double> S_ij_k = parity * add_mirrored_component(
             stats_sn.compute_uncoupled_shotnoise_for_bispec_per_bin(
-              dn_LM_for_sn, N_00, ylm_r_a, ylm_r_b, sj_a, sj_b,
-              Sbar_LM, k_a, k_b
-            );  // S|{i = j ≠ k}
+                dn_LM_for_sn, N_00, *ylm_r_a, m1_, *ylm_r_b, m2_, sj_a, sj_b,
+                Sbar_LM, k_a, k_b
+            ),
+            0, self_mirrored
+          );  // S|{i = j ≠ k}
 
           sn_dv[idx_dv] += coupling * S_ij_k;
         }
@@ -859,7 +1172,30 @@ trv::BispecMeasurements compute_bispec(
             m1_, m2_, M_
           );
         }
+
+        if (checkpointing) {
+          checkpoint.idx_term = idx_term + 1;
+          checkpoint.count_terms = count_terms;
+          checkpoint.nmodes1_dv.assign(nmodes1_dv, nmodes1_dv + dv_dim);
+          checkpoint.nmodes2_dv.assign(nmodes2_dv, nmodes2_dv + dv_dim);
+          checkpoint.k1bin_dv.assign(k1bin_dv, k1bin_dv + dv_dim);
+          checkpoint.k2bin_dv.assign(k2bin_dv, k2bin_dv + dv_dim);
+          checkpoint.k1eff_dv.assign(k1eff_dv, k1eff_dv + dv_dim);
+          checkpoint.k2eff_dv.assign(k2eff_dv, k2eff_dv + dv_dim);
+          checkpoint.bk_dv.assign(bk_dv, bk_dv + dv_dim);
+          checkpoint.sn_dv.assign(sn_dv, sn_dv + dv_dim);
+          if (trvs::currTask == 0) {
+            checkpoint.save(checkpoint_filepath);
+            trvs::logger.info(
+              "Checkpoint saved after %d computed terms: %s",
+              count_terms, checkpoint_filepath.c_str()
+            );
+          }
+        }
       }
+
+      shells_b_.reset();
+      shells_a.reset();
     }
   }
 
@@ -885,10 +1221,6 @@ trv::BispecMeasurements compute_bispec(
   delete[] k1eff_dv; delete[] k2eff_dv;
   delete[] bk_dv; delete[] sn_dv;
 
-  trvs::count_cgrid -= 4;
-  trvs::count_grid -= 4;
-  trvs::gbytesMem -=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
 
   if (trvs::currTask == 0) {
     trvs::logger.stat(
@@ -979,7 +1311,7 @@ trv::ThreePCFMeasurements compute_3pcf(
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute common field quantities.
-  MeshField dn_00(params, true, "`dn_00`");  // δn_00(k)
+  MeshField dn_00(params, true, "`dn_00`", true);  // δn_00(k)
   dn_00.compute_ylm_wgtd_field(
     catalogue_data, catalogue_rand, los_data, los_rand, alpha, 0, 0
   );
@@ -987,7 +1319,7 @@ trv::ThreePCFMeasurements compute_3pcf(
 
   double vol_cell = dn_00.vol_cell;
 
-  MeshField N_00(params, true, "`N_00`");  // N_00(k)
+  MeshField N_00(params, true, "`N_00`", true);  // N_00(k)
   N_00.compute_ylm_wgtd_quad_field(
     catalogue_data, catalogue_rand, los_data, los_rand, alpha, 0, 0
   );
@@ -997,18 +1329,36 @@ trv::ThreePCFMeasurements compute_3pcf(
   trvm::SphericalBesselCalculator sj_b(params.ell2);  // j_l_b
 
   FieldStats stats_sn(params);
+  MeshFieldPool pool(params);  // reused by fields in loops
+
+  // Plan storage strategies within the memory limit (if any).
+  trv::plan_memory_usage(params, catalogue_data.ntotal, catalogue_rand.ntotal);
+
+  // Set up reduced-spherical-harmonic weights on mesh grids, with
+  // all orders either stored in tables (possibly in single precision)
+  // or evaluated on the fly.
+  bool ylm_stored = (params.ylm_tables != "none");
+  bool ylm_single = (params.ylm_tables == "single");
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
 
-  // Initialise reduced-spherical-harmonic weights on mesh grids.
-  std::vector< std::complex<double> > ylm_r_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_b(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_b(params.nmesh);
-  trvs::count_cgrid += 4;
-  trvs::count_grid += 4;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem +=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
-  trvs::update_maxmem();
+  // Terms at negated orders are added as mirrored components only if
+  // the fields are Hermitian at all wavevector modes.
+  const bool mirrored = if_mirrored_in_config(params);
 
   // Compute 3PCF terms including shot noise.
   int count_terms = 0;
@@ -1028,22 +1378,14 @@ trv::ThreePCFMeasurements compute_3pcf(
       }
       if (flag_vanishing == "true") {continue;}
 
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_r_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_r_b
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_k_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_k_b
-        );
+      // Only compute terms at orders with M = - m₁ - m₂ > 0, or M = 0
+      // and m₁ ≥ 0, if terms at negated orders are added as their
+      // mirrored components.
+      if (
+        mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+      ) {continue;}
+      bool self_mirrored = !mirrored || (m1_ == 0 && m2_ == 0);
+
 
       for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
         // Calculate the coupling coefficient.
@@ -1057,7 +1399,7 @@ trv::ThreePCFMeasurements compute_3pcf(
         // ·······························································
 
         // Compute shot noise components in eq. (51) in the Paper.
-        MeshField dn_LM_for_sn(params, true, "`dn_LM_for_sn`");  // δn_LM(k)
+        MeshField dn_LM_for_sn(params, pool, "`dn_LM_for_sn`");  // δn_LM(k)
                                                                  // (for
                                                                  // shot noise)
         dn_LM_for_sn.compute_ylm_wgtd_field(
@@ -1072,14 +1414,15 @@ trv::ThreePCFMeasurements compute_3pcf(
         );  // \bar{S}_LM
 
         stats_sn.compute_uncoupled_shotnoise_for_3pcf(
-          dn_LM_for_sn, N_00, ylm_r_a, ylm_r_b, Sbar_LM, rbinning
+          dn_LM_for_sn, N_00, *ylm_r_a, m1_, *ylm_r_b, m2_, Sbar_LM, rbinning
         );  // S|{i = j ≠ k}
 
         // Enforce the Kronecker delta in eq. (51) in the Paper.
         if (params.shape == "diag") {
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin = idx_dv;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[ibin];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[ibin], 0, self_mirrored);
           }
         }
 
@@ -1087,19 +1430,23 @@ trv::ThreePCFMeasurements compute_3pcf(
           // Note that ``idx_col == idx_row``.
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin = idx_dv;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[ibin];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[ibin], 0, self_mirrored);
           }
         }
 
         if (params.shape == "row") {
-          sn_dv[params.idx_bin] += coupling * stats_sn.xi[params.idx_bin];
+          sn_dv[params.idx_bin] += coupling * add_mirrored_component(
+            stats_sn.xi[params.idx_bin], 0, self_mirrored
+          );
         }
 
         if (params.shape == "full") {
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
             // Note that ``idx_col == idx_row``.
             int idx_dv = idx_row * params.num_bins + idx_row;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[idx_row];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[idx_row], 0, self_mirrored);
           }
         }
 
@@ -1107,7 +1454,8 @@ trv::ThreePCFMeasurements compute_3pcf(
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
             // Note that ``idx_col == idx_row``.
             int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[idx_row];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[idx_row], 0, self_mirrored);
           }
         }
 
@@ -1197,7 +1545,7 @@ trv::ThreePCFMeasurements compute_3pcf(
         // ·······························································
 
         // Compute 3PCF components in eqs. (42), (48) & (49) in the Paper.
-        MeshField G_LM(params, true, "`G_LM`");  // G_LM
+        MeshField G_LM(params, pool, "`G_LM`");  // G_LM
         G_LM.compute_ylm_wgtd_field(
           catalogue_data, catalogue_rand, los_data, los_rand, alpha,
           params.ELL, M_
@@ -1206,50 +1554,127 @@ trv::ThreePCFMeasurements compute_3pcf(
         G_LM.apply_assignment_compensation();
         G_LM.inv_fourier_transform();
 
-        MeshField F_lm_a(params, true, "`F_lm_a`");  // F_lm_a
-        MeshField F_lm_b(params, true, "`F_lm_b`");  // F_lm_b
+        MeshField F_lm_a(params, pool, "`F_lm_a`");  // F_lm_a
+        MeshField F_lm_b(params, pool, "`F_lm_b`");  // F_lm_b
+
+        // Compute components at the orders and, unless they are all zero,
+        // at the negated orders with the same coupling coefficient, where
+        // G_LM at the negated order is obtained in place.  Unlike G_LM,
+        // spherical-Bessel-weighted fields are computed at both orders as
+        // wavevector modes on the Nyquist planes of the mesh grid are unpaired.
+        for (int imirror = 0; imirror < (self_mirrored ? 1 : 2); imirror++) {
+          int m1 = (imirror == 0) ? m1_ : - m1_;
+          int m2 = (imirror == 0) ? m2_ : - m2_;
+          int M = (imirror == 0) ? M_ : - M_;
+          if (imirror == 1) {G_LM.apply_order_negation(M_);}
+
+          // Cache spherical-Bessel-weighted fields in all separation shells
+          // for pairs of shells.
+          std::unique_ptr<ShellFieldCache> shells_a;   // F_lm_a shells
+          std::unique_ptr<ShellFieldCache> shells_b_;  // distinct F_lm_b shells
+          ShellFieldCache* shells_b = nullptr;         // F_lm_b shells
+          if (params.shape == "full" || params.shape == "triu") {
+            shells_a = std::make_unique<ShellFieldCache>(
+              params, rbinning.num_bins, "`F_lm_a` shells"
+            );
+            shells_a->compute_sjl_fields(
+              dn_00, *ylm_k_a, m1, sj_a, stats_sn.r, F_lm_a
+            );
+            if (params.ell1 == params.ell2 && m1 == m2) {
+              shells_b = shells_a.get();
+            } else {
+              shells_b_ = std::make_unique<ShellFieldCache>(
+                params, rbinning.num_bins, "`F_lm_b` shells"
+              );
+              shells_b = shells_b_.get();
+              shells_b->compute_sjl_fields(
+                dn_00, *ylm_k_b, m2, sj_b, stats_sn.r, F_lm_b
+              );
+            }
+          }
 
-        for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
-          double r_a = r1eff_dv[idx_dv];
-          F_lm_a.inv_fourier_transform_sjl_ylm_wgtd_field(
-            dn_00, ylm_k_a, sj_a, r_a
-          );
+          if (params.shape == "full" || params.shape == "triu") {
+            // ζ_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+            std::vector<std::complex<double>> zeta_components =
+              trv::calc_shell_field_products(
+                *shells_a, *shells_b, G_LM, params.shape == "triu"
+              );
 
-          double r_b = r2eff_dv[idx_dv];
-          F_lm_b.inv_fourier_transform_sjl_ylm_wgtd_field(
-            dn_00, ylm_k_b, sj_b, r_b
-          );
+            for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
+              int idx_col_start = (params.shape == "triu") ? idx_row : 0;
+              for (
+                int idx_col = idx_col_start;
+                idx_col < params.num_bins;
+                idx_col++
+              ) {
+                int idx_dv = (params.shape == "full")
+                  ? idx_row * params.num_bins + idx_col
+                  : (2*params.num_bins - idx_row + 1) * idx_row / 2
+                    + (idx_col - idx_row);
+
+                int ipair = idx_row * params.num_bins + idx_col;
+                zeta_dv[idx_dv] +=
+                  parity * coupling * vol_cell * zeta_components[ipair];
+              }
+            }
+          } else {
+            for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+              double r_a = r1eff_dv[idx_dv];
+              F_lm_a.inv_fourier_transform_sjl_ylm_wgtd_field(
+                dn_00, *ylm_k_a, m1, sj_a, r_a
+              );
+
+              double r_b = r2eff_dv[idx_dv];
+              F_lm_b.inv_fourier_transform_sjl_ylm_wgtd_field(
+                dn_00, *ylm_k_b, m2, sj_b, r_b
+              );
 
-          // ζ_{l₁ l₂ L}^{m₁ m₂ M}
-          double zeta_comp_real = 0., zeta_comp_imag = 0.;
+              // ζ_{l₁ l₂ L}^{m₁ m₂ M}
+              double zeta_comp_real = 0., zeta_comp_imag = 0.;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:zeta_comp_real, zeta_comp_imag)
 #endif  // TRV_USE_OMP
-          for (long long gid = 0; gid < params.nmesh; gid++) {
-            std::complex<double> F_lm_a_gridpt(F_lm_a[gid][0], F_lm_a[gid][1]);
-            std::complex<double> F_lm_b_gridpt(F_lm_b[gid][0], F_lm_b[gid][1]);
-            std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-            std::complex<double> zeta_gridpt =
-              F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
+              for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
+                std::complex<double> F_lm_a_gridpt(
+                  F_lm_a[gid][0], F_lm_a[gid][1]
+                );
+                std::complex<double> F_lm_b_gridpt(
+                  F_lm_b[gid][0], F_lm_b[gid][1]
+                );
+                std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
+                std::complex<double> zeta_gridpt =
+                  F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
+
+                zeta_comp_real += zeta_gridpt.real();
+                zeta_comp_imag += zeta_gridpt.imag();
+              }
 
-            zeta_comp_real += zeta_gridpt.real();
-            zeta_comp_imag += zeta_gridpt.imag();
+              // Sum contributions from all slabs.
+              double zeta_comp[2] = {zeta_comp_real, zeta_comp_imag};
+              trvs::allreduce_sum(zeta_comp, 2);
+
+              std::complex<double> zeta_component(
+                zeta_comp[0], zeta_comp[1]
+              );
+
+              zeta_dv[idx_dv] += parity * coupling * vol_cell * zeta_component;
+            }
           }
 
-          std::complex<double> zeta_component(zeta_comp_real, zeta_comp_imag);
+          shells_b_.reset();
+          shells_a.reset();
 
-          zeta_dv[idx_dv] += parity * coupling * vol_cell * zeta_component;
+          if (trvs::currTask == 0) {
+            trvs::logger.stat(
+              "Three-point correlation function term computed at orders "
+              "(m1, m2, M) = (%d, %d, %d).",
+              m1, m2, M
+            );
+          }
         }
 
         count_terms++;
-        if (trvs::currTask == 0) {
-          trvs::logger.stat(
-            "Three-point correlation function term computed at orders "
-            "(m1, m2, M) = (%d, %d, %d).",
-            m1_, m2_, M_
-          );
-        }
       }
     }
   }
@@ -1276,10 +1701,6 @@ trv::ThreePCFMeasurements compute_3pcf(
   delete[] r1eff_dv; delete[] r2eff_dv;
   delete[] zeta_dv; delete[] sn_dv;
 
-  trvs::count_cgrid -= 4;
-  trvs::count_grid -= 4;
-  trvs::gbytesMem -=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
 
   if (trvs::currTask == 0) {
     trvs::logger.stat(
@@ -1368,7 +1789,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute common field quantities.
-  MeshField dn_00(params, true, "`dn_00`");  // δn_00(k)
+  MeshField dn_00(params, true, "`dn_00`", true);  // δn_00(k)
   dn_00.compute_unweighted_field_fluctuations_insitu(catalogue_data);
   dn_00.fourier_transform();
 
@@ -1379,7 +1800,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 
   // Under the global plane-parallel approximation, y_{LM} = δᴰ_{M0}
   // (L-invariant) for the line-of-sight spherical harmonic.
-  MeshField N_L0(params, true, "`N_L0`");  // N_L0(k)
+  MeshField N_L0(params, true, "`N_L0`", true);  // N_L0(k)
   N_L0.compute_unweighted_field(catalogue_data);
   N_L0.fourier_transform();
 
@@ -1389,18 +1810,36 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
   trvm::SphericalBesselCalculator sj_b(params.ell2);  // j_l_b
 
   FieldStats stats_sn(params);
+  MeshFieldPool pool(params);  // reused by fields in loops
+
+  // Plan storage strategies within the memory limit (if any).
+  trv::plan_memory_usage(params, catalogue_data.ntotal, 0);
+
+  // Set up reduced-spherical-harmonic weights on mesh grids, with
+  // all orders either stored in tables (possibly in single precision)
+  // or evaluated on the fly.
+  bool ylm_stored = (params.ylm_tables != "none");
+  bool ylm_single = (params.ylm_tables == "single");
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
 
-  // Initialise/reset spherical harmonic mesh grids.
-  std::vector< std::complex<double> > ylm_k_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_b(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_b(params.nmesh);
-  trvs::count_cgrid += 4;
-  trvs::count_grid += 4;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem +=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
-  trvs::update_maxmem();
+  // Terms at negated orders are added as mirrored components only if
+  // no wavevector modes on the Nyquist planes are binned.
+  const bool mirrored = if_mirrored_in_fourier(params, kbinning.bin_max);
 
   // Compute bispectrum terms including shot noise.
   int count_terms = 0;
@@ -1416,35 +1855,49 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
       );  // Wigner 3-j's
       if (std::fabs(coupling) < trvm::eps_coupling) {continue;}
 
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_k_a
-        );
-      trvm::SphericalHarmonicCalculator
-        ::store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_k_b
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_r_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_r_b
-        );
+      // Only compute terms at orders with M = - m₁ - m₂ > 0, or M = 0
+      // and m₁ ≥ 0, if terms at negated orders are added as their
+      // mirrored components.
+      if (
+        mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+      ) {continue;}
+      bool self_mirrored = !mirrored || (m1_ == 0 && m2_ == 0);
+
 
       // ·································································
       // Raw bispectrum
       // ·································································
 
-      MeshField G_00(params, true, "`G_00`");  // G_00
+      MeshField G_00(params, pool, "`G_00`");  // G_00
       G_00.compute_unweighted_field_fluctuations_insitu(catalogue_data);
       G_00.fourier_transform();
       G_00.apply_assignment_compensation();
       G_00.inv_fourier_transform();
 
-      MeshField F_lm_a(params, true, "`F_lm_a`");  // F_lm_a
-      MeshField F_lm_b(params, true, "`F_lm_b`");  // F_lm_b
+      MeshField F_lm_a(params, pool, "`F_lm_a`");  // F_lm_a
+      MeshField F_lm_b(params, pool, "`F_lm_b`");  // F_lm_b
+
+      // Cache band-limited fields in all shells for pairs of shells.
+      std::unique_ptr<ShellFieldCache> shells_a;   // F_lm_a shells
+      std::unique_ptr<ShellFieldCache> shells_b_;  // distinct F_lm_b shells
+      ShellFieldCache* shells_b = nullptr;         // F_lm_b shells
+      if (params.shape == "full" || params.shape == "triu") {
+        shells_a = std::make_unique<ShellFieldCache>(
+          params, kbinning.num_bins, "`F_lm_a` shells"
+        );
+        shells_a->compute_shell_fields(dn_00, *ylm_k_a, m1_, kbinning, F_lm_a);
+        if (params.ell1 == params.ell2 && m1_ == m2_) {
+          shells_b = shells_a.get();
+        } else {
+          shells_b_ = std::make_unique<ShellFieldCache>(
+            params, kbinning.num_bins, "`F_lm_b` shells"
+          );
+          shells_b = shells_b_.get();
+          shells_b->compute_shell_fields(
+            dn_00, *ylm_k_b, m2_, kbinning, F_lm_a
+          );
+        }
+      }
 
       if (params.shape == "diag") {
         for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
@@ -1457,10 +1910,10 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
           int nmodes_a_, nmodes_b_;
 
           F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_00, ylm_k_a, k_lower, k_upper, k_eff_a_, nmodes_a_
+            dn_00, *ylm_k_a, m1_, k_lower, k_upper, k_eff_a_, nmodes_a_
           );
           F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_00, ylm_k_b, k_lower, k_upper, k_eff_b_, nmodes_b_
+            dn_00, *ylm_k_b, m2_, k_lower, k_upper, k_eff_b_, nmodes_b_
           );
 
           if (count_terms == 0) {
@@ -1478,7 +1931,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-          for (long long gid = 0; gid < params.nmesh; gid++) {
+          for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
             std::complex<double> F_lm_a_gridpt(F_lm_a[gid][0], F_lm_a[gid][1]);
             std::complex<double> F_lm_b_gridpt(F_lm_b[gid][0], F_lm_b[gid][1]);
             std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
@@ -1489,9 +1942,15 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
             bk_comp_imag += bk_gridpt.imag();
           }
 
-          std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+          // Sum contributions from all slabs.
+          double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+          trvs::allreduce_sum(bk_comp, 2);
+
+          std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
 
-          bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+          bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+            bk_component, params.ell1 + params.ell2, self_mirrored
+          );
         }
       }
 
@@ -1515,10 +1974,10 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
           int nmodes_a_, nmodes_b_;
 
           F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
+            dn_00, *ylm_k_a, m1_, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
           );
           F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
+            dn_00, *ylm_k_b, m2_, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
           );
 
           if (count_terms == 0) {
@@ -1536,7 +1995,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-          for (long long gid = 0; gid < params.nmesh; gid++) {
+          for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
             std::complex<double> F_lm_a_gridpt(F_lm_a[gid][0], F_lm_a[gid][1]);
             std::complex<double> F_lm_b_gridpt(F_lm_b[gid][0], F_lm_b[gid][1]);
             std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
@@ -1547,9 +2006,15 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
             bk_comp_imag += bk_gridpt.imag();
           }
 
-          std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+          // Sum contributions from all slabs.
+          double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+          trvs::allreduce_sum(bk_comp, 2);
+
+          std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
 
-          bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+          bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+            bk_component, params.ell1 + params.ell2, self_mirrored
+          );
         }
       }
 
@@ -1563,7 +2028,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
         int nmodes_a_;
 
         F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-          dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
+          dn_00, *ylm_k_a, m1_, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
         );
 
         for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
@@ -1576,7 +2041,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
           int nmodes_b_;
 
           F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
+            dn_00, *ylm_k_b, m2_, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
           );
 
           if (count_terms == 0) {
@@ -1594,7 +2059,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-          for (long long gid = 0; gid < params.nmesh; gid++) {
+          for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
             std::complex<double> F_lm_a_gridpt(F_lm_a[gid][0], F_lm_a[gid][1]);
             std::complex<double> F_lm_b_gridpt(F_lm_b[gid][0], F_lm_b[gid][1]);
             std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
@@ -1605,127 +2070,74 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
             bk_comp_imag += bk_gridpt.imag();
           }
 
-          std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-          bk_dv[idx_dv] += coupling * vol_cell * bk_component;
-        }
-      }
-
-      if (params.shape == "full") {
-        for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-          for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-            int idx_dv = idx_row * params.num_bins + idx_col;
-
-            double k_lower_a = kbinning.bin_edges[idx_row];
-            double k_upper_a = kbinning.bin_edges[idx_row + 1];
-            double k_lower_b = kbinning.bin_edges[idx_col];
-            double k_upper_b = kbinning.bin_edges[idx_col + 1];
-
-            double k_eff_a_, k_eff_b_;
-            int nmodes_a_, nmodes_b_;
-
-            F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-            );
-            F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
-            );
+          // Sum contributions from all slabs.
+          double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+          trvs::allreduce_sum(bk_comp, 2);
 
-            if (count_terms == 0) {
-              k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
-              k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
-              k1eff_dv[idx_dv] = k_eff_a_;
-              k2eff_dv[idx_dv] = k_eff_b_;
-              nmodes1_dv[idx_dv] = nmodes_a_;
-              nmodes2_dv[idx_dv] = nmodes_b_;
-            }
+          std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
 
-            // B_{l₁ l₂ L}^{m₁ m₂ M}
-            double bk_comp_real = 0., bk_comp_imag = 0.;
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
-#endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
-              std::complex<double> F_lm_a_gridpt(
-                F_lm_a[gid][0], F_lm_a[gid][1]
-              );
-              std::complex<double> F_lm_b_gridpt(
-                F_lm_b[gid][0], F_lm_b[gid][1]
-              );
-              std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
-              std::complex<double> bk_gridpt =
-                F_lm_a_gridpt * F_lm_b_gridpt * G_00_gridpt;
+          bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+            bk_component, params.ell1 + params.ell2, self_mirrored
+          );
+        }
+      }
 
-              bk_comp_real += bk_gridpt.real();
-              bk_comp_imag += bk_gridpt.imag();
-            }
+      if (params.shape == "full") {
+        // B_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+        std::vector<std::complex<double>> bk_components =
+          trv::calc_shell_field_products(*shells_a, *shells_b, G_00);
+
+        for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
+          for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
+            int idx_dv = idx_row * params.num_bins + idx_col;
 
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+            if (count_terms == 0) {
+              k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
+              k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
+              k1eff_dv[idx_dv] = shells_a->k_eff[idx_row];
+              k2eff_dv[idx_dv] = shells_b->k_eff[idx_col];
+              nmodes1_dv[idx_dv] = shells_a->nmodes[idx_row];
+              nmodes2_dv[idx_dv] = shells_b->nmodes[idx_col];
+            }
 
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+            int ipair = idx_row * params.num_bins + idx_col;
+            bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+              bk_components[ipair], params.ell1 + params.ell2, self_mirrored
+            );
           }
         }
       }
 
       if (params.shape == "triu") {
+        // B_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+        std::vector<std::complex<double>> bk_components =
+          trv::calc_shell_field_products(*shells_a, *shells_b, G_00, true);
+
         for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
           for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
             int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
               + (idx_col - idx_row);
 
-            double k_lower_a = kbinning.bin_edges[idx_row];
-            double k_upper_a = kbinning.bin_edges[idx_row + 1];
-            double k_lower_b = kbinning.bin_edges[idx_col];
-            double k_upper_b = kbinning.bin_edges[idx_col + 1];
-
-            double k_eff_a_, k_eff_b_;
-            int nmodes_a_, nmodes_b_;
-
-            F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-            );
-            F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_00, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
-            );
-
             if (count_terms == 0) {
               k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
               k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
-              k1eff_dv[idx_dv] = k_eff_a_;
-              k2eff_dv[idx_dv] = k_eff_b_;
-              nmodes1_dv[idx_dv] = nmodes_a_;
-              nmodes2_dv[idx_dv] = nmodes_b_;
-            }
-
-            // B_{l₁ l₂ L}^{m₁ m₂ M}
-            double bk_comp_real = 0., bk_comp_imag = 0.;
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
-#endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
-              std::complex<double> F_lm_a_gridpt(
-                F_lm_a[gid][0], F_lm_a[gid][1]
-              );
-              std::complex<double> F_lm_b_gridpt(
-                F_lm_b[gid][0], F_lm_b[gid][1]
-              );
-              std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
-              std::complex<double> bk_gridpt =
-                F_lm_a_gridpt * F_lm_b_gridpt * G_00_gridpt;
-
-              bk_comp_real += bk_gridpt.real();
-              bk_comp_imag += bk_gridpt.imag();
+              k1eff_dv[idx_dv] = shells_a->k_eff[idx_row];
+              k2eff_dv[idx_dv] = shells_b->k_eff[idx_col];
+              nmodes1_dv[idx_dv] = shells_a->nmodes[idx_row];
+              nmodes2_dv[idx_dv] = shells_b->nmodes[idx_col];
             }
 
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+            int ipair = idx_row * params.num_bins + idx_col;
+            bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+              bk_components[ipair], params.ell1 + params.ell2, self_mirrored
+            );
           }
         }
       }
 
+      shells_b_.reset();
+      shells_a.reset();
+
       // ·································································
       // Shot noise
       // ·································································
@@ -1734,7 +2146,7 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
       // (L-invariant) for the line-of-sight spherical harmonic.
       // Also note the field is unweighted from simulation sources.
       std::complex<double> Sbar_LM =
-        double(catalogue_data.ntotal);  // \bar{S}_LM
+        double(catalogue_data.ntotal_global);  // \bar{S}_LM
       std::complex<double> Sbar_L0 = Sbar_LM;  // \bar{S}_L0
 
       if (params.ell1 == 0 && params.ell2 == 0) {
@@ -1753,8 +2165,9 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
         if (params.shape == "diag") {
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin = idx_dv;
-            sn_dv[idx_dv] += coupling * (
-              stats_sn.pk[ibin] - stats_sn.sn[ibin]
+            sn_dv[idx_dv] += coupling * add_mirrored_component(
+              stats_sn.pk[ibin] - stats_sn.sn[ibin],
+              params.ell1 + params.ell2, self_mirrored
             );
           }
         }
@@ -1767,15 +2180,17 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
             } else {
               ibin_row = idx_dv + std::abs(params.idx_bin);
             }
-            sn_dv[idx_dv] += coupling * (
-              stats_sn.pk[ibin_row] - stats_sn.sn[ibin_row]
+            sn_dv[idx_dv] += coupling * add_mirrored_component(
+              stats_sn.pk[ibin_row] - stats_sn.sn[ibin_row],
+              params.ell1 + params.ell2, self_mirrored
             );
           }
         }
 
         if (params.shape == "row") {
-          std::complex<double> sn_row_ = coupling * (
-            stats_sn.pk[params.idx_bin] - stats_sn.sn[params.idx_bin]
+          std::complex<double> sn_row_ = coupling * add_mirrored_component(
+            stats_sn.pk[params.idx_bin] - stats_sn.sn[params.idx_bin],
+            params.ell1 + params.ell2, self_mirrored
           );
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             sn_dv[idx_dv] += sn_row_;
@@ -1784,8 +2199,9 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 
         if (params.shape == "full") {
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-            std::complex<double> sn_row_ = coupling * (
-              stats_sn.pk[idx_row] - stats_sn.sn[idx_row]
+            std::complex<double> sn_row_ = coupling * add_mirrored_component(
+              stats_sn.pk[idx_row] - stats_sn.sn[idx_row],
+              params.ell1 + params.ell2, self_mirrored
             );
             for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
               int idx_dv = idx_row * params.num_bins + idx_col;
@@ -1796,8 +2212,9 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 
         if (params.shape == "triu") {
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-            std::complex<double> sn_row_ = coupling * (
-              stats_sn.pk[idx_row] - stats_sn.sn[idx_row]
+            std::complex<double> sn_row_ = coupling * add_mirrored_component(
+              stats_sn.pk[idx_row] - stats_sn.sn[idx_row],
+              params.ell1 + params.ell2, self_mirrored
             );
             for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
               int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
@@ -1817,8 +2234,9 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
         if (params.shape == "diag") {
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin = idx_dv;
-            sn_dv[idx_dv] += coupling * (
-              stats_sn.pk[ibin] - stats_sn.sn[ibin]
+            sn_dv[idx_dv] += coupling * add_mirrored_component(
+              stats_sn.pk[ibin] - stats_sn.sn[ibin],
+              params.ell1 + params.ell2, self_mirrored
             );
           }
         }
@@ -1831,8 +2249,9 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
             } else {
               ibin_col = idx_dv;
             }
-            sn_dv[idx_dv] += coupling * (
-              stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col]
+            sn_dv[idx_dv] += coupling * add_mirrored_component(
+              stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col],
+              params.ell1 + params.ell2, self_mirrored
             );
           }
         }
@@ -1840,16 +2259,18 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
         if (params.shape == "row") {
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin_col = idx_dv;
-            sn_dv[idx_dv] += coupling * (
-              stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col]
+            sn_dv[idx_dv] += coupling * add_mirrored_component(
+              stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col],
+              params.ell1 + params.ell2, self_mirrored
             );
           }
         }
 
         if (params.shape == "full") {
           for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-            std::complex<double> sn_col_ = coupling * (
-              stats_sn.pk[idx_col] - stats_sn.sn[idx_col]
+            std::complex<double> sn_col_ = coupling * add_mirrored_component(
+              stats_sn.pk[idx_col] - stats_sn.sn[idx_col],
+              params.ell1 + params.ell2, self_mirrored
             );
             for (int idx_row = 0; idx_row <= params.num_bins; idx_row++) {
               int idx_dv = idx_row * params.num_bins + idx_col;
@@ -1860,8 +2281,9 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
 
         if (params.shape == "triu") {
           for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-            std::complex<double> sn_col_ = coupling * (
-              stats_sn.pk[idx_col] - stats_sn.sn[idx_col]
+            std::complex<double> sn_col_ = coupling * add_mirrored_component(
+              stats_sn.pk[idx_col] - stats_sn.sn[idx_col],
+              params.ell1 + params.ell2, self_mirrored
             );
             for (int idx_row = 0; idx_row <= idx_col; idx_row++) {
               int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
@@ -1876,11 +2298,13 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
         double k_a = k1eff_dv[idx_dv];
         double k_b = k2eff_dv[idx_dv];
 
-        std::complex<double> S_ij_k = parity *
+        std::complex<double> S_ij_k = parity * add_mirrored_component(
           stats_sn.compute_uncoupled_shotnoise_for_bispec_per_bin(
-            dn_L0_for_sn, N_00, ylm_r_a, ylm_r_b, sj_a, sj_b,
-            Sbar_L0, k_a, k_b
-          );  // S|{i = j ≠ k}
+              dn_L0_for_sn, N_00, *ylm_r_a, m1_, *ylm_r_b, m2_, sj_a, sj_b,
+              Sbar_L0, k_a, k_b
+          ),
+          0, self_mirrored
+        );  // S|{i = j ≠ k}
 
         sn_dv[idx_dv] += coupling * S_ij_k;
       }
@@ -1917,10 +2341,6 @@ trv::BispecMeasurements compute_bispec_in_gpp_box(
   delete[] k1eff_dv; delete[] k2eff_dv;
   delete[] bk_dv; delete[] sn_dv;
 
-  trvs::count_cgrid -= 4;
-  trvs::count_grid -= 4;
-  trvs::gbytesMem -=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
 
   if (trvs::currTask == 0) {
     trvs::logger.stat(
@@ -2010,7 +2430,7 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute common field quantities.
-  MeshField dn_00(params, true, "`dn_00`");  // δn_00(k)
+  MeshField dn_00(params, true, "`dn_00`", true);  // δn_00(k)
   dn_00.compute_unweighted_field_fluctuations_insitu(catalogue_data);
   dn_00.fourier_transform();
 
@@ -2018,7 +2438,7 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
 
   double vol_cell = dn_00.vol_cell;
 
-  MeshField N_00(params, true, "`N_00`");  // N_00(k)
+  MeshField N_00(params, true, "`N_00`", true);  // N_00(k)
   N_00.compute_unweighted_field(catalogue_data);
   N_00.fourier_transform();
 
@@ -2026,18 +2446,36 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
   trvm::SphericalBesselCalculator sj_b(params.ell2);  // j_l_b
 
   FieldStats stats_sn(params);
+  MeshFieldPool pool(params);  // reused by fields in loops
+
+  // Plan storage strategies within the memory limit (if any).
+  trv::plan_memory_usage(params, catalogue_data.ntotal, 0);
+
+  // Set up reduced-spherical-harmonic weights on mesh grids, with
+  // all orders either stored in tables (possibly in single precision)
+  // or evaluated on the fly.
+  bool ylm_stored = (params.ylm_tables != "none");
+  bool ylm_single = (params.ylm_tables == "single");
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
 
-  // Initialise/reset spherical harmonic mesh grids.
-  std::vector< std::complex<double> > ylm_r_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_b(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_b(params.nmesh);
-  trvs::count_cgrid += 4;
-  trvs::count_grid += 4;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem +=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
-  trvs::update_maxmem();
+  // Terms at negated orders are added as mirrored components only if
+  // the fields are Hermitian at all wavevector modes.
+  const bool mirrored = if_mirrored_in_config(params);
 
   // Compute 3PCF terms including shot noise.
   int count_terms = 0;
@@ -2053,22 +2491,14 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
       );  // Wigner 3-j's
       if (std::fabs(coupling) < trvm::eps_coupling) {continue;}
 
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_r_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_r_b
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_k_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_k_b
-        );
+      // Only compute terms at orders with M = - m₁ - m₂ > 0, or M = 0
+      // and m₁ ≥ 0, if terms at negated orders are added as their
+      // mirrored components.
+      if (
+        mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+      ) {continue;}
+      bool self_mirrored = !mirrored || (m1_ == 0 && m2_ == 0);
+
 
       // ·································································
       // Shot noise
@@ -2078,17 +2508,18 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
       // (L-invariant) for the line-of-sight spherical harmonic.
       // Also note the field is unweighted from simulation sources.
       std::complex<double> Sbar_L0 =
-        double(catalogue_data.ntotal);  // \bar{S}_L0
+        double(catalogue_data.ntotal_global);  // \bar{S}_L0
 
       stats_sn.compute_uncoupled_shotnoise_for_3pcf(
-        dn_L0_for_sn, N_00, ylm_r_a, ylm_r_b, Sbar_L0, rbinning
+        dn_L0_for_sn, N_00, *ylm_r_a, m1_, *ylm_r_b, m2_, Sbar_L0, rbinning
       );  // S|{i = j ≠ k}
 
       // Enforce the Kronecker delta in eq. (51) in the Paper.
       if (params.shape == "diag") {
         for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
           int ibin = idx_dv;
-          sn_dv[idx_dv] += coupling * stats_sn.xi[ibin];
+          sn_dv[idx_dv] += coupling
+            * add_mirrored_component(stats_sn.xi[ibin], 0, self_mirrored);
         }
       }
 
@@ -2096,19 +2527,23 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
         // Note that ``idx_col == idx_row``.
         for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
           int ibin = idx_dv;
-          sn_dv[idx_dv] += coupling * stats_sn.xi[ibin];
+          sn_dv[idx_dv] += coupling
+            * add_mirrored_component(stats_sn.xi[ibin], 0, self_mirrored);
         }
       }
 
       if (params.shape == "row") {
-        sn_dv[params.idx_bin] += coupling * stats_sn.xi[params.idx_bin];
+        sn_dv[params.idx_bin] += coupling * add_mirrored_component(
+          stats_sn.xi[params.idx_bin], 0, self_mirrored
+        );
       }
 
       if (params.shape == "full") {
         for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
           // Note that ``idx_col == idx_row``.
           int idx_dv = idx_row * params.num_bins + idx_row;
-          sn_dv[idx_dv] += coupling * stats_sn.xi[idx_row];
+          sn_dv[idx_dv] += coupling
+            * add_mirrored_component(stats_sn.xi[idx_row], 0, self_mirrored);
         }
       }
 
@@ -2116,7 +2551,8 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
         for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
           // Note that ``idx_col == idx_row``.
           int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2;
-          sn_dv[idx_dv] += coupling * stats_sn.xi[idx_row];
+          sn_dv[idx_dv] += coupling
+            * add_mirrored_component(stats_sn.xi[idx_row], 0, self_mirrored);
         }
       }
 
@@ -2206,56 +2642,128 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
       // ·································································
 
       // Compute 3PCF components in eqs. (42), (48) & (49) in the Paper.
-      MeshField G_00(params, true, "`G_00`");  // G_00
+      MeshField G_00(params, pool, "`G_00`");  // G_00
       G_00.compute_unweighted_field_fluctuations_insitu(catalogue_data);
       G_00.fourier_transform();
       G_00.apply_assignment_compensation();
       G_00.inv_fourier_transform();
 
-      MeshField F_lm_a(params, true, "`F_lm_a`");  // F_lm_a
-      MeshField F_lm_b(params, true, "`F_lm_b`");  // F_lm_b
+      MeshField F_lm_a(params, pool, "`F_lm_a`");  // F_lm_a
+      MeshField F_lm_b(params, pool, "`F_lm_b`");  // F_lm_b
+
+      // Compute components at the orders and, unless they are all zero,
+      // at the negated orders with the same coupling coefficient.
+      // Spherical-Bessel-weighted fields are computed at both orders as
+      // wavevector modes on the Nyquist planes of the mesh grid are unpaired.
+      for (int imirror = 0; imirror < (self_mirrored ? 1 : 2); imirror++) {
+        int m1 = (imirror == 0) ? m1_ : - m1_;
+        int m2 = (imirror == 0) ? m2_ : - m2_;
+
+        // Cache spherical-Bessel-weighted fields in all separation shells
+        // for pairs of shells.
+        std::unique_ptr<ShellFieldCache> shells_a;   // F_lm_a shells
+        std::unique_ptr<ShellFieldCache> shells_b_;  // distinct F_lm_b shells
+        ShellFieldCache* shells_b = nullptr;         // F_lm_b shells
+        if (params.shape == "full" || params.shape == "triu") {
+          shells_a = std::make_unique<ShellFieldCache>(
+            params, rbinning.num_bins, "`F_lm_a` shells"
+          );
+          shells_a->compute_sjl_fields(
+            dn_00, *ylm_k_a, m1, sj_a, stats_sn.r, F_lm_a
+          );
+          if (params.ell1 == params.ell2 && m1 == m2) {
+            shells_b = shells_a.get();
+          } else {
+            shells_b_ = std::make_unique<ShellFieldCache>(
+              params, rbinning.num_bins, "`F_lm_b` shells"
+            );
+            shells_b = shells_b_.get();
+            shells_b->compute_sjl_fields(
+              dn_00, *ylm_k_b, m2, sj_b, stats_sn.r, F_lm_b
+            );
+          }
+        }
 
-      for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
-        double r_a = r1eff_dv[idx_dv];
-        F_lm_a.inv_fourier_transform_sjl_ylm_wgtd_field(
-          dn_00, ylm_k_a, sj_a, r_a
-        );
+        if (params.shape == "full" || params.shape == "triu") {
+          // ζ_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+          std::vector<std::complex<double>> zeta_components =
+            trv::calc_shell_field_products(
+              *shells_a, *shells_b, G_00, params.shape == "triu"
+            );
 
-        double r_b = r2eff_dv[idx_dv];
-        F_lm_b.inv_fourier_transform_sjl_ylm_wgtd_field(
-          dn_00, ylm_k_b, sj_b, r_b
-        );
+          for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
+            int idx_col_start = (params.shape == "triu") ? idx_row : 0;
+            for (
+              int idx_col = idx_col_start; idx_col < params.num_bins; idx_col++
+            ) {
+              int idx_dv = (params.shape == "full")
+                ? idx_row * params.num_bins + idx_col
+                : (2*params.num_bins - idx_row + 1) * idx_row / 2
+                  + (idx_col - idx_row);
+
+              int ipair = idx_row * params.num_bins + idx_col;
+              zeta_dv[idx_dv] +=
+                parity * coupling * vol_cell * zeta_components[ipair];
+            }
+          }
+        } else {
+          for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+            double r_a = r1eff_dv[idx_dv];
+            F_lm_a.inv_fourier_transform_sjl_ylm_wgtd_field(
+              dn_00, *ylm_k_a, m1, sj_a, r_a
+            );
+
+            double r_b = r2eff_dv[idx_dv];
+            F_lm_b.inv_fourier_transform_sjl_ylm_wgtd_field(
+              dn_00, *ylm_k_b, m2, sj_b, r_b
+            );
 
-        // ζ_{l₁ l₂ L}^{m₁ m₂ M}
-        double zeta_comp_real = 0., zeta_comp_imag = 0.;
+            // ζ_{l₁ l₂ L}^{m₁ m₂ M}
+            double zeta_comp_real = 0., zeta_comp_imag = 0.;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:zeta_comp_real, zeta_comp_imag)
 #endif  // TRV_USE_OMP
-        for (long long gid = 0; gid < params.nmesh; gid++) {
-          std::complex<double> F_lm_a_gridpt(F_lm_a[gid][0], F_lm_a[gid][1]);
-          std::complex<double> F_lm_b_gridpt(F_lm_b[gid][0], F_lm_b[gid][1]);
-          std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
-          std::complex<double> zeta_gridpt =
-            F_lm_a_gridpt * F_lm_b_gridpt * G_00_gridpt;
+            for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
+              std::complex<double> F_lm_a_gridpt(
+                F_lm_a[gid][0], F_lm_a[gid][1]
+              );
+              std::complex<double> F_lm_b_gridpt(
+                F_lm_b[gid][0], F_lm_b[gid][1]
+              );
+              std::complex<double> G_00_gridpt(G_00[gid][0], G_00[gid][1]);
+              std::complex<double> zeta_gridpt =
+                F_lm_a_gridpt * F_lm_b_gridpt * G_00_gridpt;
+
+              zeta_comp_real += zeta_gridpt.real();
+              zeta_comp_imag += zeta_gridpt.imag();
+            }
+
+            // Sum contributions from all slabs.
+            double zeta_comp[2] = {zeta_comp_real, zeta_comp_imag};
+            trvs::allreduce_sum(zeta_comp, 2);
 
-          zeta_comp_real += zeta_gridpt.real();
-          zeta_comp_imag += zeta_gridpt.imag();
+            std::complex<double> zeta_component(
+              zeta_comp[0], zeta_comp[1]
+            );
+
+            zeta_dv[idx_dv] += parity * coupling * vol_cell * zeta_component;
+          }
         }
 
-        std::complex<double> zeta_component(zeta_comp_real, zeta_comp_imag);
+        shells_b_.reset();
+        shells_a.reset();
 
-        zeta_dv[idx_dv] += parity * coupling * vol_cell * zeta_component;
+        if (trvs::currTask == 0) {
+          trvs::logger.stat(
+            "Three-point correlation function term computed at orders "
+            "(m1, m2, M) = (%d, %d, 0).",
+              m1, m2
+          );
+        }
       }
 
       count_terms++;
-      if (trvs::currTask == 0) {
-        trvs::logger.stat(
-          "Three-point correlation function term computed at orders "
-          "(m1, m2, M) = (%d, %d, 0).",
-          m1_, m2_
-        );
-      }
     }
   }
 
@@ -2281,10 +2789,6 @@ trv::ThreePCFMeasurements compute_3pcf_in_gpp_box(
   delete[] r1eff_dv; delete[] r2eff_dv;
   delete[] zeta_dv; delete[] sn_dv;
 
-  trvs::count_cgrid -= 4;
-  trvs::count_grid -= 4;
-  trvs::gbytesMem -=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
 
   if (trvs::currTask == 0) {
     trvs::logger.stat(
@@ -2377,13 +2881,13 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute common field quantities.
-  MeshField n_00(params, true, "`n_00`");  // n_00(k)
+  MeshField n_00(params, true, "`n_00`", true);  // n_00(k)
   n_00.compute_ylm_wgtd_field(catalogue_rand, los_rand, alpha, 0, 0);
   n_00.fourier_transform();
 
   double vol_cell = n_00.vol_cell;
 
-  MeshField N_00(params, true, "`N_00`");  // N_00(k)
+  MeshField N_00(params, true, "`N_00`", true);  // N_00(k)
   N_00.compute_ylm_wgtd_quad_field(catalogue_rand, los_rand, alpha, 0, 0);
   N_00.fourier_transform();
 
@@ -2391,18 +2895,36 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
   trvm::SphericalBesselCalculator sj_b(params.ell2);  // j_l_b
 
   FieldStats stats_sn(params);
+  MeshFieldPool pool(params);  // reused by fields in loops
+
+  // Plan storage strategies within the memory limit (if any).
+  trv::plan_memory_usage(params, 0, catalogue_rand.ntotal);
+
+  // Set up reduced-spherical-harmonic weights on mesh grids, with
+  // all orders either stored in tables (possibly in single precision)
+  // or evaluated on the fly.
+  bool ylm_stored = (params.ylm_tables != "none");
+  bool ylm_single = (params.ylm_tables == "single");
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
 
-  // Initialise reduced-spherical-harmonic weights on mesh grids.
-  std::vector< std::complex<double> > ylm_r_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_b(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_b(params.nmesh);
-  trvs::count_cgrid += 4;
-  trvs::count_grid += 4;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem +=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
-  trvs::update_maxmem();
+  // Terms at negated orders are added as mirrored components only if
+  // the fields are Hermitian at all wavevector modes.
+  const bool mirrored = if_mirrored_in_config(params);
 
   // Compute 3PCF window terms including shot noise.
   int count_terms = 0;
@@ -2422,22 +2944,14 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
       }
       if (flag_vanishing == "true") {continue;}
 
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_r_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_r_b
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_k_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_k_b
-        );
+      // Only compute terms at orders with M = - m₁ - m₂ > 0, or M = 0
+      // and m₁ ≥ 0, if terms at negated orders are added as their
+      // mirrored components.
+      if (
+        mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+      ) {continue;}
+      bool self_mirrored = !mirrored || (m1_ == 0 && m2_ == 0);
+
 
       for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
         // Calculate the coupling coefficient.
@@ -2451,7 +2965,7 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
         // ·······························································
 
         // Compute shot noise components in eq. (51) in the Paper.
-        MeshField n_LM_for_sn(params, true, "`n_LM_for_sn`");  // δn_LM(k)
+        MeshField n_LM_for_sn(params, pool, "`n_LM_for_sn`");  // δn_LM(k)
                                                                // (for
                                                                // shot noise)
         n_LM_for_sn.compute_ylm_wgtd_field(
@@ -2464,14 +2978,15 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
         );  // \bar{S}_LM
 
         stats_sn.compute_uncoupled_shotnoise_for_3pcf(
-          n_LM_for_sn, N_00, ylm_r_a, ylm_r_b, Sbar_LM, rbinning
+          n_LM_for_sn, N_00, *ylm_r_a, m1_, *ylm_r_b, m2_, Sbar_LM, rbinning
         );  // S|{i = j ≠ k}
 
         // Enforce the Kronecker delta in eq. (51) in the Paper.
         if (params.shape == "diag") {
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin = idx_dv;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[ibin];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[ibin], 0, self_mirrored);
           }
         }
 
@@ -2479,19 +2994,23 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
           // Note that ``idx_col == idx_row``.
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
             int ibin = idx_dv;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[ibin];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[ibin], 0, self_mirrored);
           }
         }
 
         if (params.shape == "row") {
-          sn_dv[params.idx_bin] += coupling * stats_sn.xi[params.idx_bin];
+          sn_dv[params.idx_bin] += coupling * add_mirrored_component(
+            stats_sn.xi[params.idx_bin], 0, self_mirrored
+          );
         }
 
         if (params.shape == "full") {
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
             // Note that ``idx_col == idx_row``.
             int idx_dv = idx_row * params.num_bins + idx_row;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[idx_row];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[idx_row], 0, self_mirrored);
           }
         }
 
@@ -2499,7 +3018,8 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
             // Note that ``idx_col == idx_row``.
             int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2;
-            sn_dv[idx_dv] += coupling * stats_sn.xi[idx_row];
+            sn_dv[idx_dv] += coupling
+              * add_mirrored_component(stats_sn.xi[idx_row], 0, self_mirrored);
           }
         }
 
@@ -2588,7 +3108,7 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
         // ·······························································
 
         // Compute 3PCF components in eqs. (42), (48) & (49) in the Paper.
-        MeshField G_LM(params, true, "`G_LM`");  // G_LM
+        MeshField G_LM(params, pool, "`G_LM`");  // G_LM
         G_LM.compute_ylm_wgtd_field(
           catalogue_rand, los_rand, alpha, params.ELL, M_
         );
@@ -2601,50 +3121,127 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
           G_LM.apply_wide_angle_pow_law_kernel();
         }
 
-        MeshField F_lm_a(params, true, "`F_lm_a`");  // F_lm_a
-        MeshField F_lm_b(params, true, "`F_lm_b`");  // F_lm_b
+        MeshField F_lm_a(params, pool, "`F_lm_a`");  // F_lm_a
+        MeshField F_lm_b(params, pool, "`F_lm_b`");  // F_lm_b
+
+        // Compute components at the orders and, unless they are all zero,
+        // at the negated orders with the same coupling coefficient, where
+        // G_LM at the negated order is obtained in place.  Unlike G_LM,
+        // spherical-Bessel-weighted fields are computed at both orders as
+        // wavevector modes on the Nyquist planes of the mesh grid are unpaired.
+        for (int imirror = 0; imirror < (self_mirrored ? 1 : 2); imirror++) {
+          int m1 = (imirror == 0) ? m1_ : - m1_;
+          int m2 = (imirror == 0) ? m2_ : - m2_;
+          int M = (imirror == 0) ? M_ : - M_;
+          if (imirror == 1) {G_LM.apply_order_negation(M_);}
+
+          // Cache spherical-Bessel-weighted fields in all separation shells
+          // for pairs of shells.
+          std::unique_ptr<ShellFieldCache> shells_a;   // F_lm_a shells
+          std::unique_ptr<ShellFieldCache> shells_b_;  // distinct F_lm_b shells
+          ShellFieldCache* shells_b = nullptr;         // F_lm_b shells
+          if (params.shape == "full" || params.shape == "triu") {
+            shells_a = std::make_unique<ShellFieldCache>(
+              params, rbinning.num_bins, "`F_lm_a` shells"
+            );
+            shells_a->compute_sjl_fields(
+              n_00, *ylm_k_a, m1, sj_a, stats_sn.r, F_lm_a
+            );
+            if (params.ell1 == params.ell2 && m1 == m2) {
+              shells_b = shells_a.get();
+            } else {
+              shells_b_ = std::make_unique<ShellFieldCache>(
+                params, rbinning.num_bins, "`F_lm_b` shells"
+              );
+              shells_b = shells_b_.get();
+              shells_b->compute_sjl_fields(
+                n_00, *ylm_k_b, m2, sj_b, stats_sn.r, F_lm_b
+              );
+            }
+          }
 
-        for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
-          double r_a = r1eff_dv[idx_dv];
-          F_lm_a.inv_fourier_transform_sjl_ylm_wgtd_field(
-            n_00, ylm_k_a, sj_a, r_a
-          );
+          if (params.shape == "full" || params.shape == "triu") {
+            // ζ_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+            std::vector<std::complex<double>> zeta_components =
+              trv::calc_shell_field_products(
+                *shells_a, *shells_b, G_LM, params.shape == "triu"
+              );
 
-          double r_b = r2eff_dv[idx_dv];
-          F_lm_b.inv_fourier_transform_sjl_ylm_wgtd_field(
-            n_00, ylm_k_b, sj_b, r_b
-          );
+            for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
+              int idx_col_start = (params.shape == "triu") ? idx_row : 0;
+              for (
+                int idx_col = idx_col_start;
+                idx_col < params.num_bins;
+                idx_col++
+              ) {
+                int idx_dv = (params.shape == "full")
+                  ? idx_row * params.num_bins + idx_col
+                  : (2*params.num_bins - idx_row + 1) * idx_row / 2
+                    + (idx_col - idx_row);
+
+                int ipair = idx_row * params.num_bins + idx_col;
+                zeta_dv[idx_dv] +=
+                  parity * coupling * vol_cell * zeta_components[ipair];
+              }
+            }
+          } else {
+            for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
+              double r_a = r1eff_dv[idx_dv];
+              F_lm_a.inv_fourier_transform_sjl_ylm_wgtd_field(
+                n_00, *ylm_k_a, m1, sj_a, r_a
+              );
 
-          // ζ_{l₁ l₂ L}^{m₁ m₂ M}
-          double zeta_comp_real = 0., zeta_comp_imag = 0.;
+              double r_b = r2eff_dv[idx_dv];
+              F_lm_b.inv_fourier_transform_sjl_ylm_wgtd_field(
+                n_00, *ylm_k_b, m2, sj_b, r_b
+              );
+
+              // ζ_{l₁ l₂ L}^{m₁ m₂ M}
+              double zeta_comp_real = 0., zeta_comp_imag = 0.;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:zeta_comp_real, zeta_comp_imag)
 #endif  // TRV_USE_OMP
-          for (long long gid = 0; gid < params.nmesh; gid++) {
-            std::complex<double> F_lm_a_gridpt(F_lm_a[gid][0], F_lm_a[gid][1]);
-            std::complex<double> F_lm_b_gridpt(F_lm_b[gid][0], F_lm_b[gid][1]);
-            std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-            std::complex<double> zeta_gridpt =
-              F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
+              for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
+                std::complex<double> F_lm_a_gridpt(
+                  F_lm_a[gid][0], F_lm_a[gid][1]
+                );
+                std::complex<double> F_lm_b_gridpt(
+                  F_lm_b[gid][0], F_lm_b[gid][1]
+                );
+                std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
+                std::complex<double> zeta_gridpt =
+                  F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
+
+                zeta_comp_real += zeta_gridpt.real();
+                zeta_comp_imag += zeta_gridpt.imag();
+              }
+
+              // Sum contributions from all slabs.
+              double zeta_comp[2] = {zeta_comp_real, zeta_comp_imag};
+              trvs::allreduce_sum(zeta_comp, 2);
+
+              std::complex<double> zeta_component(
+                zeta_comp[0], zeta_comp[1]
+              );
 
-            zeta_comp_real += zeta_gridpt.real();
-            zeta_comp_imag += zeta_gridpt.imag();
+              zeta_dv[idx_dv] += parity * coupling * vol_cell * zeta_component;
+            }
           }
 
-          std::complex<double> zeta_component(zeta_comp_real, zeta_comp_imag);
+          shells_b_.reset();
+          shells_a.reset();
 
-          zeta_dv[idx_dv] += parity * coupling * vol_cell * zeta_component;
+          if (trvs::currTask == 0) {
+            trvs::logger.stat(
+              "Three-point correlation function window term computed at orders "
+              "(m1, m2, M) = (%d, %d, %d).",
+              m1, m2, M
+            );
+          }
         }
 
         count_terms++;
-        if (trvs::currTask == 0) {
-          trvs::logger.stat(
-            "Three-point correlation function window term computed at orders "
-            "(m1, m2, M) = (%d, %d, %d).",
-            m1_, m2_, M_
-          );
-        }
       }
     }
   }
@@ -2671,10 +3268,6 @@ trv::ThreePCFWindowMeasurements compute_3pcf_window(
   delete[] r1eff_dv; delete[] r2eff_dv;
   delete[] zeta_dv; delete[] sn_dv;
 
-  trvs::count_cgrid -= 4;
-  trvs::count_grid -= 4;
-  trvs::gbytesMem -=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
 
   if (trvs::currTask == 0) {
     trvs::logger.stat(
@@ -2804,18 +3397,36 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
   trvm::SphericalBesselCalculator sj_b(params.ell2);  // j_l_b
 
   FieldStats stats_sn(params);
+  MeshFieldPool pool(params);  // reused by fields in loops
+
+  // Plan storage strategies within the memory limit (if any).
+  trv::plan_memory_usage(params, catalogue_data.ntotal, catalogue_rand.ntotal);
+
+  // Set up reduced-spherical-harmonic weights on mesh grids, with
+  // all orders either stored in tables (possibly in single precision)
+  // or evaluated on the fly.
+  bool ylm_stored = (params.ylm_tables != "none");
+  bool ylm_single = (params.ylm_tables == "single");
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, true, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_a =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell1, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_r_b =
+    trvm::SphericalHarmonicTable::ret_shared(
+      params.ell2, false, params.boxsize, params.ngrid, ylm_stored, ylm_single
+    );
 
-  // Initialise reduced-spherical-harmonic weights on mesh grids.
-  std::vector< std::complex<double> > ylm_k_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_k_b(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_a(params.nmesh);
-  std::vector< std::complex<double> > ylm_r_b(params.nmesh);
-  trvs::count_cgrid += 4;
-  trvs::count_grid += 4;
-  trvs::update_maxcntgrid();
-  trvs::gbytesMem +=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
-  trvs::update_maxmem();
+  // Terms at negated orders are added as mirrored components only if
+  // no wavevector modes on the Nyquist planes are binned.
+  const bool mirrored = if_mirrored_in_fourier(params, kbinning.bin_max);
 
   // Compute bispectrum terms.
   int count_terms = 0;
@@ -2834,22 +3445,14 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
       }
       if (flag_vanishing == "true") {continue;}
 
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_k_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_fourier_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_k_b
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell1, m1_, params.boxsize, params.ngrid, ylm_r_a
-        );
-      trvm::SphericalHarmonicCalculator::
-        store_reduced_spherical_harmonic_in_config_space(
-          params.ell2, m2_, params.boxsize, params.ngrid, ylm_r_b
-        );
+      // Only compute terms at orders with M = - m₁ - m₂ > 0, or M = 0
+      // and m₁ ≥ 0, if terms at negated orders are added as their
+      // mirrored components.
+      if (
+        mirrored && (m1_ + m2_ > 0 || (m1_ + m2_ == 0 && m1_ < 0))
+      ) {continue;}
+      bool self_mirrored = !mirrored || (m1_ == 0 && m2_ == 0);
+
 
       for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
         // Calculate the coupling coefficient.
@@ -2863,7 +3466,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         // ·······························································
 
         // Compute bispectrum components in eqs. (41) & (42) in the Paper.
-        MeshField dn_LM_a(params, true, "`dn_LM_a`");  // δn_LM_a
+        MeshField dn_LM_a(params, pool, "`dn_LM_a`");  // δn_LM_a
         if (los_choice == 0) {
           dn_LM_a.compute_ylm_wgtd_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -2877,7 +3480,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         }
         dn_LM_a.fourier_transform();
 
-        MeshField dn_LM_b(params, true, "`dn_LM_b`");  // δn_LM_b
+        MeshField dn_LM_b(params, pool, "`dn_LM_b`");  // δn_LM_b
         if (los_choice == 1) {
           dn_LM_b.compute_ylm_wgtd_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -2891,7 +3494,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         }
         dn_LM_b.fourier_transform();
 
-        MeshField G_LM(params, true, "`G_LM`");  // G_LM
+        MeshField G_LM(params, pool, "`G_LM`");  // G_LM
         if (los_choice == 2) {
           G_LM.compute_ylm_wgtd_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -2909,8 +3512,28 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 
         double vol_cell = G_LM.vol_cell;
 
-        MeshField F_lm_a(params, true, "`F_lm_a`");  // F_lm_a
-        MeshField F_lm_b(params, true, "`F_lm_b`");  // F_lm_b
+        MeshField F_lm_a(params, pool, "`F_lm_a`");  // F_lm_a
+        MeshField F_lm_b(params, pool, "`F_lm_b`");  // F_lm_b
+
+        // Cache band-limited fields in all shells for pairs of shells.
+        std::unique_ptr<ShellFieldCache> shells_a;   // F_lm_a shells
+        std::unique_ptr<ShellFieldCache> shells_b_;  // distinct F_lm_b shells
+        ShellFieldCache* shells_b = nullptr;         // F_lm_b shells
+        if (params.shape == "full" || params.shape == "triu") {
+          shells_a = std::make_unique<ShellFieldCache>(
+            params, kbinning.num_bins, "`F_lm_a` shells"
+          );
+          shells_a->compute_shell_fields(
+            dn_LM_a, *ylm_k_a, m1_, kbinning, F_lm_a
+          );
+          shells_b_ = std::make_unique<ShellFieldCache>(
+            params, kbinning.num_bins, "`F_lm_b` shells"
+          );
+          shells_b = shells_b_.get();
+          shells_b->compute_shell_fields(
+            dn_LM_b, *ylm_k_b, m2_, kbinning, F_lm_a
+          );
+        }
 
         if (params.shape == "diag") {
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
@@ -2923,10 +3546,10 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
             int nmodes_a_, nmodes_b_;
 
             F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_LM_a, ylm_k_a, k_lower, k_upper, k_eff_a_, nmodes_a_
+              dn_LM_a, *ylm_k_a, m1_, k_lower, k_upper, k_eff_a_, nmodes_a_
             );
             F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_LM_b, ylm_k_b, k_lower, k_upper, k_eff_b_, nmodes_b_
+              dn_LM_b, *ylm_k_b, m2_, k_lower, k_upper, k_eff_b_, nmodes_b_
             );
 
             if (count_terms == 0) {
@@ -2944,7 +3567,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
+            for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
               std::complex<double> F_lm_a_gridpt(
                 F_lm_a[gid][0], F_lm_a[gid][1]
               );
@@ -2959,9 +3582,15 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
               bk_comp_imag += bk_gridpt.imag();
             }
 
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+            // Sum contributions from all slabs.
+            double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+            trvs::allreduce_sum(bk_comp, 2);
 
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+            std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
+
+            bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+              bk_component, params.ell1 + params.ell2, self_mirrored
+            );
           }
         }
 
@@ -2985,10 +3614,10 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
             int nmodes_a_, nmodes_b_;
 
             F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_LM_a, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
+              dn_LM_a, *ylm_k_a, m1_, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
             );
             F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_LM_b, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
+              dn_LM_b, *ylm_k_b, m2_, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
             );
 
             if (count_terms == 0) {
@@ -3006,7 +3635,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
+            for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
               std::complex<double> F_lm_a_gridpt(
                 F_lm_a[gid][0], F_lm_a[gid][1]
               );
@@ -3021,9 +3650,15 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
               bk_comp_imag += bk_gridpt.imag();
             }
 
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+            // Sum contributions from all slabs.
+            double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+            trvs::allreduce_sum(bk_comp, 2);
 
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+            std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
+
+            bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+              bk_component, params.ell1 + params.ell2, self_mirrored
+            );
           }
         }
 
@@ -3037,7 +3672,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
           int nmodes_a_;
 
           F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-            dn_LM_a, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
+            dn_LM_a, *ylm_k_a, m1_, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
           );
 
           for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
@@ -3050,7 +3685,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
             int nmodes_b_;
 
             F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-              dn_LM_b, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
+              dn_LM_b, *ylm_k_b, m2_, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
             );
 
             if (count_terms == 0) {
@@ -3068,7 +3703,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
 #endif  // TRV_USE_OMP
-            for (long long gid = 0; gid < params.nmesh; gid++) {
+            for (long long gid = 0; gid < F_lm_a.nmesh_local; gid++) {
               std::complex<double> F_lm_a_gridpt(
                 F_lm_a[gid][0], F_lm_a[gid][1]
               );
@@ -3083,133 +3718,80 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
               bk_comp_imag += bk_gridpt.imag();
             }
 
-            std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
+            // Sum contributions from all slabs.
+            double bk_comp[2] = {bk_comp_real, bk_comp_imag};
+            trvs::allreduce_sum(bk_comp, 2);
 
-            bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+            std::complex<double> bk_component(bk_comp[0], bk_comp[1]);
+
+            bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+              bk_component, params.ell1 + params.ell2, self_mirrored
+            );
           }
         }
 
         if (params.shape == "full") {
+          // B_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+          std::vector<std::complex<double>> bk_components =
+            trv::calc_shell_field_products(*shells_a, *shells_b, G_LM);
+
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
             for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
               int idx_dv = idx_row * params.num_bins + idx_col;
 
-              double k_lower_a = kbinning.bin_edges[idx_row];
-              double k_upper_a = kbinning.bin_edges[idx_row + 1];
-              double k_lower_b = kbinning.bin_edges[idx_col];
-              double k_upper_b = kbinning.bin_edges[idx_col + 1];
-
-              double k_eff_a_, k_eff_b_;
-              int nmodes_a_, nmodes_b_;
-
-              F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_LM_a, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-              );
-              F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_LM_b, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
-              );
-
               if (count_terms == 0) {
                 k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
                 k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
-                k1eff_dv[idx_dv] = k_eff_a_;
-                k2eff_dv[idx_dv] = k_eff_b_;
-                nmodes1_dv[idx_dv] = nmodes_a_;
-                nmodes2_dv[idx_dv] = nmodes_b_;
-              }
-
-              // B_{l₁ l₂ L}^{m₁ m₂ M}
-              double bk_comp_real = 0., bk_comp_imag = 0.;
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
-#endif  // TRV_USE_OMP
-              for (long long gid = 0; gid < params.nmesh; gid++) {
-                std::complex<double> F_lm_a_gridpt(
-                  F_lm_a[gid][0], F_lm_a[gid][1]
-                );
-                std::complex<double> F_lm_b_gridpt(
-                  F_lm_b[gid][0], F_lm_b[gid][1]
-                );
-                std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-                std::complex<double> bk_gridpt =
-                  F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
-
-                bk_comp_real += bk_gridpt.real();
-                bk_comp_imag += bk_gridpt.imag();
+                k1eff_dv[idx_dv] = shells_a->k_eff[idx_row];
+                k2eff_dv[idx_dv] = shells_b->k_eff[idx_col];
+                nmodes1_dv[idx_dv] = shells_a->nmodes[idx_row];
+                nmodes2_dv[idx_dv] = shells_b->nmodes[idx_col];
               }
 
-              std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-              bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+              int ipair = idx_row * params.num_bins + idx_col;
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_components[ipair], params.ell1 + params.ell2, self_mirrored
+              );
             }
           }
         }
 
         if (params.shape == "triu") {
+          // B_{l₁ l₂ L}^{m₁ m₂ M} in all pairs of shells
+          std::vector<std::complex<double>> bk_components =
+            trv::calc_shell_field_products(*shells_a, *shells_b, G_LM, true);
+
           for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
             for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
               int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
                 + (idx_col - idx_row);
 
-              double k_lower_a = kbinning.bin_edges[idx_row];
-              double k_upper_a = kbinning.bin_edges[idx_row + 1];
-              double k_lower_b = kbinning.bin_edges[idx_col];
-              double k_upper_b = kbinning.bin_edges[idx_col + 1];
-
-              double k_eff_a_, k_eff_b_;
-              int nmodes_a_, nmodes_b_;
-
-              F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_LM_a, ylm_k_a, k_lower_a, k_upper_a, k_eff_a_, nmodes_a_
-              );
-              F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
-                dn_LM_b, ylm_k_b, k_lower_b, k_upper_b, k_eff_b_, nmodes_b_
-              );
-
               if (count_terms == 0) {
                 k1bin_dv[idx_dv] = kbinning.bin_centres[idx_row];
                 k2bin_dv[idx_dv] = kbinning.bin_centres[idx_col];
-                k1eff_dv[idx_dv] = k_eff_a_;
-                k2eff_dv[idx_dv] = k_eff_b_;
-                nmodes1_dv[idx_dv] = nmodes_a_;
-                nmodes2_dv[idx_dv] = nmodes_b_;
-              }
-
-              // B_{l₁ l₂ L}^{m₁ m₂ M}
-              double bk_comp_real = 0., bk_comp_imag = 0.;
-
-#ifdef TRV_USE_OMP
-#pragma omp parallel for reduction(+:bk_comp_real, bk_comp_imag)
-#endif  // TRV_USE_OMP
-              for (long long gid = 0; gid < params.nmesh; gid++) {
-                std::complex<double> F_lm_a_gridpt(
-                  F_lm_a[gid][0], F_lm_a[gid][1]
-                );
-                std::complex<double> F_lm_b_gridpt(
-                  F_lm_b[gid][0], F_lm_b[gid][1]
-                );
-                std::complex<double> G_LM_gridpt(G_LM[gid][0], G_LM[gid][1]);
-                std::complex<double> bk_gridpt =
-                  F_lm_a_gridpt * F_lm_b_gridpt * G_LM_gridpt;
-
-                bk_comp_real += bk_gridpt.real();
-                bk_comp_imag += bk_gridpt.imag();
+                k1eff_dv[idx_dv] = shells_a->k_eff[idx_row];
+                k2eff_dv[idx_dv] = shells_b->k_eff[idx_col];
+                nmodes1_dv[idx_dv] = shells_a->nmodes[idx_row];
+                nmodes2_dv[idx_dv] = shells_b->nmodes[idx_col];
               }
 
-              std::complex<double> bk_component(bk_comp_real, bk_comp_imag);
-
-              bk_dv[idx_dv] += coupling * vol_cell * bk_component;
+              int ipair = idx_row * params.num_bins + idx_col;
+              bk_dv[idx_dv] += coupling * vol_cell * add_mirrored_component(
+                bk_components[ipair], params.ell1 + params.ell2, self_mirrored
+              );
             }
           }
         }
 
+        shells_b_.reset();
+        shells_a.reset();
+
         // ·······························································
         // Shot noise
         // ·······························································
 
         // Compute shot noise components in eqs. (45) & (46) in the Paper.
-        MeshField dn_LM_a_for_sn(params, true, "`dn_LM_a_for_sn`");  // δn_LM_a(k)
+        MeshField dn_LM_a_for_sn(params, pool, "`dn_LM_a_for_sn`");  // δn_LM_a(k)
                                                                // (for shot
                                                                // noise)
         if (los_choice == 0) {
@@ -3225,7 +3807,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         }
         dn_LM_a_for_sn.fourier_transform();
 
-        MeshField dn_LM_b_for_sn(params, true, "`dn_LM_b_for_sn`");  // δn_LM_b(k)
+        MeshField dn_LM_b_for_sn(params, pool, "`dn_LM_b_for_sn`");  // δn_LM_b(k)
                                                                // (for shot
                                                                // noise)
         if (los_choice == 1) {
@@ -3242,7 +3824,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         dn_LM_b_for_sn.fourier_transform();
 
         // δn_LM_c(k) (for shot noise)
-        MeshField dn_LM_c_for_sn(params, true, "`dn_LM_c_for_sn`");
+        MeshField dn_LM_c_for_sn(params, pool, "`dn_LM_c_for_sn`");
         if (los_choice == 2) {
           dn_LM_c_for_sn.compute_ylm_wgtd_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -3256,7 +3838,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         }
         dn_LM_c_for_sn.fourier_transform();
 
-        MeshField N_LM_a(params, true, "`N_LM_a`");  // N_LM_a(k)
+        MeshField N_LM_a(params, pool, "`N_LM_a`");  // N_LM_a(k)
         if (los_choice == 0) {
           N_LM_a.compute_ylm_wgtd_quad_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -3270,7 +3852,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         }
         N_LM_a.fourier_transform();
 
-        MeshField N_LM_b(params, true, "`N_LM_b`");  // N_LM_b(k)
+        MeshField N_LM_b(params, pool, "`N_LM_b`");  // N_LM_b(k)
         if (los_choice == 1) {
           N_LM_b.compute_ylm_wgtd_quad_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -3284,7 +3866,7 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
         }
         N_LM_b.fourier_transform();
 
-        MeshField N_LM_c(params, true, "`N_LM_c`");  // N_LM_c(k)
+        MeshField N_LM_c(params, pool, "`N_LM_c`");  // N_LM_c(k)
         if (los_choice == 2) {
           N_LM_c.compute_ylm_wgtd_quad_field(
             catalogue_data, catalogue_rand, los_data, los_rand, alpha,
@@ -3321,8 +3903,9 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
           if (params.shape == "diag") {
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               int ibin = idx_dv;
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin] - stats_sn.sn[ibin]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin] - stats_sn.sn[ibin],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
@@ -3335,15 +3918,17 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
               } else {
                 ibin_row = idx_dv + std::abs(params.idx_bin);
               }
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin_row] - stats_sn.sn[ibin_row]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin_row] - stats_sn.sn[ibin_row],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
 
           if (params.shape == "row") {
-            std::complex<double> sn_row_ = coupling * (
-              stats_sn.pk[params.idx_bin] - stats_sn.sn[params.idx_bin]
+            std::complex<double> sn_row_ = coupling * add_mirrored_component(
+              stats_sn.pk[params.idx_bin] - stats_sn.sn[params.idx_bin],
+              params.ell1 + params.ell2, self_mirrored
             );
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               sn_dv[idx_dv] += sn_row_;
@@ -3352,8 +3937,9 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 
           if (params.shape == "full") {
             for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-              std::complex<double> sn_row_ = coupling * (
-                stats_sn.pk[idx_row] - stats_sn.sn[idx_row]
+              std::complex<double> sn_row_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_row] - stats_sn.sn[idx_row],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
                 int idx_dv = idx_row * params.num_bins + idx_col;
@@ -3364,8 +3950,9 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 
           if (params.shape == "triu") {
             for (int idx_row = 0; idx_row < params.num_bins; idx_row++) {
-              std::complex<double> sn_row_ = coupling * (
-                stats_sn.pk[idx_row] - stats_sn.sn[idx_row]
+              std::complex<double> sn_row_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_row] - stats_sn.sn[idx_row],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_col = idx_row; idx_col < params.num_bins; idx_col++) {
                 int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
@@ -3386,8 +3973,9 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
           if (params.shape == "diag") {
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               int ibin = idx_dv;
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin] - stats_sn.sn[ibin]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin] - stats_sn.sn[ibin],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
@@ -3400,8 +3988,9 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
               } else {
                 ibin_col = idx_dv;
               }
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
@@ -3409,16 +3998,18 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
           if (params.shape == "row") {
             for (int idx_dv = 0; idx_dv < dv_dim; idx_dv++) {
               int ibin_col = idx_dv;
-              sn_dv[idx_dv] += coupling * (
-                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col]
+              sn_dv[idx_dv] += coupling * add_mirrored_component(
+                stats_sn.pk[ibin_col] - stats_sn.sn[ibin_col],
+                params.ell1 + params.ell2, self_mirrored
               );
             }
           }
 
           if (params.shape == "full") {
             for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-              std::complex<double> sn_col_ = coupling * (
-                stats_sn.pk[idx_col] - stats_sn.sn[idx_col]
+              std::complex<double> sn_col_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_col] - stats_sn.sn[idx_col],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_row = 0; idx_row <= params.num_bins; idx_row++) {
                 int idx_dv = idx_row * params.num_bins + idx_col;
@@ -3429,8 +4020,9 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
 
           if (params.shape == "triu") {
             for (int idx_col = 0; idx_col < params.num_bins; idx_col++) {
-              std::complex<double> sn_col_ = coupling * (
-                stats_sn.pk[idx_col] - stats_sn.sn[idx_col]
+              std::complex<double> sn_col_ = coupling * add_mirrored_component(
+                stats_sn.pk[idx_col] - stats_sn.sn[idx_col],
+                params.ell1 + params.ell2, self_mirrored
               );
               for (int idx_row = 0; idx_row <= idx_col; idx_row++) {
                 int idx_dv = (2*params.num_bins - idx_row + 1) * idx_row / 2
@@ -3445,11 +4037,14 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
           double k_a = k1eff_dv[idx_dv];
           double k_b = k2eff_dv[idx_dv];
 
-          std::complex<double> S_ij_k = parity *
+          std::complex<double> S_ij_k = parity * add_mirrored_component(
             stats_sn.compute_uncoupled_shotnoise_for_bispec_per_bin(
-              dn_LM_c_for_sn, N_LM_c, ylm_r_a, ylm_r_b, sj_a, sj_b,
-              Sbar_LM, k_a, k_b
-            );  // S|{i = j ≠ k}
+                dn_LM_c_for_sn, N_LM_c, *ylm_r_a, m1_, *ylm_r_b, m2_,
+                sj_a, sj_b,
+                Sbar_LM, k_a, k_b
+            ),
+            0, self_mirrored
+          );  // S|{i = j ≠ k}
 
           sn_dv[idx_dv] += coupling * S_ij_k;
         }
@@ -3494,10 +4089,6 @@ trv::BispecMeasurements compute_bispec_for_los_choice(
   delete[] k1eff_dv; delete[] k2eff_dv;
   delete[] bk_dv; delete[] sn_dv;
 
-  trvs::count_cgrid -= 4;
-  trvs::count_grid -= 4;
-  trvs::gbytesMem -=
-    trvs::size_in_gb< std::complex<double> >(4*params.nmesh);
 
   if (trvs::currTask == 0) {
     trvs::logger.stat(
@@ -46,6 +46,50 @@ double calc_coupling_coeff_2pt(int ell, int ELL, int m, int M) {
     * trvm::wigner_3j(ell, 0, ELL, m, 0, M);
 }
 
+std::complex<double> add_mirrored_component(
+  std::complex<double> component, int ell_k, bool self_mirrored
+) {
+  if (self_mirrored) {return component;}
+
+  double parity = (ell_k % 2 == 0) ? 1. : -1.;
+
+  return component + parity * std::conj(component);
+}
+
+bool if_mirrored_in_fourier(trv::ParameterSet& params, double k_max) {
+  // CAVEAT: Discretionary choice of the margin as the fine wavenumber
+  // sample spacing in `FieldStats::compute_ylm_wgtd_2pt_stats_in_fourier`,
+  // since binned wavenumbers are rounded down to fine samples.
+  const double dk_margin = 1.e-5;
+
+  // Wavevector modes are unpaired from the wavenumber of the grid index
+  // ``ngrid/2`` (rounded down) along each axis, i.e. the Nyquist
+  // wavenumber for an even number of grid cells, or half a fundamental
+  // wavenumber below it for an odd number (see
+  // @ref trv::MeshField::get_grid_wavevector).
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    double k_unpaired =
+      2*M_PI * (params.ngrid[iaxis]/2) / params.boxsize[iaxis];
+    if (k_max > k_unpaired - dk_margin) {return false;}
+  }
+
+  return true;
+}
+
+bool if_mirrored_in_config(trv::ParameterSet& params) {
+  // Inverse Fourier transforms sum over all wavevector modes, including
+  // those without negated counterparts on the mesh grid, where neither
+  // the interlacing phase nor, for an odd number of grid cells,
+  // the assignment window is Hermitian.
+  if (params.interlace == "true") {return false;}
+
+  for (int iaxis = 0; iaxis < 3; iaxis++) {
+    if (params.ngrid[iaxis] % 2 != 0) {return false;}
+  }
+
+  return true;
+}
+
 
 // ***********************************************************************
 // Normalisation
@@ -66,11 +110,13 @@ double calc_powspec_normalisation_from_particles(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd reduction(+:norm)
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
+  for (int pid = 0; pid < particles.ntotal_owned; pid++) {
     norm += particles[pid].ws
       * particles[pid].nz * std::pow(particles[pid].wc, 2);
   }
 
+  trvs::allreduce_sum(&norm, 1);
+
   if (norm == 0.) {
     if (trvs::currTask == 0) {
       trvs::logger.error(
@@ -92,7 +138,11 @@ double calc_powspec_normalisation_from_particles(
 double calc_powspec_normalisation_from_mesh(
   trv::ParticleCatalogue& particles, trv::ParameterSet& params, double alpha
 ) {
-  trv::MeshField catalogue_mesh(params, false, "`catalogue_mesh`");
+  // The normalisation is always computed in double precision.
+  trv::ParameterSet params_norm = params;
+  params_norm.precision = "double";
+
+  trv::MeshField catalogue_mesh(params_norm, false, "`catalogue_mesh`");
 
   double norm_factor =
     catalogue_mesh.calc_grid_based_powlaw_norm(particles, 2);
@@ -107,9 +157,13 @@ double calc_powspec_normalisation_from_meshes(
   trv::ParticleCatalogue& particles_rand,
   trv::ParameterSet& params, double alpha
 ) {
-  // Assign particles to mesh.
-  trv::MeshField mesh_data(params, false, "`mesh_data`");
-  trv::MeshField mesh_rand(params, false, "`mesh_rand`");
+  // Assign particles to mesh.  The normalisation is always computed in
+  // double precision.
+  trv::ParameterSet params_norm = params;
+  params_norm.precision = "double";
+
+  trv::MeshField mesh_data(params_norm, false, "`mesh_data`");
+  trv::MeshField mesh_rand(params_norm, false, "`mesh_rand`");
 
   fftw_complex* weight_data = nullptr;
   weight_data = fftw_alloc_complex(particles_data.ntotal);
@@ -152,10 +206,12 @@ double calc_powspec_normalisation_from_meshes(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd reduction(+:norm)
 #endif  // TRV_USE_OMP
-  for (long long gid = 0; gid < params.nmesh; gid++) {
+  for (long long gid = 0; gid < mesh_data.nmesh_local; gid++) {
     norm += mesh_data.field[gid][0] * mesh_rand.field[gid][0];
   }
 
+  trvs::allreduce_sum(&norm, 1);
+
   double vol_cell = params.volume / double(params.nmesh);
 
   double norm_factor = 1. / (alpha * vol_cell * norm);  // 1/I₂
@@ -191,6 +247,25 @@ double calc_powspec_normalisation_from_meshes(
 
   params_norm.validate();
 
+  // With multiple MPI tasks, particles are distributed afresh for
+  // the mesh slabs of the modified mesh grid.
+  if (trvs::numTasks > 1) {
+    trv::ParticleCatalogue particles_data_norm, particles_rand_norm;
+    particles_data_norm.copy_owned_particles(particles_data);
+    particles_rand_norm.copy_owned_particles(particles_rand);
+
+    particles_data_norm.distribute_to_slabs(
+      params_norm.boxsize, params_norm.ngrid, params_norm.assignment_order
+    );
+    particles_rand_norm.distribute_to_slabs(
+      params_norm.boxsize, params_norm.ngrid, params_norm.assignment_order
+    );
+
+    return calc_powspec_normalisation_from_meshes(
+      particles_data_norm, particles_rand_norm, params_norm, alpha
+    );
+  }
+
   // Reuse existing overloaded method.
   double norm_factor = calc_powspec_normalisation_from_meshes(
     particles_data, particles_rand, params_norm, alpha
@@ -219,11 +294,13 @@ double calc_powspec_shotnoise_from_particles(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for simd reduction(+:shotnoise)
 #endif  // TRV_USE_OMP
-  for (int pid = 0; pid < particles.ntotal; pid++) {
+  for (int pid = 0; pid < particles.ntotal_owned; pid++) {
     shotnoise +=
       std::pow(particles[pid].ws, 2) * std::pow(particles[pid].wc, 2);
   }
 
+  trvs::allreduce_sum(&shotnoise, 1);
+
   return shotnoise;
 }
 
@@ -237,7 +314,7 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_powspec(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:sn_data_real, sn_data_imag)
 #endif
-  for (int pid = 0; pid < particles_data.ntotal; pid++) {
+  for (int pid = 0; pid < particles_data.ntotal_owned; pid++) {
     double los_[3] = {
       los_data[pid].pos[0], los_data[pid].pos[1], los_data[pid].pos[2]
     };
@@ -253,14 +330,17 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_powspec(
     sn_data_imag += sn_part_imag;
   }
 
-  std::complex<double> sn_data(sn_data_real, sn_data_imag);
+  double sn_data_parts[2] = {sn_data_real, sn_data_imag};
+  trvs::allreduce_sum(sn_data_parts, 2);
+
+  std::complex<double> sn_data(sn_data_parts[0], sn_data_parts[1]);
 
   double sn_rand_real = 0., sn_rand_imag = 0.;
 
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:sn_rand_real, sn_rand_imag)
 #endif
-  for (int pid = 0; pid < particles_rand.ntotal; pid++) {
+  for (int pid = 0; pid < particles_rand.ntotal_owned; pid++) {
     double los_[3] = {
       los_rand[pid].pos[0], los_rand[pid].pos[1], los_rand[pid].pos[2]
     };
@@ -276,7 +356,10 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_powspec(
     sn_rand_imag += sn_part_imag;
   }
 
-  std::complex<double> sn_rand(sn_rand_real, sn_rand_imag);
+  double sn_rand_parts[2] = {sn_rand_real, sn_rand_imag};
+  trvs::allreduce_sum(sn_rand_parts, 2);
+
+  std::complex<double> sn_rand(sn_rand_parts[0], sn_rand_parts[1]);
 
   return sn_data + std::pow(alpha, 2) * sn_rand;
 }
@@ -290,7 +373,7 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_powspec(
 #ifdef TRV_USE_OMP
 #pragma omp parallel for reduction(+:sn_real, sn_imag)
 #endif
-  for (int pid = 0; pid < particles.ntotal; pid++) {
+  for (int pid = 0; pid < particles.ntotal_owned; pid++) {
     double los_[3] = {los[pid].pos[0], los[pid].pos[1], los[pid].pos[2]};
 
     std::complex<double> ylm = trvm::SphericalHarmonicCalculator::
@@ -304,7 +387,10 @@ std::complex<double> calc_ylm_wgtd_shotnoise_amp_for_powspec(
     sn_imag += sn_part_imag;
   }
 
-  std::complex<double> sn(sn_real, sn_imag);
+  double sn_parts[2] = {sn_real, sn_imag};
+  trvs::allreduce_sum(sn_parts, 2);
+
+  std::complex<double> sn(sn_parts[0], sn_parts[1]);
 
   return std::pow(alpha, 2) * sn;
 }
@@ -357,22 +443,44 @@ trv::PowspecMeasurements compute_powspec(
 
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
   fftw_init_threads();
+  if (params.precision == "single") {fftwf_init_threads();}
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
-  MeshField dn_00(params, true, "`dn_00`");  // δn_00(k)
+  MeshField dn_00(params, true, "`dn_00`", true);  // δn_00(k)
   dn_00.compute_ylm_wgtd_field(
     catalogue_data, catalogue_rand, los_data, los_rand, alpha, 0, 0
   );
   dn_00.fourier_transform();
 
-  FieldStats stats_2pt(params);
-
-  for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
-    MeshField dn_LM(params, true, "`dn_LM`");  // δn_LM(k)
-    dn_LM.compute_ylm_wgtd_field(
-      catalogue_data, catalogue_rand, los_data, los_rand, alpha, params.ELL, M_
-    );
-    dn_LM.fourier_transform();
+  FieldStats stats_2pt(params, false);  // no FFTW plans needed
+
+  MeshFieldPool pool(params);  // reused by fields in the loop
+  MeshFieldBatch* dn_LM_batch = nullptr;  // batches over orders M
+
+  // Only fields at non-negative orders M are computed if components
+  // at negated orders can be added as mirrored components.
+  const bool mirrored = if_mirrored_in_fourier(params, kbinning.bin_max);
+  const int M_min = mirrored ? 0 : - params.ELL;
+
+  for (int M_ = M_min; M_ <= params.ELL; M_++) {
+    // Compute and Fourier transform fields in the next batch.
+    int ifield = (M_ - M_min) % params.fft_batch;
+    if (ifield == 0) {
+      int nfields = std::min(params.fft_batch, params.ELL - M_ + 1);
+      delete dn_LM_batch;
+      dn_LM_batch = new MeshFieldBatch(
+        params, pool, std::vector<std::string>(nfields, "`dn_LM`"),
+        params.ELL == 0
+      );
+      for (int jfield = 0; jfield < nfields; jfield++) {
+        (*dn_LM_batch)[jfield].compute_ylm_wgtd_field(
+          catalogue_data, catalogue_rand, los_data, los_rand, alpha,
+          params.ELL, M_ + jfield
+        );
+      }
+      dn_LM_batch->fourier_transform();
+    }
+    MeshField& dn_LM = (*dn_LM_batch)[ifield];  // δn_LM(k)
 
     std::complex<double> sn_amp = trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
       catalogue_data, catalogue_rand, los_data, los_rand, alpha, params.ELL, M_
@@ -389,8 +497,12 @@ trv::PowspecMeasurements compute_powspec(
       );
 
       for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
-        pk_save[ibin] += coupling * stats_2pt.pk[ibin];
-        sn_save[ibin] += coupling * stats_2pt.sn[ibin];
+        pk_save[ibin] += coupling * add_mirrored_component(
+          stats_2pt.pk[ibin], ell1, !mirrored || M_ == 0
+        );
+        sn_save[ibin] += coupling * add_mirrored_component(
+          stats_2pt.sn[ibin], ell1, !mirrored || M_ == 0
+        );
       }
 
       if (M_ == 0 && m1 == 0) {
@@ -405,6 +517,7 @@ trv::PowspecMeasurements compute_powspec(
       trvs::logger.stat("Power spectrum term computed at order M = %d.", M_);
     }
   }
+  delete dn_LM_batch;
 
   // ---------------------------------------------------------------------
   // Results
@@ -470,9 +583,10 @@ trv::TwoPCFMeasurements compute_corrfunc(
 
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
   fftw_init_threads();
+  if (params.precision == "single") {fftwf_init_threads();}
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
-  MeshField dn_00(params, true, "`dn_00`");  // δn_00(k)
+  MeshField dn_00(params, true, "`dn_00`", true);  // δn_00(k)
   dn_00.compute_ylm_wgtd_field(
     catalogue_data, catalogue_rand, los_data, los_rand, alpha, 0, 0
   );
@@ -480,12 +594,33 @@ trv::TwoPCFMeasurements compute_corrfunc(
 
   FieldStats stats_2pt(params);
 
-  for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
-    MeshField dn_LM(params, true, "`dn_LM`");  // δn_LM(k)
-    dn_LM.compute_ylm_wgtd_field(
-      catalogue_data, catalogue_rand, los_data, los_rand, alpha, params.ELL, M_
-    );
-    dn_LM.fourier_transform();
+  MeshFieldPool pool(params);  // reused by fields in the loop
+  MeshFieldBatch* dn_LM_batch = nullptr;  // batches over orders M
+
+  // Only fields at non-negative orders M are computed if components
+  // at negated orders can be added as mirrored components.
+  const bool mirrored = if_mirrored_in_config(params);
+  const int M_min = mirrored ? 0 : - params.ELL;
+
+  for (int M_ = M_min; M_ <= params.ELL; M_++) {
+    // Compute and Fourier transform fields in the next batch.
+    int ifield = (M_ - M_min) % params.fft_batch;
+    if (ifield == 0) {
+      int nfields = std::min(params.fft_batch, params.ELL - M_ + 1);
+      delete dn_LM_batch;
+      dn_LM_batch = new MeshFieldBatch(
+        params, pool, std::vector<std::string>(nfields, "`dn_LM`"),
+        params.ELL == 0
+      );
+      for (int jfield = 0; jfield < nfields; jfield++) {
+        (*dn_LM_batch)[jfield].compute_ylm_wgtd_field(
+          catalogue_data, catalogue_rand, los_data, los_rand, alpha,
+          params.ELL, M_ + jfield
+        );
+      }
+      dn_LM_batch->fourier_transform();
+    }
+    MeshField& dn_LM = (*dn_LM_batch)[ifield];  // δn_LM(k)
 
     std::complex<double> sn_amp = trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
       catalogue_data, catalogue_rand, los_data, los_rand, alpha, params.ELL, M_
@@ -502,7 +637,9 @@ trv::TwoPCFMeasurements compute_corrfunc(
       );
 
       for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
-        xi_save[ibin] += coupling * stats_2pt.xi[ibin];
+        xi_save[ibin] += coupling * add_mirrored_component(
+          stats_2pt.xi[ibin], 0, !mirrored || M_ == 0
+        );
       }
 
       if (M_ == 0 && m1 == 0) {
@@ -519,6 +656,7 @@ trv::TwoPCFMeasurements compute_corrfunc(
       );
     }
   }
+  delete dn_LM_batch;
 
   // ---------------------------------------------------------------------
   // Results
@@ -575,8 +713,8 @@ trv::PowspecMeasurements compute_powspec_in_gpp_box(
   }  // likely redundant but safe
 
   // Check input normalisation matches expectation.
-  double norm = double(catalogue_data.ntotal) * double(catalogue_data.ntotal)
-    / params.volume;
+  double norm = double(catalogue_data.ntotal_global)
+    * double(catalogue_data.ntotal_global) / params.volume;
   if (std::fabs(1 - norm * norm_factor) > eps_norm) {
     if (trvs::currTask == 0) {
       trvs::logger.warn(
@@ -592,18 +730,20 @@ trv::PowspecMeasurements compute_powspec_in_gpp_box(
 
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
   fftw_init_threads();
+  if (params.precision == "single") {fftwf_init_threads();}
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute power spectrum.
-  MeshField dn(params, true, "`dn`");  // δn(k)
+  MeshField dn(params, true, "`dn`", true);  // δn(k)
   dn.compute_unweighted_field_fluctuations_insitu(catalogue_data);
   dn.fourier_transform();
 
-  std::complex<double> sn_amp = double(catalogue_data.ntotal);  // \bar{N}
+  // \bar{N}
+  std::complex<double> sn_amp = double(catalogue_data.ntotal_global);
 
   // Under the global plane-parallel approximation, δᴰ_{M0} enforces
   // M = 0 for any spherical-harmonic-weighted field fluctuations.
-  FieldStats stats_2pt(params);
+  FieldStats stats_2pt(params, false);  // no FFTW plans needed
   stats_2pt.compute_ylm_wgtd_2pt_stats_in_fourier(
     dn, dn, sn_amp, params.ELL, 0, kbinning
   );
@@ -672,8 +812,8 @@ trv::TwoPCFMeasurements compute_corrfunc_in_gpp_box(
   }  // likely redundant but safe
 
   // Check input normalisation matches expectation.
-  double norm = double(catalogue_data.ntotal) * double(catalogue_data.ntotal)
-    / params.volume;
+  double norm = double(catalogue_data.ntotal_global)
+    * double(catalogue_data.ntotal_global) / params.volume;
   if (std::fabs(1 - norm * norm_factor) > eps_norm) {
     if (trvs::currTask == 0) {
       trvs::logger.warn(
@@ -689,14 +829,16 @@ trv::TwoPCFMeasurements compute_corrfunc_in_gpp_box(
 
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
   fftw_init_threads();
+  if (params.precision == "single") {fftwf_init_threads();}
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
   // Compute 2PCF.
-  MeshField dn(params, true, "`dn`");  // δn(k)
+  MeshField dn(params, true, "`dn`", true);  // δn(k)
   dn.compute_unweighted_field_fluctuations_insitu(catalogue_data);
   dn.fourier_transform();
 
-  std::complex<double> sn_amp = double(catalogue_data.ntotal);  // \bar{N}
+  // \bar{N}
+  std::complex<double> sn_amp = double(catalogue_data.ntotal_global);
 
   // Under the global plane-parallel approximation, δᴰ_{M0} enforces
   // M = 0 for any spherical-harmonic-weighted field fluctuations.
@@ -775,20 +917,41 @@ trv::TwoPCFWindowMeasurements compute_corrfunc_window(
 
 #if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
   fftw_init_threads();
+  if (params.precision == "single") {fftwf_init_threads();}
 #endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
 
-  MeshField dn_00(params, true, "`dn_00`");
+  MeshField dn_00(params, true, "`dn_00`", true);
   dn_00.compute_ylm_wgtd_field(catalogue_rand, los_rand, alpha, 0, 0);
   dn_00.fourier_transform();  // δn_00(k)
 
   FieldStats stats_2pt(params);
 
-  for (int M_ = - params.ELL; M_ <= params.ELL; M_++) {
-    MeshField dn_LM(params, true, "`dn_LM`");
-    dn_LM.compute_ylm_wgtd_field(
-      catalogue_rand, los_rand, alpha, params.ELL, M_
-    );
-    dn_LM.fourier_transform();  // δn_LM(k)
+  MeshFieldPool pool(params);  // reused by fields in the loop
+  MeshFieldBatch* dn_LM_batch = nullptr;  // batches over orders M
+
+  // Only fields at non-negative orders M are computed if components
+  // at negated orders can be added as mirrored components.
+  const bool mirrored = if_mirrored_in_config(params);
+  const int M_min = mirrored ? 0 : - params.ELL;
+
+  for (int M_ = M_min; M_ <= params.ELL; M_++) {
+    // Compute and Fourier transform fields in the next batch.
+    int ifield = (M_ - M_min) % params.fft_batch;
+    if (ifield == 0) {
+      int nfields = std::min(params.fft_batch, params.ELL - M_ + 1);
+      delete dn_LM_batch;
+      dn_LM_batch = new MeshFieldBatch(
+        params, pool, std::vector<std::string>(nfields, "`dn_LM`"),
+        params.ELL == 0
+      );
+      for (int jfield = 0; jfield < nfields; jfield++) {
+        (*dn_LM_batch)[jfield].compute_ylm_wgtd_field(
+          catalogue_rand, los_rand, alpha, params.ELL, M_ + jfield
+        );
+      }
+      dn_LM_batch->fourier_transform();
+    }
+    MeshField& dn_LM = (*dn_LM_batch)[ifield];  // δn_LM(k)
 
     std::complex<double> sn_amp = trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
       catalogue_rand, los_rand, alpha, params.ELL, M_
@@ -805,7 +968,9 @@ trv::TwoPCFWindowMeasurements compute_corrfunc_window(
       );
 
       for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
-        xi_save[ibin] += coupling * stats_2pt.xi[ibin];
+        xi_save[ibin] += coupling * add_mirrored_component(
+          stats_2pt.xi[ibin], 0, !mirrored || M_ == 0
+        );
       }
 
       if (M_ == 0 && m1 == 0) {
@@ -823,6 +988,7 @@ trv::TwoPCFWindowMeasurements compute_corrfunc_window(
       );
     }
   }
+  delete dn_LM_batch;
 
   // ---------------------------------------------------------------------
   // Results
@@ -849,4 +1015,303 @@ trv::TwoPCFWindowMeasurements compute_corrfunc_window(
   return corrfunc_win_out;
 }
 
+
+
+// ***********************************************************************
+// Batch statistics
+// ***********************************************************************
+
+TwoPointBatch::TwoPointBatch(
+  ParticleCatalogue& catalogue_rand, LineOfSight* los_rand,
+  trv::ParameterSet& params
+) {
+  trvs::logger.reset_level(params.verbose);
+
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "Computing random-source fields for batch measurements..."
+    );
+  }
+
+  this->params = params;
+  this->wstotal_rand = catalogue_rand.wstotal;
+
+#if defined(TRV_USE_OMP) && defined(TRV_USE_FFTWOMP)
+  fftw_init_threads();
+  if (params.precision == "single") {fftwf_init_threads();}
+#endif  // TRV_USE_OMP && TRV_USE_FFTWOMP
+
+  // Compute random-source fields with unit alpha contrast in
+  // configuration space, with the same layouts as δn_00 and δn_LM.
+  this->rand_00 = std::make_unique<MeshField>(
+    this->params, false, "`rand_00`", true
+  );
+  this->rand_00->compute_ylm_wgtd_field(catalogue_rand, los_rand, 1., 0, 0);
+
+  for (int M_ = 0; M_ <= this->params.ELL; M_++) {
+    MeshField* rand_LM_ = this->rand_00.get();
+    if (this->params.ELL != 0) {
+      this->rand_LM_.push_back(
+        std::make_unique<MeshField>(this->params, false, "`rand_LM`", false)
+      );
+      rand_LM_ = this->rand_LM_.back().get();
+      rand_LM_->compute_ylm_wgtd_field(
+        catalogue_rand, los_rand, 1., this->params.ELL, M_
+      );
+    }
+    this->rand_LM.push_back(rand_LM_);
+
+    this->sn_amp_rand.push_back(
+      trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
+        catalogue_rand, los_rand, 1., this->params.ELL, M_
+      )
+    );
+  }
+
+  this->dn_00 = std::make_unique<MeshField>(
+    this->params, true, "`dn_00`", true
+  );
+  this->pool = std::make_unique<MeshFieldPool>(this->params);
+  this->stats_2pt = std::make_unique<FieldStats>(
+    this->params, this->params.space == "config"
+  );
+
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "... computed random-source fields for batch measurements."
+    );
+  }
+}
+
+template<typename Accumulate>
+void TwoPointBatch::compute_terms(
+  ParticleCatalogue& catalogue_data, LineOfSight* los_data,
+  bool mirrored, Accumulate&& accumulate
+) {
+  double alpha = catalogue_data.wstotal / this->wstotal_rand;
+
+  this->dn_00->compute_ylm_wgtd_field(
+    catalogue_data, los_data, *this->rand_00, alpha, 0, 0
+  );
+  this->dn_00->fourier_transform();
+
+  MeshFieldBatch* dn_LM_batch = nullptr;  // batches over orders M
+
+  // Only fields at non-negative orders M are computed if components
+  // at negated orders are added as mirrored components.
+  const int M_min = mirrored ? 0 : - this->params.ELL;
+
+  for (int M_ = M_min; M_ <= this->params.ELL; M_++) {
+    // Compute and Fourier transform fields in the next batch.
+    int ifield = (M_ - M_min) % this->params.fft_batch;
+    if (ifield == 0) {
+      int nfields = std::min(
+        this->params.fft_batch, this->params.ELL - M_ + 1
+      );
+      delete dn_LM_batch;
+      dn_LM_batch = new MeshFieldBatch(
+        this->params, *this->pool,
+        std::vector<std::string>(nfields, "`dn_LM`"),
+        this->params.ELL == 0
+      );
+      for (int jfield = 0; jfield < nfields; jfield++) {
+        // Random-source fields at negative orders are obtained by
+        // negating the orders of those at positive orders in place,
+        // which is exact and undone afterwards.
+        int M_field = M_ + jfield;
+        MeshField& rand_LM_ = *this->rand_LM[std::abs(M_field)];
+        if (M_field < 0) {rand_LM_.apply_order_negation(M_field);}
+        (*dn_LM_batch)[jfield].compute_ylm_wgtd_field(
+          catalogue_data, los_data, rand_LM_, alpha,
+          this->params.ELL, M_field
+        );
+        if (M_field < 0) {rand_LM_.apply_order_negation(M_field);}
+      }
+      dn_LM_batch->fourier_transform();
+    }
+    MeshField& dn_LM = (*dn_LM_batch)[ifield];  // δn_LM(k)
+
+    // Compute \bar{N}_LM(k) from the data-source shot noise amplitude.
+    std::complex<double> sn_amp_rand_ = this->sn_amp_rand[std::abs(M_)];
+    if (M_ < 0) {
+      sn_amp_rand_ = ((M_ % 2 == 0) ? 1. : -1.) * std::conj(sn_amp_rand_);
+    }
+
+    std::complex<double> sn_amp =
+      trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
+        catalogue_data, los_data, 1., this->params.ELL, M_
+      ) + std::pow(alpha, 2) * sn_amp_rand_;
+
+    accumulate(dn_LM, sn_amp, M_);
+  }
+  delete dn_LM_batch;
+}
+
+trv::PowspecMeasurements TwoPointBatch::compute_powspec(
+  ParticleCatalogue& catalogue_data, LineOfSight* los_data,
+  trv::Binning& kbinning, double norm_factor
+) {
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "Computing power spectrum from paired survey-type catalogues "
+      "in batch..."
+    );
+  }
+
+  int ell1 = this->params.ELL;
+
+  int* nmodes_save = new int[kbinning.num_bins];
+  double* k_save = new double[kbinning.num_bins];
+  std::complex<double>* pk_save = new std::complex<double>[kbinning.num_bins];
+  std::complex<double>* sn_save = new std::complex<double>[kbinning.num_bins];
+  for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
+    nmodes_save[ibin] = 0;
+    k_save[ibin] = 0.;
+    pk_save[ibin] = 0.;
+    sn_save[ibin] = 0.;
+  }  // likely redundant but safe
+
+  const bool mirrored = if_mirrored_in_fourier(this->params, kbinning.bin_max);
+
+  this->compute_terms(catalogue_data, los_data, mirrored, [&](
+    MeshField& dn_LM, std::complex<double> sn_amp, int M_
+  ) {
+    for (int m1 = - ell1; m1 <= ell1; m1++) {
+      double coupling = calc_coupling_coeff_2pt(
+        ell1, this->params.ELL, m1, M_
+      );
+      if (std::fabs(coupling) < trvm::eps_coupling) {continue;}
+
+      this->stats_2pt->compute_ylm_wgtd_2pt_stats_in_fourier(
+        dn_LM, *this->dn_00, sn_amp, ell1, m1, kbinning
+      );
+
+      for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
+        pk_save[ibin] += coupling * add_mirrored_component(
+          this->stats_2pt->pk[ibin], ell1, !mirrored || M_ == 0
+        );
+        sn_save[ibin] += coupling * add_mirrored_component(
+          this->stats_2pt->sn[ibin], ell1, !mirrored || M_ == 0
+        );
+      }
+
+      if (M_ == 0 && m1 == 0) {
+        for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
+          nmodes_save[ibin] = this->stats_2pt->nmodes[ibin];
+          k_save[ibin] = this->stats_2pt->k[ibin];
+        }
+      }
+    }
+  });
+
+  trv::PowspecMeasurements powspec_out;
+  for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
+    powspec_out.kbin.push_back(kbinning.bin_centres[ibin]);
+    powspec_out.keff.push_back(k_save[ibin]);
+    powspec_out.nmodes.push_back(nmodes_save[ibin]);
+    powspec_out.pk_raw.push_back(norm_factor * pk_save[ibin]);
+    powspec_out.pk_shot.push_back(norm_factor * sn_save[ibin]);
+  }
+  powspec_out.dim = kbinning.num_bins;
+
+  delete[] nmodes_save; delete[] k_save; delete[] pk_save; delete[] sn_save;
+
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "... computed power spectrum from paired survey-type catalogues "
+      "in batch."
+    );
+  }
+
+  return powspec_out;
+}
+
+trv::TwoPCFMeasurements TwoPointBatch::compute_corrfunc(
+  ParticleCatalogue& catalogue_data, LineOfSight* los_data,
+  trv::Binning& rbinning, double norm_factor
+) {
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "Computing two-point correlation function from "
+      "paired survey-type catalogues in batch..."
+    );
+  }
+
+  if (this->params.space != "config") {
+    if (trvs::currTask == 0) {
+      trvs::logger.error(
+        "Two-point correlation function batch measurements require "
+        "configuration-space statistics: `statistic_type` = '%s'.",
+        this->params.statistic_type.c_str()
+      );
+    }
+    throw trvs::InvalidParameterError(
+      "Two-point correlation function batch measurements require "
+      "configuration-space statistics: `statistic_type` = '%s'.\n",
+      this->params.statistic_type.c_str()
+    );
+  }
+
+  int ell1 = this->params.ELL;
+
+  int* npairs_save = new int[rbinning.num_bins];
+  double* r_save = new double[rbinning.num_bins];
+  std::complex<double>* xi_save = new std::complex<double>[rbinning.num_bins];
+  for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
+    npairs_save[ibin] = 0;
+    r_save[ibin] = 0.;
+    xi_save[ibin] = 0.;
+  }  // likely redundant but safe
+
+  const bool mirrored = if_mirrored_in_config(this->params);
+
+  this->compute_terms(catalogue_data, los_data, mirrored, [&](
+    MeshField& dn_LM, std::complex<double> sn_amp, int M_
+  ) {
+    for (int m1 = - ell1; m1 <= ell1; m1++) {
+      double coupling = calc_coupling_coeff_2pt(
+        ell1, this->params.ELL, m1, M_
+      );
+      if (std::fabs(coupling) < trvm::eps_coupling) {continue;}
+
+      this->stats_2pt->compute_ylm_wgtd_2pt_stats_in_config(
+        dn_LM, *this->dn_00, sn_amp, ell1, m1, rbinning
+      );
+
+      for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
+        xi_save[ibin] += coupling * add_mirrored_component(
+          this->stats_2pt->xi[ibin], 0, !mirrored || M_ == 0
+        );
+      }
+
+      if (M_ == 0 && m1 == 0) {
+        for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
+          npairs_save[ibin] = this->stats_2pt->npairs[ibin];
+          r_save[ibin] = this->stats_2pt->r[ibin];
+        }
+      }
+    }
+  });
+
+  trv::TwoPCFMeasurements corrfunc_out;
+  for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
+    corrfunc_out.rbin.push_back(rbinning.bin_centres[ibin]);
+    corrfunc_out.reff.push_back(r_save[ibin]);
+    corrfunc_out.npairs.push_back(npairs_save[ibin]);
+    corrfunc_out.xi.push_back(norm_factor * xi_save[ibin]);
+  }
+  corrfunc_out.dim = rbinning.num_bins;
+
+  delete[] npairs_save; delete[] r_save; delete[] xi_save;
+
+  if (trvs::currTask == 0) {
+    trvs::logger.stat(
+      "... computed two-point correlation function "
+      "from paired survey-type catalogues in batch."
+    );
+  }
+
+  return corrfunc_out;
+}
+
 }  // namespace trv
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "particles.hpp"
+#include "field.hpp"
+
+// Test suite: AssignmentEngineTest
+
+// Test fixture
+class AssignmentEngineTest
+    : public ::testing::TestWithParam<std::tuple<std::string, bool>> {
+ protected:
+  void SetUp() override {
+    // Set up a small mesh whose grid cell volume is a power of two.
+    this->params.catalogue_type = "sim";
+    this->params.statistic_type = "powspec";
+    this->params.binning = "lin";
+    this->params.bin_min = 0.;
+    this->params.bin_max = 0.1;
+    this->params.num_bins = 2;
+    this->params.verbose = 60;
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      this->params.boxsize[iaxis] = BOXSIZE;
+      this->params.ngrid[iaxis] = NGRID;
+    }
+    this->params.assignment = std::get<0>(GetParam());
+    this->params.interlace = std::get<1>(GetParam()) ? "true" : "false";
+
+    // Place particles at quarter-cell positions, including next to the
+    // upper box edges, with weights that are multiples of a quarter.
+    // Every sampling window value (except for the PCS scheme) and
+    // weighted contribution is then exactly representable, so that
+    // the assigned values do not depend on the summation order.
+    this->particles.initialise_particles(NPARTICLE);
+    this->weights = new fftw_complex[NPARTICLE];
+    for (int pid = 0; pid < NPARTICLE; pid++) {
+      this->particles[pid].pos[0] = (13 * pid) % 64;
+      this->particles[pid].pos[1] = (29 * pid + 63) % 64;
+      this->particles[pid].pos[2] = (47 * pid + 62) % 64;
+      this->weights[pid][0] = .25 * (1 + pid % 4);
+      this->weights[pid][1] = .25 * (pid % 3);
+    }
+    this->particles.calc_pos_extents();
+  }
+
+  void TearDown() override {
+    delete[] this->weights; this->weights = nullptr;
+  }
+
+  // Assign weighted particles to a mesh with the given engine, and
+  // return the configuration- and Fourier-space field values.
+  void assign_with_engine(
+    const std::string& engine,
+    std::vector<double>& values, std::vector<double>& modes
+  ) {
+    this->params.assignment_engine = engine;
+    this->params.validate();
+
+    trv::MeshField field(this->params);
+    field.assign_weighted_field_to_mesh(this->particles, this->weights);
+    for (long long gid = 0; gid < this->params.nmesh; gid++) {
+      values.push_back(field[gid][0]);
+      values.push_back(field[gid][1]);
+    }
+
+    // Interlaced shadow fields are combined in the Fourier transform.
+    field.fourier_transform();
+    for (long long gid = 0; gid < this->params.nmesh; gid++) {
+      modes.push_back(field[gid][0]);
+      modes.push_back(field[gid][1]);
+    }
+  }
+
+  // Test data members
+  static constexpr double BOXSIZE = 64.;
+  static constexpr int NGRID = 16;
+  static constexpr int NPARTICLE = 512;
+  trv::ParameterSet params;
+  trv::ParticleCatalogue particles;
+  fftw_complex* weights = nullptr;
+};
+
+// Test method: test_slab_equals_atomic
+TEST_P(AssignmentEngineTest, test_slab_equals_atomic) {
+  std::vector<double> values_atomic, modes_atomic;
+  std::vector<double> values_slab, modes_slab;
+  this->assign_with_engine("atomic", values_atomic, modes_atomic);
+  this->assign_with_engine("slab", values_slab, modes_slab);
+
+  // PCS sampling window values are not exactly representable, so the
+  // assigned values may only agree up to rounding errors.
+  double tol_values = 0., tol_modes = 0.;
+  if (this->params.assignment == "pcs") {
+    for (std::size_t idx = 0; idx < values_atomic.size(); idx++) {
+      tol_values = std::max(tol_values, std::abs(values_atomic[idx]));
+      tol_modes = std::max(tol_modes, std::abs(modes_atomic[idx]));
+    }
+    tol_values *= 1.e-14;
+    tol_modes *= 1.e-14;
+  }
+
+  ASSERT_EQ(values_slab.size(), values_atomic.size());
+  for (std::size_t idx = 0; idx < values_atomic.size(); idx++) {
+    if (this->params.assignment == "pcs") {
+      EXPECT_NEAR(values_slab[idx], values_atomic[idx], tol_values);
+      EXPECT_NEAR(modes_slab[idx], modes_atomic[idx], tol_modes);
+    } else {
+      EXPECT_EQ(values_slab[idx], values_atomic[idx]);
+      EXPECT_EQ(modes_slab[idx], modes_atomic[idx]);
+    }
+  }
+}
+
+// Test method: test_slab_memory_accounted
+TEST_P(AssignmentEngineTest, test_slab_memory_accounted) {
+  this->params.assignment_engine = "slab";
+  this->params.validate();
+
+  trv::MeshField field(this->params);
+  const double gbytes_mem = trv::sys::gbytesMem;
+  trv::sys::gbytesMaxMem = gbytes_mem;
+
+  field.assign_weighted_field_to_mesh(this->particles, this->weights);
+
+  // The sorting buffers (at least the sorted particle indices and slab
+  // identifiers, and the slab offsets) are counted while in use and
+  // released afterwards.
+  const int nslab = NGRID / this->params.assignment_order;
+  EXPECT_GE(
+    trv::sys::gbytesMaxMem - gbytes_mem,
+    trv::sys::size_in_gb<int>(2 * NPARTICLE)
+      + trv::sys::size_in_gb<long long>(2 * nslab + 1)
+      - 1.e-15
+  );
+  EXPECT_NEAR(trv::sys::gbytesMem, gbytes_mem, 1.e-15);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  AssignmentSchemes, AssignmentEngineTest,
+  ::testing::Combine(
+    ::testing::Values("ngp", "cic", "tsc", "pcs"),
+    ::testing::Bool()
+  )
+);
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
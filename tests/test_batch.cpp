@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+// Test suite: BatchMeasurementTest
+
+// Test fixture
+class BatchMeasurementTest : public ::testing::TestWithParam<std::string> {
+ protected:
+  void SetUp() override {
+    // The program executable is provided by the test runner.
+    this->progexe = std::getenv("TRV_PROGEXE");
+    if (this->progexe == nullptr || access(this->progexe, X_OK) != 0) {
+      GTEST_SKIP() << "Program executable unavailable (set TRV_PROGEXE).";
+    }
+
+    this->test_dir =
+      ::testing::TempDir() + "test_batch." + std::to_string(getpid()) + "/";
+    mkdir(this->test_dir.c_str(), 0755);
+    mkdir((this->test_dir + "batch").c_str(), 0755);
+    mkdir((this->test_dir + "single").c_str(), 0755);
+
+    // Draw data-source catalogues from a deterministic pseudo-random
+    // sequence within the extents of the random-source catalogue.
+    unsigned long long seed = 1;
+    auto draw = [&seed]() {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return double(seed >> 11) / double(1ULL << 53);
+    };
+    for (std::string name : {"mock_a", "mock_b"}) {
+      std::ofstream catalogue_file(this->test_dir + name + ".txt");
+      for (int pid = 0; pid < NPARTICLE; pid++) {
+        catalogue_file
+          << 1000. * draw() << " " << 1000. * draw() << " "
+          << 1000. * draw() << " " << 3.e-5 << "\n";
+      }
+    }
+  }
+
+  void TearDown() override {
+    if (!this->test_dir.empty()) {
+      std::system(("rm -rf " + this->test_dir).c_str());
+    }
+  }
+
+  // Write a parameter file for measurements from the test catalogues.
+  std::string write_params(
+    const std::string& tag, const std::string& data_catalogue_file,
+    const std::string& output_tag, const std::string& measurement_dir
+  ) {
+    std::string param_filepath = this->test_dir + tag + ".ini";
+    std::ofstream param_file(param_filepath);
+    param_file
+      << "catalogue_dir = tests/test_input/ctlgs\n"
+      << "measurement_dir = " << measurement_dir << "\n"
+      << "data_catalogue_file = " << data_catalogue_file << "\n"
+      << "rand_catalogue_file = test_rand_catalogue.txt\n"
+      << "catalogue_columns = x,y,z,nz\n"
+      << "output_tag = " << output_tag << "\n"
+      << "boxsize_x = 1000.\nboxsize_y = 1000.\nboxsize_z = 1000.\n"
+      << "ngrid_x = 16\nngrid_y = 16\nngrid_z = 16\n"
+      << "alignment = centre\npadscale = box\n"
+      << "assignment = tsc\ninterlace = true\n"
+      << "catalogue_type = survey\n"
+      << "statistic_type = " << GetParam() << "\n"
+      << "ell1 = 0\nell2 = 0\nELL = 2\ni_wa = 0\nj_wa = 0\nform = diag\n"
+      << "norm_convention = particle\n"
+      << "binning = lin\n"
+      << "bin_min = " << (GetParam() == "powspec" ? 0.005 : 50.) << "\n"
+      << "bin_max = " << (GetParam() == "powspec" ? 0.105 : 250.) << "\n"
+      << "num_bins = 4\nidx_bin = 0\n"
+      << "fftw_scheme = estimate\nuse_fftw_wisdom = false\n"
+      << "save_binned_vectors = false\n"
+      << "verbose = 20\n";
+    return param_filepath;
+  }
+
+  // Run the program, and return its exit status.
+  int run_program(const std::vector<std::string>& args) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      int fd_null = open("/dev/null", O_WRONLY);
+      dup2(fd_null, STDOUT_FILENO);
+      dup2(fd_null, STDERR_FILENO);
+      std::vector<char*> argv = {const_cast<char*>(this->progexe)};
+      for (const std::string& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+      }
+      argv.push_back(nullptr);
+      execv(this->progexe, argv.data());
+      _exit(127);
+    }
+    int status = -1;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid) {return -1;}
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+
+  // Read the header of a measurement file, except for the unused
+  // normalisation factor alternatives (as the mixed-mesh normalisation
+  // is not computed in batch unless used), and its data table.
+  struct Measurement {
+    std::string header;
+    std::vector<std::vector<double>> datatab;
+  };
+
+  Measurement read_measurement(const std::string& filepath) {
+    std::ifstream fin(filepath);
+    Measurement meas;
+    std::string line;
+    while (std::getline(fin, line)) {
+      if (line.empty()) {continue;}
+      if (line[0] == '#') {
+        if (line.rfind("# Normalisation factor alternatives:", 0) != 0) {
+          meas.header += line + "\n";
+        }
+        continue;
+      }
+      std::istringstream line_stream(line);
+      std::vector<double> row;
+      for (double entry; line_stream >> entry;) {row.push_back(entry);}
+      meas.datatab.push_back(row);
+    }
+    return meas;
+  }
+
+  // Test data members
+  static constexpr int NPARTICLE = 2000;
+  static constexpr std::size_t COL_NCOUNT = 2;  // mode/pair count column
+  static constexpr double TOL = 1.e-10;  // relative to the column maximum
+  static constexpr double TOL_FLOOR = 1.e-12;  // relative to the table maximum
+  const char* progexe = nullptr;
+  std::string test_dir;
+};
+
+// Test method: test_batch_equals_single
+TEST_P(BatchMeasurementTest, test_batch_equals_single) {
+  // List file with a comment line, a blank line and an output tag.
+  std::string list_filepath = this->test_dir + "list.txt";
+  std::ofstream list_file(list_filepath);
+  list_file
+    << "# data-source catalogues\n"
+    << this->test_dir << "mock_a.txt\n"
+    << "\n"
+    << this->test_dir << "mock_b.txt _second\n";
+  list_file.close();
+
+  std::string param_filepath = this->write_params(
+    "batch", this->test_dir + "mock_a.txt", "", this->test_dir + "batch"
+  );
+  ASSERT_EQ(this->run_program({param_filepath, "--batch", list_filepath}), 0);
+
+  // Each measurement in batch equals the single measurement from
+  // the same data-source catalogue.
+  std::string prefix = (GetParam() == "powspec") ? "pk2" : "xi2";
+  std::vector<std::vector<std::string>> cases = {
+    {"mock_a", "_mock_a"}, {"mock_b", "_second"}
+  };
+  for (const std::vector<std::string>& case_ : cases) {
+    std::string param_filepath_single = this->write_params(
+      case_[0], this->test_dir + case_[0] + ".txt", case_[1],
+      this->test_dir + "single"
+    );
+    ASSERT_EQ(this->run_program({param_filepath_single}), 0);
+
+    Measurement meas_batch =
+      this->read_measurement(this->test_dir + "batch/" + prefix + case_[1]);
+    Measurement meas_single =
+      this->read_measurement(this->test_dir + "single/" + prefix + case_[1]);
+    ASSERT_FALSE(meas_batch.datatab.empty())
+      << "Missing measurement: " << case_[1];
+    EXPECT_EQ(meas_batch.header, meas_single.header)
+      << "Mismatch: " << case_[1];
+    ASSERT_EQ(meas_batch.datatab.size(), meas_single.datatab.size());
+
+    // Compare counts exactly, and other entries to rounding relative to
+    // the largest value in their column.  OpenMP reductions may leave
+    // rounding residuals in columns that vanish, so the tolerance is
+    // floored relative to the largest measured value in the table.
+    std::size_t ncol = meas_single.datatab[0].size();
+    std::vector<double> col_max(ncol, 0.);
+    double val_max = 0.;
+    for (const std::vector<double>& row : meas_single.datatab) {
+      ASSERT_EQ(row.size(), ncol);
+      for (std::size_t icol = 0; icol < ncol; icol++) {
+        col_max[icol] = std::max(col_max[icol], std::abs(row[icol]));
+        if (icol > COL_NCOUNT) {
+          val_max = std::max(val_max, std::abs(row[icol]));
+        }
+      }
+    }
+    for (std::size_t irow = 0; irow < meas_single.datatab.size(); irow++) {
+      const std::vector<double>& row_batch = meas_batch.datatab[irow];
+      const std::vector<double>& row_single = meas_single.datatab[irow];
+      ASSERT_EQ(row_batch.size(), ncol);
+      for (std::size_t icol = 0; icol < ncol; icol++) {
+        if (icol == COL_NCOUNT) {
+          EXPECT_EQ(row_batch[icol], row_single[icol])
+            << "Mismatch: " << case_[1] << ", row " << irow
+            << ", column " << icol;
+        } else {
+          double tol = std::max(TOL * col_max[icol], TOL_FLOOR * val_max);
+          EXPECT_NEAR(row_batch[icol], row_single[icol], tol)
+            << "Mismatch: " << case_[1] << ", row " << irow
+            << ", column " << icol;
+        }
+      }
+    }
+  }
+}
+
+// Test method: test_batch_unloadable_catalogue
+TEST_P(BatchMeasurementTest, test_batch_unloadable_catalogue) {
+  std::string list_filepath = this->test_dir + "list.txt";
+  std::ofstream list_file(list_filepath);
+  list_file
+    << this->test_dir << "mock_a.txt\n"
+    << this->test_dir << "mock_nonexistent.txt\n";
+  list_file.close();
+
+  std::string param_filepath = this->write_params(
+    "batch", this->test_dir + "mock_a.txt", "", this->test_dir + "batch"
+  );
+  EXPECT_NE(this->run_program({param_filepath, "--batch", list_filepath}), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  TwoPointStatistics, BatchMeasurementTest,
+  ::testing::Values("powspec", "2pcf")
+);
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,194 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "particles.hpp"
+
+// Test suite: CatalogueConversionTest
+
+// Test fixture
+class CatalogueConversionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::string stem =
+      ::testing::TempDir() + "test_catalogue." + std::to_string(getpid());
+    this->text_filepath = stem + ".txt";
+    this->binary_filepath = stem + trv::BINARY_CATALOGUE_EXT;
+
+    // Write a plain-text catalogue with a header comment, a blank line
+    // and an unused column, with entries that are exactly round-tripped.
+    unsigned long long seed = 1;
+    auto draw = [&seed]() {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return double(seed >> 11) / double(1ULL << 53);
+    };
+    std::FILE* fileptr = std::fopen(this->text_filepath.c_str(), "w");
+    std::fprintf(fileptr, "# x y z extra nz ws\n");
+    for (int pid = 0; pid < NPARTICLE; pid++) {
+      if (pid == NPARTICLE / 2) {std::fprintf(fileptr, "\n");}
+      std::fprintf(
+        fileptr, "%.17g\t%.17g %.17g %d %.17g %.17g\n",
+        1000. * draw(), 1000. * draw(), 1000. * draw(), pid,
+        1.e-4 * draw(), .5 + draw()
+      );
+    }
+    std::fclose(fileptr);
+  }
+
+  void TearDown() override {
+    std::remove(this->text_filepath.c_str());
+    std::remove(this->binary_filepath.c_str());
+  }
+
+  // Test data members
+  static constexpr int NPARTICLE = 1000;
+  const std::string COLUMNS = "x,y,z,extra,nz,ws";
+  std::string text_filepath;
+  std::string binary_filepath;
+};
+
+// Test method: test_round_trip
+TEST_F(CatalogueConversionTest, test_round_trip) {
+  long long nrows = trv::ParticleCatalogue::convert_catalogue_file(
+    this->text_filepath, COLUMNS, this->binary_filepath
+  );
+  ASSERT_EQ(nrows, NPARTICLE);
+
+  trv::ParticleCatalogue catalogue_text, catalogue_binary;
+  ASSERT_EQ(
+    catalogue_text.load_catalogue_file(this->text_filepath, COLUMNS), 0
+  );
+  ASSERT_EQ(
+    catalogue_binary.load_catalogue_file(this->binary_filepath, COLUMNS), 0
+  );
+
+  ASSERT_EQ(catalogue_binary.ntotal, catalogue_text.ntotal);
+  for (int pid = 0; pid < catalogue_text.ntotal; pid++) {
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      EXPECT_EQ(
+        catalogue_binary[pid].pos[iaxis], catalogue_text[pid].pos[iaxis]
+      );
+    }
+    EXPECT_EQ(catalogue_binary[pid].nz, catalogue_text[pid].nz);
+    EXPECT_EQ(catalogue_binary[pid].ws, catalogue_text[pid].ws);
+    EXPECT_EQ(catalogue_binary[pid].wc, catalogue_text[pid].wc);
+    EXPECT_EQ(catalogue_binary[pid].w, catalogue_text[pid].w);
+  }
+  // Total weights are reduced over threads in no fixed order.
+  EXPECT_DOUBLE_EQ(catalogue_binary.wtotal, catalogue_text.wtotal);
+  EXPECT_DOUBLE_EQ(catalogue_binary.wstotal, catalogue_text.wstotal);
+}
+
+// Test method: test_round_trip_single_precision
+TEST_F(CatalogueConversionTest, test_round_trip_single_precision) {
+  trv::ParticleCatalogue::convert_catalogue_file(
+    this->text_filepath, COLUMNS, this->binary_filepath, true
+  );
+
+  trv::ParticleCatalogue catalogue_text, catalogue_binary;
+  catalogue_text.load_catalogue_file(this->text_filepath, COLUMNS);
+  catalogue_binary.load_catalogue_file(this->binary_filepath, COLUMNS);
+
+  ASSERT_EQ(catalogue_binary.ntotal, catalogue_text.ntotal);
+  for (int pid = 0; pid < catalogue_text.ntotal; pid++) {
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      EXPECT_EQ(
+        catalogue_binary[pid].pos[iaxis],
+        double(float(catalogue_text[pid].pos[iaxis]))
+      );
+    }
+    EXPECT_EQ(catalogue_binary[pid].nz, double(float(catalogue_text[pid].nz)));
+    EXPECT_EQ(catalogue_binary[pid].ws, double(float(catalogue_text[pid].ws)));
+  }
+}
+
+// Test method: test_malformed_row
+TEST_F(CatalogueConversionTest, test_malformed_row) {
+  // Append a short row and a row with an unparsable entry in turn
+  // (line numbers include the header comment and the blank line).
+  const std::string rows[2] = {"1. 2. 3. 4.", "1. 2. 3. 4. n/a 1."};
+  for (const std::string& row : rows) {
+    std::string text_filepath_bad = this->text_filepath + ".bad";
+    {
+      std::ifstream fin(this->text_filepath);
+      std::ofstream fout(text_filepath_bad);
+      fout << fin.rdbuf() << row << "\n";
+    }
+
+    try {
+      trv::ParticleCatalogue::convert_catalogue_file(
+        text_filepath_bad, COLUMNS, this->binary_filepath
+      );
+      ADD_FAILURE() << "Malformed row is not rejected: " << row;
+    } catch (const trv::sys::IOError& e) {
+      EXPECT_NE(
+        std::string(e.what()).find(
+          "at line " + std::to_string(NPARTICLE + 3)
+        ),
+        std::string::npos
+      ) << e.what();
+    }
+    EXPECT_NE(access(this->binary_filepath.c_str(), F_OK), 0);
+
+    std::remove(text_filepath_bad.c_str());
+  }
+}
+
+// Test method: test_empty_input
+TEST_F(CatalogueConversionTest, test_empty_input) {
+  // A catalogue with no rows cannot be loaded, so it is not converted.
+  std::string text_filepath_empty = this->text_filepath + ".empty";
+  std::ofstream(text_filepath_empty) << "# x y z extra nz ws\n\n";
+
+  EXPECT_THROW(
+    trv::ParticleCatalogue::convert_catalogue_file(
+      text_filepath_empty, COLUMNS, this->binary_filepath
+    ),
+    trv::sys::IOError
+  );
+  EXPECT_NE(access(this->binary_filepath.c_str(), F_OK), 0);
+
+  std::remove(text_filepath_empty.c_str());
+}
+
+// Test method: test_corrupt_column_offset
+TEST_F(CatalogueConversionTest, test_corrupt_column_offset) {
+  trv::ParticleCatalogue::convert_catalogue_file(
+    this->text_filepath, COLUMNS, this->binary_filepath
+  );
+
+  // Corrupt the first column offset such that the end of its data array
+  // wraps around past the end of the file.
+  std::uint64_t offset = UINT64_MAX - 7;
+  std::FILE* fileptr = std::fopen(this->binary_filepath.c_str(), "r+b");
+  ASSERT_NE(fileptr, nullptr);
+  std::fseek(
+    fileptr,
+    long(
+      sizeof(trv::BinaryCatalogueHeader)
+      + offsetof(trv::BinaryCatalogueColumn, offset)
+    ),
+    SEEK_SET
+  );
+  std::fwrite(&offset, sizeof(offset), 1, fileptr);
+  std::fclose(fileptr);
+
+  trv::ParticleCatalogue catalogue;
+  EXPECT_THROW(
+    catalogue.load_catalogue_file(this->binary_filepath, COLUMNS),
+    trv::sys::InvalidDataError
+  );
+}
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "dataobjs.hpp"
+#include "particles.hpp"
+#include "threept.hpp"
+
+extern char** environ;
+
+// Number of checkpoint file replacements after which the process is
+// terminated (none if non-positive), which simulates the interruption of
+// a measurement right after a checkpoint is saved.
+int ncheckpoints_before_exit = 0;
+
+// Environment variable marking the test process re-executed to run the
+// measurement to be interrupted.
+const char* INTERRUPTED_ENV = "TRV_TEST_CHECKPOINT_INTERRUPTED=1";
+
+// Intercept the renaming of checkpoint files by
+// `trv::BispecCheckpoint::save`.
+extern "C" int rename(const char* oldpath, const char* newpath) noexcept {
+  int status = renameat(AT_FDCWD, oldpath, AT_FDCWD, newpath);
+  if (ncheckpoints_before_exit > 0 && --ncheckpoints_before_exit == 0) {
+    _exit(0);
+  }
+  return status;
+}
+
+// Test suite: BispecCheckpointTest
+
+// Test fixture
+class BispecCheckpointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Set up a small bispectrum measurement with several terms.
+    this->params.catalogue_type = "survey";
+    this->params.statistic_type = "bispec";
+    this->params.ell1 = 2;
+    this->params.ell2 = 0;
+    this->params.ELL = 2;
+    this->params.form = "diag";
+    this->params.binning = "lin";
+    this->params.bin_min = 0.02;
+    this->params.bin_max = 0.1;
+    this->params.num_bins = 2;
+    this->params.verbose = 60;
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      this->params.boxsize[iaxis] = BOXSIZE;
+      this->params.ngrid[iaxis] = NGRID;
+    }
+    this->params.validate();
+
+    this->binning = new trv::Binning(this->params);
+    this->binning->set_bins();
+
+    // Draw particles from a deterministic pseudo-random sequence.
+    unsigned long long seed = 1;
+    auto draw = [&seed]() {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return double(seed >> 11) / double(1ULL << 53);
+    };
+    auto fill = [&](trv::ParticleCatalogue& catalogue, int nparticle) {
+      catalogue.initialise_particles(nparticle);
+      for (int pid = 0; pid < nparticle; pid++) {
+        for (int iaxis = 0; iaxis < 3; iaxis++) {
+          catalogue[pid].pos[iaxis] = BOXSIZE * (.1 + .8 * draw());
+        }
+        catalogue[pid].nz = 1.e-4;
+        catalogue[pid].ws = 1.;
+        catalogue[pid].wc = 1.;
+        catalogue[pid].w = 1.;
+      }
+      catalogue.calc_pos_extents();
+      catalogue.wtotal = nparticle;
+      catalogue.wstotal = nparticle;
+    };
+    fill(this->catalogue_data, 200);
+    fill(this->catalogue_rand, 800);
+
+    this->los_data = this->compute_los(this->catalogue_data);
+    this->los_rand = this->compute_los(this->catalogue_rand);
+
+    this->checkpoint_filepath = ::testing::TempDir() + "test_bispec.ckpt";
+    std::remove(this->checkpoint_filepath.c_str());
+  }
+
+  void TearDown() override {
+    std::remove(this->checkpoint_filepath.c_str());
+    delete[] this->los_data; this->los_data = nullptr;
+    delete[] this->los_rand; this->los_rand = nullptr;
+    delete this->binning; this->binning = nullptr;
+  }
+
+  trv::LineOfSight* compute_los(trv::ParticleCatalogue& catalogue) {
+    trv::LineOfSight* los = new trv::LineOfSight[catalogue.ntotal];
+    for (int pid = 0; pid < catalogue.ntotal; pid++) {
+      double los_mag = std::sqrt(
+        catalogue[pid].pos[0] * catalogue[pid].pos[0]
+        + catalogue[pid].pos[1] * catalogue[pid].pos[1]
+        + catalogue[pid].pos[2] * catalogue[pid].pos[2]
+      );
+      for (int iaxis = 0; iaxis < 3; iaxis++) {
+        los[pid].pos[iaxis] = catalogue[pid].pos[iaxis] / los_mag;
+      }
+    }
+    return los;
+  }
+
+  trv::BispecMeasurements measure(
+    double norm_factor, const std::string& checkpoint_filepath, bool resume
+  ) {
+    return trv::compute_bispec(
+      this->catalogue_data, this->catalogue_rand,
+      this->los_data, this->los_rand,
+      this->params, *this->binning, norm_factor,
+      checkpoint_filepath, resume
+    );
+  }
+
+  // Test data members
+  static constexpr double BOXSIZE = 1000.;
+  static constexpr int NGRID = 16;
+  static constexpr double NORM_FACTOR = 1.e-3;
+  static constexpr double TOL = 1.e-10;  // relative to the maximum
+  trv::ParameterSet params;
+  trv::Binning* binning = nullptr;
+  trv::ParticleCatalogue catalogue_data;
+  trv::ParticleCatalogue catalogue_rand;
+  trv::LineOfSight* los_data = nullptr;
+  trv::LineOfSight* los_rand = nullptr;
+  std::string checkpoint_filepath;
+};
+
+// Test method: test_resume_equals_uninterrupted
+TEST_F(BispecCheckpointTest, test_resume_equals_uninterrupted) {
+  // In the re-executed test process, run the measurement to be
+  // interrupted after two checkpoints.
+  if (std::getenv("TRV_TEST_CHECKPOINT_INTERRUPTED") != nullptr) {
+    ncheckpoints_before_exit = 2;
+    this->measure(NORM_FACTOR, this->checkpoint_filepath, false);
+    _exit(1);  // not interrupted
+  }
+
+  trv::BispecMeasurements bispec_ref = this->measure(NORM_FACTOR, "", false);
+
+  // Interrupt a measurement in a freshly executed test process (as
+  // a forked copy of this process may deadlock on the OpenMP thread
+  // pool already started by the reference measurement).
+  std::string filter_arg = std::string("--gtest_filter=")
+    + ::testing::UnitTest::GetInstance()->current_test_suite()->name() + "."
+    + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  std::vector<char*> argv = {
+    const_cast<char*>("/proc/self/exe"), const_cast<char*>(filter_arg.c_str()),
+    nullptr
+  };
+  std::vector<char*> envp = {const_cast<char*>(INTERRUPTED_ENV)};
+  for (char** env = environ; *env != nullptr; env++) {envp.push_back(*env);}
+  envp.push_back(nullptr);
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    int fd_null = open("/dev/null", O_WRONLY);
+    dup2(fd_null, STDOUT_FILENO);
+    dup2(fd_null, STDERR_FILENO);
+    execve(argv[0], argv.data(), envp.data());
+    _exit(127);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0) << "Measurement was not interrupted.";
+
+  trv::BispecCheckpoint checkpoint;
+  ASSERT_TRUE(checkpoint.load(this->checkpoint_filepath));
+  ASSERT_EQ(checkpoint.count_terms, 2);
+
+  // Resume the measurement from the checkpoint, which agrees with the
+  // uninterrupted measurement to rounding (as OpenMP reductions need
+  // not be deterministic).
+  trv::BispecMeasurements bispec_resumed =
+    this->measure(NORM_FACTOR, this->checkpoint_filepath, true);
+
+  ASSERT_EQ(bispec_resumed.bk_raw.size(), bispec_ref.bk_raw.size());
+  double bk_raw_max = 0., bk_shot_max = 0.;
+  for (std::size_t idx = 0; idx < bispec_ref.bk_raw.size(); idx++) {
+    bk_raw_max = std::max(bk_raw_max, std::abs(bispec_ref.bk_raw[idx]));
+    bk_shot_max = std::max(bk_shot_max, std::abs(bispec_ref.bk_shot[idx]));
+  }
+  for (std::size_t idx = 0; idx < bispec_ref.bk_raw.size(); idx++) {
+    EXPECT_EQ(bispec_resumed.nmodes_1[idx], bispec_ref.nmodes_1[idx]);
+    EXPECT_NEAR(
+      bispec_resumed.k1_eff[idx], bispec_ref.k1_eff[idx],
+      TOL * std::abs(bispec_ref.k1_eff[idx])
+    );
+    EXPECT_LE(
+      std::abs(bispec_resumed.bk_raw[idx] - bispec_ref.bk_raw[idx]),
+      TOL * bk_raw_max
+    ) << "Mismatch: bk_raw, index " << idx;
+    EXPECT_LE(
+      std::abs(bispec_resumed.bk_shot[idx] - bispec_ref.bk_shot[idx]),
+      TOL * bk_shot_max
+    ) << "Mismatch: bk_shot, index " << idx;
+  }
+}
+
+// Test method: test_resume_rejects_mismatch
+TEST_F(BispecCheckpointTest, test_resume_rejects_mismatch) {
+  this->measure(NORM_FACTOR, this->checkpoint_filepath, false);
+
+  // Mismatching normalisation (e.g. from changed catalogue contents).
+  EXPECT_THROW(
+    this->measure(2. * NORM_FACTOR, this->checkpoint_filepath, true),
+    trv::sys::InvalidParameterError
+  );
+
+  // Mismatching parameter set hash.
+  this->params.assignment = "cic";
+  this->params.validate();
+  EXPECT_THROW(
+    this->measure(NORM_FACTOR, this->checkpoint_filepath, true),
+    trv::sys::InvalidParameterError
+  );
+}
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "dataobjs.hpp"
+#include "particles.hpp"
+#include "field.hpp"
+#include "twopt.hpp"
+
+// Test suite: FieldR2CTest
+
+// Test fixture
+class FieldR2CTest
+  : public ::testing::TestWithParam<
+      std::tuple<std::string, std::array<int, 3>>
+    > {
+ protected:
+  void SetUp() override {
+    this->ngrid = std::get<1>(GetParam());
+
+    // Set up an interlaced power spectrum monopole measurement
+    // with bins extending beyond the Nyquist wavenumber.
+    this->params.catalogue_type = "survey";
+    this->params.statistic_type = "powspec";
+    this->params.ell1 = 0;
+    this->params.ell2 = 0;
+    this->params.ELL = 0;
+    this->params.assignment = std::get<0>(GetParam());
+    this->params.interlace = "true";
+    this->params.binning = "lin";
+    this->params.bin_min = 0.;
+    this->params.bin_max = 0.12;
+    this->params.num_bins = 24;
+    this->params.verbose = 60;
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      this->params.boxsize[iaxis] = BOXSIZE;
+      this->params.ngrid[iaxis] = this->ngrid[iaxis];
+    }
+    this->params.validate();
+
+    // Load the reference catalogues (relative to the repository root,
+    // from which tests are run).
+    ASSERT_EQ(
+      this->catalogue_data.load_catalogue_file(
+        "tests/test_input/ctlgs/test_data_catalogue.txt", "x,y,z,nz"
+      ),
+      0
+    );
+    ASSERT_EQ(
+      this->catalogue_rand.load_catalogue_file(
+        "tests/test_input/ctlgs/test_rand_catalogue.txt", "x,y,z,nz"
+      ),
+      0
+    );
+    trv::ParticleCatalogue::centre_in_box(
+      this->catalogue_data, this->catalogue_rand, this->params.boxsize
+    );
+
+    this->los_data = this->compute_los(this->catalogue_data);
+    this->los_rand = this->compute_los(this->catalogue_rand);
+    this->alpha = this->catalogue_data.wstotal / this->catalogue_rand.wstotal;
+  }
+
+  void TearDown() override {
+    delete[] this->los_data; this->los_data = nullptr;
+    delete[] this->los_rand; this->los_rand = nullptr;
+  }
+
+  trv::LineOfSight* compute_los(trv::ParticleCatalogue& catalogue) {
+    trv::LineOfSight* los = new trv::LineOfSight[catalogue.ntotal];
+    for (int pid = 0; pid < catalogue.ntotal; pid++) {
+      double los_mag = std::sqrt(
+        catalogue[pid].pos[0] * catalogue[pid].pos[0]
+        + catalogue[pid].pos[1] * catalogue[pid].pos[1]
+        + catalogue[pid].pos[2] * catalogue[pid].pos[2]
+      );
+      for (int iaxis = 0; iaxis < 3; iaxis++) {
+        los[pid].pos[iaxis] = catalogue[pid].pos[iaxis] / los_mag;
+      }
+    }
+    return los;
+  }
+
+  // Compute the Fourier-space monopole field fluctuations as in
+  // power spectrum measurements.
+  void compute_field(trv::MeshField& dn_00) {
+    dn_00.compute_ylm_wgtd_field(
+      this->catalogue_data, this->catalogue_rand,
+      this->los_data, this->los_rand, this->alpha, 0, 0
+    );
+    dn_00.fourier_transform();
+  }
+
+  // Test data members
+  static constexpr double BOXSIZE = 1000.;
+  static constexpr double TOL = 1.e-10;  // relative to the maximum
+  std::array<int, 3> ngrid;
+  trv::ParameterSet params;
+  trv::ParticleCatalogue catalogue_data;
+  trv::ParticleCatalogue catalogue_rand;
+  trv::LineOfSight* los_data = nullptr;
+  trv::LineOfSight* los_rand = nullptr;
+  double alpha = 1.;
+};
+
+// Test method: test_fourier_modes
+TEST_P(FieldR2CTest, test_fourier_modes) {
+  trv::MeshField dn_00_c2c(this->params, true, "dn_00_c2c", false);
+  trv::MeshField dn_00_r2c(this->params, true, "dn_00_r2c", true);
+  this->compute_field(dn_00_c2c);
+  this->compute_field(dn_00_r2c);
+
+  // Compare all Fourier modes, including those recovered by Hermitian
+  // symmetry and those on the Nyquist planes (or at the middle index
+  // pairs for odd numbers of grid cells), where the interlacing phase
+  // is not Hermitian.
+  auto unpaired = [](int idx, int n) {
+    return idx == n / 2 || idx == (n + 1) / 2;
+  };
+  double mode_max = 0., diff_max = 0., diff_max_unpaired = 0.;
+  for (int i = 0; i < this->ngrid[0]; i++) {
+    for (int j = 0; j < this->ngrid[1]; j++) {
+      for (int k = 0; k < this->ngrid[2]; k++) {
+        std::complex<double> mode_c2c = dn_00_c2c.ret_fourier_mode(i, j, k);
+        std::complex<double> mode_r2c = dn_00_r2c.ret_fourier_mode(i, j, k);
+        double diff = std::abs(mode_r2c - mode_c2c);
+
+        mode_max = std::max(mode_max, std::abs(mode_c2c));
+        diff_max = std::max(diff_max, diff);
+        if (
+          unpaired(i, this->ngrid[0])
+          || unpaired(j, this->ngrid[1])
+          || unpaired(k, this->ngrid[2])
+        ) {
+          diff_max_unpaired = std::max(diff_max_unpaired, diff);
+        }
+      }
+    }
+  }
+  ASSERT_GT(mode_max, 0.);
+  EXPECT_LE(diff_max, TOL * mode_max);
+  EXPECT_LE(diff_max_unpaired, TOL * mode_max);
+}
+
+// Test method: test_binned_powspec
+TEST_P(FieldR2CTest, test_binned_powspec) {
+  trv::Binning kbinning(this->params);
+  kbinning.set_bins();
+
+  trv::MeshField dn_00_c2c(this->params, true, "dn_00_c2c", false);
+  trv::MeshField dn_00_r2c(this->params, true, "dn_00_r2c", true);
+  this->compute_field(dn_00_c2c);
+  this->compute_field(dn_00_r2c);
+
+  std::complex<double> sn_amp = trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, this->alpha, 0, 0
+  );
+
+  trv::FieldStats stats_c2c(this->params, false);
+  trv::FieldStats stats_r2c(this->params, false);
+  stats_c2c.compute_ylm_wgtd_2pt_stats_in_fourier(
+    dn_00_c2c, dn_00_c2c, sn_amp, 0, 0, kbinning
+  );
+  stats_r2c.compute_ylm_wgtd_2pt_stats_in_fourier(
+    dn_00_r2c, dn_00_r2c, sn_amp, 0, 0, kbinning
+  );
+
+  double pk_max = 0.;
+  for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
+    pk_max = std::max(pk_max, std::abs(stats_c2c.pk[ibin]));
+  }
+  ASSERT_GT(pk_max, 0.);
+
+  // The bins cover the Nyquist wavenumber along every axis.
+  const double k_nyquist =
+    M_PI * *std::max_element(this->ngrid.begin(), this->ngrid.end()) / BOXSIZE;
+  bool nyquist_covered = false;
+  for (int ibin = 0; ibin < kbinning.num_bins; ibin++) {
+    if (
+      kbinning.bin_edges[ibin] <= k_nyquist
+      && k_nyquist < kbinning.bin_edges[ibin + 1]
+      && stats_c2c.nmodes[ibin] > 0
+    ) {
+      nyquist_covered = true;
+    }
+
+    EXPECT_EQ(stats_r2c.nmodes[ibin], stats_c2c.nmodes[ibin]);
+    EXPECT_NEAR(stats_r2c.k[ibin], stats_c2c.k[ibin], 1.e-12);
+    EXPECT_LE(std::abs(stats_r2c.pk[ibin] - stats_c2c.pk[ibin]), TOL * pk_max)
+      << "Mismatch in bin " << ibin;
+    EXPECT_LE(
+      std::abs(stats_r2c.sn[ibin] - stats_c2c.sn[ibin]),
+      TOL * std::max(std::abs(stats_c2c.sn[ibin]), pk_max)
+    ) << "Mismatch in bin " << ibin;
+  }
+  EXPECT_TRUE(nyquist_covered);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  AssignmentSchemesAndGrids, FieldR2CTest,
+  ::testing::Combine(
+    ::testing::Values("ngp", "cic", "tsc", "pcs"),
+    ::testing::Values(
+      std::array<int, 3>{16, 16, 16},
+      std::array<int, 3>{32, 32, 31},
+      std::array<int, 3>{33, 33, 33}
+    )
+  )
+);
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,333 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "jobqueue.hpp"
+
+// Test suite: JobRequestTest
+
+// Test method: test_request_round_trip
+TEST(JobRequestTest, test_request_round_trip) {
+  std::vector<std::string> args = {"params.ini", "--batch", "list.txt"};
+  std::string request = trv::sys::compose_job_request("/path/to dir", args);
+
+  std::string cwd;
+  std::vector<std::string> args_parsed;
+  ASSERT_TRUE(trv::sys::parse_job_request(request, cwd, args_parsed));
+  EXPECT_EQ(cwd, "/path/to dir");
+  EXPECT_EQ(args_parsed, args);
+}
+
+// Test method: test_request_malformed
+TEST(JobRequestTest, test_request_malformed) {
+  std::string cwd;
+  std::vector<std::string> args;
+  EXPECT_FALSE(trv::sys::parse_job_request("", cwd, args));
+  EXPECT_FALSE(trv::sys::parse_job_request("/path/to/dir", cwd, args));
+}
+
+// Test method: test_line_transfer
+TEST(JobRequestTest, test_line_transfer) {
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+  ASSERT_TRUE(trv::sys::write_line(fds[0], "first line"));
+  ASSERT_TRUE(trv::sys::write_line(fds[0], ""));
+  ASSERT_TRUE(trv::sys::write_line(fds[0], "last line"));
+  close(fds[0]);
+
+  std::string line;
+  ASSERT_TRUE(trv::sys::read_line(fds[1], line));
+  EXPECT_EQ(line, "first line");
+  ASSERT_TRUE(trv::sys::read_line(fds[1], line));
+  EXPECT_EQ(line, "");
+  ASSERT_TRUE(trv::sys::read_line(fds[1], line));
+  EXPECT_EQ(line, "last line");
+  EXPECT_FALSE(trv::sys::read_line(fds[1], line));
+  close(fds[1]);
+}
+
+// Test method: test_line_timeout
+TEST(JobRequestTest, test_line_timeout) {
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+  // A complete line is read within the timeout.
+  std::string line;
+  ASSERT_TRUE(trv::sys::write_line(fds[0], "complete line"));
+  ASSERT_TRUE(trv::sys::read_line(fds[1], line, 1));
+  EXPECT_EQ(line, "complete line");
+
+  // A partial line from an idle peer is not read once timed out.
+  ASSERT_EQ(write(fds[0], "partial", 7), 7);
+  EXPECT_FALSE(trv::sys::read_line(fds[1], line, 1));
+
+  close(fds[0]);
+  close(fds[1]);
+}
+
+// Test suite: JobSocketTest
+
+// Test method: test_socket_path_not_socket
+TEST(JobSocketTest, test_socket_path_not_socket) {
+  // A non-socket file at the socket path (e.g. a parameter file passed
+  // by mistake) is neither removed nor replaced.
+  std::string filepath =
+    ::testing::TempDir() + "test_jobqueue_file." + std::to_string(getpid());
+  std::ofstream(filepath) << "statistic_type = powspec\n";
+
+  EXPECT_THROW(trv::sys::listen_on_socket(filepath), trv::sys::IOError);
+
+  struct stat file_stat;
+  ASSERT_EQ(lstat(filepath.c_str(), &file_stat), 0);
+  EXPECT_TRUE(S_ISREG(file_stat.st_mode));
+  EXPECT_GT(file_stat.st_size, 0);
+
+  std::remove(filepath.c_str());
+}
+
+// Test method: test_socket_owner_only
+TEST(JobSocketTest, test_socket_owner_only) {
+  std::string socket_path =
+    ::testing::TempDir() + "test_jobqueue_sock." + std::to_string(getpid());
+
+  // A stale socket file is replaced.
+  for (int ilisten = 0; ilisten < 2; ilisten++) {
+    int fd = trv::sys::listen_on_socket(socket_path);
+    close(fd);
+  }
+
+  struct stat socket_stat;
+  ASSERT_EQ(lstat(socket_path.c_str(), &socket_stat), 0);
+  EXPECT_TRUE(S_ISSOCK(socket_stat.st_mode));
+  EXPECT_EQ(socket_stat.st_mode & 0077, 0u);
+
+  unlink(socket_path.c_str());
+}
+
+// Test suite: JobServerTest
+
+// Test fixture
+class JobServerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // The program executable is provided by the test runner.
+    const char* progexe = std::getenv("TRV_PROGEXE");
+    if (progexe == nullptr || access(progexe, X_OK) != 0) {
+      GTEST_SKIP() << "Program executable unavailable (set TRV_PROGEXE).";
+    }
+
+    this->socket_path =
+      ::testing::TempDir() + "test_jobqueue." + std::to_string(getpid());
+    unlink(this->socket_path.c_str());
+
+    this->pid_server = fork();
+    ASSERT_NE(this->pid_server, -1);
+    if (this->pid_server == 0) {
+      std::freopen("/dev/null", "w", stdout);
+      execl(
+        progexe, progexe, "--serve", this->socket_path.c_str(),
+        static_cast<char*>(nullptr)
+      );
+      _exit(127);
+    }
+
+    // Wait for the server to listen on the socket.
+    for (int itry = 0; itry < 100; itry++) {
+      struct stat socket_stat;
+      if (stat(this->socket_path.c_str(), &socket_stat) == 0) {return;}
+      usleep(50000);
+    }
+    FAIL() << "Server did not start listening on the socket.";
+  }
+
+  void TearDown() override {
+    if (this->pid_server > 0) {
+      kill(this->pid_server, SIGTERM);
+      waitpid(this->pid_server, nullptr, 0);
+    }
+    unlink(this->socket_path.c_str());
+  }
+
+  // Submit a request line, and return the exit status in the response
+  // (or -1 if there is none) with the preceding output lines.
+  int submit(const std::string& request, std::vector<std::string>& output) {
+    int fd = trv::sys::connect_to_socket(this->socket_path);
+    trv::sys::write_line(fd, request);
+
+    int status = -1;
+    std::string line;
+    while (trv::sys::read_line(fd, line)) {
+      if (line.rfind(trv::sys::JOB_STATUS_TAG, 0) == 0) {
+        status = std::atoi(
+          line.substr(trv::sys::JOB_STATUS_TAG.size()).c_str()
+        );
+        break;
+      }
+      output.push_back(line);
+    }
+    close(fd);
+
+    return status;
+  }
+
+  // Submit a job, and return the exit status in the response.
+  int submit_job(
+    const std::vector<std::string>& args, std::vector<std::string>& output
+  ) {
+    char cwd[4096];
+    if (getcwd(cwd, sizeof(cwd)) == nullptr) {return -1;}
+    return this->submit(trv::sys::compose_job_request(cwd, args), output);
+  }
+
+  // Test data members
+  std::string socket_path;
+  pid_t pid_server = -1;
+};
+
+// Test method: test_submit_job
+TEST_F(JobServerTest, test_submit_job) {
+  // Measure the same power spectrum twice, the second time with
+  // objects kept warm from the first job.
+  std::string param_filepath = this->socket_path + ".ini";
+  std::string meas_filepath = ::testing::TempDir() + "pk0_jobqueue";
+  std::ofstream param_file(param_filepath);
+  param_file
+    << "catalogue_dir = tests/test_input/ctlgs\n"
+    << "measurement_dir = " << ::testing::TempDir() << "\n"
+    << "data_catalogue_file = test_data_catalogue.txt\n"
+    << "catalogue_columns = x,y,z,nz\n"
+    << "output_tag = _jobqueue\n"
+    << "boxsize_x = 1000.\nboxsize_y = 1000.\nboxsize_z = 1000.\n"
+    << "ngrid_x = 16\nngrid_y = 16\nngrid_z = 16\n"
+    << "alignment = centre\npadscale = box\n"
+    << "assignment = tsc\ninterlace = false\n"
+    << "catalogue_type = sim\nstatistic_type = powspec\n"
+    << "ell1 = 0\nell2 = 0\nELL = 0\ni_wa = 0\nj_wa = 0\nform = diag\n"
+    << "norm_convention = particle\n"
+    << "binning = lin\nbin_min = 0.005\nbin_max = 0.105\nnum_bins = 4\n"
+    << "idx_bin = 0\n"
+    << "fftw_scheme = estimate\nuse_fftw_wisdom = false\n"
+    << "save_binned_vectors = false\n"
+    << "verbose = 20\n";
+  param_file.close();
+
+  std::vector<std::string> meas_contents;
+  for (int ijob = 0; ijob < 2; ijob++) {
+    std::remove(meas_filepath.c_str());
+
+    std::vector<std::string> output;
+    EXPECT_EQ(this->submit_job({param_filepath}, output), 0);
+    EXPECT_FALSE(output.empty());
+
+    std::ifstream meas_file(meas_filepath);
+    ASSERT_TRUE(meas_file.good()) << "Measurement file was not saved.";
+    meas_contents.emplace_back(
+      (std::istreambuf_iterator<char>(meas_file)),
+      std::istreambuf_iterator<char>()
+    );
+  }
+  EXPECT_EQ(meas_contents[1], meas_contents[0]);
+
+  std::remove(meas_filepath.c_str());
+  std::remove(
+    (::testing::TempDir() + "parameters_used_jobqueue").c_str()
+  );
+  std::remove(param_filepath.c_str());
+}
+
+// Test method: test_failed_job_status
+TEST_F(JobServerTest, test_failed_job_status) {
+  std::vector<std::string> output;
+  EXPECT_EQ(
+    this->submit_job({this->socket_path + ".nonexistent.ini"}, output), 1
+  );
+
+  // The server keeps serving after a failed job.
+  output.clear();
+  EXPECT_EQ(this->submit("malformed request", output), 1);
+}
+
+// Test method: test_shutdown
+TEST_F(JobServerTest, test_shutdown) {
+  std::vector<std::string> output;
+  EXPECT_EQ(this->submit_job({trv::sys::JOB_SHUTDOWN_ARG}, output), 0);
+
+  int status = -1;
+  ASSERT_EQ(waitpid(this->pid_server, &status, 0), this->pid_server);
+  this->pid_server = -1;
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+
+  struct stat socket_stat;
+  EXPECT_NE(stat(this->socket_path.c_str(), &socket_stat), 0);
+}
+
+// Test suite: JobClientTest
+
+// Test method: test_client_rejects_invalid_params
+TEST(JobClientTest, test_client_rejects_invalid_params) {
+  // The client executable is next to the program executable provided
+  // by the test runner.
+  const char* progexe = std::getenv("TRV_PROGEXE");
+  std::string clientexe = (progexe == nullptr) ? "" : progexe;
+  clientexe =
+    clientexe.substr(0, clientexe.find_last_of('/') + 1) + "trvclient";
+  if (progexe == nullptr || access(clientexe.c_str(), X_OK) != 0) {
+    GTEST_SKIP() << "Client executable unavailable (set TRV_PROGEXE).";
+  }
+
+  // Invalid parameters are rejected before any connection to a server
+  // (none of which is listening on the socket path).
+  std::string stem =
+    ::testing::TempDir() + "test_jobqueue_client." + std::to_string(getpid());
+  std::string param_filepath = stem + ".ini";
+  std::string stderr_filepath = stem + ".err";
+  std::ofstream(param_filepath)
+    << "catalogue_type = sim\nstatistic_type = powspec\n"
+    << "assignment = invalid\n";
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    std::freopen("/dev/null", "w", stdout);
+    std::freopen(stderr_filepath.c_str(), "w", stderr);
+    execl(
+      clientexe.c_str(), clientexe.c_str(), (stem + ".sock").c_str(),
+      param_filepath.c_str(), static_cast<char*>(nullptr)
+    );
+    _exit(127);
+  }
+  int status = -1;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 1);
+
+  std::ifstream stderr_file(stderr_filepath);
+  std::string stderr_contents(
+    (std::istreambuf_iterator<char>(stderr_file)),
+    std::istreambuf_iterator<char>()
+  );
+  EXPECT_EQ(stderr_contents.find("connect"), std::string::npos)
+    << stderr_contents;
+
+  std::remove(param_filepath.c_str());
+  std::remove(stderr_filepath.c_str());
+}
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+// Test suite: MPISlabTest
+
+// Test fixture
+class MPISlabTest : public ::testing::TestWithParam<int> {
+ protected:
+  void SetUp() override {
+    // The program executable and the MPI launcher (with any options,
+    // e.g. "mpiexec --oversubscribe") are provided by the test runner.
+    // Without an MPI launcher, the program is run as a single task.
+    this->progexe = std::getenv("TRV_PROGEXE");
+    if (this->progexe == nullptr || access(this->progexe, X_OK) != 0) {
+      GTEST_SKIP() << "Program executable unavailable (set TRV_PROGEXE).";
+    }
+    const char* mpiexec = std::getenv("TRV_MPIEXEC");
+    std::istringstream mpiexec_stream((mpiexec == nullptr) ? "" : mpiexec);
+    for (std::string arg; mpiexec_stream >> arg;) {
+      this->launcher.push_back(arg);
+    }
+    if (this->launcher.empty() && GetParam() > 1) {
+      GTEST_SKIP() << "MPI launcher unavailable (set TRV_MPIEXEC).";
+    }
+
+    this->test_dir =
+      ::testing::TempDir() + "test_mpi_slab." + std::to_string(getpid()) + "/";
+    mkdir(this->test_dir.c_str(), 0755);
+    mkdir((this->test_dir + "serial").c_str(), 0755);
+    mkdir((this->test_dir + "mpi").c_str(), 0755);
+  }
+
+  void TearDown() override {
+    if (!this->test_dir.empty()) {
+      std::system(("rm -rf " + this->test_dir).c_str());
+    }
+  }
+
+  // Write a parameter file for measurements from the reference
+  // catalogues.
+  std::string write_params(
+    const std::string& tag, const std::string& measurement_dir,
+    const std::string& catalogue_type, const std::string& statistic_type,
+    int ELL, const std::string& assignment, const std::string& interlace
+  ) {
+    std::string param_filepath = this->test_dir + tag + ".ini";
+    bool fourier = (statistic_type == "powspec" || statistic_type == "bispec");
+    std::ofstream param_file(param_filepath);
+    param_file
+      << "catalogue_dir = tests/test_input/ctlgs\n"
+      << "measurement_dir = " << measurement_dir << "\n"
+      << "data_catalogue_file = test_data_catalogue.txt\n"
+      << "rand_catalogue_file = test_rand_catalogue.txt\n"
+      << "catalogue_columns = x,y,z,nz\n"
+      << "output_tag = _" << tag << "\n"
+      << "boxsize_x = 1000.\nboxsize_y = 1000.\nboxsize_z = 1000.\n"
+      << "ngrid_x = 16\nngrid_y = 16\nngrid_z = 16\n"
+      << "alignment = centre\npadscale = box\n"
+      << "assignment = " << assignment << "\n"
+      << "interlace = " << interlace << "\n"
+      << "catalogue_type = " << catalogue_type << "\n"
+      << "statistic_type = " << statistic_type << "\n"
+      << "ell1 = 0\nell2 = 0\nELL = " << ELL << "\n"
+      << "i_wa = 0\nj_wa = 0\nform = diag\n"
+      << "norm_convention = particle\n"
+      << "binning = lin\n"
+      << "bin_min = " << (fourier ? 0. : 50.) << "\n"
+      << "bin_max = " << (fourier ? 0.09 : 250.) << "\n"
+      << "num_bins = 9\nidx_bin = 0\n"
+      << "fftw_scheme = estimate\nuse_fftw_wisdom = false\n"
+      << "save_binned_vectors = false\n"
+      << "verbose = 20\n";
+    return param_filepath;
+  }
+
+  // Run the program (with the MPI launcher, if any, on a number of
+  // tasks if positive), and return its exit status.
+  int run_program(const std::string& param_filepath, int ntasks) {
+    std::vector<std::string> args;
+    if (ntasks > 0 && !this->launcher.empty()) {
+      args = this->launcher;
+      args.push_back("-np");
+      args.push_back(std::to_string(ntasks));
+    }
+    args.push_back(this->progexe);
+    args.push_back(param_filepath);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      int fd_null = open("/dev/null", O_WRONLY);
+      dup2(fd_null, STDOUT_FILENO);
+      dup2(fd_null, STDERR_FILENO);
+      std::vector<char*> argv;
+      for (const std::string& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+      }
+      argv.push_back(nullptr);
+      execvp(argv[0], argv.data());
+      _exit(127);
+    }
+    int status = -1;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid) {return -1;}
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+
+  // Read the data table of a measurement file.
+  std::vector<std::vector<double>> read_datatab(const std::string& filepath) {
+    std::ifstream fin(filepath);
+    std::vector<std::vector<double>> datatab;
+    std::string line;
+    while (std::getline(fin, line)) {
+      if (line.empty() || line[0] == '#') {continue;}
+      std::istringstream line_stream(line);
+      std::vector<double> row;
+      for (double entry; line_stream >> entry;) {row.push_back(entry);}
+      datatab.push_back(row);
+    }
+    return datatab;
+  }
+
+  // Test data members
+  static constexpr double TOL = 1.e-10;  // relative to the maximum
+  const char* progexe = nullptr;
+  std::vector<std::string> launcher;
+  std::string test_dir;
+};
+
+// Test method: test_slab_equals_serial
+TEST_P(MPISlabTest, test_slab_equals_serial) {
+  struct Case {
+    std::string tag, catalogue_type, statistic_type, assignment, interlace;
+    int ELL;
+    std::string prefix;  // measurement file name prefix
+  };
+  std::vector<Case> cases = {
+    {"pk_survey", "survey", "powspec", "tsc", "true", 0, "pk0"},
+    {"pk_sim", "sim", "powspec", "pcs", "false", 2, "pk2"},
+    {"xi_survey", "survey", "2pcf", "pcs", "true", 2, "xi2"},
+    {"bk_survey", "survey", "bispec", "tsc", "false", 0, "bk000_diag"},
+    {"bk_sim", "sim", "bispec", "pcs", "false", 0, "bk000_diag"},
+  };
+
+  for (const Case& case_ : cases) {
+    std::string param_filepath_serial = this->write_params(
+      case_.tag + "_serial", this->test_dir + "serial",
+      case_.catalogue_type, case_.statistic_type, case_.ELL,
+      case_.assignment, case_.interlace
+    );
+    std::string param_filepath_mpi = this->write_params(
+      case_.tag + "_mpi", this->test_dir + "mpi",
+      case_.catalogue_type, case_.statistic_type, case_.ELL,
+      case_.assignment, case_.interlace
+    );
+    ASSERT_EQ(this->run_program(param_filepath_serial, 0), 0);
+    ASSERT_EQ(this->run_program(param_filepath_mpi, GetParam()), 0);
+
+    std::vector<std::vector<double>> datatab_serial = this->read_datatab(
+      this->test_dir + "serial/" + case_.prefix + "_" + case_.tag + "_serial"
+    );
+    std::vector<std::vector<double>> datatab_mpi = this->read_datatab(
+      this->test_dir + "mpi/" + case_.prefix + "_" + case_.tag + "_mpi"
+    );
+    ASSERT_FALSE(datatab_serial.empty()) << "Missing measurement: "
+      << case_.tag;
+    ASSERT_EQ(datatab_mpi.size(), datatab_serial.size());
+
+    double entry_max = 0.;
+    for (const std::vector<double>& row : datatab_serial) {
+      for (double entry : row) {
+        entry_max = std::max(entry_max, std::abs(entry));
+      }
+    }
+    for (std::size_t irow = 0; irow < datatab_serial.size(); irow++) {
+      ASSERT_EQ(datatab_mpi[irow].size(), datatab_serial[irow].size());
+      for (std::size_t icol = 0; icol < datatab_serial[irow].size(); icol++) {
+        EXPECT_NEAR(
+          datatab_mpi[irow][icol], datatab_serial[irow][icol],
+          TOL * entry_max
+        ) << "Mismatch: " << case_.tag << ", row " << irow
+          << ", column " << icol;
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  NumTasks, MPISlabTest, ::testing::Values(1, 2, 3)
+);
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
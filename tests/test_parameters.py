@@ -121,11 +121,16 @@ def default_parameters():
         'padscale': 'box',
         'assignment': 'tsc',
         'interlace': False,
+        'assignment_engine': 'atomic',
+        'precision': 'double',
         'form': 'diag',
         'norm_convention': 'particle',
         'binning': 'lin',
+        'binning_reduction': 'thread',
         'fftw_scheme': 'measure',
         'use_fftw_wisdom': False,
+        'fft_batch': 1,
+        'memory_limit': 0.,
         'save_binned_vectors': False,
         'verbose': 20,
     }
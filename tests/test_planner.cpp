@@ -0,0 +1,338 @@
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "dataobjs.hpp"
+#include "particles.hpp"
+#include "planner.hpp"
+#include "twopt.hpp"
+#include "threept.hpp"
+
+namespace trvs = trv::sys;
+
+// Test suite: MemoryPlanTest
+
+// Test fixture
+class MemoryPlanTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Draw particles from a deterministic pseudo-random sequence.
+    unsigned long long seed = 1;
+    auto draw = [&seed]() {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return double(seed >> 11) / double(1ULL << 53);
+    };
+    auto fill = [&](trv::ParticleCatalogue& catalogue, int nparticle) {
+      catalogue.initialise_particles(nparticle);
+      for (int pid = 0; pid < nparticle; pid++) {
+        for (int iaxis = 0; iaxis < 3; iaxis++) {
+          catalogue[pid].pos[iaxis] = BOXSIZE * (.1 + .8 * draw());
+        }
+        catalogue[pid].nz = 1.e-4;
+        catalogue[pid].ws = 1.;
+        catalogue[pid].wc = 1.;
+        catalogue[pid].w = 1.;
+      }
+      catalogue.calc_pos_extents();
+      catalogue.wtotal = nparticle;
+      catalogue.wstotal = nparticle;
+    };
+    fill(this->catalogue_data, 200);
+    fill(this->catalogue_rand, 800);
+
+    this->los_data = this->compute_los(this->catalogue_data);
+    this->los_rand = this->compute_los(this->catalogue_rand);
+  }
+
+  void TearDown() override {
+    delete[] this->los_data; this->los_data = nullptr;
+    delete[] this->los_rand; this->los_rand = nullptr;
+  }
+
+  trv::LineOfSight* compute_los(trv::ParticleCatalogue& catalogue) {
+    trv::LineOfSight* los = new trv::LineOfSight[catalogue.ntotal];
+    for (int pid = 0; pid < catalogue.ntotal; pid++) {
+      double los_mag = std::sqrt(
+        catalogue[pid].pos[0] * catalogue[pid].pos[0]
+        + catalogue[pid].pos[1] * catalogue[pid].pos[1]
+        + catalogue[pid].pos[2] * catalogue[pid].pos[2]
+      );
+      for (int iaxis = 0; iaxis < 3; iaxis++) {
+        los[pid].pos[iaxis] = catalogue[pid].pos[iaxis] / los_mag;
+      }
+    }
+    return los;
+  }
+
+  // Measurement set-up.
+  struct Case {
+    std::string catalogue_type, statistic_type;
+    int ell1, ell2, ELL;
+    std::string form;
+    int idx_bin;
+    double bin_max;  // (beyond the Nyquist wavenumber if > 0.05)
+    std::string interlace = "false";
+  };
+
+  trv::ParameterSet set_params(const Case& case_) {
+    trv::ParameterSet params;
+    params.catalogue_type = case_.catalogue_type;
+    params.statistic_type = case_.statistic_type;
+    params.ell1 = case_.ell1;
+    params.ell2 = case_.ell2;
+    params.ELL = case_.ELL;
+    params.form = case_.form;
+    params.idx_bin = case_.idx_bin;
+    params.interlace = case_.interlace;
+    params.binning = "lin";
+    if (
+      case_.statistic_type == "powspec" || case_.statistic_type == "bispec"
+    ) {
+      params.bin_min = 0.01;
+      params.bin_max = (case_.bin_max > 0.) ? case_.bin_max : 0.05;
+    } else {
+      params.bin_min = 80.;
+      params.bin_max = 320.;
+    }
+    params.num_bins = NBINS;
+    params.verbose = 60;
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      params.boxsize[iaxis] = BOXSIZE;
+      params.ngrid[iaxis] = NGRID;
+    }
+    params.validate();
+    return params;
+  }
+
+  // Run a measurement and return the numbers of forward and
+  // backward FFTs performed.
+  std::vector<long long> count_ffts(trv::ParameterSet& params) {
+    trv::Binning binning(params);
+    binning.set_bins();
+
+    const std::string& stat = params.statistic_type;
+    const bool sim = (params.catalogue_type == "sim");
+    const double alpha =
+      this->catalogue_data.wstotal / this->catalogue_rand.wstotal;
+
+    trvs::count_fft = 0;
+    trvs::count_ifft = 0;
+    if (stat == "powspec" && sim) {
+      trv::compute_powspec_in_gpp_box(
+        this->catalogue_data, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "powspec") {
+      trv::compute_powspec(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "2pcf" && sim) {
+      trv::compute_corrfunc_in_gpp_box(
+        this->catalogue_data, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "2pcf") {
+      trv::compute_corrfunc(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "2pcf-win") {
+      trv::compute_corrfunc_window(
+        this->catalogue_rand, this->los_rand, params, binning,
+        alpha, NORM_FACTOR
+      );
+    } else
+    if (stat == "bispec" && sim) {
+      trv::compute_bispec_in_gpp_box(
+        this->catalogue_data, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "bispec") {
+      trv::compute_bispec(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "3pcf" && sim) {
+      trv::compute_3pcf_in_gpp_box(
+        this->catalogue_data, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "3pcf") {
+      trv::compute_3pcf(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, params, binning, NORM_FACTOR
+      );
+    } else
+    if (stat == "3pcf-win" || stat == "3pcf-win-wa") {
+      trv::compute_3pcf_window(
+        this->catalogue_rand, this->los_rand, params, binning,
+        alpha, NORM_FACTOR, stat == "3pcf-win-wa"
+      );
+    }
+
+    return {trvs::count_fft, trvs::count_ifft};
+  }
+
+  // Return the number of particles in catalogues used by a measurement.
+  long long ntotal_data(const trv::ParameterSet& params) {
+    return (params.catalogue_type == "random")
+      ? 0 : this->catalogue_data.ntotal;
+  }
+
+  long long ntotal_rand(const trv::ParameterSet& params) {
+    return (params.catalogue_type == "sim")
+      ? 0 : this->catalogue_rand.ntotal;
+  }
+
+  // Test data members
+  static constexpr double BOXSIZE = 1000.;
+  static constexpr int NGRID = 16;
+  static constexpr int NBINS = 3;
+  static constexpr double NORM_FACTOR = 1.e-3;
+  trv::ParticleCatalogue catalogue_data;
+  trv::ParticleCatalogue catalogue_rand;
+  trv::LineOfSight* los_data = nullptr;
+  trv::LineOfSight* los_rand = nullptr;
+};
+
+// Test method: test_fft_counts
+TEST_F(MemoryPlanTest, test_fft_counts) {
+  std::vector<Case> cases = {
+    {"survey", "powspec", 0, 0, 0, "diag", 0, 0.},
+    {"survey", "powspec", 0, 0, 2, "diag", 0, 0.},
+    {"survey", "powspec", 0, 0, 2, "diag", 0, 0.1},
+    {"sim", "powspec", 0, 0, 2, "diag", 0, 0.},
+    {"survey", "2pcf", 0, 0, 2, "diag", 0, 0.},
+    {"survey", "2pcf", 0, 0, 2, "diag", 0, 0., "true"},
+    {"sim", "2pcf", 0, 0, 2, "diag", 0, 0.},
+    {"random", "2pcf-win", 0, 0, 2, "diag", 0, 0.},
+    {"random", "2pcf-win", 0, 0, 2, "diag", 0, 0., "true"},
+    {"survey", "bispec", 0, 0, 0, "diag", 0, 0.},
+    {"survey", "bispec", 2, 0, 2, "diag", 0, 0.},
+    {"survey", "bispec", 2, 0, 2, "diag", 0, 0.1},
+    {"survey", "bispec", 2, 0, 2, "off-diag", 1, 0.},
+    {"survey", "bispec", 2, 0, 2, "row", 1, 0.},
+    {"survey", "bispec", 2, 0, 2, "full", 0, 0.},
+    {"survey", "bispec", 1, 1, 0, "full", 0, 0.},
+    {"survey", "bispec", 1, 1, 0, "full", 0, 0.1},
+    {"sim", "bispec", 2, 0, 2, "diag", 0, 0.},
+    {"sim", "bispec", 1, 1, 0, "full", 0, 0.},
+    {"survey", "3pcf", 0, 0, 0, "diag", 0, 0.},
+    {"survey", "3pcf", 2, 0, 2, "off-diag", -1, 0.},
+    {"survey", "3pcf", 2, 0, 2, "row", 1, 0.},
+    {"survey", "3pcf", 2, 0, 2, "full", 0, 0.},
+    {"survey", "3pcf", 1, 1, 0, "full", 0, 0.},
+    {"survey", "3pcf", 2, 0, 2, "diag", 0, 0., "true"},
+    {"sim", "3pcf", 2, 0, 2, "diag", 0, 0.},
+    {"sim", "3pcf", 1, 1, 0, "full", 0, 0.},
+    {"sim", "3pcf", 1, 1, 0, "full", 0, 0., "true"},
+    {"random", "3pcf-win", 2, 0, 2, "diag", 0, 0.},
+    {"random", "3pcf-win", 1, 1, 0, "full", 0, 0.},
+    {"random", "3pcf-win", 1, 1, 0, "full", 0, 0., "true"},
+    {"random", "3pcf-win-wa", 1, 1, 0, "diag", 0, 0.},
+  };
+
+  for (const Case& case_ : cases) {
+    trv::ParameterSet params = this->set_params(case_);
+    SCOPED_TRACE(
+      case_.catalogue_type + " " + case_.statistic_type
+      + " (" + std::to_string(case_.ell1) + ", " + std::to_string(case_.ell2)
+      + ", " + std::to_string(case_.ELL) + ") " + params.shape
+      + " to " + std::to_string(params.bin_max)
+      + " (interlace: " + params.interlace + ")"
+    );
+
+    trv::MemoryPlan plan = trv::estimate_memory_usage(
+      params, this->ntotal_data(params), this->ntotal_rand(params)
+    );
+    std::vector<long long> counts = this->count_ffts(params);
+
+    EXPECT_EQ(plan.count_fft, counts[0]);
+    EXPECT_EQ(plan.count_ifft, counts[1]);
+  }
+}
+
+// Test method: test_fallback_strategies
+TEST_F(MemoryPlanTest, test_fallback_strategies) {
+  trv::ParameterSet params = this->set_params(
+    {"survey", "bispec", 2, 0, 2, "full", 0, 0.}
+  );
+  const long long ntotal_data = this->ntotal_data(params);
+  const long long ntotal_rand = this->ntotal_rand(params);
+
+  // Estimate the peak memory usage with each combination of
+  // storage strategies adopted in turn.
+  auto estimate_peak = [&](
+    const std::string& shell_cache, const std::string& ylm_tables
+  ) {
+    trv::ParameterSet params_ = params;
+    params_.shell_cache = shell_cache;
+    params_.ylm_tables = ylm_tables;
+    return trv::estimate_memory_usage(
+      params_, ntotal_data, ntotal_rand
+    ).gbytes_peak;
+  };
+  const double gbytes_memory = estimate_peak("memory", "double");
+  const double gbytes_disk = estimate_peak("disk", "double");
+  const double gbytes_single = estimate_peak("disk", "single");
+  const double gbytes_none = estimate_peak("disk", "none");
+  ASSERT_GT(gbytes_memory, gbytes_disk);
+  ASSERT_GT(gbytes_disk, gbytes_single);
+  ASSERT_GT(gbytes_single, gbytes_none);
+
+  struct Fallback {
+    double memory_limit;
+    std::string shell_cache, ylm_tables;
+    bool within_limit;
+  };
+  std::vector<Fallback> fallbacks = {
+    {0., "memory", "double", true},
+    {gbytes_memory, "memory", "double", true},
+    {(gbytes_memory + gbytes_disk) / 2., "disk", "double", true},
+    {(gbytes_disk + gbytes_single) / 2., "disk", "single", true},
+    {(gbytes_single + gbytes_none) / 2., "disk", "none", true},
+    {gbytes_none / 2., "disk", "none", false},
+  };
+
+  for (const Fallback& fallback : fallbacks) {
+    SCOPED_TRACE("memory limit " + std::to_string(fallback.memory_limit));
+
+    params.memory_limit = fallback.memory_limit;
+    trv::MemoryPlan plan = trv::plan_memory_usage(
+      params, ntotal_data, ntotal_rand
+    );
+
+    EXPECT_EQ(params.shell_cache, fallback.shell_cache);
+    EXPECT_EQ(params.ylm_tables, fallback.ylm_tables);
+    EXPECT_EQ(plan.shell_cache, fallback.shell_cache);
+    EXPECT_EQ(plan.ylm_tables, fallback.ylm_tables);
+    EXPECT_EQ(plan.within_limit, fallback.within_limit);
+  }
+
+  // Two-point statistics have neither shell field caches nor spherical
+  // harmonic tables to fall back on.
+  trv::ParameterSet params_2pt = this->set_params(
+    {"survey", "powspec", 0, 0, 2, "diag", 0, 0.}
+  );
+  params_2pt.memory_limit = 1.e-9;
+  trv::MemoryPlan plan_2pt = trv::plan_memory_usage(
+    params_2pt, ntotal_data, ntotal_rand
+  );
+  EXPECT_EQ(params_2pt.shell_cache, "memory");
+  EXPECT_EQ(params_2pt.ylm_tables, "double");
+  EXPECT_FALSE(plan_2pt.within_limit);
+}
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,417 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "maths.hpp"
+#include "dataobjs.hpp"
+#include "particles.hpp"
+#include "field.hpp"
+#include "planner.hpp"
+#include "threept.hpp"
+
+namespace trvm = trv::maths;
+
+// Test suite: ShellCacheTest
+
+// Test fixture
+class ShellCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Draw particles from a deterministic pseudo-random sequence.
+    unsigned long long seed = 1;
+    auto draw = [&seed]() {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      return double(seed >> 11) / double(1ULL << 53);
+    };
+    auto fill = [&](trv::ParticleCatalogue& catalogue, int nparticle) {
+      catalogue.initialise_particles(nparticle);
+      for (int pid = 0; pid < nparticle; pid++) {
+        for (int iaxis = 0; iaxis < 3; iaxis++) {
+          catalogue[pid].pos[iaxis] = BOXSIZE * (.1 + .8 * draw());
+        }
+        catalogue[pid].nz = 1.e-4;
+        catalogue[pid].ws = 1.;
+        catalogue[pid].wc = 1.;
+        catalogue[pid].w = 1.;
+      }
+      catalogue.calc_pos_extents();
+      catalogue.wtotal = nparticle;
+      catalogue.wstotal = nparticle;
+    };
+    fill(this->catalogue_data, 200);
+    fill(this->catalogue_rand, 800);
+
+    this->los_data = this->compute_los(this->catalogue_data);
+    this->los_rand = this->compute_los(this->catalogue_rand);
+    this->alpha = this->catalogue_data.wstotal / this->catalogue_rand.wstotal;
+  }
+
+  void TearDown() override {
+    delete[] this->los_data; this->los_data = nullptr;
+    delete[] this->los_rand; this->los_rand = nullptr;
+  }
+
+  trv::LineOfSight* compute_los(trv::ParticleCatalogue& catalogue) {
+    trv::LineOfSight* los = new trv::LineOfSight[catalogue.ntotal];
+    for (int pid = 0; pid < catalogue.ntotal; pid++) {
+      double los_mag = std::sqrt(
+        catalogue[pid].pos[0] * catalogue[pid].pos[0]
+        + catalogue[pid].pos[1] * catalogue[pid].pos[1]
+        + catalogue[pid].pos[2] * catalogue[pid].pos[2]
+      );
+      for (int iaxis = 0; iaxis < 3; iaxis++) {
+        los[pid].pos[iaxis] = catalogue[pid].pos[iaxis] / los_mag;
+      }
+    }
+    return los;
+  }
+
+  // Set up a three-point measurement in a small number of bins.
+  trv::ParameterSet set_params(
+    const std::string& statistic_type, int ell1, int ell2, int ELL,
+    const std::string& form, int idx_bin = 0
+  ) {
+    trv::ParameterSet params;
+    params.catalogue_type = "survey";
+    params.statistic_type = statistic_type;
+    params.ell1 = ell1;
+    params.ell2 = ell2;
+    params.ELL = ELL;
+    params.form = form;
+    params.idx_bin = idx_bin;
+    params.binning = "lin";
+    if (statistic_type == "bispec") {
+      params.bin_min = 0.01;
+      params.bin_max = 0.05;
+    } else {
+      params.bin_min = 80.;
+      params.bin_max = 320.;
+    }
+    params.num_bins = NBINS;
+    params.verbose = 60;
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      params.boxsize[iaxis] = BOXSIZE;
+      params.ngrid[iaxis] = NGRID;
+    }
+    params.validate();
+    return params;
+  }
+
+  // Assert that measurements in all pairs of bins from cached shell
+  // fields match the uncached per-pair measurements in rows.
+  void expect_bispec_matches_rows(
+    trv::ParameterSet& params, const trv::BispecMeasurements& bispec
+  ) {
+    const bool triu = (params.shape == "triu");
+
+    double bk_max = 0.;
+    for (int idx_row = 0; idx_row < NBINS; idx_row++) {
+      trv::ParameterSet params_row = this->set_params(
+        "bispec", params.ell1, params.ell2, params.ELL, "row", idx_row
+      );
+      trv::Binning kbinning(params_row);
+      kbinning.set_bins();
+
+      trv::BispecMeasurements bispec_row = trv::compute_bispec(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, params_row, kbinning, NORM_FACTOR
+      );
+      for (int idx_col = 0; idx_col < NBINS; idx_col++) {
+        bk_max = std::max(bk_max, std::abs(bispec_row.bk_raw[idx_col]));
+      }
+
+      for (int idx_col = triu ? idx_row : 0; idx_col < NBINS; idx_col++) {
+        int idx_dv = triu
+          ? (2*NBINS - idx_row + 1) * idx_row / 2 + (idx_col - idx_row)
+          : idx_row * NBINS + idx_col;
+
+        EXPECT_EQ(bispec.nmodes_1[idx_dv], bispec_row.nmodes_1[idx_col]);
+        EXPECT_EQ(bispec.nmodes_2[idx_dv], bispec_row.nmodes_2[idx_col]);
+        EXPECT_NEAR(bispec.k1_eff[idx_dv], bispec_row.k1_eff[idx_col], 1.e-12);
+        EXPECT_NEAR(bispec.k2_eff[idx_dv], bispec_row.k2_eff[idx_col], 1.e-12);
+        EXPECT_LE(
+          std::abs(bispec.bk_raw[idx_dv] - bispec_row.bk_raw[idx_col]),
+          TOL * bk_max
+        ) << "Mismatch in bins (" << idx_row << ", " << idx_col << ")";
+        EXPECT_LE(
+          std::abs(bispec.bk_shot[idx_dv] - bispec_row.bk_shot[idx_col]),
+          TOL * std::max(std::abs(bispec_row.bk_shot[idx_col]), bk_max)
+        ) << "Mismatch in bins (" << idx_row << ", " << idx_col << ")";
+      }
+    }
+    EXPECT_GT(bk_max, 0.);
+  }
+
+  // Assert that measurements in all pairs of bins from cached shell
+  // fields match the uncached per-pair measurements in rows.
+  void expect_3pcf_matches_rows(
+    trv::ParameterSet& params, const trv::ThreePCFMeasurements& threepcf
+  ) {
+    const bool triu = (params.shape == "triu");
+
+    double zeta_max = 0.;
+    for (int idx_row = 0; idx_row < NBINS; idx_row++) {
+      trv::ParameterSet params_row = this->set_params(
+        "3pcf", params.ell1, params.ell2, params.ELL, "row", idx_row
+      );
+      trv::Binning rbinning(params_row);
+      rbinning.set_bins();
+
+      trv::ThreePCFMeasurements threepcf_row = trv::compute_3pcf(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, params_row, rbinning, NORM_FACTOR
+      );
+      for (int idx_col = 0; idx_col < NBINS; idx_col++) {
+        zeta_max = std::max(
+          zeta_max, std::abs(threepcf_row.zeta_raw[idx_col])
+        );
+      }
+
+      for (int idx_col = triu ? idx_row : 0; idx_col < NBINS; idx_col++) {
+        int idx_dv = triu
+          ? (2*NBINS - idx_row + 1) * idx_row / 2 + (idx_col - idx_row)
+          : idx_row * NBINS + idx_col;
+
+        EXPECT_EQ(threepcf.npairs_1[idx_dv], threepcf_row.npairs_1[idx_col]);
+        EXPECT_EQ(threepcf.npairs_2[idx_dv], threepcf_row.npairs_2[idx_col]);
+        EXPECT_NEAR(
+          threepcf.r1_eff[idx_dv], threepcf_row.r1_eff[idx_col], 1.e-9
+        );
+        EXPECT_NEAR(
+          threepcf.r2_eff[idx_dv], threepcf_row.r2_eff[idx_col], 1.e-9
+        );
+        EXPECT_LE(
+          std::abs(threepcf.zeta_raw[idx_dv] - threepcf_row.zeta_raw[idx_col]),
+          TOL * zeta_max
+        ) << "Mismatch in bins (" << idx_row << ", " << idx_col << ")";
+        EXPECT_LE(
+          std::abs(
+            threepcf.zeta_shot[idx_dv] - threepcf_row.zeta_shot[idx_col]
+          ),
+          TOL * std::max(std::abs(threepcf_row.zeta_shot[idx_col]), zeta_max)
+        ) << "Mismatch in bins (" << idx_row << ", " << idx_col << ")";
+      }
+    }
+    EXPECT_GT(zeta_max, 0.);
+  }
+
+  // Test data members
+  static constexpr double BOXSIZE = 1000.;
+  static constexpr int NGRID = 16;
+  static constexpr int NBINS = 3;
+  static constexpr double NORM_FACTOR = 1.e-3;
+  static constexpr double TOL = 1.e-10;  // relative to the maximum
+  trv::ParticleCatalogue catalogue_data;
+  trv::ParticleCatalogue catalogue_rand;
+  trv::LineOfSight* los_data = nullptr;
+  trv::LineOfSight* los_rand = nullptr;
+  double alpha = 1.;
+};
+
+// Test method: test_shell_field_products
+TEST_F(ShellCacheTest, test_shell_field_products) {
+  trv::ParameterSet params = this->set_params("bispec", 1, 1, 0, "full");
+  trv::Binning kbinning(params);
+  kbinning.set_bins();
+
+  trv::MeshField dn_00(params, true, "dn_00", true);
+  dn_00.compute_ylm_wgtd_field(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, this->alpha, 0, 0
+  );
+  dn_00.fourier_transform();
+
+  // Any complex-valued field serves as the third field.
+  trv::MeshField G_LM(params, true, "G_LM");
+  G_LM.compute_ylm_wgtd_field(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, this->alpha, 1, 1
+  );
+
+  std::shared_ptr<trvm::SphericalHarmonicTable> ylm_k =
+    trvm::SphericalHarmonicTable::ret_shared(
+      1, true, params.boxsize, params.ngrid
+    );
+  const int m = 1;
+
+  // Compute the same shell fields in distinct caches, the second of
+  // which is spilled to disk.
+  trv::MeshField F_lm(params, true, "F_lm");
+  trv::ShellFieldCache shells_a(params, NBINS, "shells_a");
+  shells_a.compute_shell_fields(dn_00, *ylm_k, m, kbinning, F_lm);
+
+  params.shell_cache = "disk";
+  trv::ShellFieldCache shells_b(params, NBINS, "shells_b");
+  shells_b.compute_shell_fields(dn_00, *ylm_k, m, kbinning, F_lm);
+  EXPECT_FALSE(shells_a.spilled);
+  EXPECT_TRUE(shells_b.spilled);
+
+  std::vector<std::complex<double>> products_aliased =
+    trv::calc_shell_field_products(shells_a, shells_a, G_LM);
+  std::vector<std::complex<double>> products_distinct =
+    trv::calc_shell_field_products(shells_a, shells_b, G_LM);
+  std::vector<std::complex<double>> products_triu =
+    trv::calc_shell_field_products(shells_a, shells_a, G_LM, true);
+
+  // Compare with direct sums over band-limited fields per pair of bins.
+  trv::MeshField F_lm_a(params, true, "F_lm_a");
+  trv::MeshField F_lm_b(params, true, "F_lm_b");
+  std::vector<std::complex<double>> products_direct(NBINS * NBINS);
+  double product_max = 0.;
+  for (int ishell = 0; ishell < NBINS; ishell++) {
+    double k_eff_a;
+    int nmodes_a;
+    F_lm_a.inv_fourier_transform_ylm_wgtd_field_band_limited(
+      dn_00, *ylm_k, m,
+      kbinning.bin_edges[ishell], kbinning.bin_edges[ishell + 1],
+      k_eff_a, nmodes_a
+    );
+    EXPECT_NEAR(shells_a.k_eff[ishell], k_eff_a, 1.e-12);
+    EXPECT_EQ(shells_a.nmodes[ishell], nmodes_a);
+    EXPECT_EQ(shells_b.nmodes[ishell], nmodes_a);
+
+    for (int jshell = 0; jshell < NBINS; jshell++) {
+      double k_eff_b;
+      int nmodes_b;
+      F_lm_b.inv_fourier_transform_ylm_wgtd_field_band_limited(
+        dn_00, *ylm_k, m,
+        kbinning.bin_edges[jshell], kbinning.bin_edges[jshell + 1],
+        k_eff_b, nmodes_b
+      );
+
+      std::complex<double> product = 0.;
+      for (long long gid = 0; gid < params.nmesh; gid++) {
+        product += std::complex<double>(F_lm_a[gid][0], F_lm_a[gid][1])
+          * std::complex<double>(F_lm_b[gid][0], F_lm_b[gid][1])
+          * std::complex<double>(G_LM[gid][0], G_LM[gid][1]);
+      }
+      products_direct[ishell * NBINS + jshell] = product;
+      product_max = std::max(product_max, std::abs(product));
+    }
+  }
+  ASSERT_GT(product_max, 0.);
+
+  for (int ishell = 0; ishell < NBINS; ishell++) {
+    for (int jshell = 0; jshell < NBINS; jshell++) {
+      int ipair = ishell * NBINS + jshell;
+      EXPECT_LE(
+        std::abs(products_aliased[ipair] - products_direct[ipair]),
+        TOL * product_max
+      ) << "Mismatch in shells (" << ishell << ", " << jshell << ")";
+      EXPECT_LE(
+        std::abs(products_distinct[ipair] - products_aliased[ipair]),
+        TOL * product_max
+      ) << "Mismatch in shells (" << ishell << ", " << jshell << ")";
+      if (jshell >= ishell) {
+        EXPECT_EQ(products_triu[ipair], products_aliased[ipair]);
+      } else {
+        EXPECT_EQ(products_triu[ipair], std::complex<double>(0.));
+      }
+    }
+  }
+}
+
+// Test method: test_bispec_full
+TEST_F(ShellCacheTest, test_bispec_full) {
+  // Distinct shell caches for different degrees.
+  trv::ParameterSet params = this->set_params("bispec", 2, 0, 2, "full");
+  ASSERT_EQ(params.shape, "full");
+  trv::Binning kbinning(params);
+  kbinning.set_bins();
+
+  trv::BispecMeasurements bispec = trv::compute_bispec(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, params, kbinning, NORM_FACTOR
+  );
+  ASSERT_EQ(bispec.dim, NBINS * NBINS);
+
+  this->expect_bispec_matches_rows(params, bispec);
+}
+
+// Test method: test_bispec_triu
+TEST_F(ShellCacheTest, test_bispec_triu) {
+  // Shared shell caches at equal orders of equal degrees.
+  trv::ParameterSet params = this->set_params("bispec", 1, 1, 0, "full");
+  ASSERT_EQ(params.shape, "triu");
+  trv::Binning kbinning(params);
+  kbinning.set_bins();
+
+  trv::BispecMeasurements bispec = trv::compute_bispec(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, params, kbinning, NORM_FACTOR
+  );
+  ASSERT_EQ(bispec.dim, NBINS * (NBINS + 1) / 2);
+
+  this->expect_bispec_matches_rows(params, bispec);
+}
+
+// Test method: test_bispec_triu_disk
+TEST_F(ShellCacheTest, test_bispec_triu_disk) {
+  // Set a memory limit such that shell fields are spilled to disk
+  // but spherical harmonic tables are kept in double precision.
+  trv::ParameterSet params = this->set_params("bispec", 1, 1, 0, "full");
+  trv::MemoryPlan plan = trv::estimate_memory_usage(
+    params, this->catalogue_data.ntotal, this->catalogue_rand.ntotal
+  );
+  ASSERT_GT(plan.gbytes_shells, 0.);
+  params.memory_limit = plan.gbytes_peak - plan.gbytes_shells / 2.;
+
+  trv::Binning kbinning(params);
+  kbinning.set_bins();
+
+  trv::BispecMeasurements bispec = trv::compute_bispec(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, params, kbinning, NORM_FACTOR
+  );
+  EXPECT_EQ(params.shell_cache, "disk");
+  EXPECT_EQ(params.ylm_tables, "double");
+
+  this->expect_bispec_matches_rows(params, bispec);
+}
+
+// Test method: test_3pcf_full
+TEST_F(ShellCacheTest, test_3pcf_full) {
+  // Distinct shell caches for different degrees.
+  trv::ParameterSet params = this->set_params("3pcf", 2, 0, 2, "full");
+  ASSERT_EQ(params.shape, "full");
+  trv::Binning rbinning(params);
+  rbinning.set_bins();
+
+  trv::ThreePCFMeasurements threepcf = trv::compute_3pcf(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, params, rbinning, NORM_FACTOR
+  );
+  ASSERT_EQ(threepcf.dim, NBINS * NBINS);
+
+  this->expect_3pcf_matches_rows(params, threepcf);
+}
+
+// Test method: test_3pcf_triu
+TEST_F(ShellCacheTest, test_3pcf_triu) {
+  // Shared shell caches at equal orders of equal degrees.
+  trv::ParameterSet params = this->set_params("3pcf", 1, 1, 0, "full");
+  ASSERT_EQ(params.shape, "triu");
+  trv::Binning rbinning(params);
+  rbinning.set_bins();
+
+  trv::ThreePCFMeasurements threepcf = trv::compute_3pcf(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand, params, rbinning, NORM_FACTOR
+  );
+  ASSERT_EQ(threepcf.dim, NBINS * (NBINS + 1) / 2);
+
+  this->expect_3pcf_matches_rows(params, threepcf);
+}
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
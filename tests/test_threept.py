@@ -20,6 +20,8 @@ from triumvirate.threept import (
         ((0, 0, 0), 'diag', None),
         ((2, 0, 2), 'diag', None),
         ((0, 0, 0), 'row', 0),
+        ((2, 0, 2), 'row', 0),
+        ((2, 0, 2), 'off-diag', 1),
     ]
 )
 def test_compute_bispec(degrees, form, idx_bin,
@@ -74,6 +76,45 @@ def test_compute_bispec(degrees, form, idx_bin,
     ), "Measured shot noise contributions do not match."
 
 
+@pytest.mark.slow
+def test_compute_bispec_nyquist(test_data_catalogue, test_rand_catalogue,
+                                test_binning_fourier,
+                                test_paramset,
+                                test_logger,
+                                test_stats_dir):
+
+    # The last wavenumber bin straddles the Nyquist wavenumber, so that
+    # terms at negated orders are computed rather than mirrored.
+    test_paramset.update(ngrid={'x': 32, 'y': 32, 'z': 32})
+    measurements = compute_bispec(
+        test_data_catalogue, test_rand_catalogue,
+        degrees=(2, 0, 2),
+        binning=test_binning_fourier,
+        form='diag',
+        paramset=test_paramset,
+        logger=test_logger
+    )
+    measurements_ext = np.loadtxt(
+        test_stats_dir/"bk202_diag_lpp_ngrid32.txt", unpack=True
+    )
+
+    assert np.allclose(measurements['k1_bin'], measurements_ext[0]), \
+        "Measurement bins do not match."
+    assert np.allclose(measurements['k1_eff'], measurements_ext[1]), \
+        "Measured coordinates do not match."
+    assert np.allclose(measurements['nmodes_1'], measurements_ext[2]), \
+        "Measured mode counts do not match."
+    assert np.allclose(
+        measurements['bk_raw'],
+        measurements_ext[-4] + 1j * measurements_ext[-3]
+    ), "Measured raw statistics do not match."
+    assert np.allclose(
+        measurements['bk_shot'],
+        measurements_ext[-2] + 1j * measurements_ext[-1],
+        atol=1.e-6
+    ), "Measured shot noise contributions do not match."
+
+
 @pytest.mark.slow
 @pytest.mark.parametrize(
     "degrees, form, idx_bin",
@@ -147,6 +188,8 @@ def test_compute_3pcf(degrees, form, idx_bin,
         ((0, 0, 0), 'diag', None),
         ((2, 0, 2), 'diag', None),
         ((0, 0, 0), 'row', 0),
+        ((2, 0, 2), 'row', 0),
+        ((2, 0, 2), 'off-diag', 1),
     ]
 )
 def test_compute_bispec_in_gpp_box(degrees, form, idx_bin,
@@ -131,6 +131,87 @@ def test_compute_powspec_in_gpp_box(degree,
     ), "Measured shot noise contributions do not match."
 
 
+@pytest.mark.slow
+@pytest.mark.parametrize(
+    "degree",
+    [0, 2,]  # noqa: E231
+)
+def test_compute_powspec_in_gpp_box_interlaced(degree,
+                                               test_rand_catalogue,
+                                               test_binning_fourier,
+                                               test_paramset,
+                                               test_logger,
+                                               test_stats_dir):
+
+    # The random catalogue fills the box, so that the interlaced
+    # assignment stencil wraps around the box edges.
+    test_paramset.update(interlace=True)
+    measurements = compute_powspec_in_gpp_box(
+        test_rand_catalogue,
+        degree=degree,
+        binning=test_binning_fourier,
+        paramset=test_paramset,
+        logger=test_logger
+    )
+    measurements_ext = np.loadtxt(
+        test_stats_dir/f"pk{degree}_gpp_intlc.txt", unpack=True
+    )
+
+    assert np.allclose(measurements['kbin'], measurements_ext[0]), \
+        "Measurement bins do not match."
+    assert np.allclose(measurements['keff'], measurements_ext[1]), \
+        "Measured coordinates do not match."
+    assert np.allclose(measurements['nmodes'], measurements_ext[2]), \
+        "Measured mode counts do not match."
+    assert np.allclose(
+        measurements['pk_raw'],
+        measurements_ext[3] + 1j * measurements_ext[4]
+    ), "Measured raw statistics do not match."
+    assert np.allclose(
+        measurements['pk_shot'],
+        measurements_ext[5] + 1j * measurements_ext[6],
+        atol=1.e-5
+    ), "Measured shot noise contributions do not match."
+
+
+@pytest.mark.slow
+def test_compute_powspec_nyquist(test_data_catalogue, test_rand_catalogue,
+                                 test_binning_fourier,
+                                 test_paramset,
+                                 test_logger,
+                                 test_stats_dir):
+
+    # The last wavenumber bin straddles the Nyquist wavenumber, so that
+    # terms at negated orders are computed rather than mirrored.
+    test_paramset.update(ngrid={'x': 32, 'y': 32, 'z': 32})
+    measurements = compute_powspec(
+        test_data_catalogue, test_rand_catalogue,
+        degree=2,
+        binning=test_binning_fourier,
+        paramset=test_paramset,
+        logger=test_logger
+    )
+    measurements_ext = np.loadtxt(
+        test_stats_dir/"pk2_lpp_ngrid32.txt", unpack=True
+    )
+
+    assert np.allclose(measurements['kbin'], measurements_ext[0]), \
+        "Measurement bins do not match."
+    assert np.allclose(measurements['keff'], measurements_ext[1]), \
+        "Measured coordinates do not match."
+    assert np.allclose(measurements['nmodes'], measurements_ext[2]), \
+        "Measured mode counts do not match."
+    assert np.allclose(
+        measurements['pk_raw'],
+        measurements_ext[3] + 1j * measurements_ext[4]
+    ), "Measured raw statistics do not match."
+    assert np.allclose(
+        measurements['pk_shot'],
+        measurements_ext[5] + 1j * measurements_ext[6],
+        atol=1.e-6
+    ), "Measured shot noise contributions do not match."
+
+
 @pytest.mark.slow
 @pytest.mark.parametrize(
     "degree",
@@ -205,3 +286,83 @@ def test_compute_corrfunc_window(degree,
         measurements['xi'],
         measurements_ext[3] + 1j * measurements_ext[4]
     ), "Measured statistics do not match."
+
+
+@pytest.mark.slow
+@pytest.mark.parametrize(
+    "degree",
+    [0, 2,]  # noqa: E231
+)
+def test_compute_powspec_single_precision(degree,
+                                          test_data_catalogue,
+                                          test_rand_catalogue,
+                                          test_binning_fourier,
+                                          test_paramset,
+                                          test_logger):
+
+    measurements_double = compute_powspec(
+        test_data_catalogue, test_rand_catalogue,
+        degree=degree,
+        binning=test_binning_fourier,
+        paramset=test_paramset,
+        logger=test_logger
+    )
+
+    test_paramset.update(precision='single')
+    measurements_single = compute_powspec(
+        test_data_catalogue, test_rand_catalogue,
+        degree=degree,
+        binning=test_binning_fourier,
+        paramset=test_paramset,
+        logger=test_logger
+    )
+
+    assert np.allclose(
+        measurements_single['nmodes'], measurements_double['nmodes']
+    ), "Single-precision mode counts do not match."
+    assert np.allclose(
+        measurements_single['pk_raw'], measurements_double['pk_raw'],
+        rtol=1.e-4, atol=1.e-4 * np.max(np.abs(measurements_double['pk_raw']))
+    ), "Single-precision raw statistics do not match."
+    assert np.allclose(
+        measurements_single['pk_shot'], measurements_double['pk_shot'],
+        rtol=1.e-4, atol=1.e-6
+    ), "Single-precision shot noise contributions do not match."
+
+
+@pytest.mark.slow
+@pytest.mark.parametrize(
+    "degree",
+    [0, 2,]  # noqa: E231
+)
+def test_compute_corrfunc_single_precision(degree,
+                                           test_data_catalogue,
+                                           test_rand_catalogue,
+                                           test_binning_config,
+                                           test_paramset,
+                                           test_logger):
+
+    measurements_double = compute_corrfunc(
+        test_data_catalogue, test_rand_catalogue,
+        degree=degree,
+        binning=test_binning_config,
+        paramset=test_paramset,
+        logger=test_logger
+    )
+
+    test_paramset.update(precision='single')
+    measurements_single = compute_corrfunc(
+        test_data_catalogue, test_rand_catalogue,
+        degree=degree,
+        binning=test_binning_config,
+        paramset=test_paramset,
+        logger=test_logger
+    )
+
+    assert np.allclose(
+        measurements_single['npairs'], measurements_double['npairs']
+    ), "Single-precision pair counts do not match."
+    assert np.allclose(
+        measurements_single['xi'], measurements_double['xi'],
+        rtol=1.e-4, atol=1.e-4 * np.max(np.abs(measurements_double['xi']))
+    ), "Single-precision statistics do not match."
@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "dataobjs.hpp"
+#include "particles.hpp"
+#include "field.hpp"
+#include "twopt.hpp"
+
+// Test suite: TwoPointMirroringTest
+
+// Test fixture
+class TwoPointMirroringTest
+  : public ::testing::TestWithParam<std::tuple<std::string, int>> {
+ protected:
+  void SetUp() override {
+    // Set up a quadrupole two-point correlation function measurement
+    // with or without interlacing.
+    this->params.catalogue_type = "survey";
+    this->params.statistic_type = "2pcf";
+    this->params.ell1 = 0;
+    this->params.ell2 = 0;
+    this->params.ELL = 2;
+    this->params.assignment = "tsc";
+    this->params.interlace = std::get<0>(GetParam());
+    this->params.binning = "lin";
+    this->params.bin_min = 50.;
+    this->params.bin_max = 250.;
+    this->params.num_bins = 5;
+    this->params.verbose = 60;
+    for (int iaxis = 0; iaxis < 3; iaxis++) {
+      this->params.boxsize[iaxis] = BOXSIZE;
+      this->params.ngrid[iaxis] = std::get<1>(GetParam());
+    }
+    this->params.validate();
+
+    // Load the reference catalogues (relative to the repository root,
+    // from which tests are run).
+    ASSERT_EQ(
+      this->catalogue_data.load_catalogue_file(
+        "tests/test_input/ctlgs/test_data_catalogue.txt", "x,y,z,nz"
+      ),
+      0
+    );
+    ASSERT_EQ(
+      this->catalogue_rand.load_catalogue_file(
+        "tests/test_input/ctlgs/test_rand_catalogue.txt", "x,y,z,nz"
+      ),
+      0
+    );
+    trv::ParticleCatalogue::centre_in_box(
+      this->catalogue_data, this->catalogue_rand, this->params.boxsize
+    );
+
+    this->los_data = this->compute_los(this->catalogue_data);
+    this->los_rand = this->compute_los(this->catalogue_rand);
+    this->alpha = this->catalogue_data.wstotal / this->catalogue_rand.wstotal;
+  }
+
+  void TearDown() override {
+    delete[] this->los_data; this->los_data = nullptr;
+    delete[] this->los_rand; this->los_rand = nullptr;
+  }
+
+  trv::LineOfSight* compute_los(trv::ParticleCatalogue& catalogue) {
+    trv::LineOfSight* los = new trv::LineOfSight[catalogue.ntotal];
+    for (int pid = 0; pid < catalogue.ntotal; pid++) {
+      double los_mag = std::sqrt(
+        catalogue[pid].pos[0] * catalogue[pid].pos[0]
+        + catalogue[pid].pos[1] * catalogue[pid].pos[1]
+        + catalogue[pid].pos[2] * catalogue[pid].pos[2]
+      );
+      for (int iaxis = 0; iaxis < 3; iaxis++) {
+        los[pid].pos[iaxis] = catalogue[pid].pos[iaxis] / los_mag;
+      }
+    }
+    return los;
+  }
+
+  // Compute the (unnormalised) correlation function (window) by summing
+  // terms at all orders M, none of which is mirrored.
+  std::vector<std::complex<double>> compute_xi_all_orders(
+    trv::Binning& rbinning, bool window
+  ) {
+    trv::MeshField dn_00(this->params, true, "`dn_00`", true);
+    if (window) {
+      dn_00.compute_ylm_wgtd_field(
+        this->catalogue_rand, this->los_rand, this->alpha, 0, 0
+      );
+    } else {
+      dn_00.compute_ylm_wgtd_field(
+        this->catalogue_data, this->catalogue_rand,
+        this->los_data, this->los_rand, this->alpha, 0, 0
+      );
+    }
+    dn_00.fourier_transform();
+
+    trv::FieldStats stats_2pt(this->params);
+
+    std::vector<std::complex<double>> xi(rbinning.num_bins, 0.);
+    for (int M_ = - this->params.ELL; M_ <= this->params.ELL; M_++) {
+      trv::MeshField dn_LM(this->params, true, "`dn_LM`");
+      std::complex<double> sn_amp;
+      if (window) {
+        dn_LM.compute_ylm_wgtd_field(
+          this->catalogue_rand, this->los_rand, this->alpha,
+          this->params.ELL, M_
+        );
+        sn_amp = trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
+          this->catalogue_rand, this->los_rand, this->alpha,
+          this->params.ELL, M_
+        );
+      } else {
+        dn_LM.compute_ylm_wgtd_field(
+          this->catalogue_data, this->catalogue_rand,
+          this->los_data, this->los_rand, this->alpha,
+          this->params.ELL, M_
+        );
+        sn_amp = trv::calc_ylm_wgtd_shotnoise_amp_for_powspec(
+          this->catalogue_data, this->catalogue_rand,
+          this->los_data, this->los_rand, this->alpha,
+          this->params.ELL, M_
+        );
+      }
+      dn_LM.fourier_transform();
+
+      for (int m1 = - this->params.ELL; m1 <= this->params.ELL; m1++) {
+        double coupling = trv::calc_coupling_coeff_2pt(
+          this->params.ELL, this->params.ELL, m1, M_
+        );
+        if (std::fabs(coupling) < trvm::eps_coupling) {continue;}
+
+        stats_2pt.compute_ylm_wgtd_2pt_stats_in_config(
+          dn_LM, dn_00, sn_amp, this->params.ELL, m1, rbinning
+        );
+        for (int ibin = 0; ibin < rbinning.num_bins; ibin++) {
+          xi[ibin] += coupling * stats_2pt.xi[ibin];
+        }
+      }
+    }
+
+    return xi;
+  }
+
+  // Check measurements against the sum over all orders.
+  void check_against_all_orders(
+    const std::vector<std::complex<double>>& xi,
+    const std::vector<std::complex<double>>& xi_all_orders
+  ) {
+    ASSERT_EQ(xi.size(), xi_all_orders.size());
+
+    double xi_max = 0.;
+    for (const std::complex<double>& xi_ : xi_all_orders) {
+      xi_max = std::max(xi_max, NORM_FACTOR * std::abs(xi_));
+    }
+    ASSERT_GT(xi_max, 0.);
+
+    for (std::size_t ibin = 0; ibin < xi.size(); ibin++) {
+      EXPECT_LE(
+        std::abs(xi[ibin] - NORM_FACTOR * xi_all_orders[ibin]), TOL * xi_max
+      ) << "Mismatch in bin " << ibin;
+    }
+  }
+
+  // Test data members
+  static constexpr double BOXSIZE = 1000.;
+  static constexpr double NORM_FACTOR = 1.e-3;
+  static constexpr double TOL = 1.e-10;  // relative to the maximum
+  trv::ParameterSet params;
+  trv::ParticleCatalogue catalogue_data;
+  trv::ParticleCatalogue catalogue_rand;
+  trv::LineOfSight* los_data = nullptr;
+  trv::LineOfSight* los_rand = nullptr;
+  double alpha = 1.;
+};
+
+// Test method: test_corrfunc
+TEST_P(TwoPointMirroringTest, test_corrfunc) {
+  trv::Binning rbinning(this->params);
+  rbinning.set_bins();
+
+  trv::TwoPCFMeasurements corrfunc = trv::compute_corrfunc(
+    this->catalogue_data, this->catalogue_rand,
+    this->los_data, this->los_rand,
+    this->params, rbinning, NORM_FACTOR
+  );
+
+  this->check_against_all_orders(
+    corrfunc.xi, this->compute_xi_all_orders(rbinning, false)
+  );
+}
+
+// Test method: test_corrfunc_window
+TEST_P(TwoPointMirroringTest, test_corrfunc_window) {
+  this->params.catalogue_type = "random";
+  this->params.statistic_type = "2pcf-win";
+  this->params.validate();
+
+  trv::Binning rbinning(this->params);
+  rbinning.set_bins();
+
+  trv::TwoPCFWindowMeasurements corrfunc_win = trv::compute_corrfunc_window(
+    this->catalogue_rand, this->los_rand,
+    this->params, rbinning, this->alpha, NORM_FACTOR
+  );
+
+  this->check_against_all_orders(
+    corrfunc_win.xi, this->compute_xi_all_orders(rbinning, true)
+  );
+}
+
+// Mirroring applies only without interlacing on even mesh grids.
+INSTANTIATE_TEST_SUITE_P(
+  InterlacingAndGrids, TwoPointMirroringTest,
+  ::testing::Values(
+    std::make_tuple("false", 16),
+    std::make_tuple("true", 16),
+    std::make_tuple("false", 15),
+    std::make_tuple("true", 15)
+  )
+);
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
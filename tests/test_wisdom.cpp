@@ -0,0 +1,275 @@
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <fftw3.h>
+#include <gtest/gtest.h>
+
+#include "monitor.hpp"
+#include "parameters.hpp"
+#include "field.hpp"
+
+// Test suite: FFTWWisdomTest
+
+// Test fixture
+class FFTWWisdomTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    this->wisdom_dir =
+      ::testing::TempDir() + "test_wisdom." + std::to_string(getpid()) + "/";
+    mkdir(this->wisdom_dir.c_str(), 0755);
+
+    fftw_forget_wisdom();
+    fftwf_forget_wisdom();
+    trv::sys::fftw_wisdom_file.clear();
+    trv::sys::fftwf_wisdom_file.clear();
+  }
+
+  void TearDown() override {
+    std::system(("rm -rf " + this->wisdom_dir).c_str());
+  }
+
+  // Set up parameters for the wisdom cache in the same way as
+  // the `trvwisdom` utility.
+  trv::ParameterSet set_params(int nx, int ny, int nz) {
+    trv::ParameterSet params;
+    params.fftw_scheme = "measure";
+    params.fftw_planner_flag = FFTW_MEASURE;
+    params.use_fftw_wisdom = this->wisdom_dir;
+    params.ngrid[0] = nx;
+    params.ngrid[1] = ny;
+    params.ngrid[2] = nz;
+    params.nmesh = static_cast<long long>(nx) * ny * nz;
+    return params;
+  }
+
+  // Plan mesh field transforms as in measurements.
+  void plan_transforms(trv::ParameterSet& params) {
+    trv::MeshFieldPool pool(params);
+    for (bool r2c : {false, true}) {
+      fftw_plan transform, inv_transform;
+      pool.ret_plans(r2c, transform, inv_transform);
+    }
+  }
+
+  // Return whether the forward complex-to-complex transform of a mesh
+  // grid can be planned from the wisdom of a wisdom file alone.
+  bool is_planned_from_wisdom(
+    const std::string& wisdom_filepath, int nx, int ny, int nz
+  ) {
+    fftw_forget_wisdom();
+    trv::sys::fftw_wisdom_file.clear();
+    if (!fftw_import_wisdom_from_filename(wisdom_filepath.c_str())) {
+      return false;
+    }
+
+    fftw_complex* buffer =
+      fftw_alloc_complex(static_cast<long long>(nx) * ny * nz);
+    fftw_plan transform = fftw_plan_dft_3d(
+      nx, ny, nz, buffer, buffer,
+      FFTW_FORWARD, FFTW_MEASURE | FFTW_WISDOM_ONLY
+    );
+    bool planned = (transform != nullptr);
+    if (planned) {fftw_destroy_plan(transform);}
+    fftw_free(buffer);
+
+    return planned;
+  }
+
+  // Test data members
+  std::string wisdom_dir;
+};
+
+// Test method: test_filepath_keying
+TEST_F(FFTWWisdomTest, test_filepath_keying) {
+  // Wisdom files are distinct for each precision, transform direction,
+  // mesh grid and planner scheme.
+  std::set<std::string> wisdom_filepaths;
+  int ngrids[3][3] = {{8, 8, 8}, {8, 8, 16}, {16, 8, 8}};
+  for (std::string scheme : {"measure", "patient"}) {
+    for (auto& ngrid : ngrids) {
+      trv::ParameterSet params = this->set_params(
+        ngrid[0], ngrid[1], ngrid[2]
+      );
+      params.fftw_scheme = scheme;
+      for (int sign : {FFTW_FORWARD, FFTW_BACKWARD}) {
+        for (bool single : {false, true}) {
+          std::string wisdom_filepath =
+            params.ret_fftw_wisdom_filepath(sign, single);
+          EXPECT_EQ(wisdom_filepath.rfind(this->wisdom_dir, 0), 0u);
+          EXPECT_NE(
+            wisdom_filepath.find("_" + scheme + "_"), std::string::npos
+          );
+          wisdom_filepaths.insert(wisdom_filepath);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(wisdom_filepaths.size(), 2u * 3u * 2u * 2u);
+
+  // No wisdom files are used if the cache is disabled.
+  trv::ParameterSet params = this->set_params(8, 8, 8);
+  params.use_fftw_wisdom = "";
+  EXPECT_EQ(params.ret_fftw_wisdom_filepath(FFTW_FORWARD), "");
+
+  // The default cache directory is overridden by the environment.
+  setenv("TRV_FFTW_WISDOM_DIR", this->wisdom_dir.c_str(), 1);
+  EXPECT_EQ(
+    trv::ParameterSet::ret_fftw_wisdom_dir_default().rfind(
+      this->wisdom_dir, 0
+    ),
+    0
+  );
+  unsetenv("TRV_FFTW_WISDOM_DIR");
+}
+
+// Test method: test_files_hold_own_key
+TEST_F(FFTWWisdomTest, test_files_hold_own_key) {
+  // Plan transforms for two mesh grids in turn in the same process.
+  trv::ParameterSet params_a = this->set_params(8, 8, 8);
+  trv::ParameterSet params_b = this->set_params(8, 8, 16);
+  this->plan_transforms(params_a);
+  this->plan_transforms(params_b);
+
+  std::string wisdom_filepath_a =
+    params_a.ret_fftw_wisdom_filepath(FFTW_FORWARD);
+  std::string wisdom_filepath_b =
+    params_b.ret_fftw_wisdom_filepath(FFTW_FORWARD);
+
+  // Each wisdom file only holds wisdom for its own mesh grid.
+  EXPECT_TRUE(this->is_planned_from_wisdom(wisdom_filepath_a, 8, 8, 8));
+  EXPECT_FALSE(this->is_planned_from_wisdom(wisdom_filepath_a, 8, 8, 16));
+  EXPECT_TRUE(this->is_planned_from_wisdom(wisdom_filepath_b, 8, 8, 16));
+  EXPECT_FALSE(this->is_planned_from_wisdom(wisdom_filepath_b, 8, 8, 8));
+
+  // Wisdom is reused from the cache for a mesh grid planned before.
+  fftw_forget_wisdom();
+  trv::sys::fftw_wisdom_file.clear();
+  EXPECT_TRUE(trv::import_fftw_wisdom(params_a, FFTW_FORWARD));
+  EXPECT_EQ(trv::sys::fftw_wisdom_file, wisdom_filepath_a);
+}
+
+// Test method: test_interlaced_fields_plan_from_wisdom
+TEST_F(FFTWWisdomTest, test_interlaced_fields_plan_from_wisdom) {
+  // Plan interlaced mesh field transforms (as in periodic-box
+  // measurements), which exports wisdom to the cache.
+  trv::ParameterSet params = this->set_params(8, 8, 8);
+  params.interlace = "true";
+  for (bool r2c : {false, true}) {
+    trv::MeshField field(params, true, "`field`", r2c);
+  }
+
+  // In a later run, all transforms including those of the shadow fields
+  // are planned from the cached wisdom alone, i.e. no plan is null.
+  params.fftw_planner_flag = FFTW_MEASURE | FFTW_WISDOM_ONLY;
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  EXPECT_EXIT(
+    {
+      fftw_forget_wisdom();
+      trv::sys::fftw_wisdom_file.clear();
+      for (bool r2c : {false, true}) {
+        trv::MeshField field(params, true, "`field`", r2c);
+        field.reset_density_field();
+        field.fourier_transform();
+      }
+      std::exit(0);
+    },
+    ::testing::ExitedWithCode(0), ""
+  );
+}
+
+// Test method: test_trvwisdom
+TEST_F(FFTWWisdomTest, test_trvwisdom) {
+  // The utility executable is next to the program executable provided
+  // by the test runner.
+  const char* progexe = std::getenv("TRV_PROGEXE");
+  std::string utilexe = (progexe == nullptr) ? "" : progexe;
+  utilexe = utilexe.substr(0, utilexe.find_last_of('/') + 1) + "trvwisdom";
+  if (progexe == nullptr || access(utilexe.c_str(), X_OK) != 0) {
+    GTEST_SKIP() << "Utility executable unavailable (set TRV_PROGEXE).";
+  }
+
+  auto run_utility = [&utilexe](std::vector<std::string> args) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      int fd_null = open("/dev/null", O_WRONLY);
+      dup2(fd_null, STDOUT_FILENO);
+      dup2(fd_null, STDERR_FILENO);
+      std::vector<char*> argv = {const_cast<char*>(utilexe.c_str())};
+      for (std::string& arg : args) {argv.push_back(arg.data());}
+      argv.push_back(nullptr);
+      execv(utilexe.c_str(), argv.data());
+      _exit(127);
+    }
+    int status = -1;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid) {return -1;}
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  };
+
+  std::string wisdom_dir_ = this->wisdom_dir.substr(
+    0, this->wisdom_dir.size() - 1
+  );
+  ASSERT_EQ(run_utility({"8,8x8x16", "--wisdom-dir", wisdom_dir_}), 0);
+  ASSERT_EQ(
+    run_utility({"8", "--wisdom-dir", wisdom_dir_, "--float32"}), 0
+  );
+
+  // Wisdom files are generated under the same keys as in measurements.
+  trv::ParameterSet params_a = this->set_params(8, 8, 8);
+  trv::ParameterSet params_b = this->set_params(8, 8, 16);
+  for (trv::ParameterSet* params : {&params_a, &params_b}) {
+    for (int sign : {FFTW_FORWARD, FFTW_BACKWARD}) {
+      EXPECT_EQ(
+        access(params->ret_fftw_wisdom_filepath(sign).c_str(), F_OK), 0
+      );
+    }
+  }
+  std::string wisdom_filepath_sp =
+    params_a.ret_fftw_wisdom_filepath(FFTW_FORWARD, true);
+  EXPECT_EQ(access(wisdom_filepath_sp.c_str(), F_OK), 0);
+  EXPECT_TRUE(this->is_planned_from_wisdom(
+    params_a.ret_fftw_wisdom_filepath(FFTW_FORWARD), 8, 8, 8
+  ));
+
+  // Batched transforms of interlaced mesh field batches are planned
+  // from the generated wisdom alone, i.e. no plan is null.
+  ASSERT_EQ(
+    run_utility({"8", "--wisdom-dir", wisdom_dir_, "--fft-batch", "2"}), 0
+  );
+  fftw_forget_wisdom();
+  trv::sys::fftw_wisdom_file.clear();
+  params_a.fftw_planner_flag = FFTW_MEASURE | FFTW_WISDOM_ONLY;
+  {
+    trv::MeshFieldPool pool(params_a);
+    for (bool r2c : {false, true}) {
+      for (int nbatch = 1; nbatch <= 4; nbatch++) {
+        EXPECT_NE(pool.ret_batch_plan(r2c, nbatch), nullptr)
+          << "r2c = " << r2c << ", nbatch = " << nbatch;
+      }
+    }
+  }
+
+  // Invalid arguments are rejected.
+  EXPECT_EQ(run_utility({}), 1);
+  EXPECT_EQ(
+    run_utility({"8", "--wisdom-dir", wisdom_dir_, "--scheme", "estimate"}),
+    1
+  );
+  EXPECT_EQ(run_utility({"8x8", "--wisdom-dir", wisdom_dir_}), 1);
+  EXPECT_EQ(
+    run_utility({"8", "--wisdom-dir", wisdom_dir_, "--fft-batch", "0"}), 1
+  );
+}
+
+// Test run: all
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}